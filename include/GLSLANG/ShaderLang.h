@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 263
+#define ANGLE_SH_VERSION 265
 
 enum ShShaderSpec
 {
@@ -341,6 +341,14 @@ const ShCompileOptions SH_INIT_FRAGMENT_OUTPUT_VARIABLES = UINT64_C(1) << 57;
 // non-assert-enabled builds to avoid increasing ANGLE's binary size while both generators coexist.
 const ShCompileOptions SH_GENERATE_SPIRV_DIRECTLY = UINT64_C(1) << 58;
 
+// Allow the transformations that only look at one function at a time to process the functions of
+// large shaders in several threads.  The result is the same as without the flag.
+const ShCompileOptions SH_PARALLELIZE_FUNCTION_PASSES = UINT64_C(1) << 59;
+
+// Record the time, AST size and pool memory of each phase of the compilation.  Can be queried by
+// calling sh::GetPassMetrics().
+const ShCompileOptions SH_RECORD_PASS_METRICS = UINT64_C(1) << 60;
+
 // The 64 bits hash function. The first parameter is the input string; the
 // second parameter is the string length.
 using ShHashFunction64 = khronos_uint64_t (*)(const char *, size_t);
@@ -598,6 +606,23 @@ namespace sh
 {
 using BinaryBlob = std::vector<uint32_t>;
 
+// Metrics of a phase of the compilation, recorded with SH_RECORD_PASS_METRICS.
+struct PassMetrics
+{
+    // A static string naming the phase.
+    const char *name;
+    // In seconds, on the clock of angle::GetCurrentTime().  The time spent counting the AST nodes
+    // is left out.
+    double startTime;
+    double wallTime;
+    // Number of nodes in the AST at the end of the phase.
+    size_t astNodeCount;
+    // Bytes requested from the pool allocator during the phase, and the highest number of bytes
+    // the pool held at once during the phase.
+    size_t poolBytesAllocated;
+    size_t poolPeakBytesInUse;
+};
+
 //
 // Driver must call this first, once, before doing any other compiler operations.
 // If the function succeeds, the return value is true, else false.
@@ -695,6 +720,12 @@ const std::string &GetObjectCode(const ShHandle handle);
 // handle: Specifies the compiler
 const BinaryBlob &GetObjectBinaryBlob(const ShHandle handle);
 
+// Returns the metrics of the phases of the last compilation, in order.  Empty unless the shader
+// was compiled with SH_RECORD_PASS_METRICS.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<PassMetrics> &GetPassMetrics(const ShHandle handle);
+
 // Returns a (original_name, hash) map containing all the user defined names in the shader,
 // including variable names, function names, struct names, and struct field names.
 // Parameters:
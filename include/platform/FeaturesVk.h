@@ -233,6 +233,12 @@ struct FeaturesVk : FeatureSetBase
                                  "VkDevice supports the VK_KHR_multiview extension", &members,
                                  "http://anglebug.com/6048"};
 
+    // Whether the VkDevice supports the VK_EXT_memory_budget extension, which reports how much
+    // memory of each heap the process can use.
+    Feature supportsMemoryBudget = {"supportsMemoryBudget", FeatureCategory::VulkanFeatures,
+                                    "VkDevice supports the VK_EXT_memory_budget extension",
+                                    &members};
+
     // VK_PRESENT_MODE_FIFO_KHR causes random timeouts on Linux Intel. http://anglebug.com/3153
     Feature disableFifoPresentMode = {"disableFifoPresentMode", FeatureCategory::VulkanWorkarounds,
                                       "VK_PRESENT_MODE_FIFO_KHR causes random timeouts", &members,
@@ -553,6 +559,74 @@ struct FeaturesVk : FeatureSetBase
         "Return a default descriptor count for external formats.", &members,
         "http://anglebug.com/6141"};
 
+    // Create graphics pipelines in a thread pool when they miss the cache.  The draw that needs
+    // the pipeline is recorded right away, and the pipeline is only waited for when the render
+    // pass is flushed.
+    Feature asyncGraphicsPipelineCreation = {
+        "asyncGraphicsPipelineCreation", FeatureCategory::VulkanFeatures,
+        "Create graphics pipelines in a thread pool and wait for them when the render pass is "
+        "flushed",
+        &members};
+
+    // Record the graphics pipelines each program needs in the blob cache, and when the same program
+    // is loaded from the program cache later, for example in the next run of the application,
+    // create them in a thread pool right away instead of at the first draw that needs them.
+    Feature warmUpGraphicsPipelines = {
+        "warmUpGraphicsPipelines", FeatureCategory::VulkanFeatures,
+        "Record the graphics pipelines of each program and create them in a thread pool when the "
+        "program is loaded from the program cache",
+        &members};
+
+    // When a large render pass or a large batch of commands outside render passes is flushed,
+    // split its commands in chunks that are recorded into secondary command buffers in a thread
+    // pool, instead of replaying them all into the primary command buffer on one thread.
+    Feature parallelCommandBufferRecording = {
+        "parallelCommandBufferRecording", FeatureCategory::VulkanFeatures,
+        "Record large render passes in secondary command buffers in a thread pool when they are "
+        "flushed",
+        &members};
+
+    // When the format of a pixel pack or unpack buffer differs from the format of the image,
+    // convert the pixels with a compute shader instead of mapping the buffer and converting them
+    // on the CPU.  Keeps ReadPixels and TexSubImage with such buffers entirely on the GPU.
+    Feature convertPixelsWithCompute = {
+        "convertPixelsWithCompute", FeatureCategory::VulkanFeatures,
+        "Convert the pixels of pixel pack and unpack buffers with a compute shader when their "
+        "format differs from the image",
+        &members};
+
+    // When ReadPixels into a pixel pack buffer needs to be packed on the CPU, copy the pixels to
+    // one of a small ring of readback buffers and pack them only when the pack buffer is next
+    // accessed, instead of waiting for the GPU in ReadPixels.  Lets applications keep several
+    // readbacks in flight with a ring of pixel pack buffers.
+    Feature deferReadPixelsPacking = {
+        "deferReadPixelsPacking", FeatureCategory::VulkanFeatures,
+        "Pack the result of ReadPixels into a pixel pack buffer only when the buffer is next "
+        "accessed",
+        &members};
+
+    // Suballocate small buffers from large VkBuffers shared by all buffers of the renderer,
+    // instead of creating a VkBuffer for each of them.  Saves memory and driver objects for
+    // applications that create many small vertex, index or uniform buffers.
+    Feature suballocateSmallBuffers = {
+        "suballocateSmallBuffers", FeatureCategory::VulkanFeatures,
+        "Suballocate small buffers from large buffers shared between them", &members};
+
+    // When the device-local heaps are over budget, copy the contents of textures that have not
+    // been used for a while to host-visible staging buffers and free their images.  The images are
+    // recreated from the staged copies the next time the textures are used.
+    Feature evictTexturesOverMemoryBudget = {
+        "evictTexturesOverMemoryBudget", FeatureCategory::VulkanFeatures,
+        "Evict idle textures to host memory when device memory is over budget", &members};
+
+    // When ETC2/EAC formats aren't supported, transcode their blocks to the BC format with the
+    // same block size instead of decoding them to uncompressed images.  Uses a quarter to an
+    // eighth of the memory, but the transcode is lossy.
+    Feature transcodeETCToBC = {"transcodeETCToBC", FeatureCategory::VulkanFeatures,
+                                "Transcode ETC2/EAC textures to BC formats when they are not "
+                                "supported, instead of decoding them",
+                                &members};
+
     // Whether the VkDevice can support Protected Memory.
     Feature supportsProtectedMemory = {"supports_protected_memory", FeatureCategory::VulkanFeatures,
                                        "VkDevice supports protected memory", &members,
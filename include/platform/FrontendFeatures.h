@@ -77,6 +77,19 @@ struct FrontendFeatures : angle::FeatureSetBase
         "enableCompressingPipelineCacheInThreadPool", angle::FeatureCategory::FrontendWorkarounds,
         "Enable compressing pipeline cache in thread pool.", &members, "http://anglebug.com/4722"};
 
+    // Run the whole program link on the worker thread pool when parallel shader compile is
+    // enabled.  The link is only joined when the program's link status is needed.
+    angle::Feature asyncLinkProgram = {
+        "asyncLinkProgram", angle::FeatureCategory::FrontendFeatures,
+        "Link programs in the worker thread pool when parallel shader compile is enabled",
+        &members};
+
+    // Skip the translation of shaders that were compiled before with the same source, options and
+    // resources, by storing the results of compiles in the blob cache.
+    angle::Feature cacheCompiledShader = {"cacheCompiledShader",
+                                          angle::FeatureCategory::FrontendFeatures,
+                                          "Enable to cache compiled shaders", &members};
+
     angle::Feature forceRobustResourceInit = {
         "forceRobustResourceInit", angle::FeatureCategory::FrontendWorkarounds,
         "Force-enable robust resource init", &members, "http://anglebug.com/6041"};
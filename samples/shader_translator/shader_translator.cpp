@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <sstream>
 #include <vector>
 #include "angle_gl.h"
@@ -37,6 +38,7 @@ static bool CompileFile(char *fileName, ShHandle compiler, ShCompileOptions comp
 static void LogMsg(const char *msg, const char *name, const int num, const char *logName);
 static void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVariable &var);
 static void PrintActiveVariables(ShHandle compiler);
+static void PrintPassMetrics(ShHandle compiler);
 
 // If NUM_SOURCE_STRINGS is set to a value > 1, the input file data is
 // broken into that many chunks. This will affect file/line numbering in
@@ -113,6 +115,9 @@ int main(int argc, char *argv[])
                 case 'u':
                     compileOptions |= SH_VARIABLES;
                     break;
+                case 'm':
+                    compileOptions |= SH_RECORD_PASS_METRICS;
+                    break;
                 case 'p':
                     resources.WEBGL_debug_shader_precision = 1;
                     break;
@@ -362,6 +367,13 @@ int main(int argc, char *argv[])
                     LogMsg("END", "COMPILER", numCompiles, "VARIABLES");
                     printf("\n\n");
                 }
+                if (compiled && (compileOptions & SH_RECORD_PASS_METRICS))
+                {
+                    LogMsg("BEGIN", "COMPILER", numCompiles, "PASS METRICS");
+                    PrintPassMetrics(compiler);
+                    LogMsg("END", "COMPILER", numCompiles, "PASS METRICS");
+                    printf("\n\n");
+                }
                 if (!compiled)
                     failCode = EFailCompile;
                 ++numCompiles;
@@ -403,11 +415,12 @@ void usage()
 {
     // clang-format off
     printf(
-        "Usage: translate [-i -o -u -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "Usage: translate [-i -o -u -m -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
         "Where: filename : filename ending in .frag or .vert\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
         "       -u       : print active attribs, uniforms, varyings and program outputs\n"
+        "       -m       : print the time, AST size and pool memory of each compilation phase\n"
         "       -p       : use precision emulation\n"
         "       -s=e2    : use GLES2 spec (this is by default)\n"
         "       -s=e3    : use GLES3 spec\n"
@@ -758,6 +771,28 @@ static void PrintActiveVariables(ShHandle compiler)
     }
 }
 
+static void PrintPassMetrics(ShHandle compiler)
+{
+    const std::vector<sh::PassMetrics> &passMetrics = sh::GetPassMetrics(compiler);
+
+    double totalTime      = 0;
+    size_t totalBytes     = 0;
+    size_t peakBytesInUse = 0;
+
+    printf("%-22s %10s %10s %14s %14s\n", "pass", "time (ms)", "AST nodes", "pool allocated",
+           "pool peak");
+    for (const sh::PassMetrics &metrics : passMetrics)
+    {
+        printf("%-22s %10.3f %10zu %14zu %14zu\n", metrics.name, metrics.wallTime * 1000.0,
+               metrics.astNodeCount, metrics.poolBytesAllocated, metrics.poolPeakBytesInUse);
+        totalTime += metrics.wallTime;
+        totalBytes += metrics.poolBytesAllocated;
+        peakBytesInUse = std::max(peakBytesInUse, metrics.poolPeakBytesInUse);
+    }
+    printf("%-22s %10.3f %10s %14zu %14zu\n", "total", totalTime * 1000.0, "", totalBytes,
+           peakBytesInUse);
+}
+
 static bool ReadShaderSource(const char *fileName, ShaderSource &source)
 {
     FILE *in = fopen(fileName, "rb");
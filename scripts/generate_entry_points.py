@@ -176,7 +176,7 @@ void GL_APIENTRY GL_{name}({params})
 
     if ({valid_context_check})
     {{{packed_gl_enum_conversions}
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        {context_lock}
         bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
         if (isCallValid)
         {{
@@ -200,7 +200,7 @@ TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN = """\
     {return_type} returnValue;
     if ({valid_context_check})
     {{{packed_gl_enum_conversions}
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        {context_lock}
         bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
         if (isCallValid)
         {{
@@ -1429,6 +1429,15 @@ def get_context_getter_function(cmd_name):
     return "GetValidGlobalContext()"
 
 
+def get_context_lock(params):
+    # Calls that make an object an EGL image sibling also take the global mutex, as the image may
+    # be shared with other share groups.  See GetContextLock().
+    if any(just_the_type(param) == "GLeglImageOES" for param in params):
+        return "ANGLE_SCOPED_GLOBAL_LOCK();"
+
+    return "std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);"
+
+
 def get_valid_context_check(cmd_name):
     return "context"
 
@@ -1549,6 +1558,8 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, cmd_packe
             ", ".join(format_params),
         "context_getter":
             get_context_getter_function(cmd_name),
+        "context_lock":
+            get_context_lock(params),
         "valid_context_check":
             get_valid_context_check(cmd_name),
         "constext_lost_error_generator":
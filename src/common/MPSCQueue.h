@@ -0,0 +1,157 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MPSCQueue.h:
+//   A bounded, lock-free, multi-producer single-consumer FIFO queue.  Any number of threads may
+//   push concurrently, but only one thread may pop.  Pushing never blocks; it fails when the queue
+//   is full, and it's up to the caller to decide how to wait for space.
+//
+//   Each slot of the ring carries a sequence number that tells whether it's free for the producer
+//   that claimed it, or holds a value that's ready for the consumer.  Producers claim slots with a
+//   single compare-and-swap on the enqueue position, so values come out in the order their slots
+//   were claimed.
+
+#ifndef COMMON_MPSCQUEUE_H_
+#define COMMON_MPSCQUEUE_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "common/angleutils.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+template <typename T, size_t N>
+class MPSCQueue final : angle::NonCopyable
+{
+  public:
+    // With a single slot, a slot that's ready for the consumer would look free for the next lap.
+    static_assert(N > 1 && gl::isPow2(N), "MPSCQueue capacity must be a power of two above 1");
+    static_assert(std::is_default_constructible<T>::value, "T must be default constructible");
+
+    MPSCQueue();
+    ~MPSCQueue();
+
+    // Thread-safe.  On success, |value| is moved into the queue.  On failure, i.e. when the queue
+    // is full, |value| is left untouched.
+    bool tryPush(T &&value);
+
+    // Must only be called by the consumer thread.  Returns false if the queue is empty, or if the
+    // value at the front is still being written by its producer.
+    bool tryPop(T *valueOut);
+
+    // Thread-safe, but the result is only a snapshot.  A slot that's claimed by a producer counts
+    // as used even before its value is written, so the consumer may see a non-empty queue and
+    // still fail to pop for a short while.
+    bool empty() const;
+    size_t size() const;
+
+    static constexpr size_t capacity() { return N; }
+
+  private:
+    static constexpr size_t kIndexMask     = N - 1;
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    // The positions are written by different threads, so keep them off each other's cache line.
+    alignas(kCacheLineSize) std::atomic<size_t> mEnqueuePosition;
+    alignas(kCacheLineSize) std::atomic<size_t> mDequeuePosition;
+    alignas(kCacheLineSize) std::array<Slot, N> mSlots;
+};
+
+template <typename T, size_t N>
+MPSCQueue<T, N>::MPSCQueue() : mEnqueuePosition(0), mDequeuePosition(0)
+{
+    for (size_t index = 0; index < N; ++index)
+    {
+        mSlots[index].sequence.store(index, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t N>
+MPSCQueue<T, N>::~MPSCQueue() = default;
+
+template <typename T, size_t N>
+bool MPSCQueue<T, N>::tryPush(T &&value)
+{
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+    Slot *slot      = nullptr;
+
+    while (true)
+    {
+        slot                  = &mSlots[position & kIndexMask];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const ptrdiff_t diff  = static_cast<ptrdiff_t>(sequence - position);
+
+        if (diff == 0)
+        {
+            // The slot is free.  Claim it, unless another producer got there first.
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1,
+                                                       std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The consumer hasn't freed the slot from the previous lap yet.
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the slot.
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->value = std::move(value);
+    // Hand the slot over to the consumer.
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t N>
+bool MPSCQueue<T, N>::tryPop(T *valueOut)
+{
+    const size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+    Slot &slot            = mSlots[position & kIndexMask];
+
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        return false;
+    }
+
+    *valueOut = std::move(slot.value);
+    // Hand the slot back to the producers, for the next lap.
+    slot.sequence.store(position + N, std::memory_order_release);
+    mDequeuePosition.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t N>
+bool MPSCQueue<T, N>::empty() const
+{
+    return size() == 0;
+}
+
+template <typename T, size_t N>
+size_t MPSCQueue<T, N>::size() const
+{
+    // Load the dequeue position first, so the difference can't go negative.
+    const size_t dequeuePosition = mDequeuePosition.load(std::memory_order_acquire);
+    const size_t enqueuePosition = mEnqueuePosition.load(std::memory_order_acquire);
+    return enqueuePosition - dequeuePosition;
+}
+}  // namespace angle
+
+#endif  // COMMON_MPSCQUEUE_H_
@@ -0,0 +1,149 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MPSCQueue_unittest:
+//   Tests of the MPSCQueue class
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common/MPSCQueue.h"
+
+namespace angle
+{
+// Make sure values come out in the order they were pushed, and that a full queue rejects pushes.
+TEST(MPSCQueue, PushPop)
+{
+    MPSCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.empty());
+
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(&value));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.tryPush(std::move(i)));
+    }
+    EXPECT_EQ(4u, queue.size());
+    EXPECT_FALSE(queue.tryPush(4));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.tryPop(&value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop(&value));
+}
+
+// Make sure the slots are reused correctly once the positions wrap around the ring.
+TEST(MPSCQueue, WrapAround)
+{
+    MPSCQueue<int, 4> queue;
+
+    int value = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(queue.tryPush(std::move(i)));
+        if (i % 3 == 0)
+        {
+            int j = -i;
+            EXPECT_TRUE(queue.tryPush(std::move(j)));
+            EXPECT_TRUE(queue.tryPop(&value));
+            EXPECT_EQ(i, value);
+            EXPECT_TRUE(queue.tryPop(&value));
+            EXPECT_EQ(-i, value);
+        }
+        else
+        {
+            EXPECT_TRUE(queue.tryPop(&value));
+            EXPECT_EQ(i, value);
+        }
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// Make sure a failed push leaves the value alone.
+TEST(MPSCQueue, FailedPushKeepsValue)
+{
+    MPSCQueue<std::unique_ptr<int>, 2> queue;
+
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(2)));
+
+    std::unique_ptr<int> third = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.tryPush(std::move(third)));
+    ASSERT_NE(nullptr, third);
+    EXPECT_EQ(3, *third);
+
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(queue.tryPop(&value));
+    EXPECT_EQ(1, *value);
+    EXPECT_TRUE(queue.tryPush(std::move(third)));
+    EXPECT_TRUE(queue.tryPop(&value));
+    EXPECT_EQ(2, *value);
+    EXPECT_TRUE(queue.tryPop(&value));
+    EXPECT_EQ(3, *value);
+}
+
+// Push from several threads at once while one thread pops, and make sure every value comes out
+// exactly once, and that the values of each producer come out in order.
+TEST(MPSCQueue, ConcurrentProducers)
+{
+    constexpr uint32_t kProducerCount     = 4;
+    constexpr uint32_t kValuesPerProducer = 20000;
+
+    // Small enough to be full every now and then.
+    MPSCQueue<uint32_t, 64> queue;
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < kProducerCount; ++producer)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (uint32_t index = 0; index < kValuesPerProducer; ++index)
+            {
+                uint32_t value = producer * kValuesPerProducer + index;
+                while (!queue.tryPush(std::move(value)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint32_t> nextIndex(kProducerCount, 0);
+    uint32_t popCount = 0;
+    while (popCount < kProducerCount * kValuesPerProducer)
+    {
+        uint32_t value = 0;
+        if (!queue.tryPop(&value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const uint32_t producer = value / kValuesPerProducer;
+        ASSERT_LT(producer, kProducerCount);
+        EXPECT_EQ(nextIndex[producer], value % kValuesPerProducer);
+        nextIndex[producer] = value % kValuesPerProducer + 1;
+        popCount++;
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(queue.empty());
+    for (uint32_t producer = 0; producer < kProducerCount; ++producer)
+    {
+        EXPECT_EQ(kValuesPerProducer, nextIndex[producer]);
+    }
+}
+}  // namespace angle
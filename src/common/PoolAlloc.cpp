@@ -9,6 +9,7 @@
 
 #include "common/PoolAlloc.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -33,8 +34,11 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mFreeList(0),
       mInUseList(0),
       mNumCalls(0),
-      mTotalBytes(0),
 #endif
+      mTotalBytes(0),
+      mBytesInUse(0),
+      mPeakBytesInUse(0),
+      mRecordStatistics(false),
       mLocked(false)
 {
     initialize(growthIncrement, allocationAlignment);
@@ -147,6 +151,8 @@ void Allocation::checkGuardBlock(unsigned char *blockMem,
 
 void PoolAllocator::push()
 {
+    mPushedBytesInUse.push_back(mBytesInUse);
+
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
     AllocState state = {mCurrentPageOffset, mInUseList};
 
@@ -173,6 +179,17 @@ void PoolAllocator::pop()
     if (mStack.size() < 1)
         return;
 
+    // With ANGLE_DISABLE_POOL_ALLOC, the stack starts with a level that wasn't pushed.
+    if (!mPushedBytesInUse.empty())
+    {
+        mBytesInUse = mPushedBytesInUse.back();
+        mPushedBytesInUse.pop_back();
+    }
+    else
+    {
+        mBytesInUse = 0;
+    }
+
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
     Header *page       = mStack.back().page;
     mCurrentPageOffset = mStack.back().offset;
@@ -217,12 +234,18 @@ void *PoolAllocator::allocate(size_t numBytes)
 {
     ASSERT(!mLocked);
 
+    if (mRecordStatistics)
+    {
+        mTotalBytes += numBytes;
+        mBytesInUse += numBytes;
+        mPeakBytesInUse = std::max(mPeakBytesInUse, mBytesInUse);
+    }
+
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
     //
     // Just keep some interesting statistics.
     //
     ++mNumCalls;
-    mTotalBytes += numBytes;
 
     // If we are using guard blocks, all allocations are bracketed by
     // them: [guardblock][allocation][guardblock].  numBytes is how
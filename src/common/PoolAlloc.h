@@ -202,6 +202,21 @@ class PoolAllocator : angle::NonCopyable
     void lock();
     void unlock();
 
+    //
+    // Statistics of the allocate() calls.  They are only recorded after
+    // setRecordStatistics(true), so other users don't pay for them.  fastAllocate() is never
+    // counted, to keep it fast.
+    //
+    void setRecordStatistics(bool record) { mRecordStatistics = record; }
+    // Total number of bytes requested since the allocator was created.
+    size_t getTotalBytesAllocated() const { return mTotalBytes; }
+    // Number of bytes requested and not yet freed by pop().
+    size_t getBytesInUse() const { return mBytesInUse; }
+    // The high-water mark of getBytesInUse(), since creation or since the last call to
+    // resetPeakBytesInUse().
+    size_t getPeakBytesInUse() const { return mPeakBytesInUse; }
+    void resetPeakBytesInUse() { mPeakBytesInUse = mBytesInUse; }
+
   private:
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
@@ -266,13 +281,19 @@ class PoolAllocator : angle::NonCopyable
     Header *mInUseList;         // list of all memory currently being used
     AllocStack mStack;          // stack of where to allocate from, to partition pool
 
-    int mNumCalls;       // just an interesting statistic
-    size_t mTotalBytes;  // just an interesting statistic
+    int mNumCalls;  // just an interesting statistic
 
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
 #endif
 
+    size_t mTotalBytes;
+    size_t mBytesInUse;
+    size_t mPeakBytesInUse;
+    // The value of mBytesInUse at each push(), restored by the matching pop().
+    std::vector<size_t> mPushedBytesInUse;
+    bool mRecordStatistics;
+
     bool mLocked;
 };
 
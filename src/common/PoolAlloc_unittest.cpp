@@ -50,6 +50,50 @@ TEST(PoolAllocatorTest, Interface)
     poolAllocator.popAll();
 }
 
+// Verify the allocation statistics, including the high-water mark, follow push() and pop().
+TEST(PoolAllocatorTest, Statistics)
+{
+    PoolAllocator poolAllocator;
+    poolAllocator.setRecordStatistics(true);
+    EXPECT_EQ(0u, poolAllocator.getTotalBytesAllocated());
+    EXPECT_EQ(0u, poolAllocator.getBytesInUse());
+    EXPECT_EQ(0u, poolAllocator.getPeakBytesInUse());
+
+    poolAllocator.push();
+    poolAllocator.allocate(100);
+    poolAllocator.push();
+    poolAllocator.allocate(200);
+    poolAllocator.allocate(10 * 1024);
+    EXPECT_EQ(100u + 200u + 10 * 1024u, poolAllocator.getBytesInUse());
+
+    // Popping frees the last two allocations, but keeps the high-water mark.
+    poolAllocator.pop();
+    EXPECT_EQ(100u, poolAllocator.getBytesInUse());
+    EXPECT_EQ(100u + 200u + 10 * 1024u, poolAllocator.getTotalBytesAllocated());
+    EXPECT_EQ(100u + 200u + 10 * 1024u, poolAllocator.getPeakBytesInUse());
+
+    poolAllocator.resetPeakBytesInUse();
+    EXPECT_EQ(100u, poolAllocator.getPeakBytesInUse());
+    poolAllocator.allocate(50);
+    EXPECT_EQ(150u, poolAllocator.getPeakBytesInUse());
+
+    poolAllocator.popAll();
+    EXPECT_EQ(0u, poolAllocator.getBytesInUse());
+    EXPECT_EQ(100u + 200u + 10 * 1024u + 50u, poolAllocator.getTotalBytesAllocated());
+}
+
+// Verify the allocation statistics are not recorded unless requested.
+TEST(PoolAllocatorTest, StatisticsNotRecordedByDefault)
+{
+    PoolAllocator poolAllocator;
+    poolAllocator.push();
+    poolAllocator.allocate(100);
+    EXPECT_EQ(0u, poolAllocator.getTotalBytesAllocated());
+    EXPECT_EQ(0u, poolAllocator.getBytesInUse());
+    EXPECT_EQ(0u, poolAllocator.getPeakBytesInUse());
+    poolAllocator.popAll();
+}
+
 #if !defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
 // Verify allocations are correctly aligned for different alignments
 class PoolAllocatorAlignmentTest : public testing::TestWithParam<int>
@@ -38,6 +38,23 @@ angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
     ASSERT(platform);
 
     double timestamp = platform->monotonicallyIncreasingTime(platform);
+    return AddTraceEventWithTimestamp(platform, phase, categoryGroupEnabled, name, id, timestamp,
+                                      numArgs, argNames, argTypes, argValues, flags);
+}
+
+angle::TraceEventHandle AddTraceEventWithTimestamp(PlatformMethods *platform,
+                                                   char phase,
+                                                   const unsigned char *categoryGroupEnabled,
+                                                   const char *name,
+                                                   unsigned long long id,
+                                                   double timestamp,
+                                                   int numArgs,
+                                                   const char **argNames,
+                                                   const unsigned char *argTypes,
+                                                   const unsigned long long *argValues,
+                                                   unsigned char flags)
+{
+    ASSERT(platform);
 
     if (timestamp != 0)
     {
@@ -21,6 +21,19 @@ angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
                                       const unsigned char *argTypes,
                                       const unsigned long long *argValues,
                                       unsigned char flags);
+// Adds an event that happened at |timestamp|, on the clock of the platform's
+// monotonicallyIncreasingTime, instead of now.
+angle::TraceEventHandle AddTraceEventWithTimestamp(PlatformMethods *platform,
+                                                   char phase,
+                                                   const unsigned char *categoryGroupEnabled,
+                                                   const char *name,
+                                                   unsigned long long id,
+                                                   double timestamp,
+                                                   int numArgs,
+                                                   const char **argNames,
+                                                   const unsigned char *argTypes,
+                                                   const unsigned long long *argValues,
+                                                   unsigned char flags);
 }  // namespace angle
 
 #endif  // COMMON_EVENT_TRACER_H_
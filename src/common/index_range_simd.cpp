@@ -0,0 +1,490 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// index_range_simd.cpp: Vectorized implementations of gl::ComputeIndexRange.
+//
+// Every kernel keeps a running minimum, a running maximum and a count of primitive restart
+// indices.  The restart index is always the largest value of the index type, so it never lowers
+// the minimum, and lanes holding it are replaced with zero before being folded into the maximum.
+// The indices that don't fill a whole vector are handled by a scalar loop.
+
+#include "common/index_range_simd.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/platform.h"
+
+#include <limits>
+
+#if defined(ANGLE_USE_SSE) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define ANGLE_INDEX_RANGE_SSE2 1
+#    define ANGLE_INDEX_RANGE_AVX2 1
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        define ANGLE_AVX2_TARGET
+#    else
+#        define ANGLE_AVX2_TARGET __attribute__((target("avx2")))
+#    endif
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_INDEX_RANGE_NEON 1
+#endif
+
+namespace gl
+{
+namespace priv
+{
+namespace
+{
+template <typename T>
+struct IndexScanResult
+{
+    T minIndex;
+    T maxIndex;
+    size_t restartCount;
+};
+
+template <typename T>
+void ScanRemainingIndices(const T *indices,
+                          size_t count,
+                          bool primitiveRestartEnabled,
+                          IndexScanResult<T> *result)
+{
+    constexpr T kRestartIndex = std::numeric_limits<T>::max();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        T index = indices[i];
+        if (primitiveRestartEnabled && index == kRestartIndex)
+        {
+            result->restartCount++;
+            continue;
+        }
+        result->minIndex = std::min(result->minIndex, index);
+        result->maxIndex = std::max(result->maxIndex, index);
+    }
+}
+
+template <typename T>
+IndexRange MakeIndexRange(const IndexScanResult<T> &result,
+                          size_t count,
+                          bool primitiveRestartEnabled)
+{
+    size_t vertexIndexCount = count - result.restartCount;
+    if (primitiveRestartEnabled && vertexIndexCount == 0)
+    {
+        // Matches the scalar implementation when every index is a primitive restart.
+        return IndexRange(0, 0, 0);
+    }
+    return IndexRange(static_cast<size_t>(result.minIndex), static_cast<size_t>(result.maxIndex),
+                      vertexIndexCount);
+}
+
+// Reduces a vector of lanes that was stored to memory.  Only done once per call.
+template <typename T, size_t kLanes>
+void ReduceLanes(const T (&minLanes)[kLanes],
+                 const T (&maxLanes)[kLanes],
+                 IndexScanResult<T> *result)
+{
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        result->minIndex = std::min(result->minIndex, minLanes[lane]);
+        result->maxIndex = std::max(result->maxIndex, maxLanes[lane]);
+    }
+}
+
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+// SSE2 only has unsigned min/max for 8-bit lanes.  Wider indices are flipped into the signed range
+// by toggling their top bit, which preserves their order, and flipped back after the reduction.
+uint32_t MoveMask(__m128i mask)
+{
+    // One bit per byte.
+    return static_cast<uint32_t>(_mm_movemask_epi8(mask));
+}
+
+template <typename T, size_t kLanes>
+void ReduceSSE2Lanes(__m128i minVec, __m128i maxVec, T bias, IndexScanResult<T> *result)
+{
+    alignas(16) T minLanes[kLanes];
+    alignas(16) T maxLanes[kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), minVec);
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), maxVec);
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        minLanes[lane] = static_cast<T>(minLanes[lane] ^ bias);
+        maxLanes[lane] = static_cast<T>(maxLanes[lane] ^ bias);
+    }
+    ReduceLanes(minLanes, maxLanes, result);
+}
+
+struct SSE2Uint8
+{
+    using Type                     = uint8_t;
+    using Vec                      = __m128i;
+    static constexpr size_t kLanes = 16;
+
+    static __m128i Load(const uint8_t *indices)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+    static __m128i Lowest() { return _mm_setzero_si128(); }
+    static __m128i Highest() { return _mm_set1_epi8(-1); }
+    static __m128i IsRestart(__m128i v) { return _mm_cmpeq_epi8(v, Highest()); }
+    static __m128i ClearLanes(__m128i mask, __m128i v) { return _mm_andnot_si128(mask, v); }
+    static size_t CountLanes(__m128i mask) { return BitCount(MoveMask(mask)); }
+    static void Reduce(__m128i minVec, __m128i maxVec, IndexScanResult<uint8_t> *result)
+    {
+        ReduceSSE2Lanes<uint8_t, 16>(minVec, maxVec, 0, result);
+    }
+};
+
+struct SSE2Uint16
+{
+    using Type                     = uint16_t;
+    using Vec                      = __m128i;
+    static constexpr size_t kLanes = 8;
+
+    static __m128i Bias() { return _mm_set1_epi16(static_cast<short>(0x8000)); }
+    static __m128i Load(const uint16_t *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)), Bias());
+    }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+    static __m128i Lowest() { return Bias(); }
+    static __m128i Highest() { return _mm_set1_epi16(0x7FFF); }
+    static __m128i IsRestart(__m128i v) { return _mm_cmpeq_epi16(v, Highest()); }
+    static __m128i ClearLanes(__m128i mask, __m128i v)
+    {
+        return _mm_or_si128(_mm_andnot_si128(mask, v), _mm_and_si128(mask, Lowest()));
+    }
+    static size_t CountLanes(__m128i mask) { return BitCount(MoveMask(mask)) / 2; }
+    static void Reduce(__m128i minVec, __m128i maxVec, IndexScanResult<uint16_t> *result)
+    {
+        ReduceSSE2Lanes<uint16_t, 8>(minVec, maxVec, 0x8000u, result);
+    }
+};
+
+struct SSE2Uint32
+{
+    using Type                     = uint32_t;
+    using Vec                      = __m128i;
+    static constexpr size_t kLanes = 4;
+
+    static __m128i Bias() { return _mm_set1_epi32(static_cast<int>(0x80000000u)); }
+    static __m128i Load(const uint32_t *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)), Bias());
+    }
+    static __m128i Select(__m128i mask, __m128i a, __m128i b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static __m128i Min(__m128i a, __m128i b) { return Select(_mm_cmpgt_epi32(a, b), b, a); }
+    static __m128i Max(__m128i a, __m128i b) { return Select(_mm_cmpgt_epi32(a, b), a, b); }
+    static __m128i Lowest() { return Bias(); }
+    static __m128i Highest() { return _mm_set1_epi32(0x7FFFFFFF); }
+    static __m128i IsRestart(__m128i v) { return _mm_cmpeq_epi32(v, Highest()); }
+    static __m128i ClearLanes(__m128i mask, __m128i v) { return Select(mask, Lowest(), v); }
+    static size_t CountLanes(__m128i mask) { return BitCount(MoveMask(mask)) / 4; }
+    static void Reduce(__m128i minVec, __m128i maxVec, IndexScanResult<uint32_t> *result)
+    {
+        ReduceSSE2Lanes<uint32_t, 4>(minVec, maxVec, 0x80000000u, result);
+    }
+};
+
+#endif  // defined(ANGLE_INDEX_RANGE_SSE2)
+
+#if defined(ANGLE_INDEX_RANGE_AVX2)
+// AVX2 has unsigned min/max for every lane width.  The intrinsics can only be inlined into
+// functions that are compiled for AVX2, so unlike the other kernels the traits and the loop carry
+// the target attribute, and the loop can't be shared with ComputeIndexRangeWithTraits.
+struct AVX2Uint8
+{
+    using Type                     = uint8_t;
+    static constexpr size_t kLanes = 32;
+
+    ANGLE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+    ANGLE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+    ANGLE_AVX2_TARGET static __m256i IsRestart(__m256i v)
+    {
+        return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(-1));
+    }
+};
+
+struct AVX2Uint16
+{
+    using Type                     = uint16_t;
+    static constexpr size_t kLanes = 16;
+
+    ANGLE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+    ANGLE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu16(a, b); }
+    ANGLE_AVX2_TARGET static __m256i IsRestart(__m256i v)
+    {
+        return _mm256_cmpeq_epi16(v, _mm256_set1_epi16(-1));
+    }
+};
+
+struct AVX2Uint32
+{
+    using Type                     = uint32_t;
+    static constexpr size_t kLanes = 8;
+
+    ANGLE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+    ANGLE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu32(a, b); }
+    ANGLE_AVX2_TARGET static __m256i IsRestart(__m256i v)
+    {
+        return _mm256_cmpeq_epi32(v, _mm256_set1_epi32(-1));
+    }
+};
+
+template <typename Traits>
+ANGLE_AVX2_TARGET IndexRange ComputeIndexRangeAVX2(const void *indicesIn,
+                                                   size_t count,
+                                                   bool primitiveRestartEnabled)
+{
+    using T                 = typename Traits::Type;
+    const T *indices        = static_cast<const T *>(indicesIn);
+    constexpr size_t kLanes = Traits::kLanes;
+
+    __m256i minVec      = _mm256_set1_epi8(-1);
+    __m256i maxVec      = _mm256_setzero_si256();
+    size_t restartCount = 0;
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+        minVec    = Traits::Min(minVec, v);
+        if (primitiveRestartEnabled)
+        {
+            __m256i isRestart = Traits::IsRestart(v);
+            maxVec            = Traits::Max(maxVec, _mm256_andnot_si256(isRestart, v));
+            restartCount += BitCount(static_cast<uint32_t>(_mm256_movemask_epi8(isRestart)));
+        }
+        else
+        {
+            maxVec = Traits::Max(maxVec, v);
+        }
+    }
+
+    alignas(32) T minLanes[kLanes];
+    alignas(32) T maxLanes[kLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(minLanes), minVec);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(maxLanes), maxVec);
+
+    // movemask produces one bit per byte.
+    IndexScanResult<T> result = {std::numeric_limits<T>::max(), 0, restartCount / sizeof(T)};
+    ReduceLanes(minLanes, maxLanes, &result);
+    ScanRemainingIndices(indices + i, count - i, primitiveRestartEnabled, &result);
+    return MakeIndexRange(result, count, primitiveRestartEnabled);
+}
+#endif  // defined(ANGLE_INDEX_RANGE_AVX2)
+
+#if defined(ANGLE_INDEX_RANGE_NEON)
+// The across-vector reductions (vminvq, vaddvq, ...) are only available on AArch64.
+struct NEONUint8
+{
+    using Type                     = uint8_t;
+    using Vec                      = uint8x16_t;
+    static constexpr size_t kLanes = 16;
+
+    static Vec Load(const uint8_t *indices) { return vld1q_u8(indices); }
+    static Vec Min(Vec a, Vec b) { return vminq_u8(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u8(a, b); }
+    static Vec Lowest() { return vdupq_n_u8(0); }
+    static Vec Highest() { return vdupq_n_u8(0xFF); }
+    static Vec IsRestart(Vec v) { return vceqq_u8(v, Highest()); }
+    static Vec ClearLanes(Vec mask, Vec v) { return vbicq_u8(v, mask); }
+    static size_t CountLanes(Vec mask) { return vaddvq_u8(vandq_u8(mask, vdupq_n_u8(1))); }
+    static void Reduce(Vec minVec, Vec maxVec, IndexScanResult<uint8_t> *result)
+    {
+        result->minIndex = vminvq_u8(minVec);
+        result->maxIndex = vmaxvq_u8(maxVec);
+    }
+};
+
+struct NEONUint16
+{
+    using Type                     = uint16_t;
+    using Vec                      = uint16x8_t;
+    static constexpr size_t kLanes = 8;
+
+    static Vec Load(const uint16_t *indices) { return vld1q_u16(indices); }
+    static Vec Min(Vec a, Vec b) { return vminq_u16(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u16(a, b); }
+    static Vec Lowest() { return vdupq_n_u16(0); }
+    static Vec Highest() { return vdupq_n_u16(0xFFFF); }
+    static Vec IsRestart(Vec v) { return vceqq_u16(v, Highest()); }
+    static Vec ClearLanes(Vec mask, Vec v) { return vbicq_u16(v, mask); }
+    static size_t CountLanes(Vec mask) { return vaddvq_u16(vandq_u16(mask, vdupq_n_u16(1))); }
+    static void Reduce(Vec minVec, Vec maxVec, IndexScanResult<uint16_t> *result)
+    {
+        result->minIndex = vminvq_u16(minVec);
+        result->maxIndex = vmaxvq_u16(maxVec);
+    }
+};
+
+struct NEONUint32
+{
+    using Type                     = uint32_t;
+    using Vec                      = uint32x4_t;
+    static constexpr size_t kLanes = 4;
+
+    static Vec Load(const uint32_t *indices) { return vld1q_u32(indices); }
+    static Vec Min(Vec a, Vec b) { return vminq_u32(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u32(a, b); }
+    static Vec Lowest() { return vdupq_n_u32(0); }
+    static Vec Highest() { return vdupq_n_u32(0xFFFFFFFF); }
+    static Vec IsRestart(Vec v) { return vceqq_u32(v, Highest()); }
+    static Vec ClearLanes(Vec mask, Vec v) { return vbicq_u32(v, mask); }
+    static size_t CountLanes(Vec mask) { return vaddvq_u32(vandq_u32(mask, vdupq_n_u32(1))); }
+    static void Reduce(Vec minVec, Vec maxVec, IndexScanResult<uint32_t> *result)
+    {
+        result->minIndex = vminvq_u32(minVec);
+        result->maxIndex = vmaxvq_u32(maxVec);
+    }
+};
+
+#endif  // defined(ANGLE_INDEX_RANGE_NEON)
+
+#if defined(ANGLE_INDEX_RANGE_SSE2) || defined(ANGLE_INDEX_RANGE_NEON)
+template <typename Traits>
+IndexRange ComputeIndexRangeWithTraits(const void *indicesIn,
+                                       size_t count,
+                                       bool primitiveRestartEnabled)
+{
+    using T                 = typename Traits::Type;
+    using Vec               = typename Traits::Vec;
+    constexpr size_t kLanes = Traits::kLanes;
+    const T *indices        = static_cast<const T *>(indicesIn);
+
+    Vec minVec          = Traits::Highest();
+    Vec maxVec          = Traits::Lowest();
+    size_t restartCount = 0;
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        Vec v  = Traits::Load(indices + i);
+        minVec = Traits::Min(minVec, v);
+        if (primitiveRestartEnabled)
+        {
+            Vec isRestart = Traits::IsRestart(v);
+            maxVec        = Traits::Max(maxVec, Traits::ClearLanes(isRestart, v));
+            restartCount += Traits::CountLanes(isRestart);
+        }
+        else
+        {
+            maxVec = Traits::Max(maxVec, v);
+        }
+    }
+
+    IndexScanResult<T> result = {std::numeric_limits<T>::max(), 0, restartCount};
+    Traits::Reduce(minVec, maxVec, &result);
+    ScanRemainingIndices(indices + i, count - i, primitiveRestartEnabled, &result);
+    return MakeIndexRange(result, count, primitiveRestartEnabled);
+}
+#endif  // defined(ANGLE_INDEX_RANGE_SSE2) || defined(ANGLE_INDEX_RANGE_NEON)
+}  // anonymous namespace
+
+bool IsVectorIndexRangeKernelSupported(IndexRangeKernel kernel)
+{
+    switch (kernel)
+    {
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+        case IndexRangeKernel::SSE2:
+            return true;
+#endif
+#if defined(ANGLE_INDEX_RANGE_AVX2)
+        case IndexRangeKernel::AVX2:
+            return supportsAVX2();
+#endif
+#if defined(ANGLE_INDEX_RANGE_NEON)
+        case IndexRangeKernel::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+IndexRange ComputeVectorIndexRange(IndexRangeKernel kernel,
+                                   DrawElementsType indexType,
+                                   const GLvoid *indices,
+                                   size_t count,
+                                   bool primitiveRestartEnabled)
+{
+    ASSERT(IsVectorIndexRangeKernelSupported(kernel));
+
+    switch (kernel)
+    {
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+        case IndexRangeKernel::SSE2:
+            switch (indexType)
+            {
+                case DrawElementsType::UnsignedByte:
+                    return ComputeIndexRangeWithTraits<SSE2Uint8>(indices, count,
+                                                                  primitiveRestartEnabled);
+                case DrawElementsType::UnsignedShort:
+                    return ComputeIndexRangeWithTraits<SSE2Uint16>(indices, count,
+                                                                   primitiveRestartEnabled);
+                case DrawElementsType::UnsignedInt:
+                    return ComputeIndexRangeWithTraits<SSE2Uint32>(indices, count,
+                                                                   primitiveRestartEnabled);
+                default:
+                    break;
+            }
+            break;
+#endif  // defined(ANGLE_INDEX_RANGE_SSE2)
+#if defined(ANGLE_INDEX_RANGE_AVX2)
+        case IndexRangeKernel::AVX2:
+            switch (indexType)
+            {
+                case DrawElementsType::UnsignedByte:
+                    return ComputeIndexRangeAVX2<AVX2Uint8>(indices, count,
+                                                            primitiveRestartEnabled);
+                case DrawElementsType::UnsignedShort:
+                    return ComputeIndexRangeAVX2<AVX2Uint16>(indices, count,
+                                                             primitiveRestartEnabled);
+                case DrawElementsType::UnsignedInt:
+                    return ComputeIndexRangeAVX2<AVX2Uint32>(indices, count,
+                                                             primitiveRestartEnabled);
+                default:
+                    break;
+            }
+            break;
+#endif  // defined(ANGLE_INDEX_RANGE_AVX2)
+#if defined(ANGLE_INDEX_RANGE_NEON)
+        case IndexRangeKernel::NEON:
+            switch (indexType)
+            {
+                case DrawElementsType::UnsignedByte:
+                    return ComputeIndexRangeWithTraits<NEONUint8>(indices, count,
+                                                                  primitiveRestartEnabled);
+                case DrawElementsType::UnsignedShort:
+                    return ComputeIndexRangeWithTraits<NEONUint16>(indices, count,
+                                                                   primitiveRestartEnabled);
+                case DrawElementsType::UnsignedInt:
+                    return ComputeIndexRangeWithTraits<NEONUint32>(indices, count,
+                                                                   primitiveRestartEnabled);
+                default:
+                    break;
+            }
+            break;
+#endif  // defined(ANGLE_INDEX_RANGE_NEON)
+        default:
+            break;
+    }
+
+    UNREACHABLE();
+    return IndexRange();
+}
+}  // namespace priv
+}  // namespace gl
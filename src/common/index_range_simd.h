@@ -0,0 +1,30 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// index_range_simd.h: Vectorized implementations of gl::ComputeIndexRange.  Only meant to be used
+// by ComputeIndexRangeWithKernel() in utilities.cpp.
+
+#ifndef COMMON_INDEX_RANGE_SIMD_H_
+#define COMMON_INDEX_RANGE_SIMD_H_
+
+#include "common/utilities.h"
+
+namespace gl
+{
+namespace priv
+{
+// Whether the CPU can run |kernel|, which must not be IndexRangeKernel::Scalar.
+bool IsVectorIndexRangeKernelSupported(IndexRangeKernel kernel);
+
+// Only valid to call for kernels that are supported.
+IndexRange ComputeVectorIndexRange(IndexRangeKernel kernel,
+                                   DrawElementsType indexType,
+                                   const GLvoid *indices,
+                                   size_t count,
+                                   bool primitiveRestartEnabled);
+}  // namespace priv
+}  // namespace gl
+
+#endif  // COMMON_INDEX_RANGE_SIMD_H_
@@ -174,6 +174,63 @@ inline bool supportsSSE2()
 #endif
 }
 
+// Code using these instructions has to be compiled with the matching target attribute, since the
+// rest of ANGLE only assumes SSE2.
+inline bool supportsSSSE3()
+{
+#if defined(ANGLE_USE_SSE)
+    static const bool supports = []() {
+#    if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 1)
+        {
+            return false;
+        }
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+#    else
+        return __builtin_cpu_supports("ssse3") != 0;
+#    endif
+    }();
+    return supports;
+#else  // defined(ANGLE_USE_SSE)
+    return false;
+#endif
+}
+
+inline bool supportsAVX2()
+{
+#if defined(ANGLE_USE_SSE)
+    static const bool supports = []() {
+#    if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        // The OS has to save the YMM registers as well.
+        __cpuid(info, 1);
+        constexpr int kOSXSAVEAndAVX = (1 << 27) | (1 << 28);
+        if ((info[2] & kOSXSAVEAndAVX) != kOSXSAVEAndAVX || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#    else
+        return __builtin_cpu_supports("avx2") != 0;
+#    endif
+    }();
+    return supports;
+#else  // defined(ANGLE_USE_SSE)
+    return false;
+#endif
+}
+
 template <typename destType, typename sourceType>
 destType bitCast(const sourceType &source)
 {
@@ -135,4 +135,18 @@ std::string ConcatenatePath(std::string first, std::string second)
     }
     return first + GetPathSeparator() + second;
 }
+
+MemoryMappedFile::MemoryMappedFile() : mData(nullptr), mSize(0), mHandle(nullptr) {}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    unmap();
+}
+
+ExclusiveFileLock::ExclusiveFileLock() : mHandle(kInvalidHandle) {}
+
+ExclusiveFileLock::~ExclusiveFileLock()
+{
+    unlock();
+}
 }  // namespace angle
@@ -83,6 +83,50 @@ enum class SearchType
 Library *OpenSharedLibrary(const char *libraryName, SearchType searchType);
 Library *OpenSharedLibraryWithExtension(const char *libraryName, SearchType searchType);
 
+// Read-only memory mapping of a file.  The mapping is a snapshot of the file's size at the time
+// map() was called; callers that append to the file must remap to see the new contents.
+class MemoryMappedFile final : angle::NonCopyable
+{
+  public:
+    MemoryMappedFile();
+    ~MemoryMappedFile();
+
+    // Maps the first |size| bytes of the file at |path|.  Any previous mapping is released first.
+    bool map(const char *path, size_t size);
+    void unmap();
+
+    bool valid() const { return mData != nullptr; }
+    const uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    const uint8_t *mData;
+    size_t mSize;
+    // Platform specific handle to the mapping object, if any.
+    void *mHandle;
+};
+
+// Exclusive lock on a file, used to keep a file owned by a single process.  The lock is released
+// by unlock() or when the process exits.
+class ExclusiveFileLock final : angle::NonCopyable
+{
+  public:
+    ExclusiveFileLock();
+    ~ExclusiveFileLock();
+
+    // Creates the file at |path| if needed and locks it without blocking.  Returns false if
+    // another process holds the lock.
+    bool lock(const char *path);
+    void unlock();
+
+    bool locked() const { return mHandle != kInvalidHandle; }
+
+  private:
+    static constexpr intptr_t kInvalidHandle = -1;
+    // Platform specific handle to the locked file.
+    intptr_t mHandle;
+};
+
 // Returns true if the process is currently being debugged.
 bool IsDebuggerAttached();
 
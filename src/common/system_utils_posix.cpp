@@ -12,6 +12,9 @@
 #include <iostream>
 
 #include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -90,6 +93,76 @@ std::string GetModuleDirectory()
     return directory;
 }
 
+bool MemoryMappedFile::map(const char *path, size_t size)
+{
+    unmap();
+
+    if (size == 0)
+    {
+        return false;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    mData = static_cast<const uint8_t *>(data);
+    mSize = size;
+    return true;
+}
+
+void MemoryMappedFile::unmap()
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+}
+
+bool ExclusiveFileLock::lock(const char *path)
+{
+    unlock();
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    // flock() locks are tied to the open file description, so the lock is also released if the
+    // process dies.
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    mHandle = fd;
+    return true;
+}
+
+void ExclusiveFileLock::unlock()
+{
+    if (locked())
+    {
+        close(static_cast<int>(mHandle));
+    }
+    mHandle = kInvalidHandle;
+}
+
 class PosixLibrary : public Library
 {
   public:
@@ -37,6 +37,86 @@ std::string GetEnvironmentVar(const char *variableName)
     }
 }
 
+bool MemoryMappedFile::map(const char *path, size_t size)
+{
+    unmap();
+
+    if (size == 0)
+    {
+        return false;
+    }
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    ULARGE_INTEGER mappingSize;
+    mappingSize.QuadPart = size;
+    HANDLE mapping       = CreateFileMappingA(file, nullptr, PAGE_READONLY, mappingSize.HighPart,
+                                        mappingSize.LowPart, nullptr);
+    // The mapping object keeps its own reference to the file.
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        return false;
+    }
+
+    void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+    if (data == nullptr)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    mData   = static_cast<const uint8_t *>(data);
+    mSize   = size;
+    mHandle = mapping;
+    return true;
+}
+
+void MemoryMappedFile::unmap()
+{
+    if (mData != nullptr)
+    {
+        UnmapViewOfFile(mData);
+    }
+    if (mHandle != nullptr)
+    {
+        CloseHandle(static_cast<HANDLE>(mHandle));
+    }
+    mData   = nullptr;
+    mSize   = 0;
+    mHandle = nullptr;
+}
+
+bool ExclusiveFileLock::lock(const char *path)
+{
+    unlock();
+
+    // Opening the file without sharing fails while another process has it open.
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    mHandle = reinterpret_cast<intptr_t>(file);
+    return true;
+}
+
+void ExclusiveFileLock::unlock()
+{
+    if (locked())
+    {
+        CloseHandle(reinterpret_cast<HANDLE>(mHandle));
+    }
+    mHandle = kInvalidHandle;
+}
+
 class Win32Library : public Library
 {
   public:
@@ -90,6 +90,32 @@ class UwpLibrary : public Library
     HMODULE mModule = nullptr;
 };
 
+bool MemoryMappedFile::map(const char *path, size_t size)
+{
+    // File mappings are not exposed to UWP applications through the Win32 API set we use.
+    unmap();
+    return false;
+}
+
+void MemoryMappedFile::unmap()
+{
+    mData   = nullptr;
+    mSize   = 0;
+    mHandle = nullptr;
+}
+
+bool ExclusiveFileLock::lock(const char *path)
+{
+    // The disk cache can't be used without file mappings anyway.
+    unlock();
+    return false;
+}
+
+void ExclusiveFileLock::unlock()
+{
+    mHandle = kInvalidHandle;
+}
+
 Library *OpenSharedLibrary(const char *libraryName, SearchType searchType)
 {
     char buffer[MAX_PATH];
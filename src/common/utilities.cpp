@@ -8,6 +8,7 @@
 
 #include "common/utilities.h"
 #include "GLES3/gl3.h"
+#include "common/index_range_simd.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "common/string_utils.h"
@@ -46,12 +47,12 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
             {
                 minIndex = indices[i];
                 maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
                 break;
             }
         }
 
-        // Loop over the rest of the indices
+        // Loop over the rest of the indices, starting again with the first one so it is counted
+        // exactly once
         for (; i < count; i++)
         {
             if (indices[i] != primitiveRestartIndex)
@@ -91,6 +92,23 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                           nonPrimitiveRestartIndices);
 }
 
+// Below this many indices, the setup and final reduction of the vector kernels outweigh their
+// speedup.
+constexpr size_t kMinVectorIndexRangeCount = 32;
+
+gl::IndexRangeKernel GetFastestIndexRangeKernel()
+{
+    for (gl::IndexRangeKernel kernel :
+         {gl::IndexRangeKernel::AVX2, gl::IndexRangeKernel::SSE2, gl::IndexRangeKernel::NEON})
+    {
+        if (gl::IsIndexRangeKernelSupported(kernel))
+        {
+            return kernel;
+        }
+    }
+    return gl::IndexRangeKernel::Scalar;
+}
+
 }  // anonymous namespace
 
 namespace gl
@@ -690,6 +708,34 @@ IndexRange ComputeIndexRange(DrawElementsType indexType,
                              size_t count,
                              bool primitiveRestartEnabled)
 {
+    static const IndexRangeKernel kFastestKernel = GetFastestIndexRangeKernel();
+
+    IndexRangeKernel kernel =
+        count < kMinVectorIndexRangeCount ? IndexRangeKernel::Scalar : kFastestKernel;
+    return ComputeIndexRangeWithKernel(kernel, indexType, indices, count, primitiveRestartEnabled);
+}
+
+bool IsIndexRangeKernelSupported(IndexRangeKernel kernel)
+{
+    if (kernel == IndexRangeKernel::Scalar)
+    {
+        return true;
+    }
+    return priv::IsVectorIndexRangeKernelSupported(kernel);
+}
+
+IndexRange ComputeIndexRangeWithKernel(IndexRangeKernel kernel,
+                                       DrawElementsType indexType,
+                                       const GLvoid *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled)
+{
+    if (kernel != IndexRangeKernel::Scalar)
+    {
+        return priv::ComputeVectorIndexRange(kernel, indexType, indices, count,
+                                             primitiveRestartEnabled);
+    }
+
     switch (indexType)
     {
         case DrawElementsType::UnsignedByte:
@@ -710,6 +756,21 @@ IndexRange ComputeIndexRange(DrawElementsType indexType,
     }
 }
 
+void ComputeIndexRanges(DrawElementsType indexType,
+                        const uint8_t *bufferData,
+                        const std::vector<IndexSpan> &spans,
+                        bool primitiveRestartEnabled,
+                        std::vector<IndexRange> *rangesOut)
+{
+    rangesOut->resize(spans.size());
+    for (size_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex)
+    {
+        const IndexSpan &span   = spans[spanIndex];
+        (*rangesOut)[spanIndex] = ComputeIndexRange(indexType, bufferData + span.offset,
+                                                    span.count, primitiveRestartEnabled);
+    }
+}
+
 GLuint GetPrimitiveRestartIndex(DrawElementsType indexType)
 {
     switch (indexType)
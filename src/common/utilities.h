@@ -80,6 +80,40 @@ IndexRange ComputeIndexRange(DrawElementsType indexType,
                              size_t count,
                              bool primitiveRestartEnabled);
 
+// The implementations of ComputeIndexRange.  By default, the fastest one supported by the CPU is
+// used.  Exposed for testing.
+enum class IndexRangeKernel
+{
+    Scalar,
+    SSE2,
+    AVX2,
+    NEON,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+bool IsIndexRangeKernelSupported(IndexRangeKernel kernel);
+IndexRange ComputeIndexRangeWithKernel(IndexRangeKernel kernel,
+                                       DrawElementsType indexType,
+                                       const GLvoid *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled);
+
+// A span of indices, starting at |offset| bytes in a buffer.
+struct IndexSpan
+{
+    size_t offset;
+    size_t count;
+};
+
+// Find the range of every span of indices in the provided buffer data.
+void ComputeIndexRanges(DrawElementsType indexType,
+                        const uint8_t *bufferData,
+                        const std::vector<IndexSpan> &spans,
+                        bool primitiveRestartEnabled,
+                        std::vector<IndexRange> *rangesOut);
+
 // Get the primitive restart index value for the given index type.
 GLuint GetPrimitiveRestartIndex(DrawElementsType indexType);
 
@@ -10,6 +10,8 @@
 
 #include "common/utilities.h"
 
+#include <limits>
+
 namespace
 {
 
@@ -177,4 +179,118 @@ TEST(ParseArrayIndex, ArrayIndexOutOfRange)
     EXPECT_EQ(15u, nameLengthWithoutArrayIndex);
 }
 
+// Fills |indices| with pseudo-random values, with roughly one in |restartFrequency| of them being
+// the primitive restart index.
+template <typename T>
+std::vector<T> MakeTestIndices(size_t count, uint32_t seed, uint32_t restartFrequency)
+{
+    std::vector<T> indices(count);
+    uint32_t state = seed;
+    for (T &index : indices)
+    {
+        state = state * 1664525u + 1013904223u;
+        if ((state >> 24) % restartFrequency == 0)
+        {
+            index = gl::GetPrimitiveRestartIndexFromType<T>();
+        }
+        else
+        {
+            // Keep the values away from the extremes so that the padding can reach them.
+            index = static_cast<T>(1 + (state >> 8) % (std::numeric_limits<T>::max() - 2));
+        }
+    }
+    return indices;
+}
+
+void ExpectIndexRangeEq(const gl::IndexRange &expected, const gl::IndexRange &actual)
+{
+    EXPECT_EQ(expected.start, actual.start);
+    EXPECT_EQ(expected.end, actual.end);
+    EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+}
+
+template <typename T>
+void CheckIndexRangeKernel(gl::IndexRangeKernel kernel, gl::DrawElementsType indexType)
+{
+    constexpr size_t kCounts[] = {1, 3, 15, 16, 17, 31, 32, 33, 63, 100, 1000, 4099};
+
+    for (size_t count : kCounts)
+    {
+        for (uint32_t restartFrequency : {2u, 13u, 1000u})
+        {
+            std::vector<T> indices = MakeTestIndices<T>(count + 1, static_cast<uint32_t>(count),
+                                                        restartFrequency);
+
+            // Make sure the extremes are found anywhere, including in the scalar tail.
+            indices[count / 3] = 0;
+            indices[count]     = std::numeric_limits<T>::max() - 1;
+
+            for (bool primitiveRestartEnabled : {false, true})
+            {
+                // Also test indices that don't start at a vector boundary.
+                for (size_t offset : {0, 1})
+                {
+                    const T *data    = indices.data() + offset;
+                    size_t dataCount = count + 1 - offset;
+                    gl::IndexRange expected = gl::ComputeIndexRangeWithKernel(
+                        gl::IndexRangeKernel::Scalar, indexType, data, dataCount,
+                        primitiveRestartEnabled);
+                    gl::IndexRange actual = gl::ComputeIndexRangeWithKernel(
+                        kernel, indexType, data, dataCount, primitiveRestartEnabled);
+
+                    SCOPED_TRACE(testing::Message()
+                                 << "count " << dataCount << ", restart frequency "
+                                 << restartFrequency << ", restart "
+                                 << primitiveRestartEnabled);
+                    ExpectIndexRangeEq(expected, actual);
+                }
+            }
+        }
+    }
+
+    // All primitive restart indices.
+    std::vector<T> restartIndices(100, gl::GetPrimitiveRestartIndexFromType<T>());
+    ExpectIndexRangeEq(gl::IndexRange(0, 0, 0),
+                       gl::ComputeIndexRangeWithKernel(kernel, indexType, restartIndices.data(),
+                                                       restartIndices.size(), true));
+    ExpectIndexRangeEq(gl::IndexRange(std::numeric_limits<T>::max(),
+                                      std::numeric_limits<T>::max(), restartIndices.size()),
+                       gl::ComputeIndexRangeWithKernel(kernel, indexType, restartIndices.data(),
+                                                       restartIndices.size(), false));
+}
+
+// Test that every index range kernel supported by the CPU gives the same result as the scalar one.
+TEST(ComputeIndexRange, KernelsMatchScalar)
+{
+    for (gl::IndexRangeKernel kernel : angle::AllEnums<gl::IndexRangeKernel>())
+    {
+        if (!gl::IsIndexRangeKernelSupported(kernel))
+        {
+            continue;
+        }
+
+        SCOPED_TRACE(testing::Message() << "kernel " << static_cast<int>(kernel));
+        CheckIndexRangeKernel<uint8_t>(kernel, gl::DrawElementsType::UnsignedByte);
+        CheckIndexRangeKernel<uint16_t>(kernel, gl::DrawElementsType::UnsignedShort);
+        CheckIndexRangeKernel<uint32_t>(kernel, gl::DrawElementsType::UnsignedInt);
+    }
+}
+
+// Test that ComputeIndexRange handles the extreme index values of each type.
+TEST(ComputeIndexRange, ExtremeValues)
+{
+    std::vector<uint16_t> indices(64, 7);
+    indices[5]  = 0;
+    indices[40] = 0xFFFE;
+    indices[63] = 0xFFFF;
+
+    gl::IndexRange range = gl::ComputeIndexRange(gl::DrawElementsType::UnsignedShort,
+                                                 indices.data(), indices.size(), false);
+    ExpectIndexRangeEq(gl::IndexRange(0, 0xFFFF, 64), range);
+
+    range = gl::ComputeIndexRange(gl::DrawElementsType::UnsignedShort, indices.data(),
+                                  indices.size(), true);
+    ExpectIndexRangeEq(gl::IndexRange(0, 0xFFFE, 63), range);
+}
+
 }  // anonymous namespace
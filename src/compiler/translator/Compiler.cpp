@@ -6,9 +6,14 @@
 
 #include "compiler/translator/Compiler.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "angle_gl.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/CollectVariables.h"
@@ -172,6 +177,188 @@ int GetMaxUniformVectorsForShaderType(GLenum shaderType, const ShBuiltInResource
 namespace
 {
 
+// Function-local passes are only split among threads when there are enough functions to make up
+// for starting the threads.
+constexpr size_t kMinFunctionsPerPassThread = 16;
+constexpr size_t kMaxFunctionPassThreads    = 4;
+
+size_t GetFunctionPassThreadCount(ShCompileOptions compileOptions, size_t functionCount)
+{
+    if ((compileOptions & SH_PARALLELIZE_FUNCTION_PASSES) == 0)
+    {
+        return 1;
+    }
+
+    const size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    const size_t threadCount     = std::min(hardwareThreads, kMaxFunctionPassThreads);
+    return std::max<size_t>(std::min(threadCount, functionCount / kMinFunctionsPerPassThread), 1);
+}
+
+}  // anonymous namespace
+
+// Helper threads that run the function-local passes of a compilation.  Each has a pool allocator
+// of its own, as the pool allocator isn't thread-safe.
+class FunctionPassWorkers : angle::NonCopyable
+{
+  public:
+    FunctionPassWorkers() = default;
+    ~FunctionPassWorkers();
+
+    // Runs task(0) on this thread and task(workerIndex + 1) on the first |workerCount| workers,
+    // starting the missing ones, and waits for all of them to finish.
+    void run(const std::vector<angle::PoolAllocator *> &poolAllocators,
+             size_t workerCount,
+             const std::function<void(size_t)> &task);
+
+  private:
+    void workerMain(size_t workerIndex, angle::PoolAllocator *poolAllocator);
+
+    std::mutex mMutex;
+    std::condition_variable mWorkReady;
+    std::condition_variable mWorkDone;
+    std::vector<std::thread> mThreads;
+
+    // The task of the current run, and the number of workers that run it.  The generation is
+    // incremented with every run, so workers can tell a new run from the one they just did.
+    const std::function<void(size_t)> *mTask = nullptr;
+    size_t mActiveWorkerCount                = 0;
+    size_t mRemainingWorkerCount             = 0;
+    uint64_t mGeneration                     = 0;
+    bool mExit                               = false;
+};
+
+FunctionPassWorkers::~FunctionPassWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mWorkReady.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+void FunctionPassWorkers::run(const std::vector<angle::PoolAllocator *> &poolAllocators,
+                              size_t workerCount,
+                              const std::function<void(size_t)> &task)
+{
+    ASSERT(workerCount <= poolAllocators.size());
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (mThreads.size() < workerCount)
+    {
+        const size_t workerIndex = mThreads.size();
+        mThreads.emplace_back(&FunctionPassWorkers::workerMain, this, workerIndex,
+                              poolAllocators[workerIndex]);
+    }
+
+    mTask                 = &task;
+    mActiveWorkerCount    = workerCount;
+    mRemainingWorkerCount = workerCount;
+    ++mGeneration;
+    mWorkReady.notify_all();
+
+    lock.unlock();
+    task(0);
+    lock.lock();
+
+    mWorkDone.wait(lock, [this]() { return mRemainingWorkerCount == 0; });
+    mTask = nullptr;
+}
+
+void FunctionPassWorkers::workerMain(size_t workerIndex, angle::PoolAllocator *poolAllocator)
+{
+    SetGlobalPoolAllocator(poolAllocator);
+
+    // A worker started by a run takes part in it.
+    std::unique_lock<std::mutex> lock(mMutex);
+    uint64_t generation = mGeneration - 1;
+
+    while (true)
+    {
+        mWorkReady.wait(lock, [this, generation]() { return mExit || mGeneration != generation; });
+        if (mExit)
+        {
+            break;
+        }
+        generation = mGeneration;
+
+        if (workerIndex >= mActiveWorkerCount)
+        {
+            continue;
+        }
+
+        const std::function<void(size_t)> &task = *mTask;
+        lock.unlock();
+        task(workerIndex + 1);
+        lock.lock();
+
+        if (--mRemainingWorkerCount == 0)
+        {
+            mWorkDone.notify_one();
+        }
+    }
+
+    SetGlobalPoolAllocator(nullptr);
+}
+
+namespace
+{
+
+class CountNodesTraverser : public TIntermTraverser
+{
+  public:
+    CountNodesTraverser() : TIntermTraverser(true, false, false) {}
+
+    size_t getCount() const { return mCount; }
+
+    void visitSymbol(TIntermSymbol *node) override { ++mCount; }
+    void visitConstantUnion(TIntermConstantUnion *node) override { ++mCount; }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override { return count(); }
+    bool visitBinary(Visit visit, TIntermBinary *node) override { return count(); }
+    bool visitUnary(Visit visit, TIntermUnary *node) override { return count(); }
+    bool visitTernary(Visit visit, TIntermTernary *node) override { return count(); }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override { return count(); }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override { return count(); }
+    bool visitCase(Visit visit, TIntermCase *node) override { return count(); }
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override { ++mCount; }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        return count();
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override { return count(); }
+    bool visitBlock(Visit visit, TIntermBlock *node) override { return count(); }
+    bool visitGlobalQualifierDeclaration(Visit visit,
+                                         TIntermGlobalQualifierDeclaration *node) override
+    {
+        return count();
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override { return count(); }
+    bool visitLoop(Visit visit, TIntermLoop *node) override { return count(); }
+    bool visitBranch(Visit visit, TIntermBranch *node) override { return count(); }
+    void visitPreprocessorDirective(TIntermPreprocessorDirective *node) override { ++mCount; }
+
+  private:
+    bool count()
+    {
+        ++mCount;
+        return true;
+    }
+
+    size_t mCount = 0;
+};
+
+size_t CountASTNodes(TIntermBlock *root)
+{
+    CountNodesTraverser traverser;
+    root->traverse(&traverser);
+    return traverser.getCount();
+}
+
 class TScopedPoolAllocator
 {
   public:
@@ -299,6 +486,9 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mOutputType(output),
       mBuiltInFunctionEmulator(),
       mDiagnostics(mInfoSink.info),
+      mDeferValidateAST(false),
+      mPassStartTime(0),
+      mPassStartPoolBytesAllocated(0),
       mSourcePath(nullptr),
       mComputeShaderLocalSizeDeclared(false),
       mComputeShaderLocalSize(1),
@@ -366,6 +556,9 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     ASSERT(numStrings > 0);
     ASSERT(GetGlobalPoolAllocator());
 
+    GetGlobalPoolAllocator()->setRecordStatistics((compileOptions & SH_RECORD_PASS_METRICS) != 0);
+    startPassMetrics();
+
     // Reset the extension behavior for each compilation unit.
     ResetExtensionBehavior(mResources, mExtensionBehavior, compileOptions);
 
@@ -431,6 +624,8 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     }
 
     TIntermBlock *root = parseContext.getTreeRoot();
+    recordPassMetrics("Parse", root);
+
     if (!checkAndSimplifyAST(root, parseContext, compileOptions))
     {
         return nullptr;
@@ -552,6 +747,11 @@ unsigned int TCompiler::getSharedMemorySize() const
 
 bool TCompiler::validateAST(TIntermNode *root)
 {
+    if (mDeferValidateAST)
+    {
+        return true;
+    }
+
     if ((mCompileOptions & SH_VALIDATE_AST) != 0)
     {
         bool valid = ValidateAST(root, &mDiagnostics, mValidateASTOptions);
@@ -629,6 +829,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
+    recordPassMetrics("Validate", root);
+
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
     if (!FoldExpressions(this, root, &mDiagnostics))
@@ -637,6 +839,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     }
     // Folding should only be able to generate warnings.
     ASSERT(mDiagnostics.numErrors() == 0);
+    recordPassMetrics("FoldExpressions", root);
 
     // Validate no barrier() after return before prunning it in |PruneNoOps()| below.
     if (mShaderType == GL_TESS_CONTROL_SHADER && !ValidateBarrierFunctionCall(root, &mDiagnostics))
@@ -656,6 +859,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassMetrics("PruneNoOps", root);
 
     // We need to generate globals early if we have non constant initializers enabled
     bool initializeLocalsAndGlobals = (compileOptions & SH_INITIALIZE_UNINITIALIZED_LOCALS) != 0 &&
@@ -666,11 +870,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                   mResources.FragmentPrecisionHigh == 1;
     bool enableNonConstantInitializers = IsExtensionEnabled(
         mExtensionBehavior, TExtension::EXT_shader_non_constant_global_initializers);
-    if (enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, &mSymbolTable))
+    if (enableNonConstantInitializers)
     {
-        return false;
+        if (!DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                     canUseLoopsToInitialize, highPrecisionSupported,
+                                     &mSymbolTable))
+        {
+            return false;
+        }
+        recordPassMetrics("DeferGlobalInitializers", root);
     }
 
     // Create the function DAG and check there is no recursion
@@ -693,12 +901,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     }
 
     pruneUnusedFunctions(root);
+    // Includes building the call DAG.
+    recordPassMetrics("PruneUnusedFunctions", root);
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
         if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
         {
             return false;
         }
+        recordPassMetrics("ReplaceShadowingVariables", root);
     }
 
     if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
@@ -729,6 +940,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
     }
 
+    recordPassMetrics("ValidateInterface", root);
+
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if ((compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS) != 0)
     {
@@ -736,6 +949,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("ClampIndirectIndices", root);
     }
 
     if ((compileOptions & SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW) != 0 &&
@@ -748,6 +962,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("DeclareAndInitBuiltinsForInstancedMultiview", root);
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
@@ -757,14 +972,16 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("RewriteDoWhile", root);
     }
 
     if ((compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION) != 0)
     {
-        if (!AddAndTrueToLoopCondition(this, root))
+        if (!runFunctionLocalPass(root, AddAndTrueToLoopCondition))
         {
             return false;
         }
+        recordPassMetrics("AddAndTrueToLoopCondition", root);
     }
 
     if ((compileOptions & SH_UNFOLD_SHORT_CIRCUIT) != 0)
@@ -773,6 +990,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("UnfoldShortCircuitAST", root);
     }
 
     if ((compileOptions & SH_REGENERATE_STRUCT_NAMES) != 0)
@@ -781,6 +999,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("RegenerateStructNames", root);
     }
 
     if (mShaderType == GL_VERTEX_SHADER &&
@@ -793,6 +1012,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassMetrics("EmulateGLDrawID", root);
         }
     }
 
@@ -807,6 +1027,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassMetrics("EmulateGLBaseVertexBaseInstance", root);
         }
     }
 
@@ -819,6 +1040,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("EmulateGLFragColorBroadcast", root);
     }
 
     int simplifyScalarized = (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS) != 0
@@ -836,6 +1058,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassMetrics("SimplifyLoopConditions", root);
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
@@ -844,6 +1067,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
     mValidateASTOptions.validateMultiDeclarations = true;
+    recordPassMetrics("SeparateDeclarations", root);
 
     if (!SplitSequenceOperator(this, root,
                                IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
@@ -851,16 +1075,19 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassMetrics("SplitSequenceOperator", root);
 
     if (!RemoveArrayLengthMethod(this, root))
     {
         return false;
     }
+    recordPassMetrics("RemoveArrayLengthMethod", root);
 
     if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
     {
         return false;
     }
+    recordPassMetrics("RemoveUnreferencedVariables", root);
 
     // In case the last case inside a switch statement is a certain type of no-op, GLSL compilers in
     // drivers may not accept it. In this case we clean up the dead code from the end of switch
@@ -868,10 +1095,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
-    if (!PruneEmptyCases(this, root))
+    if (!runFunctionLocalPass(root, PruneEmptyCases))
     {
         return false;
     }
+    recordPassMetrics("PruneEmptyCases", root);
 
     // Built-in function emulation needs to happen after validateLimitations pass.
     // TODO(jmadill): Remove global pool allocator.
@@ -879,6 +1107,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
     mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    recordPassMetrics("MarkBuiltInFunctionsForEmulation", root);
 
     if ((compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS) != 0)
     {
@@ -887,6 +1116,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("ScalarizeVecAndMatConstructorArgs", root);
     }
 
     if ((compileOptions & SH_FORCE_SHADER_PRECISION_HIGHP_TO_MEDIUMP) != 0)
@@ -895,6 +1125,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("ForceShaderPrecisionToMediump", root);
     }
 
     if (shouldCollectVariables(compileOptions))
@@ -906,12 +1137,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                          mExtensionBehavior, mResources, mTessControlShaderOutputVertices);
         collectInterfaceBlocks();
         mVariablesCollected = true;
+        recordPassMetrics("CollectVariables", root);
         if ((compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS) != 0)
         {
             if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
             {
                 return false;
             }
+            recordPassMetrics("UseInterfaceBlockFields", root);
         }
         if ((compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS) != 0)
         {
@@ -935,6 +1168,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassMetrics("InitializeOutputVariables", root);
         }
     }
 
@@ -946,6 +1180,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("RemoveInvariantDeclaration", root);
     }
 
     // gl_Position is always written in compatibility output mode.
@@ -960,6 +1195,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             return false;
         }
         mGLPositionInitialized = true;
+        recordPassMetrics("InitializeGLPosition", root);
     }
 
     // DeferGlobalInitializers needs to be run before other AST transformations that generate new
@@ -969,11 +1205,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Exception: if EXT_shader_non_constant_global_initializers is enabled, we must generate global
     // initializers before we generate the DAG, since initializers may call functions which must not
     // be optimized out
-    if (!enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, &mSymbolTable))
+    if (!enableNonConstantInitializers)
     {
-        return false;
+        if (!DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                     canUseLoopsToInitialize, highPrecisionSupported,
+                                     &mSymbolTable))
+        {
+            return false;
+        }
+        recordPassMetrics("DeferGlobalInitializers", root);
     }
 
     if (initializeLocalsAndGlobals)
@@ -1002,6 +1242,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        // Includes the above SimplifyLoopConditions, which is only run for this pass.
+        recordPassMetrics("InitializeUninitializedLocals", root);
     }
 
     if (getShaderType() == GL_VERTEX_SHADER && (compileOptions & SH_CLAMP_POINT_SIZE) != 0)
@@ -1010,6 +1252,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("ClampPointSize", root);
     }
 
     if (getShaderType() == GL_FRAGMENT_SHADER && (compileOptions & SH_CLAMP_FRAG_DEPTH) != 0)
@@ -1018,14 +1261,16 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("ClampFragDepth", root);
     }
 
     if ((compileOptions & SH_REWRITE_REPEATED_ASSIGN_TO_SWIZZLED) != 0)
     {
-        if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
+        if (!runFunctionLocalPass(root, sh::RewriteRepeatedAssignToSwizzled))
         {
             return false;
         }
+        recordPassMetrics("RewriteRepeatedAssignToSwizzled", root);
     }
 
     if ((compileOptions & SH_REWRITE_VECTOR_SCALAR_ARITHMETIC) != 0)
@@ -1034,6 +1279,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("VectorizeVectorScalarArithmetic", root);
     }
 
     if ((compileOptions & SH_REMOVE_DYNAMIC_INDEXING_OF_SWIZZLED_VECTOR) != 0)
@@ -1042,6 +1288,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassMetrics("RemoveDynamicIndexingOfSwizzledVector", root);
     }
 
     mEarlyFragmentTestsOptimized = false;
@@ -1051,6 +1298,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             !isEarlyFragmentTestsSpecified())
         {
             mEarlyFragmentTestsOptimized = CheckEarlyFragmentTestsFeasible(this, root);
+            recordPassMetrics("CheckEarlyFragmentTestsFeasible", root);
         }
     }
 
@@ -1081,6 +1329,9 @@ bool TCompiler::compile(const char *const shaderStrings[],
     TScopedPoolAllocator scopedAlloc(&allocator);
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
+    // Only the passes of compileTreeImpl run in parallel.
+    mFunctionPassWorkers.reset();
+
     if (root)
     {
         if ((compileOptions & SH_INTERMEDIATE_TREE) != 0)
@@ -1095,6 +1346,7 @@ bool TCompiler::compile(const char *const shaderStrings[],
             {
                 return false;
             }
+            recordPassMetrics("Output", root);
         }
 
         if (mShaderType == GL_VERTEX_SHADER)
@@ -1311,8 +1563,144 @@ bool TCompiler::emulatePrecisionIfNeeded(TIntermBlock *root,
     return true;
 }
 
+bool TCompiler::runFunctionLocalPass(TIntermBlock *root, const FunctionLocalPass &pass)
+{
+    std::vector<TIntermBlock *> functionBodies;
+    for (TIntermNode *node : *root->getSequence())
+    {
+        TIntermFunctionDefinition *functionDefinition = node->getAsFunctionDefinition();
+        if (functionDefinition != nullptr)
+        {
+            functionBodies.push_back(functionDefinition->getBody());
+        }
+    }
+
+    const size_t threadCount = GetFunctionPassThreadCount(mCompileOptions, functionBodies.size());
+
+    // Every helper thread allocates from a pool of its own, as the pool allocator isn't
+    // thread-safe.  This thread keeps using the compiler's.
+    while (mFunctionPassPoolAllocators.size() < threadCount - 1)
+    {
+        mFunctionPassPoolAllocators.emplace_back(new angle::PoolAllocator);
+        mFunctionPassPoolAllocators.back()->setRecordStatistics(
+            (mCompileOptions & SH_RECORD_PASS_METRICS) != 0);
+        mFunctionPassPoolAllocators.back()->push();
+    }
+
+    // Each thread takes a contiguous range of the functions.  The bodies are modified in place, and
+    // each by a single thread, so the result doesn't depend on how the threads are scheduled.
+    const size_t functionsPerThread = (functionBodies.size() + threadCount - 1) / threadCount;
+    std::vector<char> succeeded(threadCount, 1);
+
+    auto runOnRange = [&](size_t threadIndex) {
+        const size_t begin = threadIndex * functionsPerThread;
+        const size_t end   = std::min(begin + functionsPerThread, functionBodies.size());
+        for (size_t index = begin; index < end; ++index)
+        {
+            if (!pass(this, functionBodies[index]))
+            {
+                succeeded[threadIndex] = 0;
+                return;
+            }
+        }
+    };
+
+    // The bodies are validated together once the pass is done with all of them.
+    mDeferValidateAST = true;
+
+    if (threadCount > 1)
+    {
+        if (!mFunctionPassWorkers)
+        {
+            mFunctionPassWorkers.reset(new FunctionPassWorkers);
+        }
+
+        std::vector<angle::PoolAllocator *> poolAllocators;
+        for (const std::unique_ptr<angle::PoolAllocator> &poolAllocator :
+             mFunctionPassPoolAllocators)
+        {
+            poolAllocators.push_back(poolAllocator.get());
+        }
+
+        mFunctionPassWorkers->run(poolAllocators, threadCount - 1, runOnRange);
+    }
+    else
+    {
+        runOnRange(0);
+    }
+
+    mDeferValidateAST = false;
+
+    if (std::find(succeeded.begin(), succeeded.end(), 0) != succeeded.end())
+    {
+        return false;
+    }
+    return validateAST(root);
+}
+
+void TCompiler::recordPassMetrics(const char *name, TIntermBlock *root)
+{
+    if ((mCompileOptions & SH_RECORD_PASS_METRICS) == 0)
+    {
+        return;
+    }
+
+    PassMetrics metrics;
+    metrics.name               = name;
+    metrics.startTime          = mPassStartTime;
+    metrics.wallTime           = angle::GetCurrentTime() - mPassStartTime;
+    metrics.astNodeCount       = CountASTNodes(root);
+    metrics.poolBytesAllocated = getPoolBytesAllocated() - mPassStartPoolBytesAllocated;
+    metrics.poolPeakBytesInUse = getPoolPeakBytesInUse();
+    mPassMetrics.push_back(metrics);
+
+    // Start the next phase after counting the nodes, so it doesn't count towards either.
+    startPassMetrics();
+}
+
+void TCompiler::startPassMetrics()
+{
+    if ((mCompileOptions & SH_RECORD_PASS_METRICS) == 0)
+    {
+        return;
+    }
+
+    GetGlobalPoolAllocator()->resetPeakBytesInUse();
+    for (const std::unique_ptr<angle::PoolAllocator> &poolAllocator : mFunctionPassPoolAllocators)
+    {
+        poolAllocator->resetPeakBytesInUse();
+    }
+
+    mPassStartPoolBytesAllocated = getPoolBytesAllocated();
+    mPassStartTime               = angle::GetCurrentTime();
+}
+
+size_t TCompiler::getPoolBytesAllocated() const
+{
+    size_t bytes = GetGlobalPoolAllocator()->getTotalBytesAllocated();
+    for (const std::unique_ptr<angle::PoolAllocator> &poolAllocator : mFunctionPassPoolAllocators)
+    {
+        bytes += poolAllocator->getTotalBytesAllocated();
+    }
+    return bytes;
+}
+
+size_t TCompiler::getPoolPeakBytesInUse() const
+{
+    // The pools of the helper threads peak at different times, so this may be an overestimate.
+    size_t bytes = GetGlobalPoolAllocator()->getPeakBytesInUse();
+    for (const std::unique_ptr<angle::PoolAllocator> &poolAllocator : mFunctionPassPoolAllocators)
+    {
+        bytes += poolAllocator->getPeakBytesInUse();
+    }
+    return bytes;
+}
+
 void TCompiler::clearResults()
 {
+    mFunctionPassPoolAllocators.clear();
+    mPassMetrics.clear();
+
     mInfoSink.info.erase();
     mInfoSink.obj.erase();
     mInfoSink.debug.erase();
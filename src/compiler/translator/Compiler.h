@@ -16,6 +16,9 @@
 
 #include <GLSLANG/ShaderVars.h>
 
+#include <functional>
+#include <memory>
+
 #include "common/PackedEnums.h"
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
@@ -30,6 +33,7 @@
 namespace sh
 {
 
+class FunctionPassWorkers;
 class TCompiler;
 class TParseContext;
 #ifdef ANGLE_ENABLE_HLSL
@@ -105,6 +109,7 @@ class TCompiler : public TShHandleBase
     // Get results of the last compilation.
     int getShaderVersion() const { return mShaderVersion; }
     TInfoSink &getInfoSink() { return mInfoSink; }
+    const std::vector<PassMetrics> &getPassMetrics() const { return mPassMetrics; }
 
     bool isEarlyFragmentTestsSpecified() const { return mEarlyFragmentTestsSpecified; }
     bool isEarlyFragmentTestsOptimized() const { return mEarlyFragmentTestsOptimized; }
@@ -215,6 +220,11 @@ class TCompiler : public TShHandleBase
                                   const ShShaderOutput outputLanguage);
 
     bool wereVariablesCollected() const;
+
+    // With SH_RECORD_PASS_METRICS, ends the current phase of the compilation and records its
+    // metrics under |name|, which must be a static string.  The next phase starts right after.
+    void recordPassMetrics(const char *name, TIntermBlock *root);
+
     std::vector<sh::ShaderVariable> mAttributes;
     std::vector<sh::ShaderVariable> mOutputVariables;
     std::vector<sh::ShaderVariable> mUniforms;
@@ -284,6 +294,19 @@ class TCompiler : public TShHandleBase
                              const TParseContext &parseContext,
                              ShCompileOptions compileOptions);
 
+    // Runs |pass| on the body of every function defined in |root|.  With
+    // SH_PARALLELIZE_FUNCTION_PASSES and enough functions, the bodies are split among several
+    // threads.  |pass| must only modify the body it's given, and must not use the symbol table or
+    // the diagnostics.
+    using FunctionLocalPass = std::function<bool(TCompiler *, TIntermBlock *)>;
+    ANGLE_NO_DISCARD bool runFunctionLocalPass(TIntermBlock *root, const FunctionLocalPass &pass);
+
+    // Starts timing the next phase for recordPassMetrics.
+    void startPassMetrics();
+    // Sums the statistics of the compiler's pool and of the pools of runFunctionLocalPass.
+    size_t getPoolBytesAllocated() const;
+    size_t getPoolPeakBytesInUse() const;
+
     sh::GLenum mShaderType;
     ShShaderSpec mShaderSpec;
     ShShaderOutput mOutputType;
@@ -312,6 +335,20 @@ class TCompiler : public TShHandleBase
     int mShaderVersion;
     TInfoSink mInfoSink;  // Output sink.
     TDiagnostics mDiagnostics;
+
+    // The pools the helper threads of runFunctionLocalPass allocate AST nodes from.  They are kept
+    // as long as the AST, until the next compilation.
+    std::vector<std::unique_ptr<angle::PoolAllocator>> mFunctionPassPoolAllocators;
+    // The helper threads of runFunctionLocalPass.  They are started by the first pass that needs
+    // them and reused by the following ones, until the end of the compilation.
+    std::unique_ptr<FunctionPassWorkers> mFunctionPassWorkers;
+    // While function-local passes run in parallel, the AST is only validated once they are done.
+    bool mDeferValidateAST;
+
+    // Recorded with SH_RECORD_PASS_METRICS.  The start of the current phase is kept to measure it.
+    std::vector<PassMetrics> mPassMetrics;
+    double mPassStartTime;
+    size_t mPassStartPoolBytesAllocated;
     const char *mSourcePath;  // Path of source file or NULL
 
     // fragment shader early fragment tests
@@ -55,6 +55,8 @@ bool TranslatorESSL::translate(TIntermBlock *root,
         return false;
     }
 
+    recordPassMetrics("TransformForOutput", root);
+
     // Write emulated built-in functions if needed.
     if (!getBuiltInFunctionEmulator().isOutputEmpty())
     {
@@ -121,6 +121,8 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
     if (!emulatePrecisionIfNeeded(root, sink, &precisionEmulation, getOutputType()))
         return false;
 
+    recordPassMetrics("TransformForOutput", root);
+
     // Write emulated built-in functions if needed.
     if (!getBuiltInFunctionEmulator().isOutputEmpty())
     {
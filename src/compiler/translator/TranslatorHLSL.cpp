@@ -197,6 +197,8 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
         }
     }
 
+    recordPassMetrics("TransformForOutput", root);
+
     sh::OutputHLSL outputHLSL(getShaderType(), getShaderSpec(), getShaderVersion(),
                               getExtensionBehavior(), getSourcePath(), getOutputType(),
                               numRenderTargets, maxDualSourceDrawBuffers, getUniforms(),
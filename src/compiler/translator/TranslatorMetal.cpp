@@ -239,6 +239,8 @@ bool TranslatorMetal::translate(TIntermBlock *root,
         }
     }
 
+    recordPassMetrics("TransformForOutput", root);
+
     // Write translated shader.
     TOutputVulkanGLSL outputGLSL(sink, getHashFunction(), getNameMap(), &getSymbolTable(),
                                  getShaderType(), getShaderVersion(), getOutputType(), false, true,
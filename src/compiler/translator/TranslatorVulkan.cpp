@@ -1344,6 +1344,8 @@ bool TranslatorVulkan::translate(TIntermBlock *root,
         }
     }
 
+    recordPassMetrics("TransformForOutput", root);
+
 #if defined(ANGLE_ENABLE_DIRECT_SPIRV_GENERATION)
     if ((compileOptions & SH_GENERATE_SPIRV_DIRECTLY) != 0)
     {
@@ -25,68 +25,9 @@ void LoadA8ToRGBA8(size_t width,
                    size_t outputRowPitch,
                    size_t outputDepthPitch)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
-    {
-        __m128i zeroWide = _mm_setzero_si128();
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint8_t *source =
-                    priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0 && x < width); x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-
-                for (; x + 7 < width; x += 8)
-                {
-                    __m128i sourceData =
-                        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Interleave each byte to 16bit, make the lower byte to zero
-                    sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
-                    // Interleave each 16bit to 32bit, make the lower 16bit to zero
-                    __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
-                    __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
-
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
-                }
-
-                // Handle the remainder
-                for (; x < width; x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint8_t *source =
-                priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint32_t *dest =
-                priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = static_cast<uint32_t>(source[x]) << 24;
-            }
-        }
-    }
+    priv::LoadRows(GetFastestLoadImageRowFunction(LoadImageConversion::A8ToRGBA8), width, height,
+                   depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                   outputDepthPitch);
 }
 
 void LoadA8ToBGRA8(size_t width,
@@ -172,24 +113,9 @@ void LoadL8ToRGBA8(size_t width,
                    size_t outputRowPitch,
                    size_t outputDepthPitch)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint8_t *source =
-                priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint8_t *dest =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                uint8_t sourceVal = source[x];
-                dest[4 * x + 0]   = sourceVal;
-                dest[4 * x + 1]   = sourceVal;
-                dest[4 * x + 2]   = sourceVal;
-                dest[4 * x + 3]   = 0xFF;
-            }
-        }
-    }
+    priv::LoadRows(GetFastestLoadImageRowFunction(LoadImageConversion::L8ToRGBA8), width, height,
+                   depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                   outputDepthPitch);
 }
 
 void LoadL8ToBGRA8(size_t width,
@@ -275,23 +201,9 @@ void LoadLA8ToRGBA8(size_t width,
                     size_t outputRowPitch,
                     size_t outputDepthPitch)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint8_t *source =
-                priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint8_t *dest =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[4 * x + 0] = source[2 * x + 0];
-                dest[4 * x + 1] = source[2 * x + 0];
-                dest[4 * x + 2] = source[2 * x + 0];
-                dest[4 * x + 3] = source[2 * x + 1];
-            }
-        }
-    }
+    priv::LoadRows(GetFastestLoadImageRowFunction(LoadImageConversion::LA8ToRGBA8), width, height,
+                   depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                   outputDepthPitch);
 }
 
 void LoadLA8ToBGRA8(size_t width,
@@ -441,23 +353,9 @@ void LoadRGB8ToBGRX8(size_t width,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint8_t *source =
-                priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint8_t *dest =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[4 * x + 0] = source[x * 3 + 2];
-                dest[4 * x + 1] = source[x * 3 + 1];
-                dest[4 * x + 2] = source[x * 3 + 0];
-                dest[4 * x + 3] = 0xFF;
-            }
-        }
-    }
+    priv::LoadRows(GetFastestLoadImageRowFunction(LoadImageConversion::RGB8ToBGRX8), width, height,
+                   depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                   outputDepthPitch);
 }
 
 void LoadRG8ToBGRX8(size_t width,
@@ -594,73 +492,9 @@ void LoadRGBA8ToBGRA8(size_t width,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
-    {
-        __m128i brMask = _mm_set1_epi32(0x00ff00ff);
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint32_t *source =
-                    priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0) && x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-
-                for (; x + 3 < width; x += 4)
-                {
-                    __m128i sourceData =
-                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Mask out g and a, which don't change
-                    __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                    // Mask out b and r
-                    __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                    // Swap b and r
-                    __m128i brSwapped = _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
-                        _MM_SHUFFLE(2, 3, 0, 1));
-                    __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
-                }
-
-                // Perform leftover writes
-                for (; x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint32_t *source =
-                priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint32_t *dest =
-                priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                uint32_t rgba = source[x];
-                dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-            }
-        }
-    }
+    priv::LoadRows(GetFastestLoadImageRowFunction(LoadImageConversion::RGBA8ToBGRA8), width, height,
+                   depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                   outputDepthPitch);
 }
 
 void LoadRGBA8ToBGRA4(size_t width,
@@ -1147,24 +981,9 @@ void LoadRGB10A2ToRGBA8(size_t width,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint32_t *source =
-                priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint8_t *dest =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                uint32_t rgba   = source[x];
-                dest[4 * x + 0] = static_cast<uint8_t>((rgba & 0x000003FF) >> 2);
-                dest[4 * x + 1] = static_cast<uint8_t>((rgba & 0x000FFC00) >> 12);
-                dest[4 * x + 2] = static_cast<uint8_t>((rgba & 0x3FF00000) >> 22);
-                dest[4 * x + 3] = static_cast<uint8_t>(((rgba & 0xC0000000) >> 30) * 0x55);
-            }
-        }
-    }
+    priv::LoadRows(GetFastestLoadImageRowFunction(LoadImageConversion::RGB10A2ToRGBA8), width,
+                   height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                   outputDepthPitch);
 }
 
 void LoadRGB10A2ToRGB10X2(size_t width,
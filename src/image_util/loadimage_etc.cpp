@@ -64,6 +64,9 @@ struct ETC2Block
                                    size_t destRowPitch,
                                    bool isSigned) const
     {
+        int values[kNumPixelsInBlock];
+        getSingleETC2Channel(isSigned, values);
+
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint8_t *row = dest + (j * destRowPitch);
@@ -72,11 +75,11 @@ struct ETC2Block
                 uint8_t *pixel = row + (i * destPixelStride);
                 if (isSigned)
                 {
-                    *pixel = clampSByte(getSingleETC2Channel(i, j, isSigned));
+                    *pixel = clampSByte(values[j * 4 + i]);
                 }
                 else
                 {
-                    *pixel = clampByte(getSingleETC2Channel(i, j, isSigned));
+                    *pixel = clampByte(values[j * 4 + i]);
                 }
             }
         }
@@ -93,6 +96,9 @@ struct ETC2Block
                                   bool isSigned,
                                   bool isFloat) const
     {
+        int values[kNumPixelsInBlock];
+        getSingleEACChannel(isSigned, values);
+
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint16_t *row = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(dest) +
@@ -102,15 +108,13 @@ struct ETC2Block
                 uint16_t *pixel = row + (i * destPixelStride);
                 if (isSigned)
                 {
-                    int16_t tempPixel =
-                        renormalizeEAC<int16_t>(getSingleEACChannel(i, j, isSigned));
+                    int16_t tempPixel = renormalizeEAC<int16_t>(values[j * 4 + i]);
                     *pixel =
                         isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
                 }
                 else
                 {
-                    uint16_t tempPixel =
-                        renormalizeEAC<uint16_t>(getSingleEACChannel(i, j, isSigned));
+                    uint16_t tempPixel = renormalizeEAC<uint16_t>(values[j * 4 + i]);
                     *pixel =
                         isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
                 }
@@ -207,6 +211,19 @@ struct ETC2Block
         }
     }
 
+    // Transcodes single channel block to BC4, from the same 8-bit values it decodes to
+    void transcodeSingleETC2ChannelAsBC4(uint8_t *dest, bool isSigned) const
+    {
+        int values[kNumPixelsInBlock];
+        getSingleETC2Channel(isSigned, values);
+        for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
+        {
+            values[pixel] = isSigned ? clampSByte(values[pixel]) : clampByte(values[pixel]);
+        }
+
+        packBC4(dest, values);
+    }
+
   private:
     union
     {
@@ -476,64 +493,34 @@ struct ETC2Block
         const IntensityModifier *intensityModifier =
             nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque : intensityModifierDefault;
 
-        R8G8B8A8 subblockColors0[4];
-        R8G8B8A8 subblockColors1[4];
+        // The colors of the first subblock followed by the colors of the second one.
+        R8G8B8A8 subblockColors[8];
         for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
         {
-            const int i1                 = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
-            subblockColors0[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
+            const int i1                = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
+            subblockColors[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
 
-            const int i2                 = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
-            subblockColors1[modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
+            const int i2                    = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
+            subblockColors[4 + modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
         }
 
-        if (u.idht.mode.idm.flipbit)
-        {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 2 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-            for (size_t j = 2; j < 4 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-        }
-        else
+        // The subblocks are the top and bottom halves of the block when flipped, and the left and
+        // right halves otherwise.
+        uint8_t indices[kNumPixelsInBlock];
+        getIndices(indices);
+
+        R8G8B8A8 pixels[kNumPixelsInBlock];
+        for (size_t j = 0; j < 4; j++)
         {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 4 && (y + j) < h; j++)
+            for (size_t i = 0; i < 4; i++)
             {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 2 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                for (size_t i = 2; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
+                const size_t subblock = u.idht.mode.idm.flipbit ? j / 2 : i / 2;
+                pixels[j * 4 + i]     = subblockColors[subblock * 4 + indices[j * 4 + i]];
             }
         }
-        if (nonOpaquePunchThroughAlpha)
-        {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
-        }
+
+        writeRGBABlock(dest, x, y, w, h, destRowPitch, indices, alphaValues,
+                       nonOpaquePunchThroughAlpha, pixels);
     }
 
     void decodeTBlock(uint8_t *dest,
@@ -565,22 +552,8 @@ struct ETC2Block
             createRGBA(r2 - d, g2 - d, b2 - d),
         };
 
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
-
-        if (nonOpaquePunchThroughAlpha)
-        {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
-        }
+        decodePaintColors(dest, x, y, w, h, destRowPitch, paintColors, alphaValues,
+                          nonOpaquePunchThroughAlpha);
     }
 
     void decodeHBlock(uint8_t *dest,
@@ -614,22 +587,31 @@ struct ETC2Block
             createRGBA(r2 - d, g2 - d, b2 - d),
         };
 
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
+        decodePaintColors(dest, x, y, w, h, destRowPitch, paintColors, alphaValues,
+                          nonOpaquePunchThroughAlpha);
+    }
 
-        if (nonOpaquePunchThroughAlpha)
+    void decodePaintColors(uint8_t *dest,
+                           size_t x,
+                           size_t y,
+                           size_t w,
+                           size_t h,
+                           size_t destRowPitch,
+                           const R8G8B8A8 paintColors[4],
+                           const uint8_t alphaValues[4][4],
+                           bool nonOpaquePunchThroughAlpha) const
+    {
+        uint8_t indices[kNumPixelsInBlock];
+        getIndices(indices);
+
+        R8G8B8A8 pixels[kNumPixelsInBlock];
+        for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
         {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
+            pixels[pixel] = paintColors[indices[pixel]];
         }
+
+        writeRGBABlock(dest, x, y, w, h, destRowPitch, indices, alphaValues,
+                       nonOpaquePunchThroughAlpha, pixels);
     }
 
     void decodePlanarBlock(uint8_t *dest,
@@ -651,23 +633,21 @@ struct ETC2Block
         int gv = extend_7to8bits(u.pblk.GVa << 2 | u.pblk.GVb);
         int bv = extend_6to8bits(u.pblk.BV);
 
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        R8G8B8A8 pixels[kNumPixelsInBlock];
+        for (size_t j = 0; j < 4; j++)
         {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-
             int ry = static_cast<int>(j) * (rv - ro) + 2;
             int gy = static_cast<int>(j) * (gv - go) + 2;
             int by = static_cast<int>(j) * (bv - bo) + 2;
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            for (size_t i = 0; i < 4; i++)
             {
-                row[i] = createRGBA(((static_cast<int>(i) * (rh - ro) + ry) >> 2) + ro,
-                                    ((static_cast<int>(i) * (gh - go) + gy) >> 2) + go,
-                                    ((static_cast<int>(i) * (bh - bo) + by) >> 2) + bo,
-                                    alphaValues[j][i]);
+                pixels[j * 4 + i] = createRGBA(((static_cast<int>(i) * (rh - ro) + ry) >> 2) + ro,
+                                               ((static_cast<int>(i) * (gh - go) + gy) >> 2) + go,
+                                               ((static_cast<int>(i) * (bh - bo) + by) >> 2) + bo);
             }
-            curPixel += pitch;
         }
+
+        writeRGBABlock(dest, x, y, w, h, pitch, nullptr, alphaValues, false, pixels);
     }
 
     // Index for individual, differential, H and T modes
@@ -680,25 +660,105 @@ struct ETC2Block
         return (msb << 1) | lsb;
     }
 
-    void decodePunchThroughAlphaBlock(uint8_t *dest,
-                                      size_t x,
-                                      size_t y,
-                                      size_t w,
-                                      size_t h,
-                                      size_t destRowPitch) const
+    // Indices of all the pixels for individual, differential, H and T modes, in row-major order.
+    // The pixel indices are stored in column-major order, so the index of pixel (x, y) is at bit
+    // x * 4 + y of each of the two 16-bit big-endian words.
+    void getIndices(uint8_t indices[kNumPixelsInBlock]) const
     {
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        const uint32_t lsbs = u.idht.pixelIndexLSB[0] << 8 | u.idht.pixelIndexLSB[1];
+        const uint32_t msbs = u.idht.pixelIndexMSB[0] << 8 | u.idht.pixelIndexMSB[1];
+        for (size_t j = 0; j < 4; j++)
         {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            for (size_t i = 0; i < 4; i++)
+            {
+                const size_t bitIndex = i * 4 + j;
+                indices[j * 4 + i] =
+                    static_cast<uint8_t>(((msbs >> bitIndex) & 1) << 1 | ((lsbs >> bitIndex) & 1));
+            }
+        }
+    }
+
+    // Applies the alpha values and the punchthrough alpha to the decoded block, and writes the
+    // part of it that is inside the image.  Whole blocks are written a row of 4 pixels at a time.
+    static void writeRGBABlock(uint8_t *dest,
+                               size_t x,
+                               size_t y,
+                               size_t w,
+                               size_t h,
+                               size_t destRowPitch,
+                               const uint8_t *indices,
+                               const uint8_t alphaValues[4][4],
+                               bool nonOpaquePunchThroughAlpha,
+                               R8G8B8A8 pixels[kNumPixelsInBlock])
+    {
+        for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
+        {
+            pixels[pixel].A = alphaValues[pixel / 4][pixel % 4];
+        }
+
+        if (nonOpaquePunchThroughAlpha)
+        {
+            for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
             {
-                if (getIndex(i, j) == 2)  //  msb == 1 && lsb == 0
+                if (indices[pixel] == 2)  //  msb == 1 && lsb == 0
                 {
-                    row[i] = createRGBA(0, 0, 0, 0);
+                    pixels[pixel] = createRGBA(0, 0, 0, 0);
                 }
             }
-            curPixel += destRowPitch;
+        }
+
+        if (x + 4 <= w && y + 4 <= h)
+        {
+            for (size_t j = 0; j < 4; j++)
+            {
+                memcpy(dest + j * destRowPitch, &pixels[j * 4], 4 * sizeof(R8G8B8A8));
+            }
+            return;
+        }
+
+        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        {
+            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(dest + j * destRowPitch);
+            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            {
+                row[i] = pixels[j * 4 + i];
+            }
+        }
+    }
+
+    // Uses the extremes of the block as the endpoints, which makes BC4 interpolate 6 values
+    // between them, and picks the closest of the 8 values for each pixel.
+    static void packBC4(uint8_t *bc4, const int values[kNumPixelsInBlock])
+    {
+        int minValue = values[0];
+        int maxValue = values[0];
+        for (size_t pixel = 1; pixel < kNumPixelsInBlock; pixel++)
+        {
+            minValue = std::min(minValue, values[pixel]);
+            maxValue = std::max(maxValue, values[pixel]);
+        }
+
+        // Code 0 is the first endpoint, which is all that's needed when both are the same.
+        uint64_t bits = 0;
+        if (maxValue > minValue)
+        {
+            const int range = maxValue - minValue;
+            for (int pixel = kNumPixelsInBlock - 1; pixel >= 0; pixel--)
+            {
+                // Position of the value from the second endpoint to the first one, in sevenths.
+                // Codes 0 and 1 are the endpoints, and codes 2 to 7 the values in between,
+                // starting from the first endpoint.
+                const int step = ((values[pixel] - minValue) * 14 + range) / (2 * range);
+                const int code = step == 7 ? 0 : (step == 0 ? 1 : 8 - step);
+                bits           = bits << 3 | static_cast<uint64_t>(code);
+            }
+        }
+
+        bc4[0] = static_cast<uint8_t>(maxValue);
+        bc4[1] = static_cast<uint8_t>(minValue);
+        for (size_t byte = 0; byte < 6; byte++)
+        {
+            bc4[2 + byte] = static_cast<uint8_t>(bits >> (byte * 8));
         }
     }
 
@@ -1317,8 +1377,10 @@ struct ETC2Block
     {
         static const size_t kNumColors = kNumPixelsInBlock;
 
+        // Decode the whole block, including the pixels outside of the image, so that all the
+        // colors are initialized.
         R8G8B8A8 rgbaBlock[kNumColors];
-        decodePlanarBlock(reinterpret_cast<uint8_t *>(rgbaBlock), x, y, w, h, sizeof(R8G8B8A8) * 4,
+        decodePlanarBlock(reinterpret_cast<uint8_t *>(rgbaBlock), 0, 0, 4, 4, sizeof(R8G8B8A8) * 4,
                           alphaValues);
 
         // Planar block doesn't have a color table, fill indices as full
@@ -1333,49 +1395,33 @@ struct ETC2Block
                 maxColorIndex, false);
     }
 
-    // Single channel utility functions
-    int getSingleEACChannel(size_t x, size_t y, bool isSigned) const
+    // Single channel utility functions, which decode all the pixels in row-major order.
+    void getSingleEACChannel(bool isSigned, int values[kNumPixelsInBlock]) const
     {
         int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
         int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
-        return codeword * 8 + 4 + getSingleChannelModifier(x, y) * multiplier;
-    }
 
-    int getSingleETC2Channel(size_t x, size_t y, bool isSigned) const
-    {
-        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
+        int modifiers[kNumPixelsInBlock];
+        getSingleChannelModifiers(modifiers);
+        for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
+        {
+            values[pixel] = codeword * 8 + 4 + modifiers[pixel] * multiplier;
+        }
     }
 
-    int getSingleChannelIndex(size_t x, size_t y) const
+    void getSingleETC2Channel(bool isSigned, int values[kNumPixelsInBlock]) const
     {
-        ASSERT(x < 4 && y < 4);
+        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
 
-        // clang-format off
-        switch (x * 4 + y)
+        int modifiers[kNumPixelsInBlock];
+        getSingleChannelModifiers(modifiers);
+        for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
         {
-            case 0: return u.scblk.ma;
-            case 1: return u.scblk.mb;
-            case 2: return u.scblk.mc1 << 1 | u.scblk.mc2;
-            case 3: return u.scblk.md;
-            case 4: return u.scblk.me;
-            case 5: return u.scblk.mf1 << 2 | u.scblk.mf2;
-            case 6: return u.scblk.mg;
-            case 7: return u.scblk.mh;
-            case 8: return u.scblk.mi;
-            case 9: return u.scblk.mj;
-            case 10: return u.scblk.mk1 << 1 | u.scblk.mk2;
-            case 11: return u.scblk.ml;
-            case 12: return u.scblk.mm;
-            case 13: return u.scblk.mn1 << 2 | u.scblk.mn2;
-            case 14: return u.scblk.mo;
-            case 15: return u.scblk.mp;
-            default: UNREACHABLE(); return 0;
+            values[pixel] = codeword + modifiers[pixel] * u.scblk.multiplier;
         }
-        // clang-format on
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    void getSingleChannelModifiers(int modifiers[kNumPixelsInBlock]) const
     {
         // clang-format off
         static const int modifierTable[16][8] =
@@ -1399,7 +1445,24 @@ struct ETC2Block
         };
         // clang-format on
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        // The last 6 bytes of the block are a big-endian 48-bit word of 3-bit indices, stored in
+        // column-major order with the first pixel in the most significant bits.
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&u.scblk);
+        uint64_t indexBits   = 0;
+        for (size_t byte = 2; byte < 8; byte++)
+        {
+            indexBits = indexBits << 8 | bytes[byte];
+        }
+
+        const int *modifierRow = modifierTable[u.scblk.table_index];
+        for (size_t j = 0; j < 4; j++)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                const size_t shift   = 45 - 3 * (i * 4 + j);
+                modifiers[j * 4 + i] = modifierRow[(indexBits >> shift) & 7];
+            }
+        }
     }
 };
 
@@ -1653,6 +1716,71 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
     }
 }
 
+void LoadR11EACToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch,
+                     bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlock = sourceRow + (x / 4);
+                uint8_t *destPixels          = destRow + (x * 2);
+
+                sourceBlock->transcodeSingleETC2ChannelAsBC4(destPixels, isSigned);
+            }
+        }
+    }
+}
+
+void LoadRG11EACToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch,
+                      bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+                uint8_t *destPixelsRed          = destRow + (x * 4);
+                sourceBlockRed->transcodeSingleETC2ChannelAsBC4(destPixelsRed, isSigned);
+
+                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+                uint8_t *destPixelsGreen          = destPixelsRed + 8;
+                sourceBlockGreen->transcodeSingleETC2ChannelAsBC4(destPixelsGreen, isSigned);
+            }
+        }
+    }
+}
+
 }  // anonymous namespace
 
 void LoadETC1RGB8ToRGBA8(size_t width,
@@ -1991,4 +2119,111 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                          outputRowPitch, outputDepthPitch, true);
 }
 
+
+void LoadEACR11ToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACR11SToBC4(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, true);
+}
+
+void LoadEACRG11ToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACRG11SToBC5(size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, true);
+}
+
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                // The alpha block of BC3 has the layout of a BC4 block, and its color block is
+                // always decoded as an opaque BC1 block.
+                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+                uint8_t *destPixelsAlpha          = destRow + (x * 4);
+                sourceBlockAlpha->transcodeSingleETC2ChannelAsBC4(destPixelsAlpha, false);
+
+                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+                uint8_t *destPixelsRGB          = destPixelsAlpha + 8;
+                sourceBlockRGB->transcodeAsBC1(destPixelsRGB, x, y, width, height,
+                                               DefaultETCAlphaValues, false);
+            }
+        }
+    }
+}
+
+void LoadETC2SRGBA8ToBC3(size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch);
+}
+
 }  // namespace angle
@@ -0,0 +1,211 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_etc_unittest.cpp: Unit tests for the ETC and EAC decoding and transcoding.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "image_util/loadimage.h"
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kWidth      = 18;
+constexpr size_t kHeight     = 10;
+constexpr size_t kBlocksWide = (kWidth + 3) / 4;
+constexpr size_t kBlocksHigh = (kHeight + 3) / 4;
+constexpr uint8_t kGuardByte = 0xCD;
+
+std::vector<uint8_t> MakeRandomBlocks(size_t blockSize, uint32_t seed)
+{
+    std::mt19937 random(seed);
+    std::vector<uint8_t> blocks(kBlocksWide * kBlocksHigh * blockSize);
+    for (uint8_t &byte : blocks)
+    {
+        byte = static_cast<uint8_t>(random());
+    }
+    return blocks;
+}
+
+// Decodes a BC4 block, or the alpha block of BC3.
+void DecodeBC4Block(const uint8_t *block, bool isSigned, int values[16])
+{
+    const int r0 = isSigned ? static_cast<int8_t>(block[0]) : block[0];
+    const int r1 = isSigned ? static_cast<int8_t>(block[1]) : block[1];
+
+    int palette[8] = {r0, r1};
+    if (r0 > r1)
+    {
+        for (int code = 2; code < 8; ++code)
+        {
+            palette[code] = ((8 - code) * r0 + (code - 1) * r1 + 3) / 7;
+        }
+    }
+    else
+    {
+        for (int code = 2; code < 6; ++code)
+        {
+            palette[code] = ((6 - code) * r0 + (code - 1) * r1 + 2) / 5;
+        }
+        palette[6] = isSigned ? -127 : 0;
+        palette[7] = isSigned ? 127 : 255;
+    }
+
+    uint64_t bits = 0;
+    for (int byte = 7; byte >= 2; --byte)
+    {
+        bits = bits << 8 | block[byte];
+    }
+    for (int pixel = 0; pixel < 16; ++pixel)
+    {
+        values[pixel] = palette[(bits >> (3 * pixel)) & 7];
+    }
+}
+
+// Checks that a channel transcoded to BC4 is within half an interpolation step of the channel
+// decoded to 8 bits, give or take the rounding of the interpolation.
+void CheckBC4Channel(const std::vector<uint8_t> &decoded,
+                     size_t decodedPixelStride,
+                     const std::vector<uint8_t> &transcoded,
+                     size_t transcodedBlockStride,
+                     bool isSigned)
+{
+    for (size_t blockY = 0; blockY < kBlocksHigh; ++blockY)
+    {
+        for (size_t blockX = 0; blockX < kBlocksWide; ++blockX)
+        {
+            int values[16];
+            DecodeBC4Block(&transcoded[(blockY * kBlocksWide + blockX) * transcodedBlockStride],
+                           isSigned, values);
+
+            int expected[16];
+            int count = 0;
+            for (size_t y = blockY * 4; y < std::min(blockY * 4 + 4, kHeight); ++y)
+            {
+                for (size_t x = blockX * 4; x < std::min(blockX * 4 + 4, kWidth); ++x)
+                {
+                    const uint8_t byte = decoded[(y * kWidth + x) * decodedPixelStride];
+                    expected[count++]  = isSigned ? static_cast<int8_t>(byte) : byte;
+                }
+            }
+
+            const int range = *std::max_element(expected, expected + count) -
+                              *std::min_element(expected, expected + count);
+
+            count = 0;
+            for (size_t y = 0; y < 4 && blockY * 4 + y < kHeight; ++y)
+            {
+                for (size_t x = 0; x < 4 && blockX * 4 + x < kWidth; ++x)
+                {
+                    EXPECT_LE(std::abs(values[y * 4 + x] - expected[count++]), range / 14 + 2)
+                        << "block " << blockX << ", " << blockY << " pixel " << x << ", " << y;
+                }
+            }
+        }
+    }
+}
+
+// Test that the EAC R11 and RG11 transcodes to BC4 and BC5 match the decode to 8-bit channels.
+TEST(LoadImageETC, EACToBC4AndBC5)
+{
+    for (bool isSigned : {false, true})
+    {
+        std::vector<uint8_t> r11 = MakeRandomBlocks(8, 1);
+        std::vector<uint8_t> r8(kWidth * kHeight);
+        std::vector<uint8_t> bc4(kBlocksWide * kBlocksHigh * 8);
+        (isSigned ? LoadEACR11SToR8 : LoadEACR11ToR8)(kWidth, kHeight, 1, r11.data(),
+                                                      kBlocksWide * 8, 0, r8.data(), kWidth, 0);
+        (isSigned ? LoadEACR11SToBC4 : LoadEACR11ToBC4)(kWidth, kHeight, 1, r11.data(),
+                                                        kBlocksWide * 8, 0, bc4.data(),
+                                                        kBlocksWide * 8, 0);
+        CheckBC4Channel(r8, 1, bc4, 8, isSigned);
+
+        std::vector<uint8_t> rg11 = MakeRandomBlocks(16, 2);
+        std::vector<uint8_t> rg8(kWidth * kHeight * 2);
+        std::vector<uint8_t> bc5(kBlocksWide * kBlocksHigh * 16);
+        (isSigned ? LoadEACRG11SToRG8 : LoadEACRG11ToRG8)(kWidth, kHeight, 1, rg11.data(),
+                                                          kBlocksWide * 16, 0, rg8.data(),
+                                                          kWidth * 2, 0);
+        (isSigned ? LoadEACRG11SToBC5 : LoadEACRG11ToBC5)(kWidth, kHeight, 1, rg11.data(),
+                                                          kBlocksWide * 16, 0, bc5.data(),
+                                                          kBlocksWide * 16, 0);
+        CheckBC4Channel(rg8, 2, bc5, 16, isSigned);
+        CheckBC4Channel(std::vector<uint8_t>(rg8.begin() + 1, rg8.end()), 2,
+                        std::vector<uint8_t>(bc5.begin() + 8, bc5.end()), 16, isSigned);
+    }
+}
+
+// Test that the ETC2 RGBA8 transcode to BC3 has the alpha of the decode to RGBA8 and the color of
+// the transcode of the RGB block to BC1.
+TEST(LoadImageETC, ETC2RGBA8ToBC3)
+{
+    std::vector<uint8_t> etc2 = MakeRandomBlocks(16, 3);
+
+    std::vector<uint8_t> rgba8(kWidth * kHeight * 4);
+    std::vector<uint8_t> bc3(kBlocksWide * kBlocksHigh * 16);
+    LoadETC2RGBA8ToRGBA8(kWidth, kHeight, 1, etc2.data(), kBlocksWide * 16, 0, rgba8.data(),
+                         kWidth * 4, 0);
+    LoadETC2RGBA8ToBC3(kWidth, kHeight, 1, etc2.data(), kBlocksWide * 16, 0, bc3.data(),
+                       kBlocksWide * 16, 0);
+
+    CheckBC4Channel(std::vector<uint8_t>(rgba8.begin() + 3, rgba8.end()), 4, bc3, 16, false);
+
+    // The RGB blocks without their alpha blocks.
+    std::vector<uint8_t> rgbBlocks;
+    for (size_t block = 0; block < kBlocksWide * kBlocksHigh; ++block)
+    {
+        rgbBlocks.insert(rgbBlocks.end(), etc2.begin() + block * 16 + 8,
+                         etc2.begin() + block * 16 + 16);
+    }
+
+    std::vector<uint8_t> bc1(kBlocksWide * kBlocksHigh * 8);
+    LoadETC2RGB8ToBC1(kWidth, kHeight, 1, rgbBlocks.data(), kBlocksWide * 8, 0, bc1.data(),
+                      kBlocksWide * 8, 0);
+    for (size_t block = 0; block < kBlocksWide * kBlocksHigh; ++block)
+    {
+        EXPECT_TRUE(std::equal(bc1.begin() + block * 8, bc1.begin() + block * 8 + 8,
+                               bc3.begin() + block * 16 + 8))
+            << "block " << block;
+    }
+}
+
+// Test that decoding blocks that cross the edges of the image doesn't write outside of it.
+TEST(LoadImageETC, PartialBlocksStayInImage)
+{
+    constexpr size_t kOutputRowPitch = kWidth * 4 + 4;
+
+    std::vector<uint8_t> etc2 = MakeRandomBlocks(8, 4);
+    std::vector<uint8_t> rgba8(kOutputRowPitch * (kHeight + 1), kGuardByte);
+    LoadETC2RGB8ToRGBA8(kWidth, kHeight, 1, etc2.data(), kBlocksWide * 8, 0, rgba8.data(),
+                        kOutputRowPitch, 0);
+
+    for (size_t y = 0; y < kHeight + 1; ++y)
+    {
+        for (size_t x = 0; x < kOutputRowPitch; ++x)
+        {
+            const bool inImage = y < kHeight && x < kWidth * 4;
+            if (inImage)
+            {
+                // RGB8 is always opaque.
+                if (x % 4 == 3)
+                {
+                    EXPECT_EQ(255u, rgba8[y * kOutputRowPitch + x]);
+                }
+            }
+            else
+            {
+                EXPECT_EQ(kGuardByte, rgba8[y * kOutputRowPitch + x]) << x << ", " << y;
+            }
+        }
+    }
+}
+}  // anonymous namespace
+}  // namespace angle
@@ -0,0 +1,850 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_simd.cpp: Vectorized row conversions used by the hottest image loading functions.
+//
+// Every vector kernel converts as many whole vectors as fit in the row and hands the rest to the
+// scalar kernel, which is the reference implementation.  The kernels never read or write outside
+// of the row.
+
+#include "image_util/loadimage_simd.h"
+
+#include "common/PackedEnums.h"
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/platform.h"
+
+#if defined(ANGLE_USE_SSE) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define ANGLE_LOAD_IMAGE_SSE2 1
+#    define ANGLE_LOAD_IMAGE_SSSE3 1
+#    define ANGLE_LOAD_IMAGE_AVX2 1
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        define ANGLE_SSSE3_TARGET
+#        define ANGLE_AVX2_TARGET
+#    else
+#        define ANGLE_SSSE3_TARGET __attribute__((target("ssse3")))
+#        define ANGLE_AVX2_TARGET __attribute__((target("avx2")))
+#    endif
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_LOAD_IMAGE_NEON 1
+#endif
+
+namespace angle
+{
+namespace
+{
+// The scalar kernels match the loops the load functions used before they were vectorized.
+void LoadA8ToRGBA8Scalar(size_t count, const uint8_t *source, uint8_t *destBytes)
+{
+    uint32_t *dest = reinterpret_cast<uint32_t *>(destBytes);
+    for (size_t x = 0; x < count; x++)
+    {
+        dest[x] = static_cast<uint32_t>(source[x]) << 24;
+    }
+}
+
+void LoadL8ToRGBA8Scalar(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    for (size_t x = 0; x < count; x++)
+    {
+        uint8_t sourceVal = source[x];
+        dest[4 * x + 0]   = sourceVal;
+        dest[4 * x + 1]   = sourceVal;
+        dest[4 * x + 2]   = sourceVal;
+        dest[4 * x + 3]   = 0xFF;
+    }
+}
+
+void LoadLA8ToRGBA8Scalar(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    for (size_t x = 0; x < count; x++)
+    {
+        dest[4 * x + 0] = source[2 * x + 0];
+        dest[4 * x + 1] = source[2 * x + 0];
+        dest[4 * x + 2] = source[2 * x + 0];
+        dest[4 * x + 3] = source[2 * x + 1];
+    }
+}
+
+void LoadRGB8ToRGBA8Scalar(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    for (size_t x = 0; x < count; x++)
+    {
+        dest[4 * x + 0] = source[x * 3 + 0];
+        dest[4 * x + 1] = source[x * 3 + 1];
+        dest[4 * x + 2] = source[x * 3 + 2];
+        dest[4 * x + 3] = 0xFF;
+    }
+}
+
+void LoadRGB8ToBGRX8Scalar(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    for (size_t x = 0; x < count; x++)
+    {
+        dest[4 * x + 0] = source[x * 3 + 2];
+        dest[4 * x + 1] = source[x * 3 + 1];
+        dest[4 * x + 2] = source[x * 3 + 0];
+        dest[4 * x + 3] = 0xFF;
+    }
+}
+
+void LoadRGBA8ToBGRA8Scalar(size_t count, const uint8_t *sourceBytes, uint8_t *destBytes)
+{
+    const uint32_t *source = reinterpret_cast<const uint32_t *>(sourceBytes);
+    uint32_t *dest         = reinterpret_cast<uint32_t *>(destBytes);
+    for (size_t x = 0; x < count; x++)
+    {
+        uint32_t rgba = source[x];
+        dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
+    }
+}
+
+void LoadRGB10A2ToRGBA8Scalar(size_t count, const uint8_t *sourceBytes, uint8_t *dest)
+{
+    const uint32_t *source = reinterpret_cast<const uint32_t *>(sourceBytes);
+    for (size_t x = 0; x < count; x++)
+    {
+        uint32_t rgba   = source[x];
+        dest[4 * x + 0] = static_cast<uint8_t>((rgba & 0x000003FF) >> 2);
+        dest[4 * x + 1] = static_cast<uint8_t>((rgba & 0x000FFC00) >> 12);
+        dest[4 * x + 2] = static_cast<uint8_t>((rgba & 0x3FF00000) >> 22);
+        dest[4 * x + 3] = static_cast<uint8_t>(((rgba & 0xC0000000) >> 30) * 0x55);
+    }
+}
+
+void LoadR32FToR16FScalar(size_t count, const uint8_t *sourceBytes, uint8_t *destBytes)
+{
+    const float *source = reinterpret_cast<const float *>(sourceBytes);
+    uint16_t *dest      = reinterpret_cast<uint16_t *>(destBytes);
+    for (size_t x = 0; x < count; x++)
+    {
+        dest[x] = gl::float32ToFloat16(source[x]);
+    }
+}
+
+#if defined(ANGLE_LOAD_IMAGE_SSE2) || defined(ANGLE_LOAD_IMAGE_NEON)
+// The vector versions of gl::float32ToFloat16 compute every case of the conversion on all lanes
+// and select the result of each lane with these masks.
+constexpr uint32_t kFloat32AbsMask      = 0x7FFFFFFF;
+constexpr uint32_t kFloat32MaxNormal16  = 0x47FFEFFF;
+constexpr uint32_t kFloat32MinNormal16  = 0x38800000;
+constexpr uint32_t kFloat32Infinity     = 0x7F800000;
+constexpr uint32_t kFloat16NaN          = 0x7FFF;
+constexpr uint32_t kFloat16Infinity     = 0x7C00;
+constexpr uint32_t kFloat16NormalBias   = 0xC8000000 + 0x00000FFF;
+constexpr uint32_t kFloat16RoundingBias = 0x00000FFF;
+#endif  // defined(ANGLE_LOAD_IMAGE_SSE2) || defined(ANGLE_LOAD_IMAGE_NEON)
+
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+// Floats below this are flushed to a signed zero by the denormal path of float32ToFloat16.
+constexpr uint32_t kFloat32MinDenormal16 = 90 << 23;
+
+__m128i Select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+void LoadA8ToRGBA8SSE2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        __m128i alpha = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+        // Interleave each byte to 16bit, make the lower byte to zero
+        __m128i lo = _mm_unpacklo_epi8(zero, alpha);
+        __m128i hi = _mm_unpackhi_epi8(zero, alpha);
+
+        // Interleave each 16bit to 32bit, make the lower 16bit to zero
+        __m128i *out = reinterpret_cast<__m128i *>(dest + 4 * x);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(zero, lo));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(zero, lo));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(zero, hi));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(zero, hi));
+    }
+
+    LoadA8ToRGBA8Scalar(count - x, source + x, dest + 4 * x);
+}
+
+void LoadL8ToRGBA8SSE2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i opaque = _mm_set1_epi8(-1);
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        __m128i luminance = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+        // LL and LA pairs, interleaved again to LLLA.
+        __m128i llLo = _mm_unpacklo_epi8(luminance, luminance);
+        __m128i llHi = _mm_unpackhi_epi8(luminance, luminance);
+        __m128i laLo = _mm_unpacklo_epi8(luminance, opaque);
+        __m128i laHi = _mm_unpackhi_epi8(luminance, opaque);
+
+        __m128i *out = reinterpret_cast<__m128i *>(dest + 4 * x);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(llLo, laLo));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(llLo, laLo));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(llHi, laHi));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(llHi, laHi));
+    }
+
+    LoadL8ToRGBA8Scalar(count - x, source + x, dest + 4 * x);
+}
+
+void LoadLA8ToRGBA8SSE2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i lowByteMask = _mm_set1_epi16(0x00FF);
+
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        __m128i la        = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 2 * x));
+        __m128i luminance = _mm_and_si128(la, lowByteMask);
+        __m128i ll        = _mm_or_si128(luminance, _mm_slli_epi16(luminance, 8));
+
+        __m128i *out = reinterpret_cast<__m128i *>(dest + 4 * x);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(ll, la));
+    }
+
+    LoadLA8ToRGBA8Scalar(count - x, source + 2 * x, dest + 4 * x);
+}
+
+void LoadRGBA8ToBGRA8SSE2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i brMask = _mm_set1_epi32(0x00ff00ff);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 4 * x));
+        // Mask out g and a, which don't change
+        __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+        // Mask out b and r
+        __m128i brComponents = _mm_and_si128(sourceData, brMask);
+        // Swap b and r
+        __m128i brSwapped =
+            _mm_shufflehi_epi16(_mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
+                                _MM_SHUFFLE(2, 3, 0, 1));
+        __m128i result = _mm_or_si128(gaComponents, brSwapped);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), result);
+    }
+
+    LoadRGBA8ToBGRA8Scalar(count - x, source + 4 * x, dest + 4 * x);
+}
+
+void LoadRGB10A2ToRGBA8SSE2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i redMask   = _mm_set1_epi32(0x000000FF);
+    const __m128i greenMask = _mm_set1_epi32(0x0000FF00);
+    const __m128i blueMask  = _mm_set1_epi32(0x00FF0000);
+    const __m128i alphaMul  = _mm_set1_epi32(0x55);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 4 * x));
+        // Keep the 8 most significant bits of every 10 bit component, already shifted to their
+        // final position.
+        __m128i red   = _mm_and_si128(_mm_srli_epi32(rgba, 2), redMask);
+        __m128i green = _mm_and_si128(_mm_srli_epi32(rgba, 4), greenMask);
+        __m128i blue  = _mm_and_si128(_mm_srli_epi32(rgba, 6), blueMask);
+        // The 2 bit alpha is at most 3, so the 16 bit multiply doesn't overflow.
+        __m128i alpha = _mm_slli_epi32(_mm_mullo_epi16(_mm_srli_epi32(rgba, 30), alphaMul), 24);
+
+        __m128i result = _mm_or_si128(_mm_or_si128(red, green), _mm_or_si128(blue, alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), result);
+    }
+
+    LoadRGB10A2ToRGBA8Scalar(count - x, source + 4 * x, dest + 4 * x);
+}
+
+// Returns false if a lane is a float16 denormal, which needs a variable shift that SSE2 lacks.
+bool Float32ToFloat16SSE2(__m128i value, __m128i *resultOut)
+{
+    __m128i abs = _mm_and_si128(value, _mm_set1_epi32(kFloat32AbsMask));
+
+    __m128i isDenormal =
+        _mm_and_si128(_mm_cmplt_epi32(abs, _mm_set1_epi32(kFloat32MinNormal16)),
+                      _mm_cmpgt_epi32(abs, _mm_set1_epi32(kFloat32MinDenormal16 - 1)));
+    if (_mm_movemask_epi8(isDenormal) != 0)
+    {
+        return false;
+    }
+
+    __m128i sign     = _mm_and_si128(_mm_srli_epi32(value, 16), _mm_set1_epi32(0x8000));
+    __m128i rounding = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    __m128i normal =
+        _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, _mm_set1_epi32(kFloat16NormalBias)),
+                                     rounding),
+                       13);
+
+    __m128i result = _mm_or_si128(sign, normal);
+    result = Select(_mm_cmplt_epi32(abs, _mm_set1_epi32(kFloat32MinNormal16)), sign, result);
+    result = Select(_mm_cmpgt_epi32(abs, _mm_set1_epi32(kFloat32MaxNormal16)),
+                    _mm_or_si128(sign, _mm_set1_epi32(kFloat16Infinity)), result);
+    result = Select(_mm_cmpgt_epi32(abs, _mm_set1_epi32(kFloat32Infinity)),
+                    _mm_set1_epi32(kFloat16NaN), result);
+
+    // Sign extend the 16 bit results so the signed saturating pack keeps them intact.
+    *resultOut = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+    return true;
+}
+
+void LoadR32FToR16FSSE2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        const __m128i *in = reinterpret_cast<const __m128i *>(source + 4 * x);
+        __m128i lo, hi;
+        if (Float32ToFloat16SSE2(_mm_loadu_si128(in), &lo) &&
+            Float32ToFloat16SSE2(_mm_loadu_si128(in + 1), &hi))
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 2 * x), _mm_packs_epi32(lo, hi));
+        }
+        else
+        {
+            LoadR32FToR16FScalar(8, source + 4 * x, dest + 2 * x);
+        }
+    }
+
+    LoadR32FToR16FScalar(count - x, source + 4 * x, dest + 2 * x);
+}
+#endif  // defined(ANGLE_LOAD_IMAGE_SSE2)
+
+#if defined(ANGLE_LOAD_IMAGE_SSSE3)
+// Expands 16 packed 3 byte pixels to 4 bytes per pixel with |shuffle|, which has to clear the
+// fourth byte of every pixel.
+ANGLE_SSSE3_TARGET void Load16RGB8PixelsSSSE3(const uint8_t *source,
+                                              uint8_t *dest,
+                                              __m128i shuffle,
+                                              __m128i fourthByte)
+{
+    const __m128i *in = reinterpret_cast<const __m128i *>(source);
+    __m128i a         = _mm_loadu_si128(in + 0);
+    __m128i b         = _mm_loadu_si128(in + 1);
+    __m128i c         = _mm_loadu_si128(in + 2);
+
+    // Bytes 0, 12, 24 and 36 of the source start groups of 4 pixels.
+    __m128i pixels0 = a;
+    __m128i pixels1 = _mm_alignr_epi8(b, a, 12);
+    __m128i pixels2 = _mm_alignr_epi8(c, b, 8);
+    __m128i pixels3 = _mm_srli_si128(c, 4);
+
+    __m128i *out = reinterpret_cast<__m128i *>(dest);
+    _mm_storeu_si128(out + 0, _mm_or_si128(_mm_shuffle_epi8(pixels0, shuffle), fourthByte));
+    _mm_storeu_si128(out + 1, _mm_or_si128(_mm_shuffle_epi8(pixels1, shuffle), fourthByte));
+    _mm_storeu_si128(out + 2, _mm_or_si128(_mm_shuffle_epi8(pixels2, shuffle), fourthByte));
+    _mm_storeu_si128(out + 3, _mm_or_si128(_mm_shuffle_epi8(pixels3, shuffle), fourthByte));
+}
+
+ANGLE_SSSE3_TARGET void LoadRGB8ToRGBA8SSSE3(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i shuffle =
+        _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        Load16RGB8PixelsSSSE3(source + 3 * x, dest + 4 * x, shuffle, opaque);
+    }
+
+    LoadRGB8ToRGBA8Scalar(count - x, source + 3 * x, dest + 4 * x);
+}
+
+ANGLE_SSSE3_TARGET void LoadRGB8ToBGRX8SSSE3(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i shuffle =
+        _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+    const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        Load16RGB8PixelsSSSE3(source + 3 * x, dest + 4 * x, shuffle, opaque);
+    }
+
+    LoadRGB8ToBGRX8Scalar(count - x, source + 3 * x, dest + 4 * x);
+}
+
+ANGLE_SSSE3_TARGET void LoadRGBA8ToBGRA8SSSE3(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128i shuffle =
+        _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 4 * x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x),
+                         _mm_shuffle_epi8(rgba, shuffle));
+    }
+
+    LoadRGBA8ToBGRA8Scalar(count - x, source + 4 * x, dest + 4 * x);
+}
+#endif  // defined(ANGLE_LOAD_IMAGE_SSSE3)
+
+#if defined(ANGLE_LOAD_IMAGE_AVX2)
+ANGLE_AVX2_TARGET __m256i Select(__m256i mask, __m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+// Converts 8 packed 3 byte pixels.  Reads 4 bytes past the last pixel.
+ANGLE_AVX2_TARGET void Load8RGB8PixelsAVX2(const uint8_t *source,
+                                           uint8_t *dest,
+                                           __m256i shuffle,
+                                           __m256i fourthByte)
+{
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 12));
+    __m256i pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest),
+                        _mm256_or_si256(_mm256_shuffle_epi8(pixels, shuffle), fourthByte));
+}
+
+ANGLE_AVX2_TARGET void LoadRGB8ToRGBA8AVX2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m256i shuffle =
+        _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4,
+                         5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i opaque = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+    // The loads of the last 8 pixels of the row would read past its end.
+    size_t x = 0;
+    for (; x + 10 <= count; x += 8)
+    {
+        Load8RGB8PixelsAVX2(source + 3 * x, dest + 4 * x, shuffle, opaque);
+    }
+
+    LoadRGB8ToRGBA8Scalar(count - x, source + 3 * x, dest + 4 * x);
+}
+
+ANGLE_AVX2_TARGET void LoadRGB8ToBGRX8AVX2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m256i shuffle =
+        _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1, 2, 1, 0, -1, 5, 4,
+                         3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+    const __m256i opaque = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+    size_t x = 0;
+    for (; x + 10 <= count; x += 8)
+    {
+        Load8RGB8PixelsAVX2(source + 3 * x, dest + 4 * x, shuffle, opaque);
+    }
+
+    LoadRGB8ToBGRX8Scalar(count - x, source + 3 * x, dest + 4 * x);
+}
+
+ANGLE_AVX2_TARGET void LoadRGBA8ToBGRA8AVX2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m256i shuffle =
+        _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4,
+                         7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 4 * x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + 4 * x),
+                            _mm256_shuffle_epi8(rgba, shuffle));
+    }
+
+    LoadRGBA8ToBGRA8Scalar(count - x, source + 4 * x, dest + 4 * x);
+}
+
+ANGLE_AVX2_TARGET void LoadRGB10A2ToRGBA8AVX2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m256i redMask   = _mm256_set1_epi32(0x000000FF);
+    const __m256i greenMask = _mm256_set1_epi32(0x0000FF00);
+    const __m256i blueMask  = _mm256_set1_epi32(0x00FF0000);
+    const __m256i alphaMul  = _mm256_set1_epi32(0x55);
+
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        __m256i rgba  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 4 * x));
+        __m256i red   = _mm256_and_si256(_mm256_srli_epi32(rgba, 2), redMask);
+        __m256i green = _mm256_and_si256(_mm256_srli_epi32(rgba, 4), greenMask);
+        __m256i blue  = _mm256_and_si256(_mm256_srli_epi32(rgba, 6), blueMask);
+        __m256i alpha =
+            _mm256_slli_epi32(_mm256_mullo_epi16(_mm256_srli_epi32(rgba, 30), alphaMul), 24);
+
+        __m256i result =
+            _mm256_or_si256(_mm256_or_si256(red, green), _mm256_or_si256(blue, alpha));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + 4 * x), result);
+    }
+
+    LoadRGB10A2ToRGBA8Scalar(count - x, source + 4 * x, dest + 4 * x);
+}
+
+// Unlike the SSE2 version, handles denormals with a variable shift.
+ANGLE_AVX2_TARGET __m256i Float32ToFloat16AVX2(__m256i value)
+{
+    __m256i abs  = _mm256_and_si256(value, _mm256_set1_epi32(kFloat32AbsMask));
+    __m256i sign = _mm256_and_si256(_mm256_srli_epi32(value, 16), _mm256_set1_epi32(0x8000));
+
+    __m256i normalRounding = _mm256_and_si256(_mm256_srli_epi32(abs, 13), _mm256_set1_epi32(1));
+    __m256i normal         = _mm256_srli_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(abs, _mm256_set1_epi32(kFloat16NormalBias)),
+                         normalRounding),
+        13);
+
+    // Shifts of 32 or more produce zero, like the scalar code does for exponents below 90.
+    __m256i mantissa = _mm256_or_si256(_mm256_and_si256(abs, _mm256_set1_epi32(0x007FFFFF)),
+                                       _mm256_set1_epi32(0x00800000));
+    __m256i shift    = _mm256_sub_epi32(_mm256_set1_epi32(113), _mm256_srli_epi32(abs, 23));
+    __m256i shifted  = _mm256_srlv_epi32(mantissa, shift);
+    __m256i denormalRounding =
+        _mm256_and_si256(_mm256_srli_epi32(shifted, 13), _mm256_set1_epi32(1));
+    __m256i denormal = _mm256_srli_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(shifted, _mm256_set1_epi32(kFloat16RoundingBias)),
+                         denormalRounding),
+        13);
+
+    __m256i isDenormal = _mm256_cmpgt_epi32(_mm256_set1_epi32(kFloat32MinNormal16), abs);
+    __m256i result     = _mm256_or_si256(sign, Select(isDenormal, denormal, normal));
+    result = Select(_mm256_cmpgt_epi32(abs, _mm256_set1_epi32(kFloat32MaxNormal16)),
+                    _mm256_or_si256(sign, _mm256_set1_epi32(kFloat16Infinity)), result);
+    result = Select(_mm256_cmpgt_epi32(abs, _mm256_set1_epi32(kFloat32Infinity)),
+                    _mm256_set1_epi32(kFloat16NaN), result);
+    return result;
+}
+
+ANGLE_AVX2_TARGET void LoadR32FToR16FAVX2(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        const __m256i *in = reinterpret_cast<const __m256i *>(source + 4 * x);
+        __m256i lo        = Float32ToFloat16AVX2(_mm256_loadu_si256(in));
+        __m256i hi        = Float32ToFloat16AVX2(_mm256_loadu_si256(in + 1));
+        // The pack works within each 128 bit lane.
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi),
+                                                  _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + 2 * x), packed);
+    }
+
+    LoadR32FToR16FScalar(count - x, source + 4 * x, dest + 2 * x);
+}
+#endif  // defined(ANGLE_LOAD_IMAGE_AVX2)
+
+#if defined(ANGLE_LOAD_IMAGE_NEON)
+void LoadA8ToRGBA8NEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    uint8x16x4_t rgba;
+    rgba.val[0] = vdupq_n_u8(0);
+    rgba.val[1] = rgba.val[0];
+    rgba.val[2] = rgba.val[0];
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        rgba.val[3] = vld1q_u8(source + x);
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    LoadA8ToRGBA8Scalar(count - x, source + x, dest + 4 * x);
+}
+
+void LoadL8ToRGBA8NEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    uint8x16x4_t rgba;
+    rgba.val[3] = vdupq_n_u8(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        uint8x16_t luminance = vld1q_u8(source + x);
+        rgba.val[0]          = luminance;
+        rgba.val[1]          = luminance;
+        rgba.val[2]          = luminance;
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    LoadL8ToRGBA8Scalar(count - x, source + x, dest + 4 * x);
+}
+
+void LoadLA8ToRGBA8NEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        uint8x16x2_t la = vld2q_u8(source + 2 * x);
+        uint8x16x4_t rgba;
+        rgba.val[0] = la.val[0];
+        rgba.val[1] = la.val[0];
+        rgba.val[2] = la.val[0];
+        rgba.val[3] = la.val[1];
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    LoadLA8ToRGBA8Scalar(count - x, source + 2 * x, dest + 4 * x);
+}
+
+void LoadRGB8ToRGBA8NEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    uint8x16x4_t rgba;
+    rgba.val[3] = vdupq_n_u8(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(source + 3 * x);
+        rgba.val[0]      = rgb.val[0];
+        rgba.val[1]      = rgb.val[1];
+        rgba.val[2]      = rgb.val[2];
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    LoadRGB8ToRGBA8Scalar(count - x, source + 3 * x, dest + 4 * x);
+}
+
+void LoadRGB8ToBGRX8NEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    uint8x16x4_t bgrx;
+    bgrx.val[3] = vdupq_n_u8(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(source + 3 * x);
+        bgrx.val[0]      = rgb.val[2];
+        bgrx.val[1]      = rgb.val[1];
+        bgrx.val[2]      = rgb.val[0];
+        vst4q_u8(dest + 4 * x, bgrx);
+    }
+
+    LoadRGB8ToBGRX8Scalar(count - x, source + 3 * x, dest + 4 * x);
+}
+
+void LoadRGBA8ToBGRA8NEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        uint8x16x4_t rgba = vld4q_u8(source + 4 * x);
+        uint8x16_t red    = rgba.val[0];
+        rgba.val[0]       = rgba.val[2];
+        rgba.val[2]       = red;
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    LoadRGBA8ToBGRA8Scalar(count - x, source + 4 * x, dest + 4 * x);
+}
+
+void LoadRGB10A2ToRGBA8NEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const uint32x4_t redMask   = vdupq_n_u32(0x000000FF);
+    const uint32x4_t greenMask = vdupq_n_u32(0x0000FF00);
+    const uint32x4_t blueMask  = vdupq_n_u32(0x00FF0000);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        uint32x4_t rgba  = vreinterpretq_u32_u8(vld1q_u8(source + 4 * x));
+        uint32x4_t red   = vandq_u32(vshrq_n_u32(rgba, 2), redMask);
+        uint32x4_t green = vandq_u32(vshrq_n_u32(rgba, 4), greenMask);
+        uint32x4_t blue  = vandq_u32(vshrq_n_u32(rgba, 6), blueMask);
+        uint32x4_t alpha = vshlq_n_u32(vmulq_n_u32(vshrq_n_u32(rgba, 30), 0x55), 24);
+
+        uint32x4_t result = vorrq_u32(vorrq_u32(red, green), vorrq_u32(blue, alpha));
+        vst1q_u8(dest + 4 * x, vreinterpretq_u8_u32(result));
+    }
+
+    LoadRGB10A2ToRGBA8Scalar(count - x, source + 4 * x, dest + 4 * x);
+}
+
+uint16x4_t Float32ToFloat16NEON(uint32x4_t value)
+{
+    uint32x4_t abs  = vandq_u32(value, vdupq_n_u32(kFloat32AbsMask));
+    uint32x4_t sign = vandq_u32(vshrq_n_u32(value, 16), vdupq_n_u32(0x8000));
+
+    uint32x4_t normalRounding = vandq_u32(vshrq_n_u32(abs, 13), vdupq_n_u32(1));
+    uint32x4_t normal         = vshrq_n_u32(
+        vaddq_u32(vaddq_u32(abs, vdupq_n_u32(kFloat16NormalBias)), normalRounding), 13);
+
+    // Negative shifts are right shifts, and right shifts of 32 or more produce zero.
+    uint32x4_t mantissa =
+        vorrq_u32(vandq_u32(abs, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x00800000));
+    int32x4_t shift =
+        vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(abs, 23)), vdupq_n_s32(113));
+    uint32x4_t shifted          = vshlq_u32(mantissa, shift);
+    uint32x4_t denormalRounding = vandq_u32(vshrq_n_u32(shifted, 13), vdupq_n_u32(1));
+    uint32x4_t denormal         = vshrq_n_u32(
+        vaddq_u32(vaddq_u32(shifted, vdupq_n_u32(kFloat16RoundingBias)), denormalRounding), 13);
+
+    uint32x4_t isDenormal = vcltq_u32(abs, vdupq_n_u32(kFloat32MinNormal16));
+    uint32x4_t result     = vorrq_u32(sign, vbslq_u32(isDenormal, denormal, normal));
+    result = vbslq_u32(vcgtq_u32(abs, vdupq_n_u32(kFloat32MaxNormal16)),
+                       vorrq_u32(sign, vdupq_n_u32(kFloat16Infinity)), result);
+    result = vbslq_u32(vcgtq_u32(abs, vdupq_n_u32(kFloat32Infinity)), vdupq_n_u32(kFloat16NaN),
+                       result);
+    return vmovn_u32(result);
+}
+
+void LoadR32FToR16FNEON(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        const uint32_t *in = reinterpret_cast<const uint32_t *>(source + 4 * x);
+        uint16x8_t result  = vcombine_u16(Float32ToFloat16NEON(vld1q_u32(in)),
+                                          Float32ToFloat16NEON(vld1q_u32(in + 4)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + 2 * x), result);
+    }
+
+    LoadR32FToR16FScalar(count - x, source + 4 * x, dest + 2 * x);
+}
+#endif  // defined(ANGLE_LOAD_IMAGE_NEON)
+
+using LoadImageRowFunctions = PackedEnumMap<LoadImageConversion, LoadImageRowFunction>;
+
+LoadImageRowFunctions GetScalarFunctions()
+{
+    LoadImageRowFunctions functions;
+    functions[LoadImageConversion::A8ToRGBA8]      = LoadA8ToRGBA8Scalar;
+    functions[LoadImageConversion::L8ToRGBA8]      = LoadL8ToRGBA8Scalar;
+    functions[LoadImageConversion::LA8ToRGBA8]     = LoadLA8ToRGBA8Scalar;
+    functions[LoadImageConversion::RGB8ToRGBA8]    = LoadRGB8ToRGBA8Scalar;
+    functions[LoadImageConversion::RGB8ToBGRX8]    = LoadRGB8ToBGRX8Scalar;
+    functions[LoadImageConversion::RGBA8ToBGRA8]   = LoadRGBA8ToBGRA8Scalar;
+    functions[LoadImageConversion::RGB10A2ToRGBA8] = LoadRGB10A2ToRGBA8Scalar;
+    functions[LoadImageConversion::R32FToR16F]     = LoadR32FToR16FScalar;
+    return functions;
+}
+
+LoadImageRowFunctions GetVectorFunctions(LoadImageKernel kernel)
+{
+    LoadImageRowFunctions functions = {};
+
+    switch (kernel)
+    {
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+        case LoadImageKernel::SSE2:
+            functions[LoadImageConversion::A8ToRGBA8]      = LoadA8ToRGBA8SSE2;
+            functions[LoadImageConversion::L8ToRGBA8]      = LoadL8ToRGBA8SSE2;
+            functions[LoadImageConversion::LA8ToRGBA8]     = LoadLA8ToRGBA8SSE2;
+            functions[LoadImageConversion::RGBA8ToBGRA8]   = LoadRGBA8ToBGRA8SSE2;
+            functions[LoadImageConversion::RGB10A2ToRGBA8] = LoadRGB10A2ToRGBA8SSE2;
+            functions[LoadImageConversion::R32FToR16F]     = LoadR32FToR16FSSE2;
+            break;
+#endif
+#if defined(ANGLE_LOAD_IMAGE_SSSE3)
+        case LoadImageKernel::SSSE3:
+            functions[LoadImageConversion::RGB8ToRGBA8]  = LoadRGB8ToRGBA8SSSE3;
+            functions[LoadImageConversion::RGB8ToBGRX8]  = LoadRGB8ToBGRX8SSSE3;
+            functions[LoadImageConversion::RGBA8ToBGRA8] = LoadRGBA8ToBGRA8SSSE3;
+            break;
+#endif
+#if defined(ANGLE_LOAD_IMAGE_AVX2)
+        case LoadImageKernel::AVX2:
+            functions[LoadImageConversion::RGB8ToRGBA8]    = LoadRGB8ToRGBA8AVX2;
+            functions[LoadImageConversion::RGB8ToBGRX8]    = LoadRGB8ToBGRX8AVX2;
+            functions[LoadImageConversion::RGBA8ToBGRA8]   = LoadRGBA8ToBGRA8AVX2;
+            functions[LoadImageConversion::RGB10A2ToRGBA8] = LoadRGB10A2ToRGBA8AVX2;
+            functions[LoadImageConversion::R32FToR16F]     = LoadR32FToR16FAVX2;
+            break;
+#endif
+#if defined(ANGLE_LOAD_IMAGE_NEON)
+        case LoadImageKernel::NEON:
+            functions[LoadImageConversion::A8ToRGBA8]      = LoadA8ToRGBA8NEON;
+            functions[LoadImageConversion::L8ToRGBA8]      = LoadL8ToRGBA8NEON;
+            functions[LoadImageConversion::LA8ToRGBA8]     = LoadLA8ToRGBA8NEON;
+            functions[LoadImageConversion::RGB8ToRGBA8]    = LoadRGB8ToRGBA8NEON;
+            functions[LoadImageConversion::RGB8ToBGRX8]    = LoadRGB8ToBGRX8NEON;
+            functions[LoadImageConversion::RGBA8ToBGRA8]   = LoadRGBA8ToBGRA8NEON;
+            functions[LoadImageConversion::RGB10A2ToRGBA8] = LoadRGB10A2ToRGBA8NEON;
+            functions[LoadImageConversion::R32FToR16F]     = LoadR32FToR16FNEON;
+            break;
+#endif
+        default:
+            break;
+    }
+
+    return functions;
+}
+
+LoadImageRowFunctions GetFastestFunctions()
+{
+    LoadImageRowFunctions fastest = GetScalarFunctions();
+
+    // Later kernels are faster.
+    for (LoadImageKernel kernel : AllEnums<LoadImageKernel>())
+    {
+        if (kernel == LoadImageKernel::Scalar || !IsLoadImageKernelSupported(kernel))
+        {
+            continue;
+        }
+
+        LoadImageRowFunctions functions = GetVectorFunctions(kernel);
+        for (LoadImageConversion conversion : AllEnums<LoadImageConversion>())
+        {
+            if (functions[conversion] != nullptr)
+            {
+                fastest[conversion] = functions[conversion];
+            }
+        }
+    }
+
+    return fastest;
+}
+}  // anonymous namespace
+
+bool IsLoadImageKernelSupported(LoadImageKernel kernel)
+{
+    switch (kernel)
+    {
+        case LoadImageKernel::Scalar:
+            return true;
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+        case LoadImageKernel::SSE2:
+            return true;
+#endif
+#if defined(ANGLE_LOAD_IMAGE_SSSE3)
+        case LoadImageKernel::SSSE3:
+            return gl::supportsSSSE3();
+#endif
+#if defined(ANGLE_LOAD_IMAGE_AVX2)
+        case LoadImageKernel::AVX2:
+            return gl::supportsAVX2();
+#endif
+#if defined(ANGLE_LOAD_IMAGE_NEON)
+        case LoadImageKernel::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+LoadImageRowFunction GetLoadImageRowFunction(LoadImageKernel kernel,
+                                             LoadImageConversion conversion)
+{
+    if (!IsLoadImageKernelSupported(kernel))
+    {
+        return nullptr;
+    }
+    if (kernel == LoadImageKernel::Scalar)
+    {
+        return GetScalarFunctions()[conversion];
+    }
+    return GetVectorFunctions(kernel)[conversion];
+}
+
+LoadImageRowFunction GetFastestLoadImageRowFunction(LoadImageConversion conversion)
+{
+    static const LoadImageRowFunctions fastest = GetFastestFunctions();
+    return fastest[conversion];
+}
+
+}  // namespace angle
@@ -0,0 +1,86 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_simd.h: Vectorized row conversions used by the hottest image loading functions.  The
+// load functions pick the fastest implementation the CPU supports at runtime, so the entries of
+// the load functions table are unchanged.
+
+#ifndef IMAGEUTIL_LOADIMAGE_SIMD_H_
+#define IMAGEUTIL_LOADIMAGE_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+
+enum class LoadImageKernel : uint8_t
+{
+    Scalar,
+    SSE2,
+    SSSE3,
+    AVX2,
+    NEON,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+enum class LoadImageConversion : uint8_t
+{
+    A8ToRGBA8,
+    L8ToRGBA8,
+    LA8ToRGBA8,
+    RGB8ToRGBA8,
+    RGB8ToBGRX8,
+    RGBA8ToBGRA8,
+    RGB10A2ToRGBA8,
+    R32FToR16F,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Converts a row of |count| source elements.  Elements are pixels, except for R32FToR16F where
+// they are the components of the pixels.
+using LoadImageRowFunction = void (*)(size_t count, const uint8_t *source, uint8_t *dest);
+
+bool IsLoadImageKernelSupported(LoadImageKernel kernel);
+
+// Returns nullptr if |kernel| isn't supported by the CPU or doesn't implement |conversion|.  Every
+// conversion is implemented by LoadImageKernel::Scalar, and all kernels produce the same output.
+LoadImageRowFunction GetLoadImageRowFunction(LoadImageKernel kernel,
+                                             LoadImageConversion conversion);
+
+LoadImageRowFunction GetFastestLoadImageRowFunction(LoadImageConversion conversion);
+
+namespace priv
+{
+inline void LoadRows(LoadImageRowFunction loadRow,
+                     size_t count,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            loadRow(count, input + y * inputRowPitch + z * inputDepthPitch,
+                    output + y * outputRowPitch + z * outputDepthPitch);
+        }
+    }
+}
+}  // namespace priv
+
+}  // namespace angle
+
+#endif  // IMAGEUTIL_LOADIMAGE_SIMD_H_
@@ -0,0 +1,203 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_simd_unittest.cpp: Unit tests for the vectorized image loading row conversions.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/PackedEnums.h"
+#include "common/mathutil.h"
+#include "image_util/loadimage.h"
+
+namespace angle
+{
+namespace
+{
+constexpr uint8_t kGuardByte = 0xCD;
+
+size_t GetSourceElementSize(LoadImageConversion conversion)
+{
+    switch (conversion)
+    {
+        case LoadImageConversion::A8ToRGBA8:
+        case LoadImageConversion::L8ToRGBA8:
+            return 1;
+        case LoadImageConversion::LA8ToRGBA8:
+            return 2;
+        case LoadImageConversion::RGB8ToRGBA8:
+        case LoadImageConversion::RGB8ToBGRX8:
+            return 3;
+        default:
+            return 4;
+    }
+}
+
+size_t GetDestElementSize(LoadImageConversion conversion)
+{
+    return conversion == LoadImageConversion::R32FToR16F ? 2 : 4;
+}
+
+// Runs |loadRow| on a row that is followed by guard bytes, and returns the row.
+std::vector<uint8_t> LoadRow(LoadImageRowFunction loadRow,
+                             LoadImageConversion conversion,
+                             const std::vector<uint8_t> &source,
+                             size_t count)
+{
+    constexpr size_t kGuardSize = 64;
+    size_t destSize             = count * GetDestElementSize(conversion);
+
+    std::vector<uint8_t> dest(destSize + kGuardSize, kGuardByte);
+    loadRow(count, source.data(), dest.data());
+    for (size_t i = destSize; i < dest.size(); ++i)
+    {
+        EXPECT_EQ(kGuardByte, dest[i]) << "Wrote past the end of the row at " << i;
+    }
+
+    dest.resize(destSize);
+    return dest;
+}
+
+// Test that every kernel produces the same output as the scalar kernel for all row lengths around
+// the vector sizes, and doesn't write outside of the row.
+TEST(LoadImageSIMD, KernelsMatchScalar)
+{
+    std::mt19937 random(0);
+
+    for (LoadImageConversion conversion : AllEnums<LoadImageConversion>())
+    {
+        LoadImageRowFunction scalarRow =
+            GetLoadImageRowFunction(LoadImageKernel::Scalar, conversion);
+        ASSERT_NE(nullptr, scalarRow);
+
+        for (size_t count : {0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 33, 47, 64, 65, 255, 1000})
+        {
+            // Source rows are sized exactly, so reading past them is caught by ASAN.
+            std::vector<uint8_t> source(count * GetSourceElementSize(conversion));
+            for (uint8_t &byte : source)
+            {
+                byte = static_cast<uint8_t>(random());
+            }
+
+            std::vector<uint8_t> expected = LoadRow(scalarRow, conversion, source, count);
+
+            for (LoadImageKernel kernel : AllEnums<LoadImageKernel>())
+            {
+                LoadImageRowFunction loadRow = GetLoadImageRowFunction(kernel, conversion);
+                if (loadRow == nullptr)
+                {
+                    continue;
+                }
+
+                EXPECT_EQ(expected, LoadRow(loadRow, conversion, source, count))
+                    << "kernel " << static_cast<int>(kernel) << ", conversion "
+                    << static_cast<int>(conversion) << ", count " << count;
+            }
+
+            LoadImageRowFunction fastestRow = GetFastestLoadImageRowFunction(conversion);
+            EXPECT_EQ(expected, LoadRow(fastestRow, conversion, source, count));
+        }
+    }
+}
+
+// Test the float16 conversion of every kernel on values that take the special paths of
+// gl::float32ToFloat16.
+TEST(LoadImageSIMD, Float32ToFloat16SpecialValues)
+{
+    std::vector<uint32_t> values = {
+        0x00000000, 0x80000000,  // Zeros
+        0x00000001, 0x2CFFFFFF,  // Flushed to zero
+        0x2D000000, 0x33000000, 0x337FFFFF, 0x38000000, 0x387FFFFF, 0xB8000001,  // Denormals
+        0x38800000, 0x3F800000, 0x3F801000, 0x3F803000, 0xC0490FDB,              // Normals
+        0x477FE000, 0x477FEFFF, 0x477FF000, 0x47FFEFFF,  // Largest normals and rounding
+        0x47FFF000, 0x7F7FFFFF, 0x7F800000, 0xFF800000,  // Infinities
+        0x7F800001, 0x7FC00000, 0xFFFFFFFF,              // NaNs
+    };
+
+    // Repeat with every value at every position of the vectors.
+    std::vector<uint32_t> input;
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        input.insert(input.end(), values.begin() + offset % values.size(), values.end());
+        input.insert(input.end(), values.begin(), values.begin() + offset % values.size());
+    }
+
+    std::vector<uint8_t> source(input.size() * sizeof(uint32_t));
+    memcpy(source.data(), input.data(), source.size());
+
+    std::vector<uint16_t> expected(input.size());
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        expected[i] = gl::float32ToFloat16(gl::bitCast<float>(input[i]));
+    }
+
+    for (LoadImageKernel kernel : AllEnums<LoadImageKernel>())
+    {
+        LoadImageRowFunction loadRow =
+            GetLoadImageRowFunction(kernel, LoadImageConversion::R32FToR16F);
+        if (loadRow == nullptr)
+        {
+            continue;
+        }
+
+        std::vector<uint8_t> dest =
+            LoadRow(loadRow, LoadImageConversion::R32FToR16F, source, input.size());
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            uint16_t actual;
+            memcpy(&actual, &dest[i * sizeof(uint16_t)], sizeof(uint16_t));
+            EXPECT_EQ(expected[i], actual) << "kernel " << static_cast<int>(kernel) << ", input 0x"
+                                           << std::hex << input[i];
+        }
+    }
+}
+
+// Test that the load functions apply the row and depth pitches around the row conversions.
+TEST(LoadImageSIMD, LoadFunctionsUsePitches)
+{
+    constexpr size_t kWidth            = 20;
+    constexpr size_t kHeight           = 3;
+    constexpr size_t kDepth            = 2;
+    constexpr size_t kInputRowPitch    = kWidth * 4 + 12;
+    constexpr size_t kInputDepthPitch  = kInputRowPitch * kHeight + 4;
+    constexpr size_t kOutputRowPitch   = kWidth * 4 + 8;
+    constexpr size_t kOutputDepthPitch = kOutputRowPitch * kHeight + 16;
+
+    std::vector<uint8_t> input(kInputDepthPitch * kDepth);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    std::vector<uint8_t> output(kOutputDepthPitch * kDepth, kGuardByte);
+    LoadRGBA8ToBGRA8(kWidth, kHeight, kDepth, input.data(), kInputRowPitch, kInputDepthPitch,
+                     output.data(), kOutputRowPitch, kOutputDepthPitch);
+
+    for (size_t z = 0; z < kDepth; ++z)
+    {
+        for (size_t y = 0; y < kHeight; ++y)
+        {
+            const uint8_t *source = input.data() + z * kInputDepthPitch + y * kInputRowPitch;
+            const uint8_t *dest   = output.data() + z * kOutputDepthPitch + y * kOutputRowPitch;
+            for (size_t x = 0; x < kWidth; ++x)
+            {
+                EXPECT_EQ(source[4 * x + 2], dest[4 * x + 0]);
+                EXPECT_EQ(source[4 * x + 1], dest[4 * x + 1]);
+                EXPECT_EQ(source[4 * x + 0], dest[4 * x + 2]);
+                EXPECT_EQ(source[4 * x + 3], dest[4 * x + 3]);
+            }
+
+            // The padding at the end of the rows is left alone.
+            for (size_t i = kWidth * 4; i < kOutputRowPitch; ++i)
+            {
+                EXPECT_EQ(kGuardByte, dest[i]);
+            }
+        }
+    }
+}
+}  // anonymous namespace
+}  // namespace angle
@@ -112,23 +112,44 @@ void BlobCache::put(const BlobCache::Key &key, angle::MemoryBuffer &&value)
     {
         // Store the result in the application's cache
         mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
+        return;
     }
-    else
+
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+    if (isDiskCacheEnabled() && mPackFile.put(key, value.data(), value.size()))
     {
-        populate(key, std::move(value), CacheSource::Memory);
+        return;
     }
+
+    populateLocked(key, std::move(value), CacheSource::Memory);
 }
 
 void BlobCache::putApplication(const BlobCache::Key &key, const angle::MemoryBuffer &value)
 {
-    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
     if (areBlobCacheFuncsSet())
     {
+        std::lock_guard<std::mutex> lock(mBlobCacheMutex);
         mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
+        return;
+    }
+
+    // Like every other pack file access, this must be done under the lock.
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+    if (isDiskCacheEnabled())
+    {
+        mPackFile.put(key, value.data(), value.size());
     }
 }
 
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
+{
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+    populateLocked(key, std::move(value), source);
+}
+
+void BlobCache::populateLocked(const BlobCache::Key &key,
+                               angle::MemoryBuffer &&value,
+                               CacheSource source)
 {
     CacheEntry newEntry;
     newEntry.first  = std::move(value);
@@ -180,6 +201,8 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     }
 
     // Otherwise we are doing caching internally, so try to find it there
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+
     const CacheEntry *entry;
     bool result = mBlobCache.get(key, &entry);
 
@@ -199,7 +222,32 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
         *valueOut      = BlobCache::Value(entry->first.data(), entry->first.size());
         *bufferSizeOut = entry->first.size();
     }
-    else
+    else if (isDiskCacheEnabled())
+    {
+        const uint8_t *data = nullptr;
+        size_t size         = 0;
+        result              = mPackFile.get(key, &data, &size);
+        if (result)
+        {
+            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitDisk,
+                                        kCacheResultMax);
+
+            // Another thread may append to the file and remap it once the lock is released, so
+            // the value can't point into the file mapping.
+            angle::MemoryBuffer *scratchMemory;
+            if (!scratchBuffer->get(size, &scratchMemory))
+            {
+                ERR() << "Failed to allocate memory for binary blob";
+                return false;
+            }
+            memcpy(scratchMemory->data(), data, size);
+
+            *valueOut      = BlobCache::Value(scratchMemory->data(), size);
+            *bufferSizeOut = size;
+        }
+    }
+
+    if (!result)
     {
         ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
                                     kCacheResultMax);
@@ -210,6 +258,8 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
 {
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+
     const CacheEntry *valueBuf;
     bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
     if (result)
@@ -221,7 +271,25 @@ bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Va
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
     mBlobCache.eraseByKey(key);
+
+    if (isDiskCacheEnabled())
+    {
+        mPackFile.remove(key);
+    }
+}
+
+bool BlobCache::enableDiskCache(const std::string &path, size_t maxDiskSizeBytes)
+{
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+    return mPackFile.open(path, maxDiskSizeBytes);
+}
+
+void BlobCache::disableDiskCache()
+{
+    std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+    mPackFile.close();
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
@@ -12,10 +12,12 @@
 
 #include <array>
 #include <cstring>
+#include <mutex>
 
 #include <anglebase/sha1.h>
 #include "common/MemoryBuffer.h"
 #include "common/hash_utils.h"
+#include "libANGLE/BlobPackFile.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
 
@@ -30,6 +32,11 @@ namespace egl
 // simplicity and efficiency.
 static constexpr size_t kBlobCacheKeyLength = angle::base::kSHA1Length;
 using BlobCacheKey                          = std::array<uint8_t, kBlobCacheKeyLength>;
+static_assert(std::is_same<BlobCacheKey, BlobPackFile::Key>::value,
+              "The pack file must be keyed like the blob cache");
+
+// Size limit of the pack file used when caching to disk.
+constexpr size_t kDefaultMaxBlobCacheDiskSizeBytes = 64 * 1024 * 1024;
 }  // namespace egl
 
 namespace std
@@ -93,10 +100,11 @@ class BlobCache final : angle::NonCopyable
     ~BlobCache();
 
     // Store a key-blob pair in the cache.  If application callbacks are set, the application cache
-    // will be used.  Otherwise the value is cached in this object.
+    // will be used.  Otherwise the value is cached on disk if enabled, or in this object.
     void put(const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
-    // Store a key-blob pair in the application cache, only if application callbacks are set.
+    // Store a key-blob pair in the application cache, only if application callbacks are set.  If
+    // not, the value is stored on disk if enabled.
     void putApplication(const BlobCache::Key &key, const angle::MemoryBuffer &value);
 
     // Store a key-blob pair in the cache without making callbacks to the application.  This is used
@@ -106,7 +114,10 @@ class BlobCache final : angle::NonCopyable
                   CacheSource source = CacheSource::Disk);
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
-    // set, those will be used.  Otherwise they key is looked up in this object's cache.
+    // set, those will be used.  Otherwise they key is looked up in this object's cache, then on
+    // disk.  A value found on disk is copied into |scratchBuffer|, as the file mapping may be
+    // replaced as soon as the lock is released.  A value found in memory points into the cache,
+    // and is only valid until the next call that modifies the cache.
     ANGLE_NO_DISCARD bool get(angle::ScratchBuffer *scratchBuffer,
                               const BlobCache::Key &key,
                               BlobCache::Value *valueOut,
@@ -120,17 +131,29 @@ class BlobCache final : angle::NonCopyable
     // Evict a blob from the binary cache.
     void remove(const BlobCache::Key &key);
 
-    // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    // Empty the in-memory cache.  The disk cache is left untouched.
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+        mBlobCache.clear();
+    }
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes)
+    {
+        std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+        mBlobCache.resize(maxCacheSizeBytes);
+    }
 
     // Returns the number of entries in the cache.
     size_t entryCount() const { return mBlobCache.entryCount(); }
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit)
+    {
+        std::lock_guard<std::mutex> lock(mBlobCacheMutex);
+        return mBlobCache.shrinkToSize(limit);
+    }
 
     // Returns the current cache size in bytes.
     size_t size() const { return mBlobCache.size(); }
@@ -145,15 +168,30 @@ class BlobCache final : angle::NonCopyable
 
     bool areBlobCacheFuncsSet() const;
 
-    bool isCachingEnabled() const { return areBlobCacheFuncsSet() || maxSize() > 0; }
+    // Persist blobs to an append-only pack file at |path| when the application doesn't provide
+    // caching callbacks.  Returns false if the file can't be used.
+    bool enableDiskCache(const std::string &path, size_t maxDiskSizeBytes);
+    void disableDiskCache();
+    bool isDiskCacheEnabled() const { return mPackFile.isOpen(); }
+
+    bool isCachingEnabled() const
+    {
+        return areBlobCacheFuncsSet() || maxSize() > 0 || isDiskCacheEnabled();
+    }
 
   private:
     // This internal cache is used only if the application is not providing caching callbacks
     using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
 
+    void populateLocked(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source);
+
+    // Guards both the in-memory cache and the pack file.
     std::mutex mBlobCacheMutex;
     angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
 
+    // Optional on-disk backing, used instead of mBlobCache for new blobs when enabled.
+    BlobPackFile mPackFile;
+
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
 };
@@ -0,0 +1,465 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobPackFile.cpp: Implements the append-only, memory-mapped blob pack file.
+
+#include "libANGLE/BlobPackFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace egl
+{
+namespace
+{
+constexpr uint32_t kFileMagic       = 0x4B504241;  // "ABPK"
+constexpr uint32_t kFileVersion     = 1;
+constexpr uint32_t kRecordMagic     = 0x43455242;  // "BREC"
+constexpr uint32_t kRecordTombstone = 0x1;
+constexpr size_t kRecordAlignment   = 8;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t keyLength;
+    uint32_t reserved;
+};
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t size;
+    uint32_t flags;
+    uint32_t checksum;
+    uint8_t key[BlobPackFile::kKeyLength];
+    uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) % kRecordAlignment == 0, "Records must start aligned");
+static_assert(sizeof(RecordHeader) % kRecordAlignment == 0, "Payloads must start aligned");
+
+size_t GetRecordSize(size_t payloadSize)
+{
+    return rx::roundUp(sizeof(RecordHeader) + payloadSize, kRecordAlignment);
+}
+
+uint32_t ComputeRecordChecksum(const uint8_t *key, const uint8_t *data, size_t size)
+{
+    XXH32_hash_t keyHash = XXH32(key, BlobPackFile::kKeyLength, kRecordMagic);
+    return size > 0 ? XXH32(data, size, keyHash) : keyHash;
+}
+
+FileHeader MakeFileHeader()
+{
+    FileHeader header = {};
+    header.magic      = kFileMagic;
+    header.version    = kFileVersion;
+    header.keyLength  = static_cast<uint32_t>(BlobPackFile::kKeyLength);
+    return header;
+}
+
+bool IsValidFileHeader(const FileHeader &header)
+{
+    return header.magic == kFileMagic && header.version == kFileVersion &&
+           header.keyLength == BlobPackFile::kKeyLength;
+}
+}  // anonymous namespace
+
+BlobPackFile::BlobPackFile()
+    : mFile(nullptr), mFileSize(0), mMaxSize(0), mLiveSize(0), mUseCounter(0)
+{}
+
+BlobPackFile::~BlobPackFile()
+{
+    close();
+}
+
+bool BlobPackFile::open(const std::string &path, size_t maxSizeBytes)
+{
+    close();
+
+    mPath    = path;
+    mMaxSize = maxSizeBytes;
+
+    if (!mLock.lock((mPath + ".lock").c_str()))
+    {
+        WARN() << "Blob cache file " << mPath << " is in use by another process";
+        return false;
+    }
+
+    FileHeader header = {};
+    mFile             = fopen(mPath.c_str(), "r+b");
+    if (mFile != nullptr && fread(&header, sizeof(header), 1, mFile) == 1 &&
+        IsValidFileHeader(header))
+    {
+        fseek(mFile, 0, SEEK_END);
+        mFileSize = static_cast<size_t>(ftell(mFile));
+    }
+    else
+    {
+        // Missing, empty or incompatible file.  Start over.
+        if (mFile != nullptr)
+        {
+            fclose(mFile);
+        }
+        mFile = fopen(mPath.c_str(), "w+b");
+        if (mFile == nullptr)
+        {
+            WARN() << "Failed to create blob cache file " << mPath;
+            close();
+            return false;
+        }
+
+        header = MakeFileHeader();
+        if (fwrite(&header, sizeof(header), 1, mFile) != 1 || fflush(mFile) != 0)
+        {
+            WARN() << "Failed to write blob cache file " << mPath;
+            close();
+            return false;
+        }
+        mFileSize = sizeof(header);
+        return true;
+    }
+
+    if (!mapFile())
+    {
+        WARN() << "Failed to map blob cache file " << mPath;
+        close();
+        return false;
+    }
+
+    size_t validEnd = 0;
+    scanRecords(&validEnd);
+
+    if (validEnd != mFileSize)
+    {
+        // The tail of the file was torn, most likely by a crash while appending.  Rewriting the
+        // file drops the partial record.
+        WARN() << "Recovering blob cache file " << mPath << ": dropping "
+               << (mFileSize - validEnd) << " bytes of incomplete data";
+        return compact(mMaxSize);
+    }
+
+    if (mFileSize > mMaxSize)
+    {
+        return compact(mMaxSize / 2);
+    }
+
+    return true;
+}
+
+void BlobPackFile::close()
+{
+    mMapping.unmap();
+    if (mFile != nullptr)
+    {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+    mLock.unlock();
+    mIndex.clear();
+    mFileSize   = 0;
+    mLiveSize   = 0;
+    mUseCounter = 0;
+}
+
+bool BlobPackFile::put(const Key &key, const uint8_t *data, size_t size)
+{
+    if (!isOpen() || size > mMaxSize / 2)
+    {
+        return false;
+    }
+
+    // Programs are often stored again with identical contents.  Don't grow the file for that.
+    const uint8_t *existingData = nullptr;
+    size_t existingSize         = 0;
+    if (get(key, &existingData, &existingSize) && existingSize == size &&
+        memcmp(existingData, data, size) == 0)
+    {
+        return true;
+    }
+
+    if (mFileSize + GetRecordSize(size) > mMaxSize && !compact(mMaxSize / 2))
+    {
+        return false;
+    }
+
+    size_t offset = mFileSize;
+    if (!appendRecord(key, data, static_cast<uint32_t>(size), 0))
+    {
+        return false;
+    }
+
+    eraseIndexEntry(key);
+    mIndex[key] = {offset, static_cast<uint32_t>(size), ++mUseCounter};
+    mLiveSize += GetRecordSize(size);
+    return true;
+}
+
+bool BlobPackFile::get(const Key &key, const uint8_t **dataOut, size_t *sizeOut)
+{
+    auto iter = mIndex.find(key);
+    if (iter == mIndex.end())
+    {
+        return false;
+    }
+
+    IndexEntry &entry = iter->second;
+    size_t recordEnd  = entry.offset + sizeof(RecordHeader) + entry.size;
+    if (recordEnd > mMapping.size() && !mapFile())
+    {
+        return false;
+    }
+
+    if (!isValidRecord(key, entry))
+    {
+        WARN() << "Blob cache file " << mPath << " has a corrupt record at offset "
+               << entry.offset;
+        eraseIndexEntry(key);
+        return false;
+    }
+
+    entry.lastUsed = ++mUseCounter;
+    *dataOut       = mMapping.data() + entry.offset + sizeof(RecordHeader);
+    *sizeOut       = entry.size;
+    return true;
+}
+
+void BlobPackFile::remove(const Key &key)
+{
+    if (mIndex.count(key) == 0)
+    {
+        return;
+    }
+
+    eraseIndexEntry(key);
+
+    // Compaction only copies the live records, so it removes the blob without a tombstone.
+    if (mFileSize + GetRecordSize(0) > mMaxSize)
+    {
+        compact(mMaxSize / 2);
+        return;
+    }
+
+    appendRecord(key, nullptr, 0, kRecordTombstone);
+}
+
+bool BlobPackFile::compact(size_t targetSizeBytes)
+{
+    if (!isOpen() || !mapFile())
+    {
+        return false;
+    }
+
+    // Keep the most recently used records that fit in the target size.
+    std::vector<std::pair<Key, IndexEntry>> entries(mIndex.begin(), mIndex.end());
+    std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+        return a.second.lastUsed > b.second.lastUsed;
+    });
+
+    // Records are otherwise only verified when they are read, so check them before they are
+    // copied; a corrupt record would get a fresh lease on life in the new file.
+    size_t newSize = sizeof(FileHeader);
+    size_t keep    = 0;
+    for (const std::pair<Key, IndexEntry> &entry : entries)
+    {
+        size_t recordSize = GetRecordSize(entry.second.size);
+        if (newSize + recordSize > targetSizeBytes)
+        {
+            break;
+        }
+        if (!isValidRecord(entry.first, entry.second))
+        {
+            WARN() << "Blob cache file " << mPath << " has a corrupt record at offset "
+                   << entry.second.offset;
+            continue;
+        }
+        entries[keep++] = entry;
+        newSize += recordSize;
+    }
+    entries.resize(keep);
+
+    // Write the oldest records first, so the order of the records reflects their recency the next
+    // time the file is scanned.
+    std::reverse(entries.begin(), entries.end());
+
+    std::string tempPath = mPath + ".tmp";
+    FILE *tempFile       = fopen(tempPath.c_str(), "wb");
+    if (tempFile == nullptr)
+    {
+        WARN() << "Failed to create " << tempPath;
+        return false;
+    }
+
+    FileHeader fileHeader = MakeFileHeader();
+    bool success          = fwrite(&fileHeader, sizeof(fileHeader), 1, tempFile) == 1;
+
+    angle::HashMap<Key, IndexEntry, KeyHash> newIndex;
+    size_t offset = sizeof(FileHeader);
+    for (std::pair<Key, IndexEntry> &entry : entries)
+    {
+        size_t recordSize = GetRecordSize(entry.second.size);
+        success           = success &&
+                  fwrite(mMapping.data() + entry.second.offset, recordSize, 1, tempFile) == 1;
+
+        newIndex[entry.first] = {offset, entry.second.size, entry.second.lastUsed};
+        offset += recordSize;
+    }
+    ASSERT(!success || offset == newSize);
+
+    success = fclose(tempFile) == 0 && success;
+    if (!success)
+    {
+        WARN() << "Failed to write " << tempPath;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // Replace the pack file.  Windows doesn't allow renaming over an existing file, nor one that's
+    // still mapped.
+    mMapping.unmap();
+    fclose(mFile);
+    mFile = nullptr;
+
+    if (std::rename(tempPath.c_str(), mPath.c_str()) != 0)
+    {
+        std::remove(mPath.c_str());
+        if (std::rename(tempPath.c_str(), mPath.c_str()) != 0)
+        {
+            WARN() << "Failed to replace blob cache file " << mPath;
+            std::remove(tempPath.c_str());
+            close();
+            return false;
+        }
+    }
+
+    mFile = fopen(mPath.c_str(), "r+b");
+    if (mFile == nullptr)
+    {
+        close();
+        return false;
+    }
+
+    mIndex    = std::move(newIndex);
+    mFileSize = newSize;
+    mLiveSize = newSize - sizeof(FileHeader);
+    return mapFile();
+}
+
+bool BlobPackFile::scanRecords(size_t *validEndOut)
+{
+    size_t offset = sizeof(FileHeader);
+
+    while (offset + sizeof(RecordHeader) <= mFileSize)
+    {
+        RecordHeader header;
+        memcpy(&header, mMapping.data() + offset, sizeof(header));
+
+        if (header.magic != kRecordMagic || header.size > mFileSize - offset - sizeof(header))
+        {
+            break;
+        }
+
+        size_t recordSize = GetRecordSize(header.size);
+        if (offset + recordSize > mFileSize)
+        {
+            break;
+        }
+
+        Key key;
+        memcpy(key.data(), header.key, kKeyLength);
+
+        // Only the last record can have been torn by an interrupted append.  The others are
+        // verified lazily in get().
+        if (offset + recordSize == mFileSize &&
+            header.checksum !=
+                ComputeRecordChecksum(key.data(), mMapping.data() + offset + sizeof(header),
+                                      header.size))
+        {
+            break;
+        }
+
+        eraseIndexEntry(key);
+        if ((header.flags & kRecordTombstone) == 0)
+        {
+            mIndex[key] = {offset, header.size, ++mUseCounter};
+            mLiveSize += recordSize;
+        }
+
+        offset += recordSize;
+    }
+
+    *validEndOut = offset;
+    return offset == mFileSize;
+}
+
+bool BlobPackFile::isValidRecord(const Key &key, const IndexEntry &entry) const
+{
+    ASSERT(entry.offset + sizeof(RecordHeader) + entry.size <= mMapping.size());
+
+    RecordHeader header;
+    memcpy(&header, mMapping.data() + entry.offset, sizeof(header));
+    const uint8_t *payload = mMapping.data() + entry.offset + sizeof(RecordHeader);
+
+    return header.magic == kRecordMagic && header.size == entry.size &&
+           header.checksum == ComputeRecordChecksum(key.data(), payload, entry.size);
+}
+
+bool BlobPackFile::mapFile()
+{
+    if (mMapping.valid() && mMapping.size() == mFileSize)
+    {
+        return true;
+    }
+    return mMapping.map(mPath.c_str(), mFileSize);
+}
+
+bool BlobPackFile::appendRecord(const Key &key, const uint8_t *data, uint32_t size, uint32_t flags)
+{
+    RecordHeader header = {};
+    header.magic        = kRecordMagic;
+    header.size         = size;
+    header.flags        = flags;
+    header.checksum     = ComputeRecordChecksum(key.data(), data, size);
+    memcpy(header.key, key.data(), kKeyLength);
+
+    static constexpr uint8_t kPadding[kRecordAlignment] = {};
+    size_t recordSize                                   = GetRecordSize(size);
+    size_t paddingSize                                  = recordSize - sizeof(RecordHeader) - size;
+
+    bool success = fseek(mFile, static_cast<long>(mFileSize), SEEK_SET) == 0 &&
+                   fwrite(&header, sizeof(header), 1, mFile) == 1 &&
+                   (size == 0 || fwrite(data, size, 1, mFile) == 1) &&
+                   (paddingSize == 0 || fwrite(kPadding, paddingSize, 1, mFile) == 1) &&
+                   fflush(mFile) == 0;
+
+    if (!success)
+    {
+        // A partial record may have been written.  It will be dropped the next time the file is
+        // opened; stop using the file until then.
+        WARN() << "Failed to append to blob cache file " << mPath;
+        close();
+        return false;
+    }
+
+    mFileSize += recordSize;
+    return true;
+}
+
+void BlobPackFile::eraseIndexEntry(const Key &key)
+{
+    auto iter = mIndex.find(key);
+    if (iter != mIndex.end())
+    {
+        mLiveSize -= GetRecordSize(iter->second.size);
+        mIndex.erase(iter);
+    }
+}
+}  // namespace egl
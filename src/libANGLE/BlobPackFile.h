@@ -0,0 +1,109 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobPackFile: Append-only, memory-mapped file of keyed blobs.  Backs the BlobCache on disk when
+//   the application doesn't provide EGL_ANDROID_blob_cache callbacks, so that compiled shaders
+//   and linked programs survive process restarts.
+//
+//   The file is a small header followed by a sequence of records, each made of a RecordHeader,
+//   the payload and padding up to kRecordAlignment.  Updates and removals are appended; the most
+//   recent record for a key wins.  An in-memory hash index from key to record is rebuilt when the
+//   file is opened.  A record that was only partially written (e.g. the process crashed while
+//   appending) is detected by its checksum and dropped.  When the file grows past its size limit,
+//   it's compacted by rewriting only the most recently used live records.
+//
+//   The index is private to the process, so a pack file is owned by a single process at a time.
+//   This is enforced with a lock file next to it; other processes fail to open the pack file.
+
+#ifndef LIBANGLE_BLOB_PACK_FILE_H_
+#define LIBANGLE_BLOB_PACK_FILE_H_
+
+#include <array>
+#include <cstdio>
+#include <string>
+
+#include <anglebase/sha1.h>
+#include "common/angleutils.h"
+#include "common/hash_utils.h"
+#include "common/system_utils.h"
+
+namespace egl
+{
+class BlobPackFile final : angle::NonCopyable
+{
+  public:
+    static constexpr size_t kKeyLength = angle::base::kSHA1Length;
+    using Key                          = std::array<uint8_t, kKeyLength>;
+
+    BlobPackFile();
+    ~BlobPackFile();
+
+    // Opens the pack file at |path|, creating it if it doesn't exist, and rebuilds the index.
+    // The file is kept under |maxSizeBytes| by compacting it when an append would exceed the
+    // limit.  Returns false if the file can't be used or is in use by another process, in which
+    // case the object stays closed.
+    bool open(const std::string &path, size_t maxSizeBytes);
+    void close();
+    bool isOpen() const { return mFile != nullptr; }
+
+    // Appends a key-blob pair to the file.  Blobs larger than half the size limit are rejected.
+    bool put(const Key &key, const uint8_t *data, size_t size);
+
+    // Looks up a blob.  The returned pointer points directly into the file mapping and stays
+    // valid until the next call to a non-const method of this object.
+    bool get(const Key &key, const uint8_t **dataOut, size_t *sizeOut);
+
+    // Forgets about a blob.  A tombstone is appended so the removal persists.
+    void remove(const Key &key);
+
+    // Rewrites the file with the most recently used live records that fit in |targetSizeBytes|.
+    // Corrupt records are dropped.
+    bool compact(size_t targetSizeBytes);
+
+    size_t entryCount() const { return mIndex.size(); }
+    size_t fileSize() const { return mFileSize; }
+    size_t maxSize() const { return mMaxSize; }
+
+    // Bytes taken by the records of live entries.  The rest of the file is stale records.
+    size_t liveSize() const { return mLiveSize; }
+
+  private:
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const
+        {
+            return angle::ComputeGenericHash(key.data(), key.size());
+        }
+    };
+
+    struct IndexEntry
+    {
+        // Offset of the record header in the file.
+        size_t offset;
+        uint32_t size;
+        // Used to pick which records survive compaction.
+        uint64_t lastUsed;
+    };
+
+    bool scanRecords(size_t *validEndOut);
+    bool isValidRecord(const Key &key, const IndexEntry &entry) const;
+    bool mapFile();
+    bool appendRecord(const Key &key, const uint8_t *data, uint32_t size, uint32_t flags);
+    void eraseIndexEntry(const Key &key);
+
+    std::string mPath;
+    angle::ExclusiveFileLock mLock;
+    FILE *mFile;
+    angle::MemoryMappedFile mMapping;
+    size_t mFileSize;
+    size_t mMaxSize;
+    size_t mLiveSize;
+    uint64_t mUseCounter;
+
+    angle::HashMap<Key, IndexEntry, KeyHash> mIndex;
+};
+}  // namespace egl
+
+#endif  // LIBANGLE_BLOB_PACK_FILE_H_
@@ -0,0 +1,330 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobPackFile_unittest.cpp: Unit tests for the on-disk blob cache pack file.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <vector>
+
+#include "libANGLE/BlobPackFile.h"
+#include "util/test_utils.h"
+
+namespace egl
+{
+namespace
+{
+using Key = BlobPackFile::Key;
+
+Key MakeKey(uint8_t start)
+{
+    Key key;
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = static_cast<uint8_t>(start + i);
+    }
+    return key;
+}
+
+std::vector<uint8_t> MakeBlob(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> blob(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        blob[i] = static_cast<uint8_t>(start + i);
+    }
+    return blob;
+}
+
+bool BlobMatches(BlobPackFile *packFile, const Key &key, const std::vector<uint8_t> &expected)
+{
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    if (!packFile->get(key, &data, &size) || size != expected.size())
+    {
+        return false;
+    }
+    return memcmp(data, expected.data(), size) == 0;
+}
+
+class BlobPackFileTest : public testing::Test
+{
+  protected:
+    static constexpr size_t kMaxSize = 64 * 1024;
+
+    void SetUp() override
+    {
+        char path[1024];
+        ASSERT_TRUE(angle::CreateTemporaryFile(path, sizeof(path)));
+        mPath = path;
+    }
+
+    void TearDown() override
+    {
+        angle::DeleteFile(mPath.c_str());
+        angle::DeleteFile((mPath + ".tmp").c_str());
+        angle::DeleteFile((mPath + ".lock").c_str());
+    }
+
+    std::string mPath;
+};
+
+// Test that blobs can be read back, including after reopening the file.
+TEST_F(BlobPackFileTest, PutGetPersists)
+{
+    std::vector<uint8_t> blob0 = MakeBlob(13, 0);
+    std::vector<uint8_t> blob1 = MakeBlob(200, 7);
+
+    {
+        BlobPackFile packFile;
+        ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+        EXPECT_TRUE(packFile.put(MakeKey(0), blob0.data(), blob0.size()));
+        EXPECT_TRUE(packFile.put(MakeKey(1), blob1.data(), blob1.size()));
+        EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), blob0));
+        EXPECT_TRUE(BlobMatches(&packFile, MakeKey(1), blob1));
+    }
+
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+    EXPECT_EQ(2u, packFile.entryCount());
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), blob0));
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(1), blob1));
+
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    EXPECT_FALSE(packFile.get(MakeKey(2), &data, &size));
+}
+
+// Test that the latest value of a key wins, and that removals persist.
+TEST_F(BlobPackFileTest, OverwriteAndRemove)
+{
+    std::vector<uint8_t> oldBlob = MakeBlob(32, 0);
+    std::vector<uint8_t> newBlob = MakeBlob(48, 3);
+
+    {
+        BlobPackFile packFile;
+        ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+        EXPECT_TRUE(packFile.put(MakeKey(0), oldBlob.data(), oldBlob.size()));
+        EXPECT_TRUE(packFile.put(MakeKey(0), newBlob.data(), newBlob.size()));
+        EXPECT_TRUE(packFile.put(MakeKey(1), oldBlob.data(), oldBlob.size()));
+        packFile.remove(MakeKey(1));
+        EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), newBlob));
+        EXPECT_EQ(1u, packFile.entryCount());
+    }
+
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+    EXPECT_EQ(1u, packFile.entryCount());
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), newBlob));
+}
+
+// Test that storing an identical blob again doesn't grow the file.
+TEST_F(BlobPackFileTest, IdenticalPutDoesNotAppend)
+{
+    std::vector<uint8_t> blob = MakeBlob(100, 0);
+
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+    EXPECT_TRUE(packFile.put(MakeKey(0), blob.data(), blob.size()));
+    size_t fileSize = packFile.fileSize();
+    EXPECT_TRUE(packFile.put(MakeKey(0), blob.data(), blob.size()));
+    EXPECT_EQ(fileSize, packFile.fileSize());
+}
+
+// Test that a record torn by an interrupted append is dropped when the file is reopened.
+TEST_F(BlobPackFileTest, TornTailRecovery)
+{
+    std::vector<uint8_t> blob = MakeBlob(64, 0);
+    size_t validSize          = 0;
+
+    {
+        BlobPackFile packFile;
+        ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+        EXPECT_TRUE(packFile.put(MakeKey(0), blob.data(), blob.size()));
+        validSize = packFile.fileSize();
+        EXPECT_TRUE(packFile.put(MakeKey(1), blob.data(), blob.size()));
+    }
+
+    // Chop the second record in half.
+    std::vector<uint8_t> contents;
+    {
+        FILE *file = fopen(mPath.c_str(), "rb");
+        ASSERT_NE(nullptr, file);
+        fseek(file, 0, SEEK_END);
+        contents.resize(static_cast<size_t>(ftell(file)));
+        fseek(file, 0, SEEK_SET);
+        ASSERT_EQ(1u, fread(contents.data(), contents.size(), 1, file));
+        fclose(file);
+    }
+    contents.resize(validSize + (contents.size() - validSize) / 2);
+    {
+        FILE *file = fopen(mPath.c_str(), "wb");
+        ASSERT_NE(nullptr, file);
+        ASSERT_EQ(1u, fwrite(contents.data(), contents.size(), 1, file));
+        fclose(file);
+    }
+
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+    EXPECT_EQ(1u, packFile.entryCount());
+    EXPECT_EQ(validSize, packFile.fileSize());
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), blob));
+
+    // Appending after recovery works.
+    EXPECT_TRUE(packFile.put(MakeKey(1), blob.data(), blob.size()));
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(1), blob));
+}
+
+// Test that the file stays under its size limit and keeps the most recently used blobs.
+TEST_F(BlobPackFileTest, Compaction)
+{
+    constexpr size_t kSmallMaxSize = 4096;
+    constexpr size_t kBlobSize     = 200;
+
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kSmallMaxSize));
+
+    std::vector<uint8_t> blob0 = MakeBlob(kBlobSize, 0);
+    EXPECT_TRUE(packFile.put(MakeKey(0), blob0.data(), blob0.size()));
+
+    for (uint8_t keyIndex = 1; keyIndex < 100; ++keyIndex)
+    {
+        std::vector<uint8_t> blob = MakeBlob(kBlobSize, keyIndex);
+        EXPECT_TRUE(packFile.put(MakeKey(keyIndex), blob.data(), blob.size()));
+        EXPECT_LE(packFile.fileSize(), kSmallMaxSize);
+
+        // Keep the first blob hot.
+        EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), blob0));
+    }
+
+    EXPECT_LT(packFile.entryCount(), 100u);
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(99), MakeBlob(kBlobSize, 99)));
+
+    // Blobs that don't fit in half the file are rejected.
+    std::vector<uint8_t> hugeBlob = MakeBlob(kSmallMaxSize, 0);
+    EXPECT_FALSE(packFile.put(MakeKey(200), hugeBlob.data(), hugeBlob.size()));
+
+    size_t entryCount = packFile.entryCount();
+    packFile.close();
+    ASSERT_TRUE(packFile.open(mPath, kSmallMaxSize));
+    EXPECT_EQ(entryCount, packFile.entryCount());
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), blob0));
+}
+
+// Test that removals keep the file under its size limit, and still persist.
+TEST_F(BlobPackFileTest, RemoveStaysUnderSizeLimit)
+{
+    constexpr size_t kBlobSize   = 200;
+    constexpr uint8_t kBlobCount = 8;
+
+    // Measure the size of the file header and of a record.
+    size_t headerSize = 0;
+    size_t recordSize = 0;
+    {
+        BlobPackFile packFile;
+        ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+        headerSize                = packFile.fileSize();
+        std::vector<uint8_t> blob = MakeBlob(kBlobSize, 0);
+        EXPECT_TRUE(packFile.put(MakeKey(0), blob.data(), blob.size()));
+        recordSize = packFile.fileSize() - headerSize;
+    }
+    angle::DeleteFile(mPath.c_str());
+
+    // Fill the file up to its size limit exactly, so that a tombstone doesn't fit.
+    const size_t maxSize = headerSize + kBlobCount * recordSize;
+    {
+        BlobPackFile packFile;
+        ASSERT_TRUE(packFile.open(mPath, maxSize));
+        for (uint8_t keyIndex = 0; keyIndex < kBlobCount; ++keyIndex)
+        {
+            std::vector<uint8_t> blob = MakeBlob(kBlobSize, keyIndex);
+            EXPECT_TRUE(packFile.put(MakeKey(keyIndex), blob.data(), blob.size()));
+        }
+        ASSERT_EQ(maxSize, packFile.fileSize());
+
+        packFile.remove(MakeKey(0));
+        EXPECT_LE(packFile.fileSize(), maxSize);
+    }
+
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, maxSize));
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    EXPECT_FALSE(packFile.get(MakeKey(0), &data, &size));
+}
+
+// Test that compaction drops records that were corrupted after they were written.
+TEST_F(BlobPackFileTest, CompactionDropsCorruptRecords)
+{
+    // The records have no padding, so the last byte of a record is part of its payload.
+    std::vector<uint8_t> blob = MakeBlob(64, 0);
+    size_t firstRecordEnd     = 0;
+
+    {
+        BlobPackFile packFile;
+        ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+        EXPECT_TRUE(packFile.put(MakeKey(0), blob.data(), blob.size()));
+        firstRecordEnd = packFile.fileSize();
+        EXPECT_TRUE(packFile.put(MakeKey(1), blob.data(), blob.size()));
+    }
+
+    {
+        FILE *file = fopen(mPath.c_str(), "r+b");
+        ASSERT_NE(nullptr, file);
+        fseek(file, static_cast<long>(firstRecordEnd - 1), SEEK_SET);
+        fputc(~blob.back() & 0xFF, file);
+        fclose(file);
+    }
+
+    // Only the last record is verified when the file is opened.
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+    EXPECT_EQ(2u, packFile.entryCount());
+
+    EXPECT_TRUE(packFile.compact(kMaxSize));
+    EXPECT_EQ(1u, packFile.entryCount());
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(1), blob));
+
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+    EXPECT_FALSE(packFile.get(MakeKey(0), &data, &size));
+}
+
+// Test that a pack file can't be opened twice at the same time.
+TEST_F(BlobPackFileTest, SingleOwner)
+{
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+
+    BlobPackFile otherPackFile;
+    EXPECT_FALSE(otherPackFile.open(mPath, kMaxSize));
+    EXPECT_FALSE(otherPackFile.isOpen());
+
+    packFile.close();
+    EXPECT_TRUE(otherPackFile.open(mPath, kMaxSize));
+}
+
+// Test that a file with an unknown header is discarded.
+TEST_F(BlobPackFileTest, InvalidHeader)
+{
+    {
+        FILE *file = fopen(mPath.c_str(), "wb");
+        ASSERT_NE(nullptr, file);
+        const char kGarbage[] = "not a blob cache file";
+        fwrite(kGarbage, sizeof(kGarbage), 1, file);
+        fclose(file);
+    }
+
+    BlobPackFile packFile;
+    ASSERT_TRUE(packFile.open(mPath, kMaxSize));
+    EXPECT_EQ(0u, packFile.entryCount());
+
+    std::vector<uint8_t> blob = MakeBlob(16, 0);
+    EXPECT_TRUE(packFile.put(MakeKey(0), blob.data(), blob.size()));
+    EXPECT_TRUE(BlobMatches(&packFile, MakeKey(0), blob));
+}
+}  // anonymous namespace
+}  // namespace egl
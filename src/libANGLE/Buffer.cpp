@@ -19,6 +19,10 @@ namespace gl
 namespace
 {
 constexpr angle::SubjectIndex kImplementationSubjectIndex = 0;
+
+// The minimum number of whole blocks a draw has to cover for its index range to be computed from
+// the block ranges.
+constexpr size_t kMinIndexRangeBlockCount = 2;
 }  // anonymous namespace
 
 BufferState::BufferState()
@@ -210,8 +214,7 @@ angle::Result Buffer::bufferSubData(const Context *context,
 {
     ANGLE_TRY(mImpl->setSubData(context, target, data, size, offset));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                     static_cast<unsigned int>(size));
+    mIndexRangeCache.invalidateRange(static_cast<size_t>(offset), static_cast<size_t>(size));
 
     // Notify when data changes.
     onStateChange(angle::SubjectMessage::ContentsChanged);
@@ -228,8 +231,7 @@ angle::Result Buffer::copyBufferSubData(const Context *context,
     ANGLE_TRY(
         mImpl->copySubData(context, source->getImplementation(), sourceOffset, destOffset, size));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(destOffset),
-                                     static_cast<unsigned int>(size));
+    mIndexRangeCache.invalidateRange(static_cast<size_t>(destOffset), static_cast<size_t>(size));
 
     // Notify when data changes.
     onStateChange(angle::SubjectMessage::ContentsChanged);
@@ -283,8 +285,7 @@ angle::Result Buffer::mapRange(const Context *context,
 
     if ((access & GL_MAP_WRITE_BIT) > 0)
     {
-        mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                         static_cast<unsigned int>(length));
+        mIndexRangeCache.invalidateRange(static_cast<size_t>(offset), static_cast<size_t>(length));
     }
 
     // Notify when state changes.
@@ -335,14 +336,94 @@ angle::Result Buffer::getIndexRange(const gl::Context *context,
         return angle::Result::Continue;
     }
 
-    ANGLE_TRY(
-        mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    // Draws that cover a few blocks are assembled from the cached block ranges, so that a partial
+    // update of the buffer doesn't require scanning all of their indices again.
+    constexpr size_t kBlockSize = IndexRangeCache::kBlockSize;
+    size_t end                  = offset + count * GetDrawElementsTypeSize(type);
+    size_t firstBlock           = rx::roundUpPow2(offset, kBlockSize) / kBlockSize;
+    size_t endBlock             = end / kBlockSize;
+    if (endBlock >= firstBlock + kMinIndexRangeBlockCount)
+    {
+        ANGLE_TRY(getIndexRangeFromBlocks(context, type, offset, count, primitiveRestartEnabled,
+                                          outRange));
+    }
+    else
+    {
+        ANGLE_TRY(
+            mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    }
 
     mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
 
     return angle::Result::Continue;
 }
 
+angle::Result Buffer::getIndexRangeFromBlocks(const gl::Context *context,
+                                              DrawElementsType type,
+                                              size_t offset,
+                                              size_t count,
+                                              bool primitiveRestartEnabled,
+                                              IndexRange *outRange) const
+{
+    constexpr size_t kBlockSize = IndexRangeCache::kBlockSize;
+    const size_t typeBytes      = GetDrawElementsTypeSize(type);
+    const size_t end            = offset + count * typeBytes;
+    const size_t blocksStart    = rx::roundUpPow2(offset, kBlockSize);
+    const size_t blocksEnd      = end - end % kBlockSize;
+
+    // Gather the spans that need to be scanned: the unaligned ends of the draw, and the blocks that
+    // aren't cached.  They are all read at once by the backend.
+    IndexRange range(0, 0, 0);
+    std::vector<IndexSpan> spans;
+    if (offset < blocksStart)
+    {
+        spans.push_back({offset, (blocksStart - offset) / typeBytes});
+    }
+    if (blocksEnd < end)
+    {
+        spans.push_back({blocksEnd, (end - blocksEnd) / typeBytes});
+    }
+    const size_t unalignedSpanCount = spans.size();
+
+    for (size_t blockOffset = blocksStart; blockOffset < blocksEnd; blockOffset += kBlockSize)
+    {
+        IndexRange blockRange;
+        if (mIndexRangeCache.findBlockRange(type, primitiveRestartEnabled, blockOffset / kBlockSize,
+                                            &blockRange))
+        {
+            range = MergeIndexRanges(range, blockRange);
+        }
+        else
+        {
+            spans.push_back({blockOffset, kBlockSize / typeBytes});
+        }
+    }
+
+    if (spans.empty())
+    {
+        *outRange = range;
+        return angle::Result::Continue;
+    }
+
+    std::vector<IndexRange> spanRanges;
+    ANGLE_TRY(mImpl->getIndexRanges(context, type, spans, primitiveRestartEnabled, &spanRanges));
+    ASSERT(spanRanges.size() == spans.size());
+
+    for (size_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex)
+    {
+        if (spanIndex >= unalignedSpanCount)
+        {
+            mIndexRangeCache.addBlockRange(type, primitiveRestartEnabled,
+                                           spans[spanIndex].offset / kBlockSize,
+                                           spanRanges[spanIndex]);
+        }
+        range = MergeIndexRanges(range, spanRanges[spanIndex]);
+    }
+
+    *outRange = range;
+    return angle::Result::Continue;
+}
+
 GLint64 Buffer::getMemorySize() const
 {
     GLint64 implSize = mImpl->getMemorySize();
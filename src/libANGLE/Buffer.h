@@ -177,6 +177,12 @@ class Buffer final : public RefCountObject<BufferID>,
                                          GLeglClientBufferEXT clientBuffer,
                                          GLsizeiptr size,
                                          GLbitfield flags);
+    angle::Result getIndexRangeFromBlocks(const gl::Context *context,
+                                          DrawElementsType type,
+                                          size_t offset,
+                                          size_t count,
+                                          bool primitiveRestartEnabled,
+                                          IndexRange *outRange) const;
 
     BufferState mState;
     rx::BufferImpl *mImpl;
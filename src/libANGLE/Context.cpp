@@ -671,6 +671,9 @@ egl::Error Context::onDestroy(const egl::Display *display)
         }
     }
 
+    // Programs linking in the worker thread pool may refer to this context.
+    mState.mShaderProgramManager->resolveLinks(this);
+
     releaseShaderCompiler();
 
     mState.reset(this);
@@ -8582,6 +8585,7 @@ void Context::eGLImageTargetTexture2D(TextureType target, GLeglImageOES image)
 {
     Texture *texture        = getTextureByType(target);
     egl::Image *imageObject = static_cast<egl::Image *>(image);
+    getShareGroup()->onImageSiblingAdded();
     ANGLE_CONTEXT_TRY(texture->setEGLImageTarget(this, target, imageObject));
 }
 
@@ -8589,6 +8593,7 @@ void Context::eGLImageTargetRenderbufferStorage(GLenum target, GLeglImageOES ima
 {
     Renderbuffer *renderbuffer = mState.getCurrentRenderbuffer();
     egl::Image *imageObject    = static_cast<egl::Image *>(image);
+    getShareGroup()->onImageSiblingAdded();
     ANGLE_CONTEXT_TRY(renderbuffer->setStorageEGLImageTarget(this, imageObject));
 }
 
@@ -9019,11 +9024,22 @@ void Context::onGPUSwitch()
     initRendererString();
 }
 
-std::mutex &Context::getProgramCacheMutex() const
+std::recursive_mutex &Context::getProgramCacheMutex() const
 {
     return mDisplay->getProgramCacheMutex();
 }
 
+MemoryShaderCache *Context::getMemoryShaderCache() const
+{
+    // The shader cache follows the program cache, which may be disabled for this context.
+    if (mMemoryProgramCache == nullptr ||
+        !mDisplay->getFrontendFeatures().cacheCompiledShader.enabled)
+    {
+        return nullptr;
+    }
+    return &mDisplay->getMemoryShaderCache();
+}
+
 bool Context::supportsGeometryOrTesselation() const
 {
     return mState.getClientVersion() == ES_3_2 || mState.getExtensions().geometryShaderAny() ||
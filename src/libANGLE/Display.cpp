@@ -144,6 +144,11 @@ rx::DisplayImpl *CreateDisplayFromDevice(Device *eglDevice, const DisplayState &
     return impl;
 }
 
+// Environment variable (and associated Android property) naming the file used to persist the blob
+// cache.
+constexpr char kBlobCachePathVarName[]      = "ANGLE_BLOB_CACHE_PATH";
+constexpr char kBlobCachePathPropertyName[] = "debug.angle.blob_cache_path";
+
 // On platforms with support for multiple back-ends, allow an environment variable to control
 // the default.  This is useful to run angle with benchmarks without having to modify the
 // benchmark source.  Possible values for this environment variable (ANGLE_DEFAULT_PLATFORM)
@@ -529,7 +534,9 @@ static constexpr uint32_t kScratchBufferLifetime = 64u;
 ShareGroup::ShareGroup(rx::EGLImplFactory *factory)
     : mRefCount(1),
       mImplementation(factory->createShareGroup()),
-      mFrameCaptureShared(new angle::FrameCaptureShared)
+      mFrameCaptureShared(new angle::FrameCaptureShared),
+      mMutex(std::make_shared<std::recursive_mutex>()),
+      mHasImageSiblings(false)
 {}
 
 ShareGroup::~ShareGroup()
@@ -555,6 +562,24 @@ void ShareGroup::release(const Display *display)
     }
 }
 
+// ScopedShareGroupLock
+ScopedShareGroupLock::ScopedShareGroupLock(const gl::Context *context)
+{
+    if (context != nullptr)
+    {
+        mMutex = context->getShareGroup()->getMutex();
+        mMutex->lock();
+    }
+}
+
+ScopedShareGroupLock::~ScopedShareGroupLock()
+{
+    if (mMutex)
+    {
+        mMutex->unlock();
+    }
+}
+
 // DisplayState
 DisplayState::DisplayState(EGLNativeDisplayType nativeDisplayId)
     : label(nullptr), featuresAllDisabled(false), displayId(nativeDisplayId)
@@ -735,6 +760,7 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mSemaphoreManager(nullptr),
       mBlobCache(gl::kDefaultMaxProgramCacheMemoryBytes),
       mMemoryProgramCache(mBlobCache),
+      mMemoryShaderCache(mBlobCache, mProgramCacheMutex),
       mGlobalTextureShareGroupUsers(0),
       mGlobalSemaphoreShareGroupUsers(0)
 {}
@@ -859,6 +885,18 @@ Error Display::initialize()
         mBlobCache.resize(1024 * 1024);
     }
 
+    // Opt-in persistent cache, for applications that can't provide their own cache callbacks.
+    std::string blobCachePath = angle::GetEnvironmentVarOrAndroidProperty(
+        kBlobCachePathVarName, kBlobCachePathPropertyName);
+    if (blobCachePath.empty())
+    {
+        mBlobCache.disableDiskCache();
+    }
+    else if (!mBlobCache.enableDiskCache(blobCachePath, kDefaultMaxBlobCacheDiskSizeBytes))
+    {
+        WARN() << "Could not open blob cache file " << blobCachePath;
+    }
+
     setGlobalDebugAnnotator();
 
     gl::InitializeDebugMutexIfNeeded();
@@ -1188,6 +1226,9 @@ Error Display::createImage(const gl::Context *context,
         ANGLE_TRY(restoreLostDevice());
     }
 
+    // The sibling may be an object of a share group that is in use by other contexts.
+    ScopedShareGroupLock shareGroupLock(context);
+
     egl::ImageSibling *sibling = nullptr;
     if (IsTextureTarget(target))
     {
@@ -1207,6 +1248,11 @@ Error Display::createImage(const gl::Context *context,
     }
     ASSERT(sibling != nullptr);
 
+    if (IsTextureTarget(target) || IsRenderbufferTarget(target))
+    {
+        context->getShareGroup()->onImageSiblingAdded();
+    }
+
     angle::UniqueObjectPointer<Image, Display> imagePtr(
         new Image(mImplementation, context, target, sibling, attribs), this);
     ANGLE_TRY(imagePtr->initialize(this));
@@ -1251,6 +1297,9 @@ Error Display::createContext(const Config *configuration,
         ANGLE_TRY(restoreLostDevice());
     }
 
+    // The new context joins the share group, while its other contexts may be in use.
+    ScopedShareGroupLock shareGroupLock(shareContext);
+
     // This display texture sharing will allow the first context to create the texture share group.
     bool usingDisplayTextureShareGroup =
         attribs.get(EGL_DISPLAY_TEXTURE_SHARE_GROUP_ANGLE, EGL_FALSE) == EGL_TRUE;
@@ -1365,6 +1414,10 @@ Error Display::makeCurrent(Thread *thread,
         return NoError();
     }
 
+    // The EGL entry points already lock the share group of the previous context, as the current
+    // context of the thread or the context being destroyed.
+    ScopedShareGroupLock shareGroupLock(context);
+
     // If the context is changing we need to update the reference counts. If it's not, e.g. just
     // changing the surfaces leave the reference count alone. Otherwise the reference count might go
     // to zero even though we know we are not done with the context.
@@ -1517,6 +1570,8 @@ Error Display::releaseContext(gl::Context *context)
 
 Error Display::destroyContext(Thread *thread, gl::Context *context)
 {
+    ScopedShareGroupLock shareGroupLock(context);
+
     context->release();
 
     auto *currentContext     = thread->getContext();
@@ -1922,6 +1977,11 @@ void Display::initializeFrontendFeatures()
     // No longer enable this on any Impl - crbug.com/1165751
     ANGLE_FEATURE_CONDITION((&mFrontendFeatures), scalarizeVecAndMatConstructorArgs, false);
 
+    // Disabled by default until the async link has seen more testing.
+    ANGLE_FEATURE_CONDITION((&mFrontendFeatures), asyncLinkProgram, false);
+
+    ANGLE_FEATURE_CONDITION((&mFrontendFeatures), cacheCompiledShader, true);
+
     mImplementation->initializeFrontendFeatures(&mFrontendFeatures);
 
     rx::ApplyFeatureOverrides(&mFrontendFeatures, mState);
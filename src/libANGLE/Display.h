@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <memory>
 #include <mutex>
 #include <set>
 #include <vector>
@@ -24,6 +25,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/Observer.h"
 #include "libANGLE/Version.h"
 #include "platform/Feature.h"
@@ -91,6 +93,17 @@ class ShareGroup final : angle::NonCopyable
 
     ContextSet *getContexts() { return &mContexts; }
 
+    // The GL calls of shared contexts are serialized with the other contexts of their share group
+    // only, so contexts of different share groups don't contend.  EGL calls lock it on top of the
+    // global mutex, and hold a reference to it as they may release the share group.
+    const std::shared_ptr<std::recursive_mutex> &getMutex() const { return mMutex; }
+
+    // Set when an object of the share group becomes an EGL image sibling.  The image may have
+    // siblings in other share groups, so from then on the GL calls of the share group take the
+    // global mutex instead.  Only accessed with the mutex held.  Once set, it cannot be undone.
+    void onImageSiblingAdded() { mHasImageSiblings = true; }
+    bool hasImageSiblings() const { return mHasImageSiblings; }
+
   protected:
     ~ShareGroup();
 
@@ -104,6 +117,20 @@ class ShareGroup final : angle::NonCopyable
 
     // The list of contexts within the share group
     ContextSet mContexts;
+
+    std::shared_ptr<std::recursive_mutex> mMutex;
+    bool mHasImageSiblings;
+};
+
+// Locks the share group of a context, if any, for the duration of an EGL call.
+class ScopedShareGroupLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedShareGroupLock(const gl::Context *context);
+    ~ScopedShareGroupLock();
+
+  private:
+    std::shared_ptr<std::recursive_mutex> mMutex;
 };
 
 // Constant coded here as a reasonable limit.
@@ -224,6 +251,7 @@ class Display final : public LabeledObject,
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
     bool areBlobCacheFuncsSet() const { return mBlobCache.areBlobCacheFuncsSet(); }
     BlobCache &getBlobCache() { return mBlobCache; }
+    gl::MemoryShaderCache &getMemoryShaderCache() { return mMemoryShaderCache; }
 
     static EGLClientBuffer GetNativeClientBuffer(const struct AHardwareBuffer *buffer);
     static Error CreateNativeClientBuffer(const egl::AttributeMap &attribMap,
@@ -287,7 +315,7 @@ class Display final : public LabeledObject,
     egl::Error handleGPUSwitch();
 
     std::mutex &getDisplayGlobalMutex() { return mDisplayGlobalMutex; }
-    std::mutex &getProgramCacheMutex() { return mProgramCacheMutex; }
+    std::recursive_mutex &getProgramCacheMutex() { return mProgramCacheMutex; }
 
     // Installs LoggingAnnotator as the global DebugAnnotator, for back-ends that do not implement
     // their own DebugAnnotator.
@@ -353,6 +381,7 @@ class Display final : public LabeledObject,
     gl::SemaphoreManager *mSemaphoreManager;
     BlobCache mBlobCache;
     gl::MemoryProgramCache mMemoryProgramCache;
+    gl::MemoryShaderCache mMemoryShaderCache;
     size_t mGlobalTextureShareGroupUsers;
     size_t mGlobalSemaphoreShareGroupUsers;
 
@@ -365,7 +394,8 @@ class Display final : public LabeledObject,
     std::vector<angle::ScratchBuffer> mZeroFilledBuffers;
 
     std::mutex mDisplayGlobalMutex;
-    std::mutex mProgramCacheMutex;
+    // Recursive, as backends access the blob cache while loading a program out of the cache.
+    std::recursive_mutex mProgramCacheMutex;
 };
 
 }  // namespace egl
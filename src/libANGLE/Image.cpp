@@ -110,6 +110,11 @@ bool ImageSibling::isEGLImageTarget() const
     return (mTargetOf.get() != nullptr);
 }
 
+bool ImageSibling::isEGLImageSource() const
+{
+    return !mSourcesOf.empty();
+}
+
 gl::InitState ImageSibling::sourceEGLImageInitState() const
 {
     ASSERT(isEGLImageTarget());
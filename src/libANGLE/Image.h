@@ -45,6 +45,7 @@ class ImageSibling : public gl::FramebufferAttachmentObject
     ~ImageSibling() override;
 
     bool isEGLImageTarget() const;
+    bool isEGLImageSource() const;
     gl::InitState sourceEGLImageInitState() const;
     void setSourceEGLImageInitState(gl::InitState initState) const;
 
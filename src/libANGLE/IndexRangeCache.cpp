@@ -14,6 +14,17 @@
 
 namespace gl
 {
+namespace
+{
+size_t GetSizeClass(size_t size)
+{
+    if (size <= 1)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(ScanReverse(static_cast<uint64_t>(size - 1))) + 1;
+}
+}  // anonymous namespace
 
 IndexRangeCache::IndexRangeCache() {}
 
@@ -25,7 +36,11 @@ void IndexRangeCache::addRange(DrawElementsType type,
                                bool primitiveRestartEnabled,
                                const IndexRange &range)
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    IndexRangeKey key(type, offset, count, primitiveRestartEnabled);
+    ASSERT(key.sizeClass < kSizeClassCount);
+
+    mIndexRangeCache[key] = range;
+    mUsedSizeClasses.set(key.sizeClass);
 }
 
 bool IndexRangeCache::findRange(DrawElementsType type,
@@ -53,25 +68,92 @@ bool IndexRangeCache::findRange(DrawElementsType type,
     }
 }
 
+void IndexRangeCache::addBlockRange(DrawElementsType type,
+                                    bool primitiveRestartEnabled,
+                                    size_t block,
+                                    const IndexRange &range)
+{
+    std::vector<BlockRange> &blockRanges = mBlockRanges[type][primitiveRestartEnabled];
+    if (block >= blockRanges.size())
+    {
+        blockRanges.resize(block + 1);
+    }
+
+    blockRanges[block].range = range;
+    blockRanges[block].valid = true;
+}
+
+bool IndexRangeCache::findBlockRange(DrawElementsType type,
+                                     bool primitiveRestartEnabled,
+                                     size_t block,
+                                     IndexRange *outRange) const
+{
+    const std::vector<BlockRange> &blockRanges = mBlockRanges[type][primitiveRestartEnabled];
+    if (block >= blockRanges.size() || !blockRanges[block].valid)
+    {
+        return false;
+    }
+
+    *outRange = blockRanges[block].range;
+    return true;
+}
+
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
+    if (size == 0)
+    {
+        return;
+    }
+
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    // The loop clears the bits of the size classes that become empty.
+    angle::BitSet64<kSizeClassCount> usedSizeClasses = mUsedSizeClasses;
+    for (size_t sizeClass : usedSizeClasses)
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd =
-            i->first.offset + (GetDrawElementsTypeSize(i->first.type) * i->first.count);
+        // A range of this class that overlaps the invalidated bytes can't start further than
+        // its maximum size before them.
+        size_t maxSize    = static_cast<size_t>(1) << sizeClass;
+        size_t firstStart = invalidateStart > maxSize ? invalidateStart - maxSize : 0;
+
+        bool erased = false;
+        auto i      = mIndexRangeCache.lower_bound(IndexRangeKey::First(sizeClass, firstStart));
+        while (i != mIndexRangeCache.end() && i->first.sizeClass == sizeClass &&
+               i->first.offset < invalidateEnd)
+        {
+            if (i->first.end() > invalidateStart)
+            {
+                i      = mIndexRangeCache.erase(i);
+                erased = true;
+            }
+            else
+            {
+                ++i;
+            }
+        }
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+        if (erased)
         {
-            ++i;
+            auto classBegin = mIndexRangeCache.lower_bound(IndexRangeKey::First(sizeClass, 0));
+            if (classBegin == mIndexRangeCache.end() || classBegin->first.sizeClass != sizeClass)
+            {
+                mUsedSizeClasses.reset(sizeClass);
+            }
         }
-        else
+    }
+
+    size_t firstBlock = invalidateStart / kBlockSize;
+    size_t lastBlock  = (invalidateEnd - 1) / kBlockSize;
+    for (BlockRanges &typeBlockRanges : mBlockRanges)
+    {
+        for (std::vector<BlockRange> &blockRanges : typeBlockRanges)
         {
-            mIndexRangeCache.erase(i++);
+            size_t endBlock = std::min(lastBlock + 1, blockRanges.size());
+            for (size_t block = firstBlock; block < endBlock; ++block)
+            {
+                blockRanges[block].valid = false;
+            }
         }
     }
 }
@@ -79,29 +161,52 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
-}
+    mUsedSizeClasses.reset();
 
-IndexRangeCache::IndexRangeKey::IndexRangeKey()
-    : IndexRangeCache::IndexRangeKey(DrawElementsType::InvalidEnum, 0, 0, false)
-{}
+    for (BlockRanges &typeBlockRanges : mBlockRanges)
+    {
+        for (std::vector<BlockRange> &blockRanges : typeBlockRanges)
+        {
+            blockRanges.clear();
+        }
+    }
+}
 
 IndexRangeCache::IndexRangeKey::IndexRangeKey(DrawElementsType type_,
                                               size_t offset_,
                                               size_t count_,
                                               bool primitiveRestartEnabled_)
-    : type(type_), offset(offset_), count(count_), primitiveRestartEnabled(primitiveRestartEnabled_)
+    : sizeClass(GetSizeClass(count_ * GetDrawElementsTypeSize(type_))),
+      offset(offset_),
+      count(count_),
+      type(type_),
+      primitiveRestartEnabled(primitiveRestartEnabled_)
 {}
 
+// static
+IndexRangeCache::IndexRangeKey IndexRangeCache::IndexRangeKey::First(size_t sizeClass,
+                                                                     size_t offset)
+{
+    // Sorts before every key of this size class that starts at |offset| or later.
+    IndexRangeKey key(DrawElementsType::UnsignedByte, offset, 0, true);
+    key.sizeClass = sizeClass;
+    return key;
+}
+
 bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
 {
-    if (type != rhs.type)
+    if (sizeClass != rhs.sizeClass)
     {
-        return type < rhs.type;
+        return sizeClass < rhs.sizeClass;
     }
     if (offset != rhs.offset)
     {
         return offset < rhs.offset;
     }
+    if (type != rhs.type)
+    {
+        return type < rhs.type;
+    }
     if (count != rhs.count)
     {
         return count < rhs.count;
@@ -113,4 +218,24 @@ bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
     return false;
 }
 
+size_t IndexRangeCache::IndexRangeKey::end() const
+{
+    return offset + GetDrawElementsTypeSize(type) * count;
+}
+
+IndexRange MergeIndexRanges(const IndexRange &first, const IndexRange &second)
+{
+    // A span made only of primitive restart indices has an empty range.
+    if (first.vertexIndexCount == 0)
+    {
+        return second;
+    }
+    if (second.vertexIndexCount == 0)
+    {
+        return first;
+    }
+    return IndexRange(std::min(first.start, second.start), std::max(first.end, second.end),
+                      first.vertexIndexCount + second.vertexIndexCount);
+}
+
 }  // namespace gl
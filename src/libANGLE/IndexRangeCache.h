@@ -13,16 +13,29 @@
 #include "angle_gl.h"
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "common/mathutil.h"
 
+#include <array>
 #include <map>
+#include <vector>
 
 namespace gl
 {
 
+// Caches two kinds of index ranges of a buffer:
+//
+// - The exact ranges of draw calls.  They are kept in an interval index so that updating a part of
+//   the buffer only visits the ranges that may overlap it, instead of every cached range.
+// - The ranges of aligned blocks of the buffer.  A large draw whose range isn't cached can be
+//   assembled from these, so that after a partial update only the modified blocks and the
+//   unaligned ends of the draw need to be scanned again.
 class IndexRangeCache
 {
   public:
+    // Size in bytes of the blocks summarized by addBlockRange.
+    static constexpr size_t kBlockSize = 4096;
+
     IndexRangeCache();
     ~IndexRangeCache();
 
@@ -37,27 +50,62 @@ class IndexRangeCache
                    bool primitiveRestartEnabled,
                    IndexRange *outRange) const;
 
+    // |block| is the byte offset of the block divided by kBlockSize.
+    void addBlockRange(DrawElementsType type,
+                       bool primitiveRestartEnabled,
+                       size_t block,
+                       const IndexRange &range);
+    bool findBlockRange(DrawElementsType type,
+                        bool primitiveRestartEnabled,
+                        size_t block,
+                        IndexRange *outRange) const;
+
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
+    size_t getRangeCount() const { return mIndexRangeCache.size(); }
+
   private:
+    // Ranges are grouped by the power of two above their size in bytes.  All the ranges of a size
+    // class that overlap [offset, offset + size) start in [offset - 2^sizeClass, offset + size),
+    // which is a single lookup in the map.
+    static constexpr size_t kSizeClassCount = 64;
+
     struct IndexRangeKey
     {
-        IndexRangeKey();
         IndexRangeKey(DrawElementsType type, size_t offset, size_t count, bool primitiveRestart);
 
+        static IndexRangeKey First(size_t sizeClass, size_t offset);
+
         bool operator<(const IndexRangeKey &rhs) const;
 
-        DrawElementsType type;
+        size_t end() const;
+
+        size_t sizeClass;
         size_t offset;
         size_t count;
+        DrawElementsType type;
         bool primitiveRestartEnabled;
     };
 
+    struct BlockRange
+    {
+        IndexRange range;
+        bool valid = false;
+    };
+    using BlockRanges = std::array<std::vector<BlockRange>, 2>;
+
     typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
     IndexRangeMap mIndexRangeCache;
+    angle::BitSet64<kSizeClassCount> mUsedSizeClasses;
+
+    // Indexed by type, then by whether primitive restart is enabled.
+    angle::PackedEnumMap<DrawElementsType, BlockRanges> mBlockRanges;
 };
 
+// Combines the ranges of two adjacent spans of indices.
+IndexRange MergeIndexRanges(const IndexRange &first, const IndexRange &second);
+
 }  // namespace gl
 
 #endif  // LIBANGLE_INDEXRANGECACHE_H_
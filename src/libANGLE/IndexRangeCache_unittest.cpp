@@ -0,0 +1,164 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the index range cache.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace gl
+{
+namespace
+{
+constexpr size_t kBlockSize = IndexRangeCache::kBlockSize;
+
+void ExpectRangeEq(const IndexRange &expected, const IndexRange &actual)
+{
+    EXPECT_EQ(expected.start, actual.start);
+    EXPECT_EQ(expected.end, actual.end);
+    EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+}
+
+bool HasRange(const IndexRangeCache &cache, DrawElementsType type, size_t offset, size_t count)
+{
+    return cache.findRange(type, offset, count, false, nullptr);
+}
+
+// Test that ranges are only found with the exact same parameters.
+TEST(IndexRangeCacheTest, AddFind)
+{
+    IndexRangeCache cache;
+    cache.addRange(DrawElementsType::UnsignedShort, 16, 100, false, IndexRange(3, 70, 100));
+
+    IndexRange range;
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedShort, 16, 100, false, &range));
+    ExpectRangeEq(IndexRange(3, 70, 100), range);
+
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedShort, 16, 100, true, &range));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedInt, 16, 100, false, &range));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedShort, 18, 100, false, &range));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedShort, 16, 99, false, &range));
+
+    // Replacing a range keeps a single entry.
+    cache.addRange(DrawElementsType::UnsignedShort, 16, 100, false, IndexRange(1, 2, 100));
+    EXPECT_EQ(1u, cache.getRangeCount());
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedShort, 16, 100, false, &range));
+    ExpectRangeEq(IndexRange(1, 2, 100), range);
+}
+
+// Test that invalidation only removes the ranges that overlap the modified bytes.
+TEST(IndexRangeCacheTest, InvalidateOverlapping)
+{
+    IndexRangeCache cache;
+
+    // Bytes [0, 200), [200, 400), [400, 600) and [1000, 1004).
+    cache.addRange(DrawElementsType::UnsignedShort, 0, 100, false, IndexRange(0, 1, 100));
+    cache.addRange(DrawElementsType::UnsignedShort, 200, 100, false, IndexRange(0, 1, 100));
+    cache.addRange(DrawElementsType::UnsignedInt, 400, 50, false, IndexRange(0, 1, 50));
+    cache.addRange(DrawElementsType::UnsignedByte, 1000, 4, false, IndexRange(0, 1, 4));
+
+    // Touching the end of a range without overlapping it doesn't invalidate it.
+    cache.invalidateRange(600, 10);
+    EXPECT_EQ(4u, cache.getRangeCount());
+
+    cache.invalidateRange(399, 2);
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 100));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 200, 100));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedInt, 400, 50));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedByte, 1000, 4));
+
+    cache.invalidateRange(1003, 1);
+    EXPECT_EQ(1u, cache.getRangeCount());
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 100));
+
+    // Empty invalidations are ignored.
+    cache.invalidateRange(50, 0);
+    EXPECT_EQ(1u, cache.getRangeCount());
+}
+
+// Test that a large range is invalidated by updates far from its start, and that small ranges
+// around it are kept.
+TEST(IndexRangeCacheTest, InvalidateMixedSizes)
+{
+    IndexRangeCache cache;
+    constexpr size_t kLargeCount = 1 << 20;
+
+    cache.addRange(DrawElementsType::UnsignedInt, 0, kLargeCount, false,
+                   IndexRange(0, 5, kLargeCount));
+    for (size_t offset = 0; offset < 64 * 1024; offset += 256)
+    {
+        cache.addRange(DrawElementsType::UnsignedShort, offset, 16, true, IndexRange(0, 5, 16));
+    }
+    EXPECT_EQ(257u, cache.getRangeCount());
+
+    // Only overlaps the large range and a single small one.
+    cache.invalidateRange(32 * 1024 + 8, 4);
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedInt, 0, kLargeCount));
+    EXPECT_EQ(255u, cache.getRangeCount());
+
+    // The size class of the large range is empty, so invalidating beyond the small ranges is free
+    // and doesn't remove anything.
+    cache.invalidateRange(1024 * 1024, 4);
+    EXPECT_EQ(255u, cache.getRangeCount());
+
+    cache.invalidateRange(0, 64 * 1024);
+    EXPECT_EQ(0u, cache.getRangeCount());
+}
+
+// Test that block ranges are stored separately for every type and primitive restart setting, and
+// that they are invalidated along with the ranges.
+TEST(IndexRangeCacheTest, BlockRanges)
+{
+    IndexRangeCache cache;
+    IndexRange range;
+
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 0, &range));
+
+    for (size_t block = 0; block < 4; ++block)
+    {
+        cache.addBlockRange(DrawElementsType::UnsignedShort, false, block,
+                            IndexRange(block, block + 10, kBlockSize / 2));
+    }
+    cache.addBlockRange(DrawElementsType::UnsignedShort, true, 1, IndexRange(0, 0, 0));
+
+    EXPECT_TRUE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 2, &range));
+    ExpectRangeEq(IndexRange(2, 12, kBlockSize / 2), range);
+    EXPECT_TRUE(cache.findBlockRange(DrawElementsType::UnsignedShort, true, 1, &range));
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedShort, true, 2, &range));
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedInt, false, 2, &range));
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 4, &range));
+
+    // Straddles the end of block 1 and the start of block 2.
+    cache.invalidateRange(2 * kBlockSize - 2, 4);
+    EXPECT_TRUE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 0, &range));
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 1, &range));
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 2, &range));
+    EXPECT_TRUE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 3, &range));
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedShort, true, 1, &range));
+
+    // Invalidating past the last block is fine.
+    cache.invalidateRange(100 * kBlockSize, kBlockSize);
+    EXPECT_TRUE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 3, &range));
+
+    cache.clear();
+    EXPECT_FALSE(cache.findBlockRange(DrawElementsType::UnsignedShort, false, 0, &range));
+}
+
+// Test merging the ranges of adjacent spans.
+TEST(IndexRangeCacheTest, MergeIndexRanges)
+{
+    ExpectRangeEq(IndexRange(2, 30, 15),
+                  MergeIndexRanges(IndexRange(5, 30, 10), IndexRange(2, 8, 5)));
+
+    // Spans made only of primitive restart indices don't contribute to the range.
+    ExpectRangeEq(IndexRange(5, 30, 10),
+                  MergeIndexRanges(IndexRange(0, 0, 0), IndexRange(5, 30, 10)));
+    ExpectRangeEq(IndexRange(5, 30, 10),
+                  MergeIndexRanges(IndexRange(5, 30, 10), IndexRange(0, 0, 0)));
+    ExpectRangeEq(IndexRange(0, 0, 0), MergeIndexRanges(IndexRange(0, 0, 0), IndexRange(0, 0, 0)));
+}
+}  // anonymous namespace
+}  // namespace gl
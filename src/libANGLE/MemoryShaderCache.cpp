@@ -0,0 +1,166 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores the results of shader compiles in memory so identical shaders don't
+//   always have to be re-translated. Shares the display's blob cache with the program cache, so
+//   the entries also reach the application's blob cache callbacks and the disk cache.
+
+#include "libANGLE/MemoryShaderCache.h"
+
+#include <anglebase/sha1.h>
+
+#include "common/angle_version.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Shader.h"
+#include "libANGLE/histogram_macros.h"
+
+namespace gl
+{
+
+namespace
+{
+constexpr unsigned int kWarningLimit = 3;
+
+class HashStream final : angle::NonCopyable
+{
+  public:
+    std::string str() { return mStringStream.str(); }
+
+    template <typename T>
+    HashStream &operator<<(T value)
+    {
+        mStringStream << value << kSeparator;
+        return *this;
+    }
+
+  private:
+    static constexpr char kSeparator = ':';
+    std::ostringstream mStringStream;
+};
+}  // anonymous namespace
+
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache,
+                                     std::recursive_mutex &blobCacheMutex)
+    : mBlobCache(blobCache), mBlobCacheMutex(blobCacheMutex), mIssuedWarnings(0)
+{}
+
+MemoryShaderCache::~MemoryShaderCache() {}
+
+void MemoryShaderCache::ComputeHash(const Context *context,
+                                    const Shader *shader,
+                                    ShCompileOptions compileOptions,
+                                    egl::BlobCache::Key *hashOut)
+{
+    // Start with the shader source and the parameters of the translation.
+    HashStream hashStream;
+    hashStream << shader->getSourceString().c_str() << shader->getSourceString().length()
+               << static_cast<int>(shader->getType()) << compileOptions
+               << shader->getCompilerResourcesString().c_str();
+
+    // Add some ANGLE metadata and Context properties, such as version and back-end.  The back-ends
+    // add compile options based on their features, WebGL and the client version.
+    hashStream << ANGLE_COMMIT_HASH << context->getClientMajorVersion()
+               << context->getClientMinorVersion() << context->getString(GL_RENDERER)
+               << context->getExtensions().webglCompatibility;
+
+    // The compute shader limits are checked when the shader is compiled.
+    hashStream << shader->getCurrentMaxComputeWorkGroupInvocations()
+               << shader->getMaxComputeSharedMemory();
+
+    // Call the secure SHA hashing function.
+    const std::string &shaderKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(shaderKey.c_str()),
+                               shaderKey.length(), hashOut->data());
+}
+
+angle::Result MemoryShaderCache::getShader(const Context *context,
+                                           Shader *shader,
+                                           ShCompileOptions compileOptions,
+                                           egl::BlobCache::Key *hashOut)
+{
+    // If caching is effectively disabled, don't bother calculating the hash.
+    if (!mBlobCache.isCachingEnabled())
+    {
+        return angle::Result::Incomplete;
+    }
+
+    ComputeHash(context, shader, compileOptions, hashOut);
+
+    angle::MemoryBuffer uncompressedData;
+    {
+        // The returned value may point into the blob cache's own storage, so decompress it before
+        // releasing the lock.
+        std::lock_guard<std::recursive_mutex> cacheLock(mBlobCacheMutex);
+
+        egl::BlobCache::Value binaryShader;
+        size_t shaderSize = 0;
+        if (!mBlobCache.get(context->getScratchBuffer(), *hashOut, &binaryShader, &shaderSize))
+        {
+            return angle::Result::Incomplete;
+        }
+
+        if (!egl::DecompressBlobCacheData(binaryShader.data(), shaderSize, &uncompressedData))
+        {
+            ERR() << "Error decompressing shader binary data.";
+            return angle::Result::Incomplete;
+        }
+    }
+
+    BinaryInputStream stream(uncompressedData.data(), uncompressedData.size());
+    bool success = shader->deserialize(stream);
+    ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.ShaderCache.LoadBinarySuccess", success);
+
+    if (success)
+    {
+        return angle::Result::Continue;
+    }
+
+    // Cache load failed, evict.
+    const unsigned int issuedWarnings = mIssuedWarnings++;
+    if (issuedWarnings < kWarningLimit)
+    {
+        WARN() << "Failed to load shader binary from cache.";
+
+        if (issuedWarnings + 1 == kWarningLimit)
+        {
+            WARN() << "Reaching warning limit for cache load failures, silencing "
+                      "subsequent warnings.";
+        }
+    }
+    std::lock_guard<std::recursive_mutex> cacheLock(mBlobCacheMutex);
+    mBlobCache.remove(*hashOut);
+    return angle::Result::Incomplete;
+}
+
+angle::Result MemoryShaderCache::putShader(const egl::BlobCache::Key &shaderHash,
+                                           const Shader *shader)
+{
+    // If caching is effectively disabled, don't bother serializing the shader.
+    if (!mBlobCache.isCachingEnabled())
+    {
+        return angle::Result::Incomplete;
+    }
+
+    angle::MemoryBuffer serializedShader;
+    ANGLE_TRY(shader->serialize(&serializedShader));
+
+    angle::MemoryBuffer compressedData;
+    if (!egl::CompressBlobCacheData(serializedShader.size(), serializedShader.data(),
+                                    &compressedData))
+    {
+        ERR() << "Error compressing shader binary data.";
+        return angle::Result::Incomplete;
+    }
+
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ShaderCache.ShaderBinarySizeBytes",
+                           static_cast<int>(compressedData.size()));
+
+    std::lock_guard<std::recursive_mutex> cacheLock(mBlobCacheMutex);
+    mBlobCache.put(shaderHash, std::move(compressedData));
+    return angle::Result::Continue;
+}
+
+}  // namespace gl
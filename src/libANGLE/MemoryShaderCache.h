@@ -0,0 +1,60 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores the results of shader compiles in memory so identical shaders don't
+//   always have to be re-translated. Shares the display's blob cache with the program cache, so
+//   the entries also reach the application's blob cache callbacks and the disk cache.
+
+#ifndef LIBANGLE_MEMORY_SHADER_CACHE_H_
+#define LIBANGLE_MEMORY_SHADER_CACHE_H_
+
+#include <atomic>
+#include <mutex>
+
+#include <GLSLANG/ShaderLang.h>
+
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/Error.h"
+
+namespace gl
+{
+class Context;
+class Shader;
+
+class MemoryShaderCache final : angle::NonCopyable
+{
+  public:
+    // The blob cache is shared with the program cache, so every access to it is made under the
+    // display's program cache mutex.
+    MemoryShaderCache(egl::BlobCache &blobCache, std::recursive_mutex &blobCacheMutex);
+    ~MemoryShaderCache();
+
+    // The hash covers the source, the shader type, the compile options and the built-in resources,
+    // as well as the context properties the backends derive their own compile options from.
+    static void ComputeHash(const Context *context,
+                            const Shader *shader,
+                            ShCompileOptions compileOptions,
+                            egl::BlobCache::Key *hashOut);
+
+    // Check the cache, and deserialize and load the shader if found. Evict existing hash if load
+    // fails.
+    angle::Result getShader(const Context *context,
+                            Shader *shader,
+                            ShCompileOptions compileOptions,
+                            egl::BlobCache::Key *hashOut);
+
+    // Helper method that serializes a compiled shader.
+    angle::Result putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader);
+
+  private:
+    egl::BlobCache &mBlobCache;
+    std::recursive_mutex &mBlobCacheMutex;
+    // Contexts of different share groups compile shaders concurrently.
+    std::atomic<unsigned int> mIssuedWarnings;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORY_SHADER_CACHE_H_
@@ -30,8 +30,16 @@ enum class WidgetId
     VulkanDescriptorSetAllocations,
     // Shader Buffer Descriptor Set Cache Hit Rate.
     VulkanShaderBufferDSHitRate,
+    // Texture Descriptor Set Cache Hit Rate.
+    VulkanTextureDSHitRate,
+    // Number of Descriptor Pools of all programs (Count).
+    VulkanDescriptorPoolCount,
+    // Number of cached Descriptor Sets of all programs (Count).
+    VulkanCachedDescriptorSetCount,
     // Buffer Allocations Made By vk::DynamicBuffer.
     VulkanDynamicBufferAllocations,
+    // Device-local Memory Used by the Process (MB).
+    VulkanDeviceMemoryUsage,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -48,6 +56,10 @@ enum class WidgetId
     PROC(VulkanWriteDescriptorSetCount)         \
     PROC(VulkanDescriptorSetAllocations)        \
     PROC(VulkanShaderBufferDSHitRate)           \
-    PROC(VulkanDynamicBufferAllocations)
+    PROC(VulkanTextureDSHitRate)                \
+    PROC(VulkanDescriptorPoolCount)             \
+    PROC(VulkanCachedDescriptorSetCount)        \
+    PROC(VulkanDynamicBufferAllocations)        \
+    PROC(VulkanDeviceMemoryUsage)
 
 }  // namespace gl
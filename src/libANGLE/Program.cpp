@@ -27,11 +27,13 @@
 #include "libANGLE/Uniform.h"
 #include "libANGLE/VaryingPacking.h"
 #include "libANGLE/Version.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/features.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/queryconversions.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ProgramImpl.h"
+#include "libANGLE/trace.h"
 #include "platform/FrontendFeatures.h"
 #include "platform/PlatformMethods.h"
 
@@ -793,11 +795,41 @@ struct Program::LinkingState
 {
     std::shared_ptr<ProgramExecutable> linkedExecutable;
     ProgramLinkedResources resources;
+    ProgramMergedVaryings mergedVaryings;
     egl::BlobCache::Key programHash;
     std::unique_ptr<rx::LinkEvent> linkEvent;
     bool linkingFromBinary;
 };
 
+// Runs Program::linkShaders() in the worker thread pool.  While the task is pending, every access
+// to the program from the context goes through resolveLink(), and the attached shaders resolve the
+// link before they are recompiled, so the task has exclusive access to the program's state.
+class Program::LinkTask final : public angle::Closure
+{
+  public:
+    LinkTask(const Context *context, Program *program, std::unique_ptr<LinkingState> linkingState)
+        : mContext(context),
+          mProgram(program),
+          mLinkingState(std::move(linkingState)),
+          mResult(false)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "Program::LinkTask");
+        mResult = mProgram->linkShaders(mContext, mLinkingState.get());
+    }
+
+    bool getResult() const { return mResult; }
+    std::unique_ptr<LinkingState> takeLinkingState() { return std::move(mLinkingState); }
+
+  private:
+    const Context *mContext;
+    Program *mProgram;
+    std::unique_ptr<LinkingState> mLinkingState;
+    bool mResult;
+};
+
 const char *const g_fakepath = "C:\\fakepath";
 
 // InfoLog implementation.
@@ -1489,7 +1521,7 @@ angle::Result Program::linkImpl(const Context *context)
     // TODO: http://anglebug.com/4530: Enable program caching for separable programs
     if (cache && !isSeparable())
     {
-        std::lock_guard<std::mutex> cacheLock(context->getProgramCacheMutex());
+        std::lock_guard<std::recursive_mutex> cacheLock(context->getProgramCacheMutex());
         angle::Result cacheResult = cache->getProgram(context, this, &programHash);
         ANGLE_TRY(cacheResult);
 
@@ -1514,7 +1546,43 @@ angle::Result Program::linkImpl(const Context *context)
     ASSERT(result);
 
     std::unique_ptr<LinkingState> linkingState(new LinkingState());
-    ProgramMergedVaryings mergedVaryings;
+    linkingState->linkingFromBinary = false;
+    linkingState->programHash       = programHash;
+
+    // Separable programs are linked synchronously, as program pipelines read their state without
+    // resolving the link.
+    std::shared_ptr<angle::WorkerThreadPool> workerPool = context->getWorkerThreadPool();
+    if (context->getFrontendFeatures().asyncLinkProgram.enabled && workerPool->isAsync() &&
+        !isSeparable())
+    {
+        for (Shader *shader : mState.mAttachedShaders)
+        {
+            if (shader)
+            {
+                shader->onProgramLinkStarted(this);
+            }
+        }
+
+        mLinkTask      = std::make_shared<LinkTask>(context, this, std::move(linkingState));
+        mLinkTaskEvent = angle::WorkerThreadPool::PostWorkerTask(workerPool, mLinkTask,
+                                                                 angle::TaskPriority::High);
+        return angle::Result::Continue;
+    }
+
+    if (!linkShaders(context, linkingState.get()))
+    {
+        return angle::Result::Continue;
+    }
+
+    mLinkingState = std::move(linkingState);
+    linkBackend(context);
+
+    return angle::Result::Continue;
+}
+
+bool Program::linkShaders(const Context *context, LinkingState *linkingState)
+{
+    InfoLog &infoLog                  = mState.mExecutable->getInfoLog();
     ProgramLinkedResources &resources = linkingState->resources;
 
     if (mState.mAttachedShaders[ShaderType::Compute])
@@ -1528,7 +1596,7 @@ angle::Result Program::linkImpl(const Context *context)
                           mState.mUniformLocationBindings, &combinedImageUniforms,
                           &resources.unusedUniforms))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         GLuint combinedShaderStorageBlocks = 0u;
@@ -1536,7 +1604,7 @@ angle::Result Program::linkImpl(const Context *context)
                                  context->getExtensions().webglCompatibility, infoLog,
                                  &combinedShaderStorageBlocks))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         // [OpenGL ES 3.1] Chapter 8.22 Page 203:
@@ -1552,7 +1620,7 @@ angle::Result Program::linkImpl(const Context *context)
                    "and active fragment shader outputs exceeds "
                    "MAX_COMBINED_SHADER_OUTPUT_RESOURCES ("
                 << context->getCaps().maxCombinedShaderOutputResources << ")";
-            return angle::Result::Continue;
+            return false;
         }
 
         InitUniformBlockLinker(mState, &resources.uniformBlockLinker);
@@ -1566,12 +1634,12 @@ angle::Result Program::linkImpl(const Context *context)
 
         if (!linkAttributes(context, infoLog))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         if (!linkVaryings(infoLog))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         GLuint combinedImageUniforms = 0u;
@@ -1579,7 +1647,7 @@ angle::Result Program::linkImpl(const Context *context)
                           mState.mUniformLocationBindings, &combinedImageUniforms,
                           &resources.unusedUniforms))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         GLuint combinedShaderStorageBlocks = 0u;
@@ -1587,19 +1655,19 @@ angle::Result Program::linkImpl(const Context *context)
                                  context->getExtensions().webglCompatibility, infoLog,
                                  &combinedShaderStorageBlocks))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         if (!LinkValidateProgramGlobalNames(infoLog, *this))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         if (!linkOutputVariables(context->getCaps(), context->getExtensions(),
                                  context->getClientVersion(), combinedImageUniforms,
                                  combinedShaderStorageBlocks))
         {
-            return angle::Result::Continue;
+            return false;
         }
 
         gl::Shader *vertexShader = mState.mAttachedShaders[ShaderType::Vertex];
@@ -1620,21 +1688,27 @@ angle::Result Program::linkImpl(const Context *context)
         InitUniformBlockLinker(mState, &resources.uniformBlockLinker);
         InitShaderStorageBlockLinker(mState, &resources.shaderStorageBlockLinker);
 
-        mergedVaryings = GetMergedVaryingsFromShaders(*this, getExecutable());
-        if (!mState.mExecutable->linkMergedVaryings(context, *this, mergedVaryings,
+        linkingState->mergedVaryings = GetMergedVaryingsFromShaders(*this, getExecutable());
+        if (!mState.mExecutable->linkMergedVaryings(context, *this, linkingState->mergedVaryings,
                                                     mState.mTransformFeedbackVaryingNames,
                                                     isSeparable(), &resources.varyingPacking))
         {
-            return angle::Result::Continue;
+            return false;
         }
     }
 
     updateLinkedShaderStages();
 
-    mLinkingState                    = std::move(linkingState);
-    mLinkingState->linkingFromBinary = false;
-    mLinkingState->programHash       = programHash;
-    mLinkingState->linkEvent         = mProgram->link(context, resources, infoLog, mergedVaryings);
+    return mProgram->prepareLink(context, resources) == angle::Result::Continue;
+}
+
+void Program::linkBackend(const Context *context)
+{
+    ASSERT(mLinkingState);
+
+    InfoLog &infoLog         = mState.mExecutable->getInfoLog();
+    mLinkingState->linkEvent = mProgram->link(context, mLinkingState->resources, infoLog,
+                                              mLinkingState->mergedVaryings);
 
     // Must be after mProgram->link() to avoid misleading the linker about output variables.
     mState.updateProgramInterfaceInputs();
@@ -1647,18 +1721,48 @@ angle::Result Program::linkImpl(const Context *context)
         mState.mExecutable->saveLinkedStateInfo(mState);
         mLinkingState->linkedExecutable = mState.mExecutable;
     }
-
-    return angle::Result::Continue;
 }
 
 bool Program::isLinking() const
 {
+    // Once the link task is done, the backend link is only started when the link is resolved.
+    if (mLinkTask)
+    {
+        return !mLinkTaskEvent->isReady();
+    }
     return (mLinkingState.get() && mLinkingState->linkEvent &&
             mLinkingState->linkEvent->isLinking());
 }
 
 void Program::resolveLinkImpl(const Context *context)
 {
+    if (mLinkTask)
+    {
+        mLinkTaskEvent->wait();
+
+        for (Shader *shader : mState.mAttachedShaders)
+        {
+            if (shader)
+            {
+                shader->onProgramLinkResolved(this);
+            }
+        }
+
+        bool linked   = mLinkTask->getResult();
+        mLinkingState = mLinkTask->takeLinkingState();
+        mLinkTask.reset();
+        mLinkTaskEvent.reset();
+
+        if (!linked)
+        {
+            mLinked = false;
+            mLinkingState.reset();
+            return;
+        }
+
+        linkBackend(context);
+    }
+
     ASSERT(mLinkingState.get());
 
     angle::Result result = mLinkingState->linkEvent->wait(context);
@@ -1691,7 +1795,7 @@ void Program::resolveLinkImpl(const Context *context)
     postResolveLink(context);
 
     // Save to the program cache.
-    std::lock_guard<std::mutex> cacheLock(context->getProgramCacheMutex());
+    std::lock_guard<std::recursive_mutex> cacheLock(context->getProgramCacheMutex());
     MemoryProgramCache *cache = context->getMemoryProgramCache();
     // TODO: http://anglebug.com/4530: Enable program caching for separable programs
     if (cache && !isSeparable() &&
@@ -35,6 +35,11 @@
 #include "libANGLE/Uniform.h"
 #include "libANGLE/angletypes.h"
 
+namespace angle
+{
+class WaitableEvent;
+}  // namespace angle
+
 namespace rx
 {
 class GLImplFactory;
@@ -495,7 +500,7 @@ class Program final : public LabeledObject, public angle::Subject, public HasAtt
 
     // Peek whether there is any running linking tasks.
     bool isLinking() const;
-    bool hasLinkingState() const { return mLinkingState != nullptr; }
+    bool hasLinkingState() const { return mLinkingState != nullptr || mLinkTask != nullptr; }
 
     bool isLinked() const
     {
@@ -805,7 +810,7 @@ class Program final : public LabeledObject, public angle::Subject, public HasAtt
     // Try to resolve linking. Inlined to make sure its overhead is as low as possible.
     void resolveLink(const Context *context)
     {
-        if (mLinkingState)
+        if (mLinkingState || mLinkTask)
         {
             resolveLinkImpl(context);
         }
@@ -823,6 +828,7 @@ class Program final : public LabeledObject, public angle::Subject, public HasAtt
 
   private:
     struct LinkingState;
+    class LinkTask;
 
     ~Program() override;
 
@@ -833,6 +839,11 @@ class Program final : public LabeledObject, public angle::Subject, public HasAtt
     void deleteSelf(const Context *context);
 
     angle::Result linkImpl(const Context *context);
+    // The part of the link that only depends on the attached shaders and the state of the context
+    // that doesn't change after its creation.  May run on a worker thread.
+    bool linkShaders(const Context *context, LinkingState *linkingState);
+    // Starts the backend link once linkShaders() has succeeded.
+    void linkBackend(const Context *context);
 
     bool linkValidateShaders(InfoLog &infoLog);
     bool linkAttributes(const Context *context, InfoLog &infoLog);
@@ -922,6 +933,9 @@ class Program final : public LabeledObject, public angle::Subject, public HasAtt
 
     bool mLinked;
     std::unique_ptr<LinkingState> mLinkingState;
+    // Set while linkShaders() runs on a worker thread.  mLinkingState is only set once it's done.
+    std::shared_ptr<LinkTask> mLinkTask;
+    std::shared_ptr<angle::WaitableEvent> mLinkTaskEvent;
     bool mDeleteStatus;  // Flag to indicate that the program can be deleted when no longer in use
 
     unsigned int mRefCount;
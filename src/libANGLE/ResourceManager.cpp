@@ -29,9 +29,11 @@ namespace gl
 namespace
 {
 
-template <typename ResourceType, typename IDType>
+template <typename ResourceType,
+          typename IDType,
+          template <typename, typename> class ResourceMapType>
 IDType AllocateEmptyObject(HandleAllocator *handleAllocator,
-                           ResourceMap<ResourceType, IDType> *objectMap)
+                           ResourceMapType<ResourceType, IDType> *objectMap)
 {
     IDType handle = PackParam<IDType>(handleAllocator->allocate());
     objectMap->assign(handle, nullptr);
@@ -58,14 +60,15 @@ void ResourceManagerBase::release(const Context *context)
     }
 }
 
-template <typename ResourceType, typename ImplT, typename IDType>
-TypedResourceManager<ResourceType, ImplT, IDType>::~TypedResourceManager()
+template <typename ResourceType, typename ImplT, typename IDType, typename ResourceMapType>
+TypedResourceManager<ResourceType, ImplT, IDType, ResourceMapType>::~TypedResourceManager()
 {
     ASSERT(mObjectMap.empty());
 }
 
-template <typename ResourceType, typename ImplT, typename IDType>
-void TypedResourceManager<ResourceType, ImplT, IDType>::reset(const Context *context)
+template <typename ResourceType, typename ImplT, typename IDType, typename ResourceMapType>
+void TypedResourceManager<ResourceType, ImplT, IDType, ResourceMapType>::reset(
+    const Context *context)
 {
     this->mHandleAllocator.reset();
     for (const auto &resource : mObjectMap)
@@ -78,9 +81,10 @@ void TypedResourceManager<ResourceType, ImplT, IDType>::reset(const Context *con
     mObjectMap.clear();
 }
 
-template <typename ResourceType, typename ImplT, typename IDType>
-void TypedResourceManager<ResourceType, ImplT, IDType>::deleteObject(const Context *context,
-                                                                     IDType handle)
+template <typename ResourceType, typename ImplT, typename IDType, typename ResourceMapType>
+void TypedResourceManager<ResourceType, ImplT, IDType, ResourceMapType>::deleteObject(
+    const Context *context,
+    IDType handle)
 {
     ResourceType *resource = nullptr;
     if (!mObjectMap.erase(handle, &resource))
@@ -100,7 +104,10 @@ void TypedResourceManager<ResourceType, ImplT, IDType>::deleteObject(const Conte
 // Unclear why Clang warns about weak vtables in this case.
 ANGLE_DISABLE_WEAK_TEMPLATE_VTABLES_WARNING
 template class TypedResourceManager<Buffer, BufferManager, BufferID>;
-template class TypedResourceManager<Texture, TextureManager, TextureID>;
+template class TypedResourceManager<Texture,
+                                    TextureManager,
+                                    TextureID,
+                                    ConcurrentResourceMap<Texture, TextureID>>;
 template class TypedResourceManager<Renderbuffer, RenderbufferManager, RenderbufferID>;
 template class TypedResourceManager<Sampler, SamplerManager, SamplerID>;
 template class TypedResourceManager<Sync, SyncManager, GLuint>;
@@ -191,6 +198,14 @@ void ShaderProgramManager::deleteProgram(const gl::Context *context, ShaderProgr
     deleteObject(context, &mPrograms, program);
 }
 
+void ShaderProgramManager::resolveLinks(const Context *context)
+{
+    for (const std::pair<GLuint, Program *> &resource : mPrograms)
+    {
+        resource.second->resolveLink(context);
+    }
+}
+
 template <typename ObjectType, typename IDType>
 void ShaderProgramManager::deleteObject(const Context *context,
                                         ResourceMap<ObjectType, IDType> *objectMap,
@@ -62,7 +62,10 @@ class ResourceManagerBase : angle::NonCopyable
     size_t mRefCount;
 };
 
-template <typename ResourceType, typename ImplT, typename IDType>
+template <typename ResourceType,
+          typename ImplT,
+          typename IDType,
+          typename ResourceMapType = ResourceMap<ResourceType, IDType>>
 class TypedResourceManager : public ResourceManagerBase
 {
   public:
@@ -75,11 +78,8 @@ class TypedResourceManager : public ResourceManagerBase
         return GetIDValue(handle) == 0 || mObjectMap.contains(handle);
     }
 
-    typename ResourceMap<ResourceType, IDType>::Iterator begin() const
-    {
-        return mObjectMap.begin();
-    }
-    typename ResourceMap<ResourceType, IDType>::Iterator end() const { return mObjectMap.end(); }
+    typename ResourceMapType::Iterator begin() const { return mObjectMap.begin(); }
+    typename ResourceMapType::Iterator end() const { return mObjectMap.end(); }
 
   protected:
     ~TypedResourceManager() override;
@@ -106,7 +106,7 @@ class TypedResourceManager : public ResourceManagerBase
 
     void reset(const Context *context) override;
 
-    ResourceMap<ResourceType, IDType> mObjectMap;
+    ResourceMapType mObjectMap;
 
   private:
     template <typename... ArgTypes>
@@ -164,6 +164,9 @@ class ShaderProgramManager : public ResourceManagerBase
         return mPrograms.query(handle);
     }
 
+    // Waits for all programs that are linking in the worker thread pool.
+    void resolveLinks(const Context *context);
+
     // For capture and performance counters only.
     const ResourceMap<Shader, ShaderProgramID> &getShadersForCapture() const { return mShaders; }
     const ResourceMap<Program, ShaderProgramID> &getProgramsForCaptureAndPerf() const
@@ -186,7 +189,14 @@ class ShaderProgramManager : public ResourceManagerBase
     ResourceMap<Program, ShaderProgramID> mPrograms;
 };
 
-class TextureManager : public TypedResourceManager<Texture, TextureManager, TextureID>
+// Textures are the objects most commonly shared between contexts, including through the global
+// texture share group, so their map supports concurrent lookups.  It only starts locking its shards
+// once the manager is shared with another context or the whole display.  GL calls on shared
+// contexts still hold the share group's lock for now; see GetContextLock().
+class TextureManager : public TypedResourceManager<Texture,
+                                                   TextureManager,
+                                                   TextureID,
+                                                   ConcurrentResourceMap<Texture, TextureID>>
 {
   public:
     TextureID createTexture();
@@ -198,6 +208,8 @@ class TextureManager : public TypedResourceManager<Texture, TextureManager, Text
 
     void signalAllTexturesDirty() const;
 
+    void enableConcurrentAccess() { mObjectMap.enableConcurrentAccess(); }
+
     ANGLE_INLINE Texture *checkTextureAllocation(rx::GLImplFactory *factory,
                                                  TextureID handle,
                                                  TextureType type)
@@ -6,11 +6,18 @@
 // ResourceMap:
 //   An optimized resource map which packs the first set of allocated objects into a
 //   flat array, and then falls back to an unordered map for the higher handle values.
+//   ConcurrentResourceMap is a variant for maps that are accessed from several threads.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "libANGLE/angletypes.h"
 
 namespace gl
@@ -341,6 +348,451 @@ void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
     }
 }
 
+// A variant of ResourceMap that doesn't need external locking.  Lookups don't take any lock: the
+// flat array is never resized in place, but replaced by a larger copy, and the arrays it replaced
+// are kept alive until the map is cleared as concurrent lookups may still be reading them.  Writes
+// lock one of several shards, picked from the handle, so writers of different handles rarely
+// contend.  Growing the flat array locks all the shards.  Higher handles are hashed in the shards,
+// and their lookups lock the shard.
+//
+// Until enableConcurrentAccess() is called, the map is assumed to be used by one thread at a time,
+// e.g. while its resource manager belongs to a single context.  The shards are then not locked,
+// and the arrays the flat array replaced are freed right away.
+template <typename ResourceType, typename IDType>
+class ConcurrentResourceMap final : angle::NonCopyable
+{
+  public:
+    ConcurrentResourceMap();
+    ~ConcurrentResourceMap();
+
+    ANGLE_INLINE ResourceType *query(IDType id) const
+    {
+        GLuint handle                      = GetIDValue(id);
+        const FlatResources *flatResources = mFlatResources.load(std::memory_order_acquire);
+        if (handle < flatResources->size)
+        {
+            ResourceType *value = flatResources->resources[handle].load(std::memory_order_acquire);
+            return (value == InvalidPointer() ? nullptr : value);
+        }
+        return queryHashed(handle);
+    }
+
+    // Returns true if the handle was reserved. Not necessarily if the resource is created.
+    bool contains(IDType id) const;
+
+    // Returns the element that was at this location.
+    bool erase(IDType id, ResourceType **resourceOut);
+
+    void assign(IDType id, ResourceType *resource);
+
+    // Clears the map.  Must not be called concurrently with any other method.
+    void clear();
+
+    // Must not be called concurrently with any other method.  Once enabled, concurrent access can't
+    // be disabled.
+    void enableConcurrentAccess() { mConcurrentAccess = true; }
+
+    using IndexAndResource = std::pair<GLuint, ResourceType *>;
+    using HashMap          = angle::HashMap<GLuint, ResourceType *>;
+
+  private:
+    struct FlatResources;
+
+  public:
+    // Visits the flat array, then the hashed handles of each shard.  Unlike ResourceMap, reserved
+    // handles are always skipped.
+    class Iterator final
+    {
+      public:
+        bool operator==(const Iterator &other) const;
+        bool operator!=(const Iterator &other) const;
+        Iterator &operator++();
+        const IndexAndResource *operator->() const;
+        const IndexAndResource &operator*() const;
+
+      private:
+        friend class ConcurrentResourceMap;
+        Iterator(const ConcurrentResourceMap &origin, bool atEnd);
+        void findResource();
+
+        const ConcurrentResourceMap &mOrigin;
+        const FlatResources *mFlatResources;
+        bool mInFlatResources;
+        size_t mFlatIndex;
+        size_t mShardIndex;
+        typename HashMap::const_iterator mHashIndex;
+        IndexAndResource mValue;
+    };
+
+    // Iterating must not be done concurrently with any writes.
+    Iterator begin() const;
+    Iterator end() const;
+
+    // Not a constant-time operation, should only be used for verification.  Must not be called
+    // concurrently with any other method.
+    bool empty() const;
+
+  private:
+    friend class Iterator;
+
+    struct FlatResources final : angle::NonCopyable
+    {
+        explicit FlatResources(size_t sizeIn);
+
+        const size_t size;
+        std::unique_ptr<std::atomic<ResourceType *>[]> resources;
+    };
+
+    struct Shard final : angle::NonCopyable
+    {
+        mutable std::mutex mutex;
+        HashMap hashedResources;
+    };
+
+    ResourceType *queryHashed(GLuint handle) const;
+    void growFlatResources(GLuint handle);
+
+    std::unique_lock<std::mutex> lockShard(const Shard &shard) const
+    {
+        return mConcurrentAccess ? std::unique_lock<std::mutex>(shard.mutex)
+                                 : std::unique_lock<std::mutex>();
+    }
+
+    Shard &getShard(GLuint handle) { return mShards[handle % kShardCount]; }
+    const Shard &getShard(GLuint handle) const { return mShards[handle % kShardCount]; }
+
+    // constexpr methods cannot contain reinterpret_cast, so we need a static method.
+    static ResourceType *InvalidPointer();
+    static constexpr intptr_t kInvalidPointer = static_cast<intptr_t>(-1);
+
+    // Same limits as ResourceMap.
+    static constexpr size_t kInitialFlatResourcesSize = 0x20;
+    static constexpr size_t kFlatResourcesLimit       = 0x4000;
+
+    static constexpr size_t kShardCount = 16;
+
+    std::atomic<FlatResources *> mFlatResources;
+
+    // The current flat array, last, and all the arrays it replaced.
+    std::vector<std::unique_ptr<FlatResources>> mAllFlatResources;
+
+    std::array<Shard, kShardCount> mShards;
+
+    bool mConcurrentAccess;
+};
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::FlatResources::FlatResources(size_t sizeIn)
+    : size(sizeIn), resources(new std::atomic<ResourceType *>[sizeIn])
+{
+    for (size_t index = 0; index < size; ++index)
+    {
+        resources[index].store(InvalidPointer(), std::memory_order_relaxed);
+    }
+}
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::ConcurrentResourceMap() : mConcurrentAccess(false)
+{
+    mAllFlatResources.emplace_back(new FlatResources(kInitialFlatResourcesSize));
+    mFlatResources.store(mAllFlatResources.back().get(), std::memory_order_release);
+}
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::~ConcurrentResourceMap()
+{
+    ASSERT(empty());
+}
+
+template <typename ResourceType, typename IDType>
+ResourceType *ConcurrentResourceMap<ResourceType, IDType>::queryHashed(GLuint handle) const
+{
+    const Shard &shard = getShard(handle);
+    std::unique_lock<std::mutex> lock = lockShard(shard);
+    auto it = shard.hashedResources.find(handle);
+    return (it == shard.hashedResources.end() ? nullptr : it->second);
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::contains(IDType id) const
+{
+    GLuint handle                      = GetIDValue(id);
+    const FlatResources *flatResources = mFlatResources.load(std::memory_order_acquire);
+    if (handle < flatResources->size)
+    {
+        return (flatResources->resources[handle].load(std::memory_order_acquire) !=
+                InvalidPointer());
+    }
+
+    const Shard &shard = getShard(handle);
+    std::unique_lock<std::mutex> lock = lockShard(shard);
+    return (shard.hashedResources.find(handle) != shard.hashedResources.end());
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resourceOut)
+{
+    GLuint handle = GetIDValue(id);
+    Shard &shard  = getShard(handle);
+    std::unique_lock<std::mutex> lock = lockShard(shard);
+
+    FlatResources *flatResources = mFlatResources.load(std::memory_order_acquire);
+    if (handle < flatResources->size)
+    {
+        ResourceType *value =
+            flatResources->resources[handle].exchange(InvalidPointer(), std::memory_order_acq_rel);
+        if (value == InvalidPointer())
+        {
+            return false;
+        }
+        *resourceOut = value;
+    }
+    else
+    {
+        auto it = shard.hashedResources.find(handle);
+        if (it == shard.hashedResources.end())
+        {
+            return false;
+        }
+        *resourceOut = it->second;
+        shard.hashedResources.erase(it);
+    }
+    return true;
+}
+
+template <typename ResourceType, typename IDType>
+void ConcurrentResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource)
+{
+    GLuint handle = GetIDValue(id);
+    if (handle < kFlatResourcesLimit &&
+        handle >= mFlatResources.load(std::memory_order_acquire)->size)
+    {
+        growFlatResources(handle);
+    }
+
+    Shard &shard = getShard(handle);
+    std::unique_lock<std::mutex> lock = lockShard(shard);
+
+    // The flat array only grows, and it can't grow while the shard is locked, so this stores into
+    // the array that lookups will see from now on.
+    if (handle < kFlatResourcesLimit)
+    {
+        FlatResources *flatResources = mFlatResources.load(std::memory_order_acquire);
+        ASSERT(flatResources->size > handle);
+        flatResources->resources[handle].store(resource, std::memory_order_release);
+    }
+    else
+    {
+        shard.hashedResources[handle] = resource;
+    }
+}
+
+template <typename ResourceType, typename IDType>
+void ConcurrentResourceMap<ResourceType, IDType>::growFlatResources(GLuint handle)
+{
+    std::array<std::unique_lock<std::mutex>, kShardCount> locks;
+    for (size_t shardIndex = 0; shardIndex < kShardCount; ++shardIndex)
+    {
+        locks[shardIndex] = lockShard(mShards[shardIndex]);
+    }
+
+    // Another thread may have grown the array while the shards were being locked.
+    FlatResources *oldResources = mFlatResources.load(std::memory_order_relaxed);
+    if (handle >= oldResources->size)
+    {
+        // Use power-of-two.
+        size_t newSize = oldResources->size;
+        while (newSize <= handle)
+        {
+            newSize *= 2;
+        }
+
+        FlatResources *newResources = new FlatResources(newSize);
+        for (size_t index = 0; index < oldResources->size; ++index)
+        {
+            newResources->resources[index].store(
+                oldResources->resources[index].load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+
+        if (!mConcurrentAccess)
+        {
+            // No other thread can be reading the arrays that were replaced.
+            mAllFlatResources.clear();
+        }
+        mAllFlatResources.emplace_back(newResources);
+        mFlatResources.store(newResources, std::memory_order_release);
+    }
+}
+
+template <typename ResourceType, typename IDType>
+void ConcurrentResourceMap<ResourceType, IDType>::clear()
+{
+    mAllFlatResources.clear();
+    mAllFlatResources.emplace_back(new FlatResources(kInitialFlatResourcesSize));
+    mFlatResources.store(mAllFlatResources.back().get(), std::memory_order_release);
+
+    for (Shard &shard : mShards)
+    {
+        shard.hashedResources.clear();
+    }
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::empty() const
+{
+    const FlatResources *flatResources = mFlatResources.load(std::memory_order_acquire);
+    for (size_t index = 0; index < flatResources->size; ++index)
+    {
+        ResourceType *value = flatResources->resources[index].load(std::memory_order_acquire);
+        if (value != nullptr && value != InvalidPointer())
+        {
+            return false;
+        }
+    }
+
+    for (const Shard &shard : mShards)
+    {
+        for (const auto &hashedResource : shard.hashedResources)
+        {
+            if (hashedResource.second != nullptr)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename ResourceType, typename IDType>
+// static
+ResourceType *ConcurrentResourceMap<ResourceType, IDType>::InvalidPointer()
+{
+    return reinterpret_cast<ResourceType *>(kInvalidPointer);
+}
+
+template <typename ResourceType, typename IDType>
+typename ConcurrentResourceMap<ResourceType, IDType>::Iterator
+ConcurrentResourceMap<ResourceType, IDType>::begin() const
+{
+    return Iterator(*this, false);
+}
+
+template <typename ResourceType, typename IDType>
+typename ConcurrentResourceMap<ResourceType, IDType>::Iterator
+ConcurrentResourceMap<ResourceType, IDType>::end() const
+{
+    return Iterator(*this, true);
+}
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::Iterator(
+    const ConcurrentResourceMap &origin,
+    bool atEnd)
+    : mOrigin(origin),
+      mFlatResources(origin.mFlatResources.load(std::memory_order_acquire)),
+      mInFlatResources(!atEnd),
+      mFlatIndex(atEnd ? mFlatResources->size : 0),
+      mShardIndex(atEnd ? kShardCount : 0)
+{
+    if (!atEnd)
+    {
+        findResource();
+    }
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator==(
+    const Iterator &other) const
+{
+    if (mInFlatResources != other.mInFlatResources || mFlatIndex != other.mFlatIndex ||
+        mShardIndex != other.mShardIndex)
+    {
+        return false;
+    }
+
+    // The hash iterators are only meaningful while visiting a shard.
+    return (mInFlatResources || mShardIndex == kShardCount || mHashIndex == other.mHashIndex);
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator!=(
+    const Iterator &other) const
+{
+    return !(*this == other);
+}
+
+template <typename ResourceType, typename IDType>
+typename ConcurrentResourceMap<ResourceType, IDType>::Iterator &
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator++()
+{
+    if (mInFlatResources)
+    {
+        mFlatIndex++;
+    }
+    else
+    {
+        mHashIndex++;
+    }
+    findResource();
+    return *this;
+}
+
+template <typename ResourceType, typename IDType>
+const typename ConcurrentResourceMap<ResourceType, IDType>::IndexAndResource *
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator->() const
+{
+    return &mValue;
+}
+
+template <typename ResourceType, typename IDType>
+const typename ConcurrentResourceMap<ResourceType, IDType>::IndexAndResource &
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator*() const
+{
+    return mValue;
+}
+
+template <typename ResourceType, typename IDType>
+void ConcurrentResourceMap<ResourceType, IDType>::Iterator::findResource()
+{
+    if (mInFlatResources)
+    {
+        for (; mFlatIndex < mFlatResources->size; ++mFlatIndex)
+        {
+            ResourceType *value =
+                mFlatResources->resources[mFlatIndex].load(std::memory_order_acquire);
+            if (value != nullptr && value != InvalidPointer())
+            {
+                mValue.first  = static_cast<GLuint>(mFlatIndex);
+                mValue.second = value;
+                return;
+            }
+        }
+
+        mInFlatResources = false;
+        mHashIndex       = mOrigin.mShards[0].hashedResources.begin();
+    }
+
+    while (mShardIndex < kShardCount)
+    {
+        const HashMap &hashedResources = mOrigin.mShards[mShardIndex].hashedResources;
+        for (; mHashIndex != hashedResources.end(); ++mHashIndex)
+        {
+            if (mHashIndex->second != nullptr)
+            {
+                mValue.first  = mHashIndex->first;
+                mValue.second = mHashIndex->second;
+                return;
+            }
+        }
+
+        if (++mShardIndex < kShardCount)
+        {
+            mHashIndex = mOrigin.mShards[mShardIndex].hashedResources.begin();
+        }
+    }
+}
+
 }  // namespace gl
 
 #endif  // LIBANGLE_RESOURCE_MAP_H_
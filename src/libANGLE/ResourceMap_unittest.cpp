@@ -4,11 +4,15 @@
 // found in the LICENSE file.
 //
 // ResourceMap_unittest:
-//   Unit tests for the ResourceMap template class.
+//   Unit tests for the ResourceMap and ConcurrentResourceMap template classes.
 //
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "libANGLE/ResourceMap.h"
 
 using namespace gl;
@@ -133,4 +137,177 @@ TEST(ResourceMapTest, QueryUnassigned)
     ASSERT_FALSE(resourceMap.contains(100));
     ASSERT_EQ(nullptr, resourceMap.query(100));
 }
+
+// Tests assigning, querying and erasing in the flat array and in the hashed handles of a
+// concurrent map.
+TEST(ConcurrentResourceMapTest, AssignQueryAndErase)
+{
+    ConcurrentResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects = {0, 1, 31, 32, 100, 0x3FFF, 0x4000, 0x12345};
+
+    for (size_t &object : objects)
+    {
+        ASSERT_FALSE(resourceMap.contains(static_cast<GLuint>(object)));
+        ASSERT_EQ(nullptr, resourceMap.query(static_cast<GLuint>(object)));
+        resourceMap.assign(static_cast<GLuint>(object), &object);
+    }
+
+    ASSERT_FALSE(resourceMap.empty());
+    ASSERT_FALSE(resourceMap.contains(2));
+    ASSERT_FALSE(resourceMap.contains(0x4001));
+
+    for (size_t &object : objects)
+    {
+        ASSERT_TRUE(resourceMap.contains(static_cast<GLuint>(object)));
+        ASSERT_EQ(&object, resourceMap.query(static_cast<GLuint>(object)));
+    }
+
+    for (size_t object : objects)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(static_cast<GLuint>(object), &found));
+        ASSERT_EQ(object, *found);
+        ASSERT_FALSE(resourceMap.erase(static_cast<GLuint>(object), &found));
+        ASSERT_EQ(nullptr, resourceMap.query(static_cast<GLuint>(object)));
+    }
+
+    ASSERT_TRUE(resourceMap.empty());
+}
+
+// Tests that reserved handles are contained but don't count as resources.
+TEST(ConcurrentResourceMapTest, ReservedHandles)
+{
+    ConcurrentResourceMap<size_t, GLuint> resourceMap;
+    resourceMap.assign(5, nullptr);
+    resourceMap.assign(0x5000, nullptr);
+
+    ASSERT_TRUE(resourceMap.contains(5));
+    ASSERT_TRUE(resourceMap.contains(0x5000));
+    ASSERT_EQ(nullptr, resourceMap.query(5));
+    ASSERT_TRUE(resourceMap.empty());
+
+    resourceMap.clear();
+    ASSERT_FALSE(resourceMap.contains(5));
+    ASSERT_FALSE(resourceMap.contains(0x5000));
+}
+
+// Tests that iterating a concurrent map visits every resource once, in the flat array and in the
+// hashed handles, and skips reserved handles.
+TEST(ConcurrentResourceMapTest, Iterate)
+{
+    ConcurrentResourceMap<size_t, GLuint> resourceMap;
+    ASSERT_TRUE(resourceMap.begin() == resourceMap.end());
+
+    std::vector<size_t> objects = {0, 1, 31, 32, 100, 0x3FFF, 0x4000, 0x5000, 0x12345};
+    for (size_t &object : objects)
+    {
+        resourceMap.assign(static_cast<GLuint>(object), &object);
+    }
+    resourceMap.assign(5, nullptr);
+    resourceMap.assign(0x6000, nullptr);
+
+    std::vector<GLuint> visited;
+    for (const auto &resource : resourceMap)
+    {
+        ASSERT_NE(nullptr, resource.second);
+        ASSERT_EQ(resource.first, *resource.second);
+        visited.push_back(resource.first);
+    }
+
+    std::sort(visited.begin(), visited.end());
+    ASSERT_EQ(objects.size(), visited.size());
+    for (size_t index = 0; index < objects.size(); ++index)
+    {
+        ASSERT_EQ(objects[index], visited[index]);
+    }
+
+    resourceMap.clear();
+    ASSERT_TRUE(resourceMap.begin() == resourceMap.end());
+}
+
+// Tests that lookups running concurrently with writers always find the resources that stay in the
+// map, while the writers grow the flat array and churn other handles.
+TEST(ConcurrentResourceMapTest, LookupsDuringWrites)
+{
+    constexpr GLuint kStableCount      = 16;
+    constexpr GLuint kWriterCount      = 4;
+    constexpr GLuint kHandlesPerWriter = 2048;
+
+    ConcurrentResourceMap<size_t, GLuint> resourceMap;
+    resourceMap.enableConcurrentAccess();
+    std::vector<size_t> stableObjects(kStableCount);
+    for (GLuint handle = 0; handle < kStableCount; ++handle)
+    {
+        resourceMap.assign(handle, &stableObjects[handle]);
+    }
+
+    std::vector<size_t> writerObjects(kWriterCount * kHandlesPerWriter);
+    std::atomic<bool> writersDone(false);
+    std::atomic<size_t> lookupFailures(0);
+
+    std::vector<std::thread> readers;
+    for (int readerIndex = 0; readerIndex < 2; ++readerIndex)
+    {
+        readers.emplace_back([&]() {
+            while (!writersDone)
+            {
+                for (GLuint handle = 0; handle < kStableCount; ++handle)
+                {
+                    if (resourceMap.query(handle) != &stableObjects[handle])
+                    {
+                        lookupFailures++;
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (GLuint writerIndex = 0; writerIndex < kWriterCount; ++writerIndex)
+    {
+        writers.emplace_back([&, writerIndex]() {
+            // Interleave the handles of the writers, so that they all grow the flat array and then
+            // spill into the hashed handles.
+            for (GLuint index = 0; index < kHandlesPerWriter; ++index)
+            {
+                GLuint handle  = kStableCount + (index * kWriterCount + writerIndex) * 4;
+                size_t *object = &writerObjects[writerIndex * kHandlesPerWriter + index];
+                resourceMap.assign(handle, object);
+                if (resourceMap.query(handle) != object)
+                {
+                    lookupFailures++;
+                }
+            }
+            for (GLuint index = 0; index < kHandlesPerWriter; ++index)
+            {
+                GLuint handle = kStableCount + (index * kWriterCount + writerIndex) * 4;
+                size_t *found = nullptr;
+                if (!resourceMap.erase(handle, &found) ||
+                    found != &writerObjects[writerIndex * kHandlesPerWriter + index])
+                {
+                    lookupFailures++;
+                }
+            }
+        });
+    }
+
+    for (std::thread &writer : writers)
+    {
+        writer.join();
+    }
+    writersDone = true;
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(0u, lookupFailures.load());
+
+    for (GLuint handle = 0; handle < kStableCount; ++handle)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(handle, &found));
+    }
+    ASSERT_TRUE(resourceMap.empty());
+}
 }  // anonymous namespace
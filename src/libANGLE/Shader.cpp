@@ -10,15 +10,22 @@
 
 #include "libANGLE/Shader.h"
 
+#include <algorithm>
 #include <functional>
 #include <sstream>
 
 #include "GLSLANG/ShaderLang.h"
+#include "common/MemoryBuffer.h"
+#include "common/angle_version.h"
+#include "common/event_tracer.h"
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
@@ -52,6 +59,84 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+void WriteShaderVariables(BinaryOutputStream *stream,
+                          const std::vector<sh::ShaderVariable> &variables)
+{
+    stream->writeInt(variables.size());
+    for (const sh::ShaderVariable &variable : variables)
+    {
+        WriteShaderVar(stream, variable);
+    }
+}
+
+// The variables are loaded one at a time so that a corrupted count can't allocate more than the
+// stream holds.
+void LoadShaderVariables(BinaryInputStream *stream, std::vector<sh::ShaderVariable> *variables)
+{
+    size_t variableCount = stream->readInt<size_t>();
+    for (size_t index = 0; index < variableCount && !stream->error(); ++index)
+    {
+        variables->emplace_back();
+        LoadShaderVar(stream, &variables->back());
+    }
+}
+
+void WriteInterfaceBlocks(BinaryOutputStream *stream, const std::vector<sh::InterfaceBlock> &blocks)
+{
+    stream->writeInt(blocks.size());
+    for (const sh::InterfaceBlock &block : blocks)
+    {
+        stream->writeString(block.name);
+        stream->writeString(block.mappedName);
+        stream->writeString(block.instanceName);
+        stream->writeInt(block.arraySize);
+        stream->writeEnum(block.layout);
+        stream->writeBool(block.isRowMajorLayout);
+        stream->writeInt(block.binding);
+        stream->writeBool(block.staticUse);
+        stream->writeBool(block.active);
+        stream->writeEnum(block.blockType);
+        WriteShaderVariables(stream, block.fields);
+    }
+}
+
+void LoadInterfaceBlocks(BinaryInputStream *stream, std::vector<sh::InterfaceBlock> *blocks)
+{
+    size_t blockCount = stream->readInt<size_t>();
+    for (size_t index = 0; index < blockCount && !stream->error(); ++index)
+    {
+        blocks->emplace_back();
+        sh::InterfaceBlock &block = blocks->back();
+        stream->readString(&block.name);
+        stream->readString(&block.mappedName);
+        stream->readString(&block.instanceName);
+        block.arraySize        = stream->readInt<unsigned int>();
+        block.layout           = stream->readEnum<sh::BlockLayoutType>();
+        block.isRowMajorLayout = stream->readBool();
+        block.binding          = stream->readInt<int>();
+        block.staticUse        = stream->readBool();
+        block.active           = stream->readBool();
+        block.blockType        = stream->readEnum<sh::BlockType>();
+        LoadShaderVariables(stream, &block.fields);
+    }
+}
+
+void WritePrimitiveMode(BinaryOutputStream *stream, const Optional<PrimitiveMode> &mode)
+{
+    stream->writeBool(mode.valid());
+    stream->writeEnum(mode.valid() ? mode.value() : PrimitiveMode::InvalidEnum);
+}
+
+void LoadPrimitiveMode(BinaryInputStream *stream, Optional<PrimitiveMode> *mode)
+{
+    bool valid              = stream->readBool();
+    PrimitiveMode primitive = stream->readEnum<PrimitiveMode>();
+    if (valid)
+    {
+        *mode = primitive;
+    }
+}
+
 }  // anonymous namespace
 
 // true if varying x has a higher priority in packing than y
@@ -118,6 +203,10 @@ struct Shader::CompilingState
 {
     std::shared_ptr<rx::WaitableCompileEvent> compileEvent;
     ShCompilerInstance shCompilerInstance;
+
+    // Set if the result of the compile is to be stored in the shader cache.
+    MemoryShaderCache *shaderCache = nullptr;
+    egl::BlobCache::Key shaderHash;
 };
 
 ShaderState::ShaderState(ShaderType shaderType)
@@ -153,6 +242,7 @@ Shader::Shader(ShaderProgramManager *manager,
 
 void Shader::onDestroy(const gl::Context *context)
 {
+    ASSERT(mLinkingPrograms.empty());
     resolveCompile();
     mImplementation->destroy();
     mBoundCompiler.set(context, nullptr);
@@ -315,29 +405,16 @@ void Shader::compile(const Context *context)
 {
     resolveCompile();
 
-    mState.mTranslatedSource.clear();
-    mState.mCompiledBinary.clear();
-    mInfoLog.clear();
-    mState.mShaderVersion = 100;
-    mState.mInputVaryings.clear();
-    mState.mOutputVaryings.clear();
-    mState.mUniforms.clear();
-    mState.mUniformBlocks.clear();
-    mState.mShaderStorageBlocks.clear();
-    mState.mActiveAttributes.clear();
-    mState.mActiveOutputVariables.clear();
-    mState.mNumViews = -1;
-    mState.mGeometryShaderInputPrimitiveType.reset();
-    mState.mGeometryShaderOutputPrimitiveType.reset();
-    mState.mGeometryShaderMaxVertices.reset();
-    mState.mGeometryShaderInvocations      = 1;
-    mState.mTessControlShaderVertices      = 0;
-    mState.mTessGenMode                    = 0;
-    mState.mTessGenSpacing                 = 0;
-    mState.mTessGenVertexOrder             = 0;
-    mState.mTessGenPointMode               = 0;
-    mState.mEarlyFragmentTestsOptimization = false;
-    mState.mSpecConstUsageBits.reset();
+    // Pop each program before resolving it, so this terminates even if the program is no longer
+    // linking with this shader.
+    while (!mLinkingPrograms.empty())
+    {
+        Program *program = mLinkingPrograms.back();
+        mLinkingPrograms.pop_back();
+        program->resolveLink(context);
+    }
+
+    resetCompiledState();
 
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
     mBoundCompiler.set(context, context->getCompiler());
@@ -380,8 +457,36 @@ void Shader::compile(const Context *context)
     ASSERT(compilerHandle);
     mCompilerResourcesString = compilerInstance.getBuiltinResourcesString();
 
+    MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    egl::BlobCache::Key shaderHash = {0};
+    if (shaderCache && mImplementation->supportsShaderCache())
+    {
+        ShCompileOptions cacheOptions =
+            options | mImplementation->getBackendCompileOptions(context);
+        if (shaderCache->getShader(context, this, cacheOptions, &shaderHash) ==
+            angle::Result::Continue)
+        {
+            mBoundCompiler->putInstance(std::move(compilerInstance));
+            mState.mCompileStatus = CompileStatus::COMPILED;
+            return;
+        }
+    }
+    else
+    {
+        shaderCache = nullptr;
+    }
+
+    // Break the translation down into its phases in the trace.  This doesn't change the result, so
+    // it's left out of the cache key.
+    if (*angle::GetTraceCategoryEnabledFlag(ANGLEPlatformCurrent(), "gpu.angle") != 0)
+    {
+        options |= SH_RECORD_PASS_METRICS;
+    }
+
     mCompilingState.reset(new CompilingState());
     mCompilingState->shCompilerInstance = std::move(compilerInstance);
+    mCompilingState->shaderCache        = shaderCache;
+    mCompilingState->shaderHash         = shaderHash;
     mCompilingState->compileEvent =
         mImplementation->compile(context, &(mCompilingState->shCompilerInstance), options);
 }
@@ -588,6 +693,172 @@ void Shader::resolveCompile()
 
     bool success          = mCompilingState->compileEvent->postTranslate(&mInfoLog);
     mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+
+    if (success && mCompilingState->shaderCache)
+    {
+        if (mCompilingState->shaderCache->putShader(mCompilingState->shaderHash, this) ==
+            angle::Result::Stop)
+        {
+            // The shader is still usable if it can't be cached.
+            WARN() << "Failed to save compiled shader to memory shader cache.";
+        }
+    }
+}
+
+void Shader::resetCompiledState()
+{
+    mState.mTranslatedSource.clear();
+    mState.mCompiledBinary.clear();
+    mInfoLog.clear();
+    mState.mShaderVersion = 100;
+    mState.mLocalSize.fill(-1);
+    mState.mInputVaryings.clear();
+    mState.mOutputVaryings.clear();
+    mState.mUniforms.clear();
+    mState.mUniformBlocks.clear();
+    mState.mShaderStorageBlocks.clear();
+    mState.mAllAttributes.clear();
+    mState.mActiveAttributes.clear();
+    mState.mActiveOutputVariables.clear();
+    mState.mNumViews = -1;
+    mState.mGeometryShaderInputPrimitiveType.reset();
+    mState.mGeometryShaderOutputPrimitiveType.reset();
+    mState.mGeometryShaderMaxVertices.reset();
+    mState.mGeometryShaderInvocations      = 1;
+    mState.mTessControlShaderVertices      = 0;
+    mState.mTessGenMode                    = 0;
+    mState.mTessGenSpacing                 = 0;
+    mState.mTessGenVertexOrder             = 0;
+    mState.mTessGenPointMode               = 0;
+    mState.mEarlyFragmentTestsOptimization = false;
+    mState.mSpecConstUsageBits.reset();
+}
+
+angle::Result Shader::serialize(angle::MemoryBuffer *binaryOut) const
+{
+    ASSERT(mState.mCompileStatus == CompileStatus::COMPILED);
+
+    BinaryOutputStream stream;
+
+    stream.writeBytes(reinterpret_cast<const unsigned char *>(ANGLE_COMMIT_HASH),
+                      ANGLE_COMMIT_HASH_SIZE);
+    stream.writeEnum(mState.mShaderType);
+
+    stream.writeString(mState.mTranslatedSource);
+    stream.writeInt(mState.mCompiledBinary.size());
+    stream.writeBytes(reinterpret_cast<const unsigned char *>(mState.mCompiledBinary.data()),
+                      mState.mCompiledBinary.size() * sizeof(uint32_t));
+    stream.writeString(mInfoLog);
+
+    stream.writeInt(mState.mShaderVersion);
+    for (size_t dimension = 0; dimension < mState.mLocalSize.size(); ++dimension)
+    {
+        stream.writeInt(mState.mLocalSize[dimension]);
+    }
+
+    WriteShaderVariables(&stream, mState.mInputVaryings);
+    WriteShaderVariables(&stream, mState.mOutputVaryings);
+    WriteShaderVariables(&stream, mState.mUniforms);
+    WriteInterfaceBlocks(&stream, mState.mUniformBlocks);
+    WriteInterfaceBlocks(&stream, mState.mShaderStorageBlocks);
+    WriteShaderVariables(&stream, mState.mAllAttributes);
+    WriteShaderVariables(&stream, mState.mActiveAttributes);
+    WriteShaderVariables(&stream, mState.mActiveOutputVariables);
+
+    stream.writeBool(mState.mEarlyFragmentTestsOptimization);
+    stream.writeInt(mState.mSpecConstUsageBits.bits());
+    stream.writeInt(mState.mNumViews);
+
+    WritePrimitiveMode(&stream, mState.mGeometryShaderInputPrimitiveType);
+    WritePrimitiveMode(&stream, mState.mGeometryShaderOutputPrimitiveType);
+    const Optional<GLint> &maxVertices = mState.mGeometryShaderMaxVertices;
+    stream.writeBool(maxVertices.valid());
+    stream.writeInt(maxVertices.valid() ? maxVertices.value() : 0);
+    stream.writeInt(mState.mGeometryShaderInvocations);
+
+    stream.writeInt(mState.mTessControlShaderVertices);
+    stream.writeInt(mState.mTessGenMode);
+    stream.writeInt(mState.mTessGenSpacing);
+    stream.writeInt(mState.mTessGenVertexOrder);
+    stream.writeInt(mState.mTessGenPointMode);
+
+    ASSERT(binaryOut);
+    if (!binaryOut->resize(stream.length()))
+    {
+        WARN() << "Failed to allocate enough memory to serialize a shader. (" << stream.length()
+               << " bytes )";
+        return angle::Result::Incomplete;
+    }
+    memcpy(binaryOut->data(), stream.data(), stream.length());
+    return angle::Result::Continue;
+}
+
+bool Shader::deserialize(BinaryInputStream &stream)
+{
+    unsigned char commitString[ANGLE_COMMIT_HASH_SIZE];
+    stream.readBytes(commitString, ANGLE_COMMIT_HASH_SIZE);
+    if (stream.error() ||
+        memcmp(commitString, ANGLE_COMMIT_HASH, sizeof(unsigned char) * ANGLE_COMMIT_HASH_SIZE) !=
+            0 ||
+        stream.readEnum<ShaderType>() != mState.mShaderType)
+    {
+        return false;
+    }
+
+    stream.readString(&mState.mTranslatedSource);
+    size_t binarySize = stream.readInt<size_t>();
+    if (binarySize > stream.remainingSize() / sizeof(uint32_t))
+    {
+        resetCompiledState();
+        return false;
+    }
+    mState.mCompiledBinary.resize(binarySize);
+    stream.readBytes(reinterpret_cast<unsigned char *>(mState.mCompiledBinary.data()),
+                     binarySize * sizeof(uint32_t));
+    stream.readString(&mInfoLog);
+
+    mState.mShaderVersion = stream.readInt<int>();
+    for (size_t dimension = 0; dimension < mState.mLocalSize.size(); ++dimension)
+    {
+        mState.mLocalSize[dimension] = stream.readInt<int>();
+    }
+
+    LoadShaderVariables(&stream, &mState.mInputVaryings);
+    LoadShaderVariables(&stream, &mState.mOutputVaryings);
+    LoadShaderVariables(&stream, &mState.mUniforms);
+    LoadInterfaceBlocks(&stream, &mState.mUniformBlocks);
+    LoadInterfaceBlocks(&stream, &mState.mShaderStorageBlocks);
+    LoadShaderVariables(&stream, &mState.mAllAttributes);
+    LoadShaderVariables(&stream, &mState.mActiveAttributes);
+    LoadShaderVariables(&stream, &mState.mActiveOutputVariables);
+
+    mState.mEarlyFragmentTestsOptimization = stream.readBool();
+    mState.mSpecConstUsageBits             = rx::SpecConstUsageBits(stream.readInt<uint32_t>());
+    mState.mNumViews                       = stream.readInt<int>();
+
+    LoadPrimitiveMode(&stream, &mState.mGeometryShaderInputPrimitiveType);
+    LoadPrimitiveMode(&stream, &mState.mGeometryShaderOutputPrimitiveType);
+    bool hasMaxVertices = stream.readBool();
+    GLint maxVertices   = stream.readInt<GLint>();
+    if (hasMaxVertices)
+    {
+        mState.mGeometryShaderMaxVertices = maxVertices;
+    }
+    mState.mGeometryShaderInvocations = stream.readInt<int>();
+
+    mState.mTessControlShaderVertices = stream.readInt<int>();
+    mState.mTessGenMode               = stream.readInt<GLenum>();
+    mState.mTessGenSpacing            = stream.readInt<GLenum>();
+    mState.mTessGenVertexOrder        = stream.readInt<GLenum>();
+    mState.mTessGenPointMode          = stream.readInt<GLenum>();
+
+    if (stream.error() || !stream.endOfStream())
+    {
+        resetCompiledState();
+        return false;
+    }
+
+    return true;
 }
 
 void Shader::addRef()
@@ -809,4 +1080,21 @@ const std::string &Shader::getCompilerResourcesString() const
     return mCompilerResourcesString;
 }
 
+void Shader::onProgramLinkStarted(Program *program)
+{
+    ASSERT(std::find(mLinkingPrograms.begin(), mLinkingPrograms.end(), program) ==
+           mLinkingPrograms.end());
+    mLinkingPrograms.push_back(program);
+}
+
+void Shader::onProgramLinkResolved(Program *program)
+{
+    // The program is already removed if the link was resolved by compile().
+    auto iter = std::find(mLinkingPrograms.begin(), mLinkingPrograms.end(), program);
+    if (iter != mLinkingPrograms.end())
+    {
+        mLinkingPrograms.erase(iter);
+    }
+}
+
 }  // namespace gl
@@ -37,14 +37,17 @@ class WaitableCompileEvent;
 
 namespace angle
 {
+class MemoryBuffer;
 class WaitableEvent;
 class WorkerThreadPool;
 }  // namespace angle
 
 namespace gl
 {
+class BinaryInputStream;
 class CompileTask;
 class Context;
+class Program;
 class ShaderProgramManager;
 class State;
 
@@ -247,6 +250,15 @@ class Shader final : angle::NonCopyable, public LabeledObject
     unsigned int getMaxComputeSharedMemory() const { return mMaxComputeSharedMemory; }
     bool hasBeenDeleted() const { return mDeleteStatus; }
 
+    // Programs linking in the worker thread pool read the shader's compiled state.  Their link is
+    // resolved before the shader is compiled again.
+    void onProgramLinkStarted(Program *program);
+    void onProgramLinkResolved(Program *program);
+
+    // Saves and restores the result of a successful compile, for the shader cache.
+    angle::Result serialize(angle::MemoryBuffer *binaryOut) const;
+    bool deserialize(BinaryInputStream &stream);
+
   private:
     struct CompilingState;
 
@@ -257,6 +269,7 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               char *buffer);
 
     void resolveCompile();
+    void resetCompiledState();
 
     ShaderState mState;
     std::unique_ptr<rx::ShaderImpl> mImplementation;
@@ -276,6 +289,8 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     GLuint mCurrentMaxComputeWorkGroupInvocations;
     unsigned int mMaxComputeSharedMemory;
+
+    std::vector<Program *> mLinkingPrograms;
 };
 
 bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y);
@@ -361,7 +361,14 @@ State::State(const State *shareContextState,
       mPatchVertices(3),
       mOverlay(overlay),
       mNoSimultaneousConstantColorAndAlphaBlendFunc(false)
-{}
+{
+    // This runs under the locks taken by Display::createContext, so no other context is using the
+    // texture manager.
+    if (shareContextState != nullptr || shareTextures != nullptr)
+    {
+        mTextureManager->enableConcurrentAccess();
+    }
+}
 
 State::~State() {}
 
@@ -10,13 +10,15 @@
 
 #include "libANGLE/WorkerThread.h"
 
+#include "common/mathutil.h"
 #include "libANGLE/trace.h"
 
 #if (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#    include <algorithm>
+#    include <atomic>
 #    include <condition_variable>
-#    include <future>
+#    include <deque>
 #    include <mutex>
-#    include <queue>
 #    include <thread>
 #endif  // (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
@@ -56,14 +58,16 @@ bool SingleThreadedWaitableEvent::isReady()
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  TaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    TaskPriority priority)
 {
     (*task)();
     return std::make_shared<SingleThreadedWaitableEvent>();
@@ -77,138 +81,368 @@ bool SingleThreadedWorkerPool::isAsync()
 }
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
-class AsyncWaitableEvent final : public WaitableEvent
+// A task posted to the WorkStealingWorkerPool.  It's shared between the pool's queues and the
+// task's waitable event.  Whoever claims it first runs it, which lets a thread that waits on a task
+// no worker has started yet run it right away instead of blocking.
+class WorkStealingTask final : angle::NonCopyable
 {
   public:
-    AsyncWaitableEvent() : mIsPending(true) {}
-    ~AsyncWaitableEvent() override = default;
+    WorkStealingTask(std::shared_ptr<Closure> closure) : mClosure(closure), mState(kPending) {}
 
-    void wait() override;
-    bool isReady() override;
+    bool tryClaim()
+    {
+        uint32_t expected = kPending;
+        return mState.compare_exchange_strong(expected, kRunning, std::memory_order_acq_rel);
+    }
+
+    void run()
+    {
+        (*mClosure)();
+        mClosure.reset();
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mState.store(kDone, std::memory_order_release);
+        }
+        mCondition.notify_all();
+    }
+
+    void waitDone()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return isDone(); });
+    }
+
+    bool isDone() const { return mState.load(std::memory_order_acquire) == kDone; }
 
   private:
-    friend class AsyncWorkerPool;
-    void setFuture(std::future<void> &&future);
+    static constexpr uint32_t kPending = 0;
+    static constexpr uint32_t kRunning = 1;
+    static constexpr uint32_t kDone    = 2;
 
-    // To block wait() when the task is still in queue to be run.
-    // Also to protect the concurrent accesses from both main thread and
-    // background threads to the member fields.
-    std::mutex mMutex;
+    std::shared_ptr<Closure> mClosure;
+    std::atomic<uint32_t> mState;
 
-    bool mIsPending;
+    // Only used to block wait() until the task is done.
+    std::mutex mMutex;
     std::condition_variable mCondition;
-    std::future<void> mFuture;
 };
 
-void AsyncWaitableEvent::setFuture(std::future<void> &&future)
+class WorkStealingWaitableEvent final : public WaitableEvent
 {
-    mFuture = std::move(future);
-}
+  public:
+    WorkStealingWaitableEvent(std::shared_ptr<WorkStealingTask> task) : mTask(task) {}
+    ~WorkStealingWaitableEvent() override = default;
+
+    void wait() override;
+    bool isReady() override;
+
+  private:
+    std::shared_ptr<WorkStealingTask> mTask;
+};
 
-void AsyncWaitableEvent::wait()
+void WorkStealingWaitableEvent::wait()
 {
-    ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWaitableEvent::wait");
+    ANGLE_TRACE_EVENT0("gpu.angle", "WorkStealingWaitableEvent::wait");
+
+    // If no worker has picked up the task yet, run it on this thread.
+    if (mTask->tryClaim())
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return !mIsPending; });
+        mTask->run();
+        return;
     }
 
-    ASSERT(mFuture.valid());
-    mFuture.wait();
+    mTask->waitDone();
 }
 
-bool AsyncWaitableEvent::isReady()
+bool WorkStealingWaitableEvent::isReady()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    if (mIsPending)
-    {
-        return false;
-    }
-    ASSERT(mFuture.valid());
-    return mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    return mTask->isDone();
 }
 
-class AsyncWorkerPool final : public WorkerThreadPool
+// A pool of std::threads, each with its own task queue.  Tasks posted from outside the pool are
+// distributed among the queues in a round-robin fashion, and tasks posted by a worker go to its own
+// queue.  A worker runs the oldest task from its own queue, and when that's empty, steals the newest
+// task from another worker's queue.  Higher priority tasks are always looked for first, in all the
+// queues.  Threads are created on demand, up to the hardware concurrency, and are kept around until
+// the pool is destroyed.
+class WorkStealingWorkerPool final : public WorkerThreadPool
 {
   public:
-    AsyncWorkerPool(size_t maxThreads) : mMaxThreads(maxThreads), mRunningThreads(0) {}
-    ~AsyncWorkerPool() override = default;
+    WorkStealingWorkerPool(size_t maxThreads);
+    ~WorkStealingWorkerPool() override;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  TaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
 
   private:
-    void checkToRunPendingTasks();
+    static constexpr size_t kPriorityCount = static_cast<size_t>(TaskPriority::EnumCount);
 
-    // To protect the concurrent accesses from both main thread and background
-    // threads to the member fields.
-    std::mutex mMutex;
+    struct WorkerQueue
+    {
+        // Protects the deques.  The counts mirror their sizes so that thieves can skip empty
+        // queues without taking the lock.
+        std::mutex mutex;
+        std::array<std::deque<std::shared_ptr<WorkStealingTask>>, kPriorityCount> tasks;
+        std::array<std::atomic<size_t>, kPriorityCount> counts;
+    };
+
+    void threadLoop(size_t workerIndex);
+    std::shared_ptr<WorkStealingTask> popTask(size_t workerIndex);
+    std::shared_ptr<WorkStealingTask> popTaskFromQueue(size_t queueIndex,
+                                                       size_t priority,
+                                                       bool steal);
+    void addThreadIfNeeded();
+
+    // One queue per potential worker thread, allocated up front so that workers can look at each
+    // other's queues without synchronizing with thread creation.
+    std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+
+    // Protects mThreads.
+    std::mutex mThreadsMutex;
+    std::vector<std::thread> mThreads;
+    std::atomic<size_t> mThreadCount;
+    std::atomic<size_t> mMaxThreads;
+    std::atomic<size_t> mNextQueue;
+
+    // Number of tasks posted but not yet popped from a queue.  Incremented before the task is
+    // queued, so it can't drop below zero when a worker pops the task right away.
+    std::atomic<size_t> mPendingTaskCount;
+
+    // Idle workers sleep on mSleepCondition.  mSleepingThreadCount lets posting skip the
+    // notification (and the lock) when every worker is busy.
+    std::mutex mSleepMutex;
+    std::condition_variable mSleepCondition;
+    std::atomic<size_t> mSleepingThreadCount;
+    bool mExiting;
+};
 
-    size_t mMaxThreads;
-    size_t mRunningThreads;
-    std::queue<std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>> mTaskQueue;
+namespace
+{
+// The pool and the index of the worker running on the current thread, if any.
+struct CurrentWorker
+{
+    const WorkerThreadPool *pool;
+    size_t index;
 };
+thread_local CurrentWorker gCurrentWorker = {nullptr, 0};
+}  // anonymous namespace
+
+WorkStealingWorkerPool::WorkStealingWorkerPool(size_t maxThreads)
+    : mThreadCount(0),
+      mMaxThreads(0),
+      mNextQueue(0),
+      mPendingTaskCount(0),
+      mSleepingThreadCount(0),
+      mExiting(false)
+{
+    const size_t queueCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    for (size_t queueIndex = 0; queueIndex < queueCount; ++queueIndex)
+    {
+        std::unique_ptr<WorkerQueue> queue(new WorkerQueue);
+        for (std::atomic<size_t> &count : queue->counts)
+        {
+            count = 0;
+        }
+        mQueues.push_back(std::move(queue));
+    }
 
-// AsyncWorkerPool implementation.
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
+    setMaxThreads(maxThreads);
+}
+
+WorkStealingWorkerPool::~WorkStealingWorkerPool()
 {
-    ASSERT(mMaxThreads > 0);
+    // A worker can't join itself, and would return to threadLoop() on a destroyed pool.
+    ASSERT(gCurrentWorker.pool != this);
 
-    auto waitable = std::make_shared<AsyncWaitableEvent>();
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        mTaskQueue.push(std::make_pair(waitable, task));
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mExiting = true;
+    }
+    mSleepCondition.notify_all();
+
+    // Workers finish the tasks that are still queued before exiting.
+    std::lock_guard<std::mutex> lock(mThreadsMutex);
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
     }
-    checkToRunPendingTasks();
-    return std::move(waitable);
 }
 
-void AsyncWorkerPool::setMaxThreads(size_t maxThreads)
+std::shared_ptr<WaitableEvent> WorkStealingWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                                      TaskPriority priority)
 {
+    auto workStealingTask = std::make_shared<WorkStealingTask>(task);
+
+    size_t queueIndex = 0;
+    if (gCurrentWorker.pool == this)
+    {
+        queueIndex = gCurrentWorker.index;
+    }
+    else
+    {
+        const size_t activeQueueCount =
+            std::max<size_t>(std::min(mThreadCount.load(), mMaxThreads.load()), 1);
+        queueIndex = mNextQueue.fetch_add(1, std::memory_order_relaxed) % activeQueueCount;
+    }
+
+    // Must come before the task is queued, as a worker may pop it immediately.  A worker that sees
+    // the count before the task is visible retries instead of sleeping.
+    mPendingTaskCount++;
+
+    const size_t priorityIndex = static_cast<size_t>(priority);
+    WorkerQueue &queue         = *mQueues[queueIndex];
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        mMaxThreads = (maxThreads == 0xFFFFFFFF ? std::thread::hardware_concurrency() : maxThreads);
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks[priorityIndex].push_back(workStealingTask);
+        queue.counts[priorityIndex]++;
     }
-    checkToRunPendingTasks();
+
+    addThreadIfNeeded();
+    if (mSleepingThreadCount > 0)
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mSleepCondition.notify_one();
+    }
+
+    return std::make_shared<WorkStealingWaitableEvent>(workStealingTask);
+}
+
+void WorkStealingWorkerPool::setMaxThreads(size_t maxThreads)
+{
+    // 0xFFFFFFFF lets the implementation pick the number of threads.  Running more threads than
+    // there are cores only adds contention.
+    if (maxThreads == 0xFFFFFFFF)
+    {
+        maxThreads = mQueues.size();
+    }
+    mMaxThreads = gl::clamp<size_t>(maxThreads, 1, mQueues.size());
+
+    // Wake up the workers that may have been idled by a lower limit.
+    std::lock_guard<std::mutex> lock(mSleepMutex);
+    mSleepCondition.notify_all();
 }
 
-bool AsyncWorkerPool::isAsync()
+bool WorkStealingWorkerPool::isAsync()
 {
     return true;
 }
 
-void AsyncWorkerPool::checkToRunPendingTasks()
+void WorkStealingWorkerPool::addThreadIfNeeded()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    while (mRunningThreads < mMaxThreads && !mTaskQueue.empty())
+    // The sleeping workers will pick up the pending tasks if there are enough of them.  Below the
+    // thread limit every worker is allowed to run tasks, so any sleeping worker can help.
+    if (mThreadCount >= mMaxThreads || mSleepingThreadCount >= mPendingTaskCount)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mThreadsMutex);
+    if (mThreads.size() >= mMaxThreads)
+    {
+        return;
+    }
+
+    const size_t workerIndex = mThreads.size();
+    mThreads.emplace_back(&WorkStealingWorkerPool::threadLoop, this, workerIndex);
+    mThreadCount = mThreads.size();
+}
+
+std::shared_ptr<WorkStealingTask> WorkStealingWorkerPool::popTaskFromQueue(size_t queueIndex,
+                                                                           size_t priority,
+                                                                           bool steal)
+{
+    WorkerQueue &queue = *mQueues[queueIndex];
+    if (queue.counts[priority] == 0)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    std::deque<std::shared_ptr<WorkStealingTask>> &tasks = queue.tasks[priority];
+    if (tasks.empty())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<WorkStealingTask> task;
+    if (steal)
+    {
+        task = std::move(tasks.back());
+        tasks.pop_back();
+    }
+    else
+    {
+        task = std::move(tasks.front());
+        tasks.pop_front();
+    }
+    queue.counts[priority]--;
+    mPendingTaskCount--;
+
+    return task;
+}
+
+std::shared_ptr<WorkStealingTask> WorkStealingWorkerPool::popTask(size_t workerIndex)
+{
+    const size_t queueCount = mQueues.size();
+    for (size_t priority = 0; priority < kPriorityCount; ++priority)
     {
-        auto task = mTaskQueue.front();
-        mTaskQueue.pop();
-        auto waitable = task.first;
-        auto closure  = task.second;
+        std::shared_ptr<WorkStealingTask> task = popTaskFromQueue(workerIndex, priority, false);
+        if (task)
+        {
+            return task;
+        }
 
-        auto future = std::async(std::launch::async, [closure, this] {
+        for (size_t offset = 1; offset < queueCount; ++offset)
+        {
+            task = popTaskFromQueue((workerIndex + offset) % queueCount, priority, true);
+            if (task)
             {
-                ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWorkerPool::RunTask");
-                (*closure)();
+                return task;
             }
+        }
+    }
+
+    return nullptr;
+}
+
+void WorkStealingWorkerPool::threadLoop(size_t workerIndex)
+{
+    gCurrentWorker = {this, workerIndex};
+
+    while (true)
+    {
+        // Workers above the thread limit only sleep, their queues get drained by the others.
+        std::shared_ptr<WorkStealingTask> task;
+        if (workerIndex < mMaxThreads)
+        {
+            task = popTask(workerIndex);
+        }
+
+        if (task)
+        {
+            // The task may have already been run by a thread waiting on it.
+            if (task->tryClaim())
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                ASSERT(mRunningThreads != 0);
-                --mRunningThreads;
+                ANGLE_TRACE_EVENT0("gpu.angle", "WorkStealingWorkerPool::RunTask");
+                task->run();
             }
-            checkToRunPendingTasks();
-        });
-
-        ++mRunningThreads;
+            continue;
+        }
 
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        if (mExiting && mPendingTaskCount == 0)
         {
-            std::lock_guard<std::mutex> waitableLock(waitable->mMutex);
-            waitable->mIsPending = false;
-            waitable->setFuture(std::move(future));
+            break;
         }
-        waitable->mCondition.notify_all();
+
+        mSleepingThreadCount++;
+        mSleepCondition.wait(lock, [this, workerIndex] {
+            return mExiting || (workerIndex < mMaxThreads && mPendingTaskCount > 0);
+        });
+        mSleepingThreadCount--;
     }
 }
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
@@ -259,7 +493,8 @@ class DelegateWorkerPool final : public WorkerThreadPool
     DelegateWorkerPool()           = default;
     ~DelegateWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  TaskPriority priority) override;
 
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
@@ -294,8 +529,10 @@ class DelegateWorkerTask
     std::shared_ptr<DelegateWaitableEvent> mWaitable;
 };
 
-std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
+std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                                  TaskPriority priority)
 {
+    // The platform's task runner has no notion of priority.
     auto waitable = std::make_shared<DelegateWaitableEvent>();
 
     // The task will be deleted by DelegateWorkerTask::RunTask(...) after its execution.
@@ -330,7 +567,7 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(bool multithreaded)
     if (!pool && multithreaded)
     {
         pool = std::shared_ptr<WorkerThreadPool>(
-            new AsyncWorkerPool(std::thread::hardware_concurrency()));
+            new WorkStealingWorkerPool(std::thread::hardware_concurrency()));
     }
 #endif
     if (!pool)
@@ -343,9 +580,10 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(bool multithreaded)
 // static
 std::shared_ptr<WaitableEvent> WorkerThreadPool::PostWorkerTask(
     std::shared_ptr<WorkerThreadPool> pool,
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    TaskPriority priority)
 {
-    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task);
+    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task, priority);
     if (event.get())
     {
         event->setWorkerThreadPool(pool);
@@ -23,6 +23,18 @@ namespace angle
 
 class WorkerThreadPool;
 
+// Order in which posted tasks are started.  Work the application is about to wait on (e.g. a
+// program link) should be started before background work (e.g. compressing the pipeline cache).
+enum class TaskPriority
+{
+    High,
+    Normal,
+    Low,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
 // A callback function with no return value and no arguments.
 class Closure
 {
@@ -76,8 +88,10 @@ class WorkerThreadPool : angle::NonCopyable
     virtual ~WorkerThreadPool();
 
     static std::shared_ptr<WorkerThreadPool> Create(bool multithreaded);
-    static std::shared_ptr<WaitableEvent> PostWorkerTask(std::shared_ptr<WorkerThreadPool> pool,
-                                                         std::shared_ptr<Closure> task);
+    static std::shared_ptr<WaitableEvent> PostWorkerTask(
+        std::shared_ptr<WorkerThreadPool> pool,
+        std::shared_ptr<Closure> task,
+        TaskPriority priority = TaskPriority::Normal);
 
     virtual void setMaxThreads(size_t maxThreads) = 0;
 
@@ -86,7 +100,8 @@ class WorkerThreadPool : angle::NonCopyable
   private:
     // Returns an event to wait on for the task to finish.
     // If the pool fails to create the task, returns null.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) = 0;
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                          TaskPriority priority) = 0;
 };
 
 }  // namespace angle
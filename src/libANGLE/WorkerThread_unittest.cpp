@@ -8,6 +8,12 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "libANGLE/WorkerThread.h"
 
@@ -49,4 +55,225 @@ TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+
+// A task that blocks the worker running it until it's released.
+class BlockingTask : public Closure
+{
+  public:
+    void operator()() override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mStarted = true;
+        mCondition.notify_all();
+        mCondition.wait(lock, [this] { return mReleased; });
+    }
+
+    void waitUntilStarted()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mStarted; });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mReleased = true;
+        mCondition.notify_all();
+    }
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStarted  = false;
+    bool mReleased = false;
+};
+
+// A task that records the order in which it ran.
+class OrderedTask : public Closure
+{
+  public:
+    OrderedTask(std::mutex *mutex, std::vector<int> *order, int id)
+        : mMutex(mutex), mOrder(order), mId(id)
+    {}
+
+    void operator()() override
+    {
+        std::lock_guard<std::mutex> lock(*mMutex);
+        mOrder->push_back(mId);
+    }
+
+  private:
+    std::mutex *mMutex;
+    std::vector<int> *mOrder;
+    int mId;
+};
+
+// Tests that higher priority tasks are started before lower priority ones.
+TEST(WorkerPoolTest, TaskPriorities)
+{
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    pool->setMaxThreads(1);
+
+    // Keep the only worker busy while the other tasks are posted.
+    auto blockingTask = std::make_shared<BlockingTask>();
+    std::shared_ptr<WaitableEvent> blockingEvent =
+        WorkerThreadPool::PostWorkerTask(pool, blockingTask);
+    blockingTask->waitUntilStarted();
+
+    constexpr int kTaskCount = 4;
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<std::shared_ptr<WaitableEvent>> events;
+    for (int taskIndex = 0; taskIndex < kTaskCount; ++taskIndex)
+    {
+        events.push_back(WorkerThreadPool::PostWorkerTask(
+            pool, std::make_shared<OrderedTask>(&mutex, &order, kTaskCount + taskIndex),
+            TaskPriority::Low));
+        events.push_back(WorkerThreadPool::PostWorkerTask(
+            pool, std::make_shared<OrderedTask>(&mutex, &order, taskIndex), TaskPriority::High));
+    }
+
+    blockingTask->release();
+    blockingEvent->wait();
+
+    // Don't wait() on the events, that would run the tasks that are still queued on this thread.
+    for (std::shared_ptr<WaitableEvent> &event : events)
+    {
+        while (!event->isReady())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ASSERT_EQ(static_cast<size_t>(2 * kTaskCount), order.size());
+    for (int taskIndex = 0; taskIndex < 2 * kTaskCount; ++taskIndex)
+    {
+        EXPECT_EQ(taskIndex, order[taskIndex]);
+    }
+}
+
+// Tests that waiting on a task that no worker has started runs it on the waiting thread.
+TEST(WorkerPoolTest, WaitRunsPendingTask)
+{
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    pool->setMaxThreads(1);
+
+    auto blockingTask = std::make_shared<BlockingTask>();
+    std::shared_ptr<WaitableEvent> blockingEvent =
+        WorkerThreadPool::PostWorkerTask(pool, blockingTask);
+    blockingTask->waitUntilStarted();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::shared_ptr<WaitableEvent> event =
+        WorkerThreadPool::PostWorkerTask(pool, std::make_shared<OrderedTask>(&mutex, &order, 0));
+    EXPECT_FALSE(event->isReady());
+
+    // The only worker is blocked, so this would deadlock if the task wasn't run here.
+    event->wait();
+    EXPECT_TRUE(event->isReady());
+    EXPECT_EQ(1u, order.size());
+
+    blockingTask->release();
+    blockingEvent->wait();
+}
+
+// Tests that a new worker is started when there are more tasks than sleeping workers.
+TEST(WorkerPoolTest, MoreTasksThanSleepingWorkers)
+{
+    if (std::thread::hardware_concurrency() < 2)
+    {
+        GTEST_SKIP() << "Needs two worker threads.";
+    }
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    pool->setMaxThreads(2);
+
+    // Start one worker and let it go to sleep.
+    std::mutex mutex;
+    std::vector<int> order;
+    std::shared_ptr<WaitableEvent> event =
+        WorkerThreadPool::PostWorkerTask(pool, std::make_shared<OrderedTask>(&mutex, &order, 0));
+    while (!event->isReady())
+    {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // Both tasks must run at the same time, which needs a second worker.
+    std::array<std::shared_ptr<BlockingTask>, 2> blockingTasks = {
+        {std::make_shared<BlockingTask>(), std::make_shared<BlockingTask>()}};
+    std::array<std::shared_ptr<WaitableEvent>, 2> blockingEvents = {
+        {WorkerThreadPool::PostWorkerTask(pool, blockingTasks[0]),
+         WorkerThreadPool::PostWorkerTask(pool, blockingTasks[1])}};
+
+    for (std::shared_ptr<BlockingTask> &blockingTask : blockingTasks)
+    {
+        blockingTask->waitUntilStarted();
+    }
+    for (std::shared_ptr<BlockingTask> &blockingTask : blockingTasks)
+    {
+        blockingTask->release();
+    }
+    WaitableEvent::WaitMany(&blockingEvents);
+}
+
+// Tests posting tasks from several threads at once, and from tasks.
+TEST(WorkerPoolTest, ManyProducers)
+{
+    class CountingTask : public Closure
+    {
+      public:
+        CountingTask(std::shared_ptr<WorkerThreadPool> pool, std::atomic<int> *counter, int depth)
+            : mPool(pool), mCounter(counter), mDepth(depth)
+        {}
+
+        void operator()() override
+        {
+            (*mCounter)++;
+            if (mDepth > 0)
+            {
+                std::shared_ptr<WaitableEvent> event = WorkerThreadPool::PostWorkerTask(
+                    mPool, std::make_shared<CountingTask>(mPool, mCounter, mDepth - 1));
+                event->wait();
+            }
+        }
+
+      private:
+        std::shared_ptr<WorkerThreadPool> mPool;
+        std::atomic<int> *mCounter;
+        int mDepth;
+    };
+
+    static constexpr int kProducerCount    = 4;
+    static constexpr int kTasksPerProducer = 256;
+    static constexpr int kDepth            = 2;
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    std::atomic<int> counter(0);
+
+    std::vector<std::thread> producers;
+    for (int producerIndex = 0; producerIndex < kProducerCount; ++producerIndex)
+    {
+        producers.emplace_back([pool, &counter] {
+            std::vector<std::shared_ptr<WaitableEvent>> events;
+            for (int taskIndex = 0; taskIndex < kTasksPerProducer; ++taskIndex)
+            {
+                events.push_back(WorkerThreadPool::PostWorkerTask(
+                    pool, std::make_shared<CountingTask>(pool, &counter, kDepth)));
+            }
+            for (std::shared_ptr<WaitableEvent> &event : events)
+            {
+                event->wait();
+            }
+        });
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(kProducerCount * kTasksPerProducer * (kDepth + 1), counter.load());
+}
 }  // anonymous namespace
@@ -20,6 +20,21 @@ angle::Result BufferImpl::getSubData(const gl::Context *context,
     return angle::Result::Stop;
 }
 
+angle::Result BufferImpl::getIndexRanges(const gl::Context *context,
+                                         gl::DrawElementsType type,
+                                         const std::vector<gl::IndexSpan> &spans,
+                                         bool primitiveRestartEnabled,
+                                         std::vector<gl::IndexRange> *outRanges)
+{
+    outRanges->resize(spans.size());
+    for (size_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex)
+    {
+        ANGLE_TRY(getIndexRange(context, type, spans[spanIndex].offset, spans[spanIndex].count,
+                                primitiveRestartEnabled, &(*outRanges)[spanIndex]));
+    }
+    return angle::Result::Continue;
+}
+
 angle::Result BufferImpl::setDataWithUsageFlags(const gl::Context *context,
                                                 gl::BufferBinding target,
                                                 GLeglClientBufferEXT clientBuffer,
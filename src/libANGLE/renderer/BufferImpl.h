@@ -12,6 +12,7 @@
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
 #include "common/mathutil.h"
+#include "common/utilities.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/Observer.h"
 
@@ -72,6 +73,15 @@ class BufferImpl : public angle::Subject
                                         bool primitiveRestartEnabled,
                                         gl::IndexRange *outRange) = 0;
 
+    // Computes the index ranges of several spans of the buffer.  The default implementation calls
+    // getIndexRange for every span; backends where reading the buffer is expensive should read it
+    // only once.
+    virtual angle::Result getIndexRanges(const gl::Context *context,
+                                         gl::DrawElementsType type,
+                                         const std::vector<gl::IndexSpan> &spans,
+                                         bool primitiveRestartEnabled,
+                                         std::vector<gl::IndexRange> *outRanges);
+
     virtual angle::Result getSubData(const gl::Context *context,
                                      GLintptr offset,
                                      GLsizeiptr size,
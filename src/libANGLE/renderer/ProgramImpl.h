@@ -82,6 +82,15 @@ class ProgramImpl : angle::NonCopyable
     virtual void setBinaryRetrievableHint(bool retrievable)                       = 0;
     virtual void setSeparable(bool separable)                                     = 0;
 
+    // Backend link work that only depends on the program's linked resources, done before link().
+    // When the front-end link runs on a worker thread, so does this, so only state of the context
+    // that doesn't change after its creation (caps, extensions, features) may be used.
+    virtual angle::Result prepareLink(const gl::Context *context,
+                                      const gl::ProgramLinkedResources &resources)
+    {
+        return angle::Result::Continue;
+    }
+
     virtual std::unique_ptr<LinkEvent> link(const gl::Context *context,
                                             const gl::ProgramLinkedResources &resources,
                                             gl::InfoLog &infoLog,
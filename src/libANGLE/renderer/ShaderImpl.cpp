@@ -8,12 +8,57 @@
 
 #include "libANGLE/renderer/ShaderImpl.h"
 
+#include "common/event_tracer.h"
+#include "common/system_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/trace.h"
 
 namespace rx
 {
 
+void TracePassMetrics(ShHandle handle)
+{
+    const std::vector<sh::PassMetrics> &passMetrics = sh::GetPassMetrics(handle);
+    if (passMetrics.empty())
+    {
+        return;
+    }
+
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    const unsigned char *categoryEnabled =
+        angle::GetTraceCategoryEnabledFlag(platform, "gpu.angle");
+    if (*categoryEnabled == 0)
+    {
+        return;
+    }
+
+    // The translator times the phases with angle::GetCurrentTime(), which isn't necessarily the
+    // clock of the platform.
+    const double clockOffset =
+        platform->monotonicallyIncreasingTime(platform) - angle::GetCurrentTime();
+
+    constexpr int kArgCount                 = 3;
+    const char *argNames[kArgCount]         = {"astNodeCount", "poolBytesAllocated",
+                                       "poolPeakBytesInUse"};
+    const unsigned char argTypes[kArgCount] = {TRACE_VALUE_TYPE_UINT, TRACE_VALUE_TYPE_UINT,
+                                               TRACE_VALUE_TYPE_UINT};
+
+    for (const sh::PassMetrics &metrics : passMetrics)
+    {
+        const unsigned long long argValues[kArgCount] = {metrics.astNodeCount,
+                                                         metrics.poolBytesAllocated,
+                                                         metrics.poolPeakBytesInUse};
+        const double startTime                        = metrics.startTime + clockOffset;
+
+        angle::AddTraceEventWithTimestamp(platform, TRACE_EVENT_PHASE_BEGIN, categoryEnabled,
+                                          metrics.name, 0, startTime, 0, nullptr, nullptr, nullptr,
+                                          TRACE_EVENT_FLAG_NONE);
+        angle::AddTraceEventWithTimestamp(platform, TRACE_EVENT_PHASE_END, categoryEnabled,
+                                          metrics.name, 0, startTime + metrics.wallTime, kArgCount,
+                                          argNames, argTypes, argValues, TRACE_EVENT_FLAG_NONE);
+    }
+}
+
 WaitableCompileEvent::WaitableCompileEvent(std::shared_ptr<angle::WaitableEvent> waitableEvent)
     : mWaitableEvent(waitableEvent)
 {}
@@ -50,6 +95,7 @@ class TranslateTask : public angle::Closure
         ANGLE_TRACE_EVENT1("gpu.angle", "TranslateTask::run", "source", mSource);
         const char *source = mSource.c_str();
         mResult            = sh::Compile(mHandle, &source, 1, mOptions);
+        TracePassMetrics(mHandle);
     }
 
     bool getResult() { return mResult; }
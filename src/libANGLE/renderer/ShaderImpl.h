@@ -24,6 +24,12 @@ namespace rx
 {
 
 using UpdateShaderStateFunctor = std::function<void(bool compiled, ShHandle handle)>;
+
+// Adds the phases of the last compilation of |handle| to the trace, if they were recorded with
+// SH_RECORD_PASS_METRICS.  Called right after sh::Compile, on the same thread, so the phases nest
+// in the events of the translation.
+void TracePassMetrics(ShHandle handle);
+
 class WaitableCompileEvent : public angle::WaitableEvent
 {
   public:
@@ -59,6 +65,17 @@ class ShaderImpl : angle::NonCopyable
 
     virtual std::string getDebugInfo() const = 0;
 
+    // Whether the whole result of a compile is held in the ShaderState, which lets the front-end
+    // restore it from the shader cache instead of compiling.
+    virtual bool supportsShaderCache() const { return false; }
+
+    // The compile options the back-end adds to the front-end's.  They are part of the shader
+    // cache key.
+    virtual ShCompileOptions getBackendCompileOptions(const gl::Context *context) const
+    {
+        return 0;
+    }
+
     const gl::ShaderState &getState() const { return mState; }
 
   protected:
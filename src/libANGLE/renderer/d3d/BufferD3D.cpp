@@ -188,4 +188,17 @@ angle::Result BufferD3D::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferD3D::getIndexRanges(const gl::Context *context,
+                                        gl::DrawElementsType type,
+                                        const std::vector<gl::IndexSpan> &spans,
+                                        bool primitiveRestartEnabled,
+                                        std::vector<gl::IndexRange> *outRanges)
+{
+    const uint8_t *data = nullptr;
+    ANGLE_TRY(getData(context, &data));
+
+    gl::ComputeIndexRanges(type, data, spans, primitiveRestartEnabled, outRanges);
+    return angle::Result::Continue;
+}
+
 }  // namespace rx
@@ -63,6 +63,11 @@ class BufferD3D : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 const std::vector<gl::IndexSpan> &spans,
+                                 bool primitiveRestartEnabled,
+                                 std::vector<gl::IndexRange> *outRanges) override;
 
     BufferFactoryD3D *getFactory() const { return mFactory; }
     D3DBufferUsage getUsage() const { return mUsage; }
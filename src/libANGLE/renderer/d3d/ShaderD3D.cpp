@@ -46,6 +46,7 @@ class TranslateTaskD3D : public angle::Closure
         srcStrings.push_back(mSource.c_str());
 
         mResult = sh::Compile(mHandle, &srcStrings[0], srcStrings.size(), mOptions);
+        TracePassMetrics(mHandle);
     }
 
     bool getResult() { return mResult; }
@@ -284,6 +284,67 @@ angle::Result BufferGL::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferGL::getIndexRanges(const gl::Context *context,
+                                       gl::DrawElementsType type,
+                                       const std::vector<gl::IndexSpan> &spans,
+                                       bool primitiveRestartEnabled,
+                                       std::vector<gl::IndexRange> *outRanges)
+{
+    ContextGL *contextGL              = GetImplAs<ContextGL>(context);
+    const FunctionsGL *functions      = GetFunctionsGL(context);
+    StateManagerGL *stateManager      = GetStateManagerGL(context);
+    const angle::FeaturesGL &features = GetFeaturesGL(context);
+
+    ASSERT(!mIsMapped);
+
+    if (features.keepBufferShadowCopy.enabled)
+    {
+        gl::ComputeIndexRanges(type, mShadowCopy.data(), spans, primitiveRestartEnabled,
+                               outRanges);
+        return angle::Result::Continue;
+    }
+
+    // Map the part of the buffer that covers all the spans only once.
+    const GLuint typeBytes = gl::GetDrawElementsTypeSize(type);
+    size_t mapStart        = std::numeric_limits<size_t>::max();
+    size_t mapEnd          = 0;
+    for (const gl::IndexSpan &span : spans)
+    {
+        mapStart = std::min(mapStart, span.offset);
+        mapEnd   = std::max(mapEnd, span.offset + span.count * typeBytes);
+    }
+    if (mapStart >= mapEnd)
+    {
+        outRanges->assign(spans.size(), gl::IndexRange(0, 0, 0));
+        return angle::Result::Continue;
+    }
+
+    stateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+
+    const uint8_t *bufferData =
+        MapBufferRangeWithFallback(functions, gl::ToGLenum(DestBufferOperationTarget), mapStart,
+                                   mapEnd - mapStart, GL_MAP_READ_BIT);
+    if (bufferData)
+    {
+        std::vector<gl::IndexSpan> mappedSpans = spans;
+        for (gl::IndexSpan &span : mappedSpans)
+        {
+            span.offset -= mapStart;
+        }
+        gl::ComputeIndexRanges(type, bufferData, mappedSpans, primitiveRestartEnabled, outRanges);
+        ANGLE_GL_TRY(context, functions->unmapBuffer(gl::ToGLenum(DestBufferOperationTarget)));
+    }
+    else
+    {
+        // Workaround the null driver not having map support.
+        outRanges->assign(spans.size(), gl::IndexRange(0, 0, 1));
+    }
+
+    contextGL->markWorkSubmitted();
+
+    return angle::Result::Continue;
+}
+
 GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
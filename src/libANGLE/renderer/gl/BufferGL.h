@@ -55,6 +55,11 @@ class BufferGL : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 const std::vector<gl::IndexSpan> &spans,
+                                 bool primitiveRestartEnabled,
+                                 std::vector<gl::IndexRange> *outRanges) override;
 
     GLuint getBufferID() const;
 
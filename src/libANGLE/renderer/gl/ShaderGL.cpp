@@ -42,6 +42,7 @@ class TranslateTaskGL : public angle::Closure
         ANGLE_TRACE_EVENT1("gpu.angle", "TranslateTaskGL::run", "source", mSource);
         const char *source = mSource.c_str();
         mResult            = sh::Compile(mHandle, &source, 1, mOptions);
+        TracePassMetrics(mHandle);
         if (mResult)
         {
             mWorkerAvailable =
@@ -395,6 +396,7 @@ std::shared_ptr<WaitableCompileEvent> ShaderGL::compile(const gl::Context *conte
         ShHandle handle = compilerInstance->getHandle();
         const char *str = source.c_str();
         bool result     = sh::Compile(handle, &str, 1, options);
+        TracePassMetrics(handle);
         if (result)
         {
             compileShader(sh::GetObjectCode(handle).c_str());
@@ -432,6 +434,7 @@ std::shared_ptr<WaitableCompileEvent> ShaderGL::compile(const gl::Context *conte
         ShHandle handle = compilerInstance->getHandle();
         const char *str = source.c_str();
         bool result     = sh::Compile(handle, &str, 1, options);
+        TracePassMetrics(handle);
         if (result)
         {
             compileAndCheckShader(sh::GetObjectCode(handle).c_str());
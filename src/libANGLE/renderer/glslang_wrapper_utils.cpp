@@ -871,6 +871,88 @@ void AssignTextureBindings(const GlslangSourceOptions &options,
     }
 }
 
+// SPIR-V 1.0 Table 1: First Words of Physical Layout
+enum HeaderIndex
+{
+    kHeaderIndexMagic        = 0,
+    kHeaderIndexVersion      = 1,
+    kHeaderIndexGenerator    = 2,
+    kHeaderIndexIndexBound   = 3,
+    kHeaderIndexSchema       = 4,
+    kHeaderIndexInstructions = 5,
+};
+
+// The declarations SpirvTransformer::resolveVariableIds gathers information from.
+bool IsVisitedDeclaration(spv::Op opCode)
+{
+    switch (opCode)
+    {
+        case spv::OpDecorate:
+        case spv::OpName:
+        case spv::OpMemberName:
+        case spv::OpTypeArray:
+        case spv::OpTypeFloat:
+        case spv::OpTypeInt:
+        case spv::OpTypePointer:
+        case spv::OpTypeVector:
+        case spv::OpVariable:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The instructions of the declarations section SpirvTransformer::transformInstruction may
+// transform.
+bool IsTransformedDeclaration(spv::Op opCode)
+{
+    switch (opCode)
+    {
+        case spv::OpName:
+        case spv::OpMemberName:
+        case spv::OpString:
+        case spv::OpLine:
+        case spv::OpNoLine:
+        case spv::OpModuleProcessed:
+        case spv::OpCapability:
+        case spv::OpEntryPoint:
+        case spv::OpDecorate:
+        case spv::OpMemberDecorate:
+        case spv::OpTypePointer:
+        case spv::OpTypeStruct:
+        case spv::OpVariable:
+        case spv::OpExecutionMode:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The instructions of the functions section SpirvTransformer::transformInstruction may transform.
+bool IsTransformedFunctionInstruction(spv::Op opCode)
+{
+    switch (opCode)
+    {
+        case spv::OpFunction:
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpPtrAccessChain:
+        case spv::OpInBoundsPtrAccessChain:
+        case spv::OpEmitVertex:
+        case spv::OpReturn:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The instructions that must come immediately after OpFunction, before any code can be inserted.
+bool IsFunctionHeaderInstruction(spv::Op opCode)
+{
+    return opCode == spv::OpFunction || opCode == spv::OpFunctionParameter ||
+           opCode == spv::OpLabel || opCode == spv::OpVariable;
+}
+
 // Base class for SPIR-V transformations.
 class SpirvTransformerBase : angle::NonCopyable
 {
@@ -894,17 +976,6 @@ class SpirvTransformerBase : angle::NonCopyable
     spirv::IdRef getNewId();
 
   protected:
-    // SPIR-V 1.0 Table 1: First Words of Physical Layout
-    enum HeaderIndex
-    {
-        kHeaderIndexMagic        = 0,
-        kHeaderIndexVersion      = 1,
-        kHeaderIndexGenerator    = 2,
-        kHeaderIndexIndexBound   = 3,
-        kHeaderIndexSchema       = 4,
-        kHeaderIndexInstructions = 5,
-    };
-
     // Common utilities
     void onTransformBegin();
     const uint32_t *getCurrentInstruction(spv::Op *opCodeOut, uint32_t *wordCountOut) const;
@@ -2819,9 +2890,11 @@ class SpirvTransformer final : public SpirvTransformerBase
     SpirvTransformer(const spirv::Blob &spirvBlobIn,
                      const GlslangSpirvOptions &options,
                      const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                     const GlslangSpirvInstructionIndex *instructionIndex,
                      spirv::Blob *spirvBlobOut)
         : SpirvTransformerBase(spirvBlobIn, variableInfoMap, spirvBlobOut),
           mOptions(options),
+          mInstructionIndex(instructionIndex),
           mXfbCodeGenerator(options.isTransformFeedbackEmulated),
           mPositionTransformer(options)
     {}
@@ -2834,8 +2907,10 @@ class SpirvTransformer final : public SpirvTransformerBase
 
     // Transform instructions:
     void transformInstruction();
+    void copyWordsUntil(size_t offset);
 
     // Instructions that are purely informational:
+    void visitDeclaration(const uint32_t *instruction, spv::Op opCode);
     void visitDecorate(const uint32_t *instruction);
     void visitName(const uint32_t *instruction);
     void visitMemberName(const uint32_t *instruction);
@@ -2870,6 +2945,9 @@ class SpirvTransformer final : public SpirvTransformerBase
     // Special flags:
     GlslangSpirvOptions mOptions;
 
+    // If available, only the indexed instructions are visited.
+    const GlslangSpirvInstructionIndex *mInstructionIndex;
+
     // Traversal state:
     bool mInsertFunctionVariables = false;
     spirv::IdRef mEntryPointId;
@@ -2894,10 +2972,31 @@ void SpirvTransformer::transform()
     // their decorations.
     resolveVariableIds();
 
-    while (mCurrentWord < mSpirvBlobIn.size())
+    if (mInstructionIndex == nullptr)
     {
+        while (mCurrentWord < mSpirvBlobIn.size())
+        {
+            transformInstruction();
+        }
+        return;
+    }
+
+    // Every instruction that's not in the index is copied as is, so copy the words in between the
+    // indexed instructions in bulk.
+    for (uint32_t offset : mInstructionIndex->getInstructions())
+    {
+        copyWordsUntil(offset);
         transformInstruction();
     }
+    copyWordsUntil(mSpirvBlobIn.size());
+}
+
+void SpirvTransformer::copyWordsUntil(size_t offset)
+{
+    ASSERT(offset >= mCurrentWord && offset <= mSpirvBlobIn.size());
+    mSpirvBlobOut->insert(mSpirvBlobOut->end(), mSpirvBlobIn.begin() + mCurrentWord,
+                          mSpirvBlobIn.begin() + offset);
+    mCurrentWord = offset;
 }
 
 void SpirvTransformer::resolveVariableIds()
@@ -2913,6 +3012,21 @@ void SpirvTransformer::resolveVariableIds()
     // that name in mVariableInfoMap.
     mVariableInfoById.resize(indexBound, nullptr);
 
+    if (mInstructionIndex != nullptr)
+    {
+        for (uint32_t offset : mInstructionIndex->getDeclarations())
+        {
+            const uint32_t *instruction = &mSpirvBlobIn[offset];
+
+            uint32_t wordCount;
+            spv::Op opCode;
+            spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+            visitDeclaration(instruction, opCode);
+        }
+        return;
+    }
+
     size_t currentWord = kHeaderIndexInstructions;
 
     while (currentWord < mSpirvBlobIn.size())
@@ -2923,51 +3037,62 @@ void SpirvTransformer::resolveVariableIds()
         spv::Op opCode;
         spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
 
-        switch (opCode)
+        if (opCode == spv::OpFunction)
         {
-            case spv::OpDecorate:
-                visitDecorate(instruction);
-                break;
-            case spv::OpName:
-                visitName(instruction);
-                break;
-            case spv::OpMemberName:
-                visitMemberName(instruction);
-                break;
-            case spv::OpTypeArray:
-                visitTypeArray(instruction);
-                break;
-            case spv::OpTypeFloat:
-                visitTypeFloat(instruction);
-                break;
-            case spv::OpTypeInt:
-                visitTypeInt(instruction);
-                break;
-            case spv::OpTypePointer:
-                visitTypePointer(instruction);
-                break;
-            case spv::OpTypeVector:
-                visitTypeVector(instruction);
-                break;
-            case spv::OpVariable:
-                visitVariable(instruction);
-                break;
-            case spv::OpFunction:
-                // SPIR-V is structured in sections (SPIR-V 1.0 Section 2.4 Logical Layout of a
-                // Module). Names appear before decorations, which are followed by type+variables
-                // and finally functions.  We are only interested in name and variable declarations
-                // (as well as type declarations for the sake of nameless interface blocks).  Early
-                // out when the function declaration section is met.
-                return;
-            default:
-                break;
+            // SPIR-V is structured in sections (SPIR-V 1.0 Section 2.4 Logical Layout of a
+            // Module). Names appear before decorations, which are followed by type+variables and
+            // finally functions.  We are only interested in name and variable declarations (as
+            // well as type declarations for the sake of nameless interface blocks).  Early out
+            // when the function declaration section is met.
+            return;
         }
 
+        visitDeclaration(instruction, opCode);
+
         currentWord += wordCount;
     }
     UNREACHABLE();
 }
 
+void SpirvTransformer::visitDeclaration(const uint32_t *instruction, spv::Op opCode)
+{
+    ASSERT(!mIsInFunctionSection);
+
+    switch (opCode)
+    {
+        case spv::OpDecorate:
+            visitDecorate(instruction);
+            break;
+        case spv::OpName:
+            visitName(instruction);
+            break;
+        case spv::OpMemberName:
+            visitMemberName(instruction);
+            break;
+        case spv::OpTypeArray:
+            visitTypeArray(instruction);
+            break;
+        case spv::OpTypeFloat:
+            visitTypeFloat(instruction);
+            break;
+        case spv::OpTypeInt:
+            visitTypeInt(instruction);
+            break;
+        case spv::OpTypePointer:
+            visitTypePointer(instruction);
+            break;
+        case spv::OpTypeVector:
+            visitTypeVector(instruction);
+            break;
+        case spv::OpVariable:
+            visitVariable(instruction);
+            break;
+        default:
+            ASSERT(!IsVisitedDeclaration(opCode));
+            break;
+    }
+}
+
 void SpirvTransformer::transformInstruction()
 {
     uint32_t wordCount;
@@ -3009,9 +3134,7 @@ void SpirvTransformer::transformInstruction()
         // immediately after OpFunction we need to check if there are any precision mismatches that
         // need to be handled. If so, output OpVariable for each variable that needed to change from
         // a StorageClassOutput to a StorageClassFunction.
-        if (mInsertFunctionVariables && opCode != spv::OpFunction &&
-            opCode != spv::OpFunctionParameter && opCode != spv::OpLabel &&
-            opCode != spv::OpVariable)
+        if (mInsertFunctionVariables && !IsFunctionHeaderInstruction(opCode))
         {
             writeInputPreamble();
             mInsertFunctionVariables = false;
@@ -3034,6 +3157,7 @@ void SpirvTransformer::transformInstruction()
                 transformationState = transformReturn(instruction);
                 break;
             default:
+                ASSERT(opCode == spv::OpFunction || !IsTransformedFunctionInstruction(opCode));
                 break;
         }
     }
@@ -3075,6 +3199,7 @@ void SpirvTransformer::transformInstruction()
                 transformationState = transformExecutionMode(instruction);
                 break;
             default:
+                ASSERT(!IsTransformedDeclaration(opCode));
                 break;
         }
     }
@@ -4902,9 +5027,78 @@ void GlslangGetShaderSpirvCode(const GlslangSourceOptions &options,
     }
 }
 
+bool operator==(const GlslangSpirvOptions &a, const GlslangSpirvOptions &b)
+{
+    return a.shaderType == b.shaderType && a.preRotation == b.preRotation &&
+           a.negativeViewportSupported == b.negativeViewportSupported &&
+           a.transformPositionToVulkanClipSpace == b.transformPositionToVulkanClipSpace &&
+           a.removeEarlyFragmentTestsOptimization == b.removeEarlyFragmentTestsOptimization &&
+           a.removeDebugInfo == b.removeDebugInfo &&
+           a.isTransformFeedbackStage == b.isTransformFeedbackStage &&
+           a.isTransformFeedbackEmulated == b.isTransformFeedbackEmulated;
+}
+
+void GlslangSpirvInstructionIndex::init(const spirv::Blob &spirvBlob)
+{
+    clear();
+
+    bool isInFunctionSection = false;
+    bool isInFunctionHeader  = false;
+
+    size_t currentWord = kHeaderIndexInstructions;
+    while (currentWord < spirvBlob.size())
+    {
+        uint32_t wordCount;
+        spv::Op opCode;
+        spirv::GetInstructionOpAndLength(&spirvBlob[currentWord], &opCode, &wordCount);
+
+        const uint32_t offset = static_cast<uint32_t>(currentWord);
+        currentWord += wordCount;
+
+        if (opCode == spv::OpFunction)
+        {
+            isInFunctionSection = true;
+            isInFunctionHeader  = true;
+        }
+
+        if (!isInFunctionSection)
+        {
+            if (IsVisitedDeclaration(opCode))
+            {
+                mDeclarations.push_back(offset);
+            }
+            if (IsTransformedDeclaration(opCode))
+            {
+                mInstructions.push_back(offset);
+            }
+            continue;
+        }
+
+        // The first instruction after the function header is where variables may be inserted.
+        bool isFirstInstructionOfFunctionBody = false;
+        if (isInFunctionHeader && !IsFunctionHeaderInstruction(opCode))
+        {
+            isInFunctionHeader               = false;
+            isFirstInstructionOfFunctionBody = true;
+        }
+
+        if (isFirstInstructionOfFunctionBody || IsTransformedFunctionInstruction(opCode))
+        {
+            mInstructions.push_back(offset);
+        }
+    }
+}
+
+void GlslangSpirvInstructionIndex::clear()
+{
+    mDeclarations.clear();
+    mInstructions.clear();
+}
+
 angle::Result GlslangTransformSpirvCode(const GlslangSpirvOptions &options,
                                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
                                         const spirv::Blob &initialSpirvBlob,
+                                        const GlslangSpirvInstructionIndex *instructionIndex,
                                         spirv::Blob *spirvBlobOut)
 {
     if (initialSpirvBlob.empty())
@@ -4912,8 +5106,11 @@ angle::Result GlslangTransformSpirvCode(const GlslangSpirvOptions &options,
         return angle::Result::Continue;
     }
 
+    ASSERT(instructionIndex == nullptr || instructionIndex->valid());
+
     // Transform the SPIR-V code by assigning location/set/binding values.
-    SpirvTransformer transformer(initialSpirvBlob, options, variableInfoMap, spirvBlobOut);
+    SpirvTransformer transformer(initialSpirvBlob, options, variableInfoMap, instructionIndex,
+                                 spirvBlobOut);
     transformer.transform();
 
     // If there are aliasing vertex attributes, transform the SPIR-V again to remove them.
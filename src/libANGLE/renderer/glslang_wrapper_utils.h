@@ -63,6 +63,8 @@ struct GlslangSpirvOptions
     bool isTransformFeedbackEmulated          = false;
 };
 
+bool operator==(const GlslangSpirvOptions &a, const GlslangSpirvOptions &b);
+
 struct ShaderInterfaceVariableXfbInfo
 {
     static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
@@ -191,9 +193,32 @@ void GlslangGetShaderSpirvCode(const GlslangSourceOptions &options,
                                gl::ShaderMap<const angle::spirv::Blob *> *spirvBlobsOut,
                                ShaderInterfaceVariableInfoMap *variableInfoMapOut);
 
+// The offsets of the instructions of a SPIR-V blob that |GlslangTransformSpirvCode| looks at.
+// Which instructions these are doesn't depend on the transformation options, so the index is built
+// once per shader and shared by all of its transformations, which then copy the words in between
+// in bulk instead of walking the module instruction by instruction.
+class GlslangSpirvInstructionIndex final
+{
+  public:
+    void init(const angle::spirv::Blob &spirvBlob);
+    void clear();
+    bool valid() const { return !mInstructions.empty(); }
+
+    // Declarations the transformation gathers information from, up to the first function.
+    const std::vector<uint32_t> &getDeclarations() const { return mDeclarations; }
+    // Instructions that may be transformed, or before which code may be inserted.
+    const std::vector<uint32_t> &getInstructions() const { return mInstructions; }
+
+  private:
+    std::vector<uint32_t> mDeclarations;
+    std::vector<uint32_t> mInstructions;
+};
+
+// |instructionIndex| is optional.  If given, it must be valid and built from |initialSpirvBlob|.
 angle::Result GlslangTransformSpirvCode(const GlslangSpirvOptions &options,
                                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
                                         const angle::spirv::Blob &initialSpirvBlob,
+                                        const GlslangSpirvInstructionIndex *instructionIndex,
                                         angle::spirv::Blob *spirvBlobOut);
 
 }  // namespace rx
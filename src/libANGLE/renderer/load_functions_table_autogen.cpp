@@ -314,6 +314,18 @@ LoadImageFunctionInfo BGRX8_ANGLEX_to_B8G8R8X8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_R11_EAC_to_BC4_RED_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11ToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_R11_EAC_to_EAC_R11_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -374,6 +386,18 @@ LoadImageFunctionInfo COMPRESSED_RED_RGTC1_EXT_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_BC5_RG_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11ToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_EAC_R11G11_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -410,6 +434,18 @@ LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_R16G16_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGB8_ETC2_to_BC1_RGB_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2RGB8ToBC1, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGB8_ETC2_to_ETC2_R8G8B8_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -446,6 +482,18 @@ LoadImageFunctionInfo COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGB_UNORM_B
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_BC1_RGBA_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2RGB8A1ToBC1, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_ETC2_R8G8B8A1_UNORM_BLOCK(
     GLenum type)
 {
@@ -484,6 +532,18 @@ COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGBA_UNORM_BL
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA8_ETC2_EAC_to_BC3_RGBA_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2RGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA8_ETC2_EAC_to_ETC2_R8G8B8A8_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -880,6 +940,18 @@ LoadImageFunctionInfo COMPRESSED_RGB_S3TC_DXT1_EXT_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_R11_EAC_to_BC4_RED_SNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11SToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SIGNED_R11_EAC_to_EAC_R11_SNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -940,6 +1012,18 @@ LoadImageFunctionInfo COMPRESSED_SIGNED_RED_RGTC1_EXT_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_BC5_RG_SNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11SToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_EAC_R11G11_SNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -1264,6 +1348,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR_to_default(GLenum typ
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_BC3_RGBA_UNORM_SRGB_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2SRGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_ETC2_R8G8B8A8_SRGB_BLOCK(GLenum type)
 {
     switch (type)
@@ -1288,6 +1384,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_R8G8B8A8_UNORM_SRGB(GL
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ETC2_to_BC1_RGB_UNORM_SRGB_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2SRGB8ToBC1, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ETC2_to_ETC2_R8G8B8_SRGB_BLOCK(GLenum type)
 {
     switch (type)
@@ -1325,6 +1433,19 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGB_UNORM_
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_BC1_RGBA_UNORM_SRGB_BLOCK(
+    GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2SRGB8A1ToBC1, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_ETC2_R8G8B8A1_SRGB_BLOCK(
     GLenum type)
 {
@@ -1584,6 +1705,18 @@ LoadImageFunctionInfo ETC1_RGB8_LOSSY_DECODE_ANGLE_to_BC1_RGB_UNORM_BLOCK(GLenum
     }
 }
 
+LoadImageFunctionInfo ETC1_RGB8_OES_to_BC1_RGB_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC1RGB8ToBC1, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo ETC1_RGB8_OES_to_ETC1_R8G8B8_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -3333,6 +3466,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC4_RED_UNORM_BLOCK:
+                    return COMPRESSED_R11_EAC_to_BC4_RED_UNORM_BLOCK;
                 case FormatID::EAC_R11_UNORM_BLOCK:
                     return COMPRESSED_R11_EAC_to_EAC_R11_UNORM_BLOCK;
                 case FormatID::R16_FLOAT:
@@ -3352,6 +3487,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC5_RG_UNORM_BLOCK:
+                    return COMPRESSED_RG11_EAC_to_BC5_RG_UNORM_BLOCK;
                 case FormatID::EAC_R11G11_UNORM_BLOCK:
                     return COMPRESSED_RG11_EAC_to_EAC_R11G11_UNORM_BLOCK;
                 case FormatID::R16G16_FLOAT:
@@ -3367,6 +3504,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC1_RGB_UNORM_BLOCK:
+                    return COMPRESSED_RGB8_ETC2_to_BC1_RGB_UNORM_BLOCK;
                 case FormatID::ETC2_R8G8B8_UNORM_BLOCK:
                     return COMPRESSED_RGB8_ETC2_to_ETC2_R8G8B8_UNORM_BLOCK;
                 case FormatID::R8G8B8A8_UNORM:
@@ -3391,6 +3530,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC1_RGBA_UNORM_BLOCK:
+                    return COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_BC1_RGBA_UNORM_BLOCK;
                 case FormatID::ETC2_R8G8B8A1_UNORM_BLOCK:
                     return COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_ETC2_R8G8B8A1_UNORM_BLOCK;
                 case FormatID::R8G8B8A8_UNORM:
@@ -3415,6 +3556,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC3_RGBA_UNORM_BLOCK:
+                    return COMPRESSED_RGBA8_ETC2_EAC_to_BC3_RGBA_UNORM_BLOCK;
                 case FormatID::ETC2_R8G8B8A8_UNORM_BLOCK:
                     return COMPRESSED_RGBA8_ETC2_EAC_to_ETC2_R8G8B8A8_UNORM_BLOCK;
                 case FormatID::R8G8B8A8_UNORM:
@@ -3490,6 +3633,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC4_RED_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_R11_EAC_to_BC4_RED_SNORM_BLOCK;
                 case FormatID::EAC_R11_SNORM_BLOCK:
                     return COMPRESSED_SIGNED_R11_EAC_to_EAC_R11_SNORM_BLOCK;
                 case FormatID::R16_FLOAT:
@@ -3509,6 +3654,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC5_RG_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_RG11_EAC_to_BC5_RG_SNORM_BLOCK;
                 case FormatID::EAC_R11G11_SNORM_BLOCK:
                     return COMPRESSED_SIGNED_RG11_EAC_to_EAC_R11G11_SNORM_BLOCK;
                 case FormatID::R16G16_FLOAT:
@@ -3572,6 +3719,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC3_RGBA_UNORM_SRGB_BLOCK:
+                    return COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_BC3_RGBA_UNORM_SRGB_BLOCK;
                 case FormatID::ETC2_R8G8B8A8_SRGB_BLOCK:
                     return COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_ETC2_R8G8B8A8_SRGB_BLOCK;
                 case FormatID::R8G8B8A8_UNORM_SRGB:
@@ -3585,6 +3734,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC1_RGB_UNORM_SRGB_BLOCK:
+                    return COMPRESSED_SRGB8_ETC2_to_BC1_RGB_UNORM_SRGB_BLOCK;
                 case FormatID::ETC2_R8G8B8_SRGB_BLOCK:
                     return COMPRESSED_SRGB8_ETC2_to_ETC2_R8G8B8_SRGB_BLOCK;
                 case FormatID::R8G8B8A8_UNORM_SRGB:
@@ -3609,6 +3760,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC1_RGBA_UNORM_SRGB_BLOCK:
+                    return COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_BC1_RGBA_UNORM_SRGB_BLOCK;
                 case FormatID::ETC2_R8G8B8A1_SRGB_BLOCK:
                     return COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_ETC2_R8G8B8A1_SRGB_BLOCK;
                 case FormatID::R8G8B8A8_UNORM_SRGB:
@@ -3729,6 +3882,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC1_RGB_UNORM_BLOCK:
+                    return ETC1_RGB8_OES_to_BC1_RGB_UNORM_BLOCK;
                 case FormatID::ETC1_R8G8B8_UNORM_BLOCK:
                     return ETC1_RGB8_OES_to_ETC1_R8G8B8_UNORM_BLOCK;
                 case FormatID::ETC2_R8G8B8_UNORM_BLOCK:
@@ -35,6 +35,7 @@ class TranslateTask : public angle::Closure
     {
         const char *source = mSource.c_str();
         mResult            = sh::Compile(mHandle, &source, 1, mOptions);
+        TracePassMetrics(mHandle);
     }
 
     bool getResult() { return mResult; }
@@ -26,6 +26,8 @@ class ShaderNULL : public ShaderImpl
                                                   ShCompileOptions options) override;
 
     std::string getDebugInfo() const override;
+
+    bool supportsShaderCache() const override { return true; }
 };
 
 }  // namespace rx
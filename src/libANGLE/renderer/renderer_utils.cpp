@@ -18,12 +18,15 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/Format.h"
+#include "libANGLE/trace.h"
 #include "platform/Feature.h"
 
 #include <string.h>
+#include <thread>
 
 namespace rx
 {
@@ -226,6 +229,54 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
     memcpy(targetData, valueData, matrixSize * count);
 }
 
+// Images are split in bands of at least this many output bytes, so that the cost of posting and
+// waiting for a band is small compared to the conversion.
+constexpr size_t kMinParallelLoadBandSize = 256 * 1024;
+
+class LoadImageBandTask final : public angle::Closure
+{
+  public:
+    LoadImageBandTask(LoadImageFunction loadFunction,
+                      size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+        : mLoadFunction(loadFunction),
+          mWidth(width),
+          mHeight(height),
+          mDepth(depth),
+          mInput(input),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutput(output),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "LoadImageBandTask");
+        mLoadFunction(mWidth, mHeight, mDepth, mInput, mInputRowPitch, mInputDepthPitch, mOutput,
+                      mOutputRowPitch, mOutputDepthPitch);
+    }
+
+  private:
+    LoadImageFunction mLoadFunction;
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDepth;
+    const uint8_t *mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
 }  // anonymous namespace
 
 void RotateRectangle(const SurfaceRotation rotation,
@@ -475,6 +526,95 @@ bool ShouldUseVirtualizedContexts(const egl::AttributeMap &attribs, bool default
     }
 }
 
+void LoadImageInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                         LoadImageFunction loadFunction,
+                         size_t inputBlockHeight,
+                         size_t outputBlockHeight,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    ASSERT(inputBlockHeight > 0 && outputBlockHeight > 0);
+
+    // Bands of rows start on a row of blocks of both the input and the output.
+    const size_t blockHeight = std::max(inputBlockHeight, outputBlockHeight);
+    ASSERT(blockHeight % inputBlockHeight == 0 && blockHeight % outputBlockHeight == 0);
+
+    // Running more bands than there are cores only adds overhead.
+    const size_t coreCount  = std::max(std::thread::hardware_concurrency(), 1u);
+    const size_t outputRows = (height + outputBlockHeight - 1) / outputBlockHeight;
+    const size_t outputSize = outputRowPitch * outputRows * depth;
+    size_t bandCount        = std::min(outputSize / kMinParallelLoadBandSize, coreCount);
+
+    // 3D images are split along their slices when there are enough of them, so that every band
+    // reads and writes contiguous memory.  Otherwise, lines are rows of blocks.
+    const bool splitSlices = depth >= bandCount;
+    const size_t lineCount = splitSlices ? depth : (height + blockHeight - 1) / blockHeight;
+    bandCount              = std::min(bandCount, lineCount);
+
+    if (!workerPool || !workerPool->isAsync() || bandCount < 2)
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "LoadImageInParallel");
+
+    const size_t inputLinePitch =
+        splitSlices ? inputDepthPitch : inputRowPitch * (blockHeight / inputBlockHeight);
+    const size_t outputLinePitch =
+        splitSlices ? outputDepthPitch : outputRowPitch * (blockHeight / outputBlockHeight);
+
+    // The first band is loaded on this thread.  Waiting on a band that no worker has started yet
+    // loads it on this thread too.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> bandEvents;
+    std::shared_ptr<LoadImageBandTask> firstBand;
+    for (size_t band = 0; band < bandCount; ++band)
+    {
+        const size_t firstLine = lineCount * band / bandCount;
+        const size_t lineEnd   = lineCount * (band + 1) / bandCount;
+
+        // The last band of rows ends with the partial row of blocks at the bottom of the image.
+        size_t bandHeight = height;
+        size_t bandDepth  = depth;
+        if (splitSlices)
+        {
+            bandDepth = lineEnd - firstLine;
+        }
+        else
+        {
+            bandHeight = std::min(lineEnd * blockHeight, height) - firstLine * blockHeight;
+        }
+
+        auto bandTask = std::make_shared<LoadImageBandTask>(
+            loadFunction, width, bandHeight, bandDepth, input + firstLine * inputLinePitch,
+            inputRowPitch, inputDepthPitch, output + firstLine * outputLinePitch, outputRowPitch,
+            outputDepthPitch);
+
+        if (band == 0)
+        {
+            firstBand = bandTask;
+        }
+        else
+        {
+            bandEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, bandTask));
+        }
+    }
+
+    (*firstBand)();
+    for (std::shared_ptr<angle::WaitableEvent> &bandEvent : bandEvents)
+    {
+        bandEvent->wait();
+    }
+}
+
 void CopyImageCHROMIUM(const uint8_t *sourceData,
                        size_t sourceRowPitch,
                        size_t sourcePixelBytes,
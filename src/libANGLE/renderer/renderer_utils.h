@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/Color.h"
@@ -26,6 +27,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 enum class FormatID;
+class WorkerThreadPool;
 }  // namespace angle
 
 namespace gl
@@ -159,6 +161,28 @@ struct LoadImageFunctionInfo
     bool requiresConversion;
 };
 
+// Runs |loadFunction| on bands of rows, or of slices for 3D images, in |workerPool|.  Images below
+// a size threshold, and all images when the pool isn't asynchronous, are loaded on the calling
+// thread.  Returns when the whole image is loaded.
+//
+// The row pitches of block formats are the pitches of rows of blocks, and |inputBlockHeight| and
+// |outputBlockHeight| are the heights of these blocks, or 1 for other formats.  Only valid for load
+// functions that convert rows of blocks independently, which excludes the load functions of YUV
+// and 3D block formats.
+void LoadImageInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                         LoadImageFunction loadFunction,
+                         size_t inputBlockHeight,
+                         size_t outputBlockHeight,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch);
+
 using LoadFunctionMap           = LoadImageFunctionInfo (*)(GLenum);
 using LoadTextureBorderFunction = void (*)(angle::ColorF &mBorderColor);
 struct LoadTextureBorderFunctionInfo
@@ -195,7 +195,12 @@ BufferVk::VertexConversionBuffer::~VertexConversionBuffer() = default;
 
 // BufferVk implementation.
 BufferVk::BufferVk(const gl::BufferState &state)
-    : BufferImpl(state), mBuffer(nullptr), mBufferOffset(0)
+    : BufferImpl(state),
+      mBuffer(nullptr),
+      mBufferOffset(0),
+      mSuballocate(false),
+      mSuballocationDesc{},
+      mPendingReadPixelsContext(nullptr)
 {}
 
 BufferVk::~BufferVk() {}
@@ -210,12 +215,23 @@ void BufferVk::destroy(const gl::Context *context)
 void BufferVk::release(ContextVk *contextVk)
 {
     RendererVk *renderer = contextVk->getRenderer();
+    // The storage the pixels were going to be packed into is gone.
+    if (mPendingReadPixelsContext != nullptr)
+    {
+        mPendingReadPixelsContext->dropPendingReadPixels(this);
+    }
     // For external buffers, mBuffer is not a reference to a chunk in mBufferPool.
     // It was allocated explicitly and needs to be deallocated during release(...)
     if (mBuffer && mBuffer->isExternalBuffer())
     {
         mBuffer->release(renderer);
     }
+    if (mSuballocation)
+    {
+        mSuballocation->release(renderer);
+        mSuballocation.reset();
+    }
+    mSuballocate = false;
     mShadowBuffer.release();
     mBufferPool.release(renderer);
     mHostVisibleBufferPool.release(renderer);
@@ -426,9 +442,20 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
         const size_t bufferHelperPoolInitialSize =
             GetPreferredDynamicBufferInitialSize(renderer, size, usage, &bufferHelperAlignment);
 
-        mBufferPool.initWithFlags(renderer, usageFlags, bufferHelperAlignment,
-                                  bufferHelperPoolInitialSize, memoryPropertyFlags,
-                                  vk::DynamicBufferPolicy::FrequentSmallAllocations);
+        mSuballocate = contextVk->getFeatures().suballocateSmallBuffers.enabled &&
+                       roundUpPow2(size, bufferHelperAlignment) <= vk::kMaxBufferSuballocationSize;
+        if (mSuballocate)
+        {
+            mSuballocationDesc.usage               = usageFlags;
+            mSuballocationDesc.memoryPropertyFlags = memoryPropertyFlags;
+            mSuballocationDesc.alignment           = bufferHelperAlignment;
+        }
+        else
+        {
+            mBufferPool.initWithFlags(renderer, usageFlags, bufferHelperAlignment,
+                                      bufferHelperPoolInitialSize, memoryPropertyFlags,
+                                      vk::DynamicBufferPolicy::FrequentSmallAllocations);
+        }
 
         ANGLE_TRY(acquireBufferHelper(contextVk, size));
 
@@ -592,6 +619,8 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
                                      GLbitfield access,
                                      void **mapPtr)
 {
+    ANGLE_TRY(resolvePendingReadPixels());
+
     if (!mShadowBuffer.valid())
     {
         ASSERT(mBuffer && mBuffer->valid());
@@ -741,6 +770,34 @@ angle::Result BufferVk::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferVk::getIndexRanges(const gl::Context *context,
+                                       gl::DrawElementsType type,
+                                       const std::vector<gl::IndexSpan> &spans,
+                                       bool primitiveRestartEnabled,
+                                       std::vector<gl::IndexRange> *outRanges)
+{
+    ContextVk *contextVk = vk::GetImpl(context);
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // See getIndexRange.
+    if (renderer->isMockICDEnabled())
+    {
+        outRanges->assign(spans.size(), gl::IndexRange(0, 0, 0));
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "BufferVk::getIndexRanges");
+
+    // Map the buffer only once for all the spans.
+    void *mapPtr;
+    ANGLE_TRY(mapRangeImpl(contextVk, 0, getSize(), 0, &mapPtr));
+    gl::ComputeIndexRanges(type, static_cast<const uint8_t *>(mapPtr), spans,
+                           primitiveRestartEnabled, outRanges);
+    ANGLE_TRY(unmapImpl(contextVk));
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferVk::updateBuffer(ContextVk *contextVk,
                                      const uint8_t *data,
                                      size_t size,
@@ -816,6 +873,7 @@ angle::Result BufferVk::acquireAndUpdate(ContextVk *contextVk,
     // If the subData size was less than the buffer's size we additionally enqueue
     // a GPU copy of the remaining regions from the old mBuffer to the new one.
     vk::BufferHelper *src          = mBuffer;
+    VkDeviceSize srcOffset         = mBufferOffset;
     size_t bufferSize              = static_cast<size_t>(mState.getSize());
     size_t offsetAfterSubdata      = (offset + updateSize);
     bool updateRegionBeforeSubData = (offset > 0);
@@ -826,7 +884,10 @@ angle::Result BufferVk::acquireAndUpdate(ContextVk *contextVk,
         src->retain(&contextVk->getResourceUseList());
     }
 
-    ANGLE_TRY(acquireBufferHelper(contextVk, bufferSize));
+    // A previous suballocation is released as soon as it's replaced, so keep it around until the
+    // copies from it are recorded.
+    std::unique_ptr<vk::BufferHelper> previousSuballocation;
+    ANGLE_TRY(acquireBufferHelper(contextVk, bufferSize, &previousSuballocation));
     ANGLE_TRY(updateBuffer(contextVk, data, updateSize, offset));
 
     constexpr int kMaxCopyRegions = 2;
@@ -834,11 +895,11 @@ angle::Result BufferVk::acquireAndUpdate(ContextVk *contextVk,
 
     if (updateRegionBeforeSubData)
     {
-        copyRegions.push_back({0, mBufferOffset, offset});
+        copyRegions.push_back({srcOffset, mBufferOffset, offset});
     }
     if (updateRegionAfterSubData)
     {
-        copyRegions.push_back({offsetAfterSubdata, mBufferOffset + offsetAfterSubdata,
+        copyRegions.push_back({srcOffset + offsetAfterSubdata, mBufferOffset + offsetAfterSubdata,
                                (bufferSize - offsetAfterSubdata)});
     }
 
@@ -848,6 +909,11 @@ angle::Result BufferVk::acquireAndUpdate(ContextVk *contextVk,
                                           copyRegions.data()));
     }
 
+    if (previousSuballocation)
+    {
+        previousSuballocation->release(contextVk->getRenderer());
+    }
+
     return angle::Result::Continue;
 }
 
@@ -856,6 +922,9 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
                                     size_t size,
                                     size_t offset)
 {
+    // The pixels of earlier ReadPixels must not overwrite the new data.
+    ANGLE_TRY(resolvePendingReadPixels());
+
     // Update shadow buffer
     updateShadowBuffer(data, size, offset);
 
@@ -918,7 +987,29 @@ void BufferVk::onDataChanged()
     markConversionBuffersDirty();
 }
 
-angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk, size_t sizeInBytes)
+bool BufferVk::canDeferReadPixelsPacking(const ContextVk *contextVk)
+{
+    // The pixels are written straight to the buffer memory, which then needs to be the only copy
+    // of the data.  A persistently mapped buffer may be read without being accessed through GL.
+    return isBufferValid() && mBuffer->isHostVisible() && !mBuffer->isExternalBuffer() &&
+           !mShadowBuffer.valid() && !mState.isMapped() &&
+           (mPendingReadPixelsContext == nullptr || mPendingReadPixelsContext == contextVk);
+}
+
+angle::Result BufferVk::resolvePendingReadPixels()
+{
+    if (mPendingReadPixelsContext == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    return mPendingReadPixelsContext->resolvePendingReadPixels(this);
+}
+
+angle::Result BufferVk::acquireBufferHelper(
+    ContextVk *contextVk,
+    size_t sizeInBytes,
+    std::unique_ptr<vk::BufferHelper> *previousSuballocationOut)
 {
     // This method should not be called if it is an ExternalBuffer
     ASSERT(mBuffer == nullptr || mBuffer->isExternalBuffer() == false);
@@ -926,6 +1017,29 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk, size_t sizeInB
     bool needToReleasePreviousBuffers = false;
     size_t size                       = roundUpPow2(sizeInBytes, kBufferSizeGranularity);
 
+    if (mSuballocate)
+    {
+        RendererVk *renderer = contextVk->getRenderer();
+
+        std::unique_ptr<vk::BufferHelper> suballocation = std::make_unique<vk::BufferHelper>();
+        ANGLE_TRY(renderer->allocateBufferSuballocation(contextVk, mSuballocationDesc, size,
+                                                        suballocation.get()));
+
+        std::swap(mSuballocation, suballocation);
+        if (suballocation && previousSuballocationOut != nullptr)
+        {
+            *previousSuballocationOut = std::move(suballocation);
+        }
+        else if (suballocation)
+        {
+            suballocation->release(renderer);
+        }
+
+        mBuffer       = mSuballocation.get();
+        mBufferOffset = mSuballocation->getSuballocationOffset();
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(mBufferPool.allocate(contextVk, size, nullptr, nullptr, &mBufferOffset,
                                    &needToReleasePreviousBuffers));
 
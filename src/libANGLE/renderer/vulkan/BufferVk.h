@@ -93,6 +93,11 @@ class BufferVk : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 const std::vector<gl::IndexSpan> &spans,
+                                 bool primitiveRestartEnabled,
+                                 std::vector<gl::IndexRange> *outRanges) override;
 
     GLint64 getSize() const { return mState.getSize(); }
 
@@ -128,6 +133,12 @@ class BufferVk : public BufferImpl
                                                 size_t offset,
                                                 bool hostVisible);
 
+    // ReadPixels into this buffer whose pixels are packed on the CPU only when the buffer is next
+    // accessed.  See ContextVk::deferReadPixelsPacking.
+    bool canDeferReadPixelsPacking(const ContextVk *contextVk);
+    void onReadPixelsDeferred(ContextVk *contextVk) { mPendingReadPixelsContext = contextVk; }
+    void onPendingReadPixelsResolved() { mPendingReadPixelsContext = nullptr; }
+
   private:
     angle::Result initializeShadowBuffer(ContextVk *contextVk,
                                          gl::BufferBinding target,
@@ -181,8 +192,15 @@ class BufferVk : public BufferImpl
                               size_t offset);
     void release(ContextVk *context);
     void markConversionBuffersDirty();
+    angle::Result resolvePendingReadPixels();
 
-    angle::Result acquireBufferHelper(ContextVk *contextVk, size_t sizeInBytes);
+    // If |previousSuballocationOut| is given and the buffer is suballocated, the previous
+    // suballocation is returned through it instead of being released, so the caller can still copy
+    // from it.
+    angle::Result acquireBufferHelper(
+        ContextVk *contextVk,
+        size_t sizeInBytes,
+        std::unique_ptr<vk::BufferHelper> *previousSuballocationOut = nullptr);
 
     struct VertexConversionBuffer : public ConversionBuffer
     {
@@ -207,6 +225,12 @@ class BufferVk : public BufferImpl
     // Pool of BufferHelpers for mBuffer to acquire from
     vk::DynamicBuffer mBufferPool;
 
+    // Small buffers are instead suballocated from slabs shared with other buffers, see
+    // vk::BufferSuballocator.  In that case, mBuffer points to mSuballocation.
+    bool mSuballocate;
+    vk::BufferSuballocationDesc mSuballocationDesc;
+    std::unique_ptr<vk::BufferHelper> mSuballocation;
+
     // DynamicBuffer to aid map operations of buffers when they are not host visible.
     vk::DynamicBuffer mHostVisibleBufferPool;
     VkDeviceSize mHostVisibleBufferOffset;
@@ -220,6 +244,9 @@ class BufferVk : public BufferImpl
 
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
+
+    // The context that holds the deferred ReadPixels into this buffer, if any.
+    ContextVk *mPendingReadPixelsContext;
 };
 
 }  // namespace rx
@@ -8,6 +8,8 @@
 //
 
 #include "libANGLE/renderer/vulkan/CommandProcessor.h"
+
+#include "common/Spinlock.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/trace.h"
 
@@ -19,6 +21,70 @@ namespace
 {
 constexpr size_t kInFlightCommandsLimit = 100u;
 constexpr bool kOutputVmaStatsString    = false;
+// How many times the command processor thread checks for new tasks before going to sleep.  Set to
+// zero to have it go to sleep right away.
+constexpr uint32_t kWorkerSpinCount = 1024;
+// Command buffers are only recorded in parallel if every chunk gets at least this many bytes of
+// commands, which is several hundred draw calls with their state changes.  Smaller chunks don't
+// make up for the cost of the secondary command buffers.
+constexpr size_t kMinParallelChunkSize = 32 * 1024;
+constexpr size_t kMaxParallelChunkCount = 8;
+
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+VkResult RecordChunk(const CommandBuffer &commands,
+                     const priv::CommandChunk &chunk,
+                     const VkCommandBufferInheritanceInfo &inheritanceInfo,
+                     priv::CommandBuffer *commandBuffer)
+{
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    beginInfo.pInheritanceInfo         = &inheritanceInfo;
+    if (inheritanceInfo.renderPass != VK_NULL_HANDLE)
+    {
+        beginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
+
+    VkResult result = commandBuffer->begin(beginInfo);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    commands.executeChunk(commandBuffer->getHandle(), chunk);
+    return commandBuffer->end();
+}
+
+class RecordChunkTask final : public angle::Closure
+{
+  public:
+    RecordChunkTask(const CommandBuffer &commands,
+                    const priv::CommandChunk &chunk,
+                    const VkCommandBufferInheritanceInfo &inheritanceInfo,
+                    priv::CommandBuffer *commandBuffer)
+        : mCommands(commands),
+          mChunk(chunk),
+          mInheritanceInfo(inheritanceInfo),
+          mCommandBuffer(commandBuffer),
+          mResult(VK_NOT_READY)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "RecordChunkTask");
+        mResult = RecordChunk(mCommands, mChunk, mInheritanceInfo, mCommandBuffer);
+    }
+
+    VkResult getResult() const { return mResult; }
+
+  private:
+    const CommandBuffer &mCommands;
+    const priv::CommandChunk &mChunk;
+    VkCommandBufferInheritanceInfo mInheritanceInfo;
+    priv::CommandBuffer *mCommandBuffer;
+    VkResult mResult;
+};
+#endif  // ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
 
 void InitializeSubmitInfo(VkSubmitInfo *submitInfo,
                           const vk::PrimaryCommandBuffer &commandBuffer,
@@ -265,6 +331,30 @@ CommandProcessorTask &CommandProcessorTask::operator=(CommandProcessorTask &&rhs
     return *this;
 }
 
+// ChunkCommandPool implementation.
+ChunkCommandPool::ChunkCommandPool() = default;
+
+ChunkCommandPool::~ChunkCommandPool() = default;
+
+ChunkCommandPool::ChunkCommandPool(ChunkCommandPool &&other)
+{
+    *this = std::move(other);
+}
+
+ChunkCommandPool &ChunkCommandPool::operator=(ChunkCommandPool &&other)
+{
+    std::swap(commandPool, other.commandPool);
+    std::swap(commandBuffer, other.commandBuffer);
+    return *this;
+}
+
+void ChunkCommandPool::destroy(VkDevice device)
+{
+    // The command buffer is freed with its pool.
+    commandBuffer.destroy(device);
+    commandPool.destroy(device);
+}
+
 // CommandBatch implementation.
 CommandBatch::CommandBatch() = default;
 
@@ -279,6 +369,7 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
 {
     std::swap(primaryCommands, other.primaryCommands);
     std::swap(commandPool, other.commandPool);
+    std::swap(chunkCommandPools, other.chunkCommandPools);
     std::swap(fence, other.fence);
     std::swap(serial, other.serial);
     std::swap(hasProtectedContent, other.hasProtectedContent);
@@ -289,10 +380,166 @@ void CommandBatch::destroy(VkDevice device)
 {
     primaryCommands.destroy(device);
     commandPool.destroy(device);
+    for (ChunkCommandPool &chunkCommandPool : chunkCommandPools)
+    {
+        chunkCommandPool.destroy(device);
+    }
+    chunkCommandPools.clear();
     fence.reset(device);
     hasProtectedContent = false;
 }
 
+// ParallelCommandRecorder implementation.
+ParallelCommandRecorder::ParallelCommandRecorder() : mQueueFamilyIndex(0) {}
+
+ParallelCommandRecorder::~ParallelCommandRecorder()
+{
+    ASSERT(mUsedCommandPools.empty() && mFreeCommandPools.empty());
+}
+
+void ParallelCommandRecorder::init(const std::shared_ptr<angle::WorkerThreadPool> &threadPool,
+                                   uint32_t queueFamilyIndex)
+{
+    mThreadPool       = threadPool;
+    mQueueFamilyIndex = queueFamilyIndex;
+}
+
+void ParallelCommandRecorder::destroy(VkDevice device)
+{
+    for (ChunkCommandPool &chunkCommandPool : mUsedCommandPools)
+    {
+        chunkCommandPool.destroy(device);
+    }
+    for (ChunkCommandPool &chunkCommandPool : mFreeCommandPools)
+    {
+        chunkCommandPool.destroy(device);
+    }
+    mUsedCommandPools.clear();
+    mFreeCommandPools.clear();
+    mThreadPool.reset();
+}
+
+bool ParallelCommandRecorder::splitIntoChunks(const CommandBuffer &commands)
+{
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+    const size_t chunkCount =
+        std::min(kMaxParallelChunkCount, commands.getCommandSize() / kMinParallelChunkSize);
+    return chunkCount > 1 && commands.splitIntoChunks(chunkCount, &mChunks);
+#else
+    return false;
+#endif  // ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+}
+
+angle::Result ParallelCommandRecorder::recordChunks(Context *context,
+                                                    const CommandBuffer &commands,
+                                                    const RenderPass *renderPass,
+                                                    VkFramebuffer framebuffer,
+                                                    PrimaryCommandBuffer *primary)
+{
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+    ANGLE_TRACE_EVENT0("gpu.angle", "ParallelCommandRecorder::recordChunks");
+    ASSERT(mChunks.size() > 1);
+
+    const size_t firstCommandPool = mUsedCommandPools.size();
+    for (size_t chunkIndex = 0; chunkIndex < mChunks.size(); ++chunkIndex)
+    {
+        ANGLE_TRY(allocateCommandPool(context));
+    }
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    inheritanceInfo.sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass  = renderPass != nullptr ? renderPass->getHandle() : VK_NULL_HANDLE;
+    inheritanceInfo.subpass     = 0;
+    inheritanceInfo.framebuffer = framebuffer;
+
+    // The first chunk is recorded by this thread, while the thread pool records the others.
+    std::vector<std::shared_ptr<RecordChunkTask>> tasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitableEvents;
+    for (size_t chunkIndex = 1; chunkIndex < mChunks.size(); ++chunkIndex)
+    {
+        tasks.push_back(std::make_shared<RecordChunkTask>(
+            commands, mChunks[chunkIndex], inheritanceInfo,
+            &mUsedCommandPools[firstCommandPool + chunkIndex].commandBuffer));
+        waitableEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(
+            mThreadPool, tasks.back(), angle::TaskPriority::High));
+    }
+
+    VkResult result = RecordChunk(commands, mChunks[0], inheritanceInfo,
+                                  &mUsedCommandPools[firstCommandPool].commandBuffer);
+
+    std::vector<VkCommandBuffer> commandBuffers(mChunks.size());
+    for (size_t chunkIndex = 0; chunkIndex < mChunks.size(); ++chunkIndex)
+    {
+        if (chunkIndex > 0)
+        {
+            waitableEvents[chunkIndex - 1]->wait();
+            if (result == VK_SUCCESS)
+            {
+                result = tasks[chunkIndex - 1]->getResult();
+            }
+        }
+        commandBuffers[chunkIndex] =
+            mUsedCommandPools[firstCommandPool + chunkIndex].commandBuffer.getHandle();
+    }
+    ANGLE_VK_TRY(context, result);
+
+    vkCmdExecuteCommands(primary->getHandle(), static_cast<uint32_t>(commandBuffers.size()),
+                         commandBuffers.data());
+    return angle::Result::Continue;
+#else
+    UNREACHABLE();
+    return angle::Result::Stop;
+#endif  // ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+}
+
+void ParallelCommandRecorder::releaseToCommandBatch(CommandBatch *batch)
+{
+    ASSERT(batch->chunkCommandPools.empty());
+    std::swap(batch->chunkCommandPools, mUsedCommandPools);
+}
+
+angle::Result ParallelCommandRecorder::recycleCommandPools(Context *context, CommandBatch *batch)
+{
+    VkDevice device = context->getDevice();
+    while (!batch->chunkCommandPools.empty())
+    {
+        ChunkCommandPool &chunkCommandPool = batch->chunkCommandPools.back();
+        ANGLE_VK_TRY(context, chunkCommandPool.commandPool.reset(device, 0));
+        mFreeCommandPools.push_back(std::move(chunkCommandPool));
+        batch->chunkCommandPools.pop_back();
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result ParallelCommandRecorder::allocateCommandPool(Context *context)
+{
+    if (!mFreeCommandPools.empty())
+    {
+        mUsedCommandPools.push_back(std::move(mFreeCommandPools.back()));
+        mFreeCommandPools.pop_back();
+        return angle::Result::Continue;
+    }
+
+    VkDevice device = context->getDevice();
+    mUsedCommandPools.emplace_back();
+    ChunkCommandPool &chunkCommandPool = mUsedCommandPools.back();
+
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex        = mQueueFamilyIndex;
+    ANGLE_VK_TRY(context, chunkCommandPool.commandPool.init(device, poolInfo));
+
+    VkCommandBufferAllocateInfo allocateInfo = {};
+    allocateInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocateInfo.commandPool                 = chunkCommandPool.commandPool.getHandle();
+    allocateInfo.level                       = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+    allocateInfo.commandBufferCount          = 1;
+    ANGLE_VK_TRY(context, chunkCommandPool.commandBuffer.init(device, allocateInfo));
+
+    return angle::Result::Continue;
+}
+
 // CommandProcessor implementation.
 void CommandProcessor::handleError(VkResult errorCode,
                                    const char *file,
@@ -317,7 +564,7 @@ void CommandProcessor::handleError(VkResult errorCode,
 }
 
 CommandProcessor::CommandProcessor(RendererVk *renderer)
-    : Context(renderer), mWorkerThreadIdle(false)
+    : Context(renderer), mWorkerSleeping(false), mWorkerThreadIdle(false)
 {
     std::lock_guard<std::mutex> queueLock(mErrorMutex);
     while (!mErrors.empty())
@@ -347,12 +594,22 @@ angle::Result CommandProcessor::checkAndPopPendingError(Context *errorHandlingCo
 void CommandProcessor::queueCommand(CommandProcessorTask &&task)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandProcessor::queueCommand");
-    // Grab the worker mutex so that we put things on the queue in the same order as we give out
-    // serials.
-    std::lock_guard<std::mutex> queueLock(mWorkerMutex);
+    // The queue keeps the tasks in the order they are pushed in, so they are processed in the same
+    // order as we give out serials.
+    while (!mTasks.tryPush(std::move(task)))
+    {
+        // The queue is full, which means the worker thread is busy emptying it.
+        std::this_thread::yield();
+    }
 
-    mTasks.emplace(std::move(task));
-    mWorkAvailableCondition.notify_one();
+    // Pairs with the fence in waitForTasks(): either the worker thread sees the new task before
+    // going to sleep, or this thread sees that it's sleeping and wakes it up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mWorkerSleeping.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(mWorkerMutex);
+        mWorkAvailableCondition.notify_one();
+    }
 }
 
 void CommandProcessor::processTasks()
@@ -381,25 +638,21 @@ angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
 {
     while (true)
     {
-        std::unique_lock<std::mutex> lock(mWorkerMutex);
-        if (mTasks.empty())
+        // All the queued tasks are processed before going to sleep, so the worker thread is only
+        // woken up once per batch of submissions.
+        CommandProcessorTask task;
+        if (!mTasks.tryPop(&task))
         {
-            mWorkerThreadIdle = true;
-            mWorkerIdleCondition.notify_all();
-            // Only wake if notified and command queue is not empty
-            mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
+            waitForTasks();
+            continue;
         }
-        mWorkerThreadIdle = false;
-        CommandProcessorTask task(std::move(mTasks.front()));
-        mTasks.pop();
-        lock.unlock();
 
         ANGLE_TRY(processTask(&task));
         if (task.getTaskCommand() == CustomTask::Exit)
         {
 
             *exitThread = true;
-            lock.lock();
+            std::lock_guard<std::mutex> lock(mWorkerMutex);
             mWorkerThreadIdle = true;
             mWorkerIdleCondition.notify_one();
             return angle::Result::Continue;
@@ -410,6 +663,35 @@ angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
     return angle::Result::Stop;
 }
 
+void CommandProcessor::waitForTasks()
+{
+    // With a steady stream of submissions, the next task usually arrives shortly.  Spinning a
+    // little first avoids the cost of sleeping and being woken up for it.  A non-empty queue may
+    // still have its front task being written, in which case the caller simply tries again.
+    for (uint32_t spin = 0; spin < kWorkerSpinCount; ++spin)
+    {
+        if (!mTasks.empty())
+        {
+            return;
+        }
+        ANGLE_SMT_PAUSE();
+    }
+
+    std::unique_lock<std::mutex> lock(mWorkerMutex);
+    mWorkerSleeping.store(true, std::memory_order_relaxed);
+    // Pairs with the fence in queueCommand().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mTasks.empty())
+    {
+        mWorkerThreadIdle = true;
+        mWorkerIdleCondition.notify_all();
+        // Only wake if notified and command queue is not empty
+        mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
+    }
+    mWorkerSleeping.store(false, std::memory_order_relaxed);
+    mWorkerThreadIdle = false;
+}
+
 angle::Result CommandProcessor::processTask(CommandProcessorTask *task)
 {
     switch (task->getTaskCommand())
@@ -773,6 +1055,8 @@ void CommandQueue::destroy(Context *context)
         mProtectedCommandPool.destroy(renderer->getDevice());
     }
 
+    mParallelRecorder.destroy(renderer->getDevice());
+
     mFenceRecycler.destroy(context);
 
     ASSERT(mInFlightCommands.empty() && mGarbageQueue.empty());
@@ -789,6 +1073,9 @@ angle::Result CommandQueue::init(Context *context, const vk::DeviceQueueMap &que
         ANGLE_TRY(mProtectedCommandPool.init(context, true, queueMap.getIndex()));
     }
 
+    mParallelRecorder.init(context->getRenderer()->getCommandRecordingThreadPool(),
+                           queueMap.getIndex());
+
     return angle::Result::Continue;
 }
 
@@ -834,6 +1121,7 @@ angle::Result CommandQueue::retireFinishedCommands(Context *context, size_t fini
         mFenceRecycler.resetSharedFence(&batch.fence);
         ANGLE_TRACE_EVENT0("gpu.angle", "command buffer recycling");
         batch.commandPool.destroy(device);
+        ANGLE_TRY(mParallelRecorder.recycleCommandPools(context, &batch));
         PersistentCommandPool &commandPool = getCommandPool(batch.hasProtectedContent);
         ANGLE_TRY(commandPool.collect(context, std::move(batch.primaryCommands)));
     }
@@ -883,6 +1171,12 @@ angle::Result CommandQueue::releaseToCommandBatch(Context *context,
 
     batch->primaryCommands = std::move(commandBuffer);
 
+    // The chunks recorded in parallel are only ever executed in the unprotected command buffer.
+    if (!hasProtectedContent)
+    {
+        mParallelRecorder.releaseToCommandBatch(batch);
+    }
+
     if (commandPool->valid())
     {
         batch->commandPool = std::move(*commandPool);
@@ -932,6 +1226,11 @@ void CommandQueue::handleDeviceLost(RendererVk *renderer)
         batch.primaryCommands.destroy(device);
 
         batch.commandPool.destroy(device);
+        for (ChunkCommandPool &chunkCommandPool : batch.chunkCommandPools)
+        {
+            chunkCommandPool.destroy(device);
+        }
+        batch.chunkCommandPools.clear();
         batch.fence.reset(device);
     }
     mInFlightCommands.clear();
@@ -1140,7 +1439,8 @@ angle::Result CommandQueue::flushOutsideRPCommands(Context *context,
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context, hasProtectedContent));
     PrimaryCommandBuffer &commandBuffer = getCommandBuffer(hasProtectedContent);
     return (*outsideRPCommands)
-        ->flushToPrimary(context->getRenderer()->getFeatures(), &commandBuffer, nullptr);
+        ->flushToPrimary(context, &commandBuffer, nullptr,
+                         getParallelRecorder(hasProtectedContent));
 }
 
 angle::Result CommandQueue::flushRenderPassCommands(Context *context,
@@ -1151,7 +1451,8 @@ angle::Result CommandQueue::flushRenderPassCommands(Context *context,
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context, hasProtectedContent));
     PrimaryCommandBuffer &commandBuffer = getCommandBuffer(hasProtectedContent);
     return (*renderPassCommands)
-        ->flushToPrimary(context->getRenderer()->getFeatures(), &commandBuffer, &renderPass);
+        ->flushToPrimary(context, &commandBuffer, &renderPass,
+                         getParallelRecorder(hasProtectedContent));
 }
 
 angle::Result CommandQueue::queueSubmitOneOff(Context *context,
@@ -11,12 +11,15 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_COMMAND_PROCESSOR_H_
 #define LIBANGLE_RENDERER_VULKAN_COMMAND_PROCESSOR_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <thread>
 
+#include "common/MPSCQueue.h"
 #include "common/vulkan/vk_headers.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/PersistentCommandPool.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
@@ -167,6 +170,22 @@ class CommandProcessorTask
     bool mHasProtectedContent;
 };
 
+// A command pool with the one secondary command buffer allocated from it, used to record a chunk
+// of commands on a worker thread.  Command pools can't be used by several threads at once, so
+// every chunk recorded in parallel needs a pool of its own.
+struct ChunkCommandPool final : angle::NonCopyable
+{
+    ChunkCommandPool();
+    ~ChunkCommandPool();
+    ChunkCommandPool(ChunkCommandPool &&other);
+    ChunkCommandPool &operator=(ChunkCommandPool &&other);
+
+    void destroy(VkDevice device);
+
+    CommandPool commandPool;
+    priv::CommandBuffer commandBuffer;
+};
+
 struct CommandBatch final : angle::NonCopyable
 {
     CommandBatch();
@@ -179,11 +198,59 @@ struct CommandBatch final : angle::NonCopyable
     PrimaryCommandBuffer primaryCommands;
     // commandPool is for secondary CommandBuffer allocation
     CommandPool commandPool;
+    // Pools of the chunks of commands recorded in parallel, see ParallelCommandRecorder.
+    std::vector<ChunkCommandPool> chunkCommandPools;
     Shared<Fence> fence;
     Serial serial;
     bool hasProtectedContent;
 };
 
+// Executes large command buffers by splitting them in chunks, which are recorded into secondary
+// command buffers concurrently in a thread pool, and then executed in the primary command buffer.
+// The chunk command pools are handed over to the CommandBatch of the primary command buffer, and
+// reused once it has finished.
+class ParallelCommandRecorder final : angle::NonCopyable
+{
+  public:
+    ParallelCommandRecorder();
+    ~ParallelCommandRecorder();
+
+    void init(const std::shared_ptr<angle::WorkerThreadPool> &threadPool,
+              uint32_t queueFamilyIndex);
+    void destroy(VkDevice device);
+
+    // Only valid with the parallelCommandBufferRecording feature.
+    bool valid() const { return mThreadPool != nullptr; }
+
+    // Splits |commands| in chunks if they are large enough to be worth recording in parallel.
+    // Returns false if they should be executed inline instead.
+    bool splitIntoChunks(const CommandBuffer &commands);
+
+    // Records the chunks |commands| was just split in, and executes them in |primary|.
+    // |renderPass| and |framebuffer| are those of the render pass the commands are in, if any,
+    // which must have been begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+    angle::Result recordChunks(Context *context,
+                               const CommandBuffer &commands,
+                               const RenderPass *renderPass,
+                               VkFramebuffer framebuffer,
+                               PrimaryCommandBuffer *primary);
+
+    // Hands the command pools used since the last submission over to the batch submitting them.
+    void releaseToCommandBatch(CommandBatch *batch);
+    // Takes back the command pools of a finished batch.
+    angle::Result recycleCommandPools(Context *context, CommandBatch *batch);
+
+  private:
+    angle::Result allocateCommandPool(Context *context);
+
+    std::shared_ptr<angle::WorkerThreadPool> mThreadPool;
+    uint32_t mQueueFamilyIndex;
+
+    std::vector<priv::CommandChunk> mChunks;
+    std::vector<ChunkCommandPool> mUsedCommandPools;
+    std::vector<ChunkCommandPool> mFreeCommandPools;
+};
+
 class DeviceQueueMap;
 
 class QueueFamily final : angle::NonCopyable
@@ -398,6 +465,12 @@ class CommandQueue final : public CommandQueueInterface
         }
     }
 
+    // Protected command buffers are always executed inline.
+    ParallelCommandRecorder *getParallelRecorder(bool hasProtectedContent)
+    {
+        return mParallelRecorder.valid() && !hasProtectedContent ? &mParallelRecorder : nullptr;
+    }
+
     PersistentCommandPool &getCommandPool(bool hasProtectedContent)
     {
         if (hasProtectedContent)
@@ -420,6 +493,8 @@ class CommandQueue final : public CommandQueueInterface
     PrimaryCommandBuffer mProtectedCommands;
     PersistentCommandPool mProtectedCommandPool;
 
+    ParallelCommandRecorder mParallelRecorder;
+
     // Queue serial management.
     AtomicSerialFactory mQueueSerialFactory;
     Serial mLastCompletedQueueSerial;
@@ -528,6 +603,9 @@ class CommandProcessor : public Context, public CommandQueueInterface
     // Command processor thread, called by processTasks. The loop waits for work to
     // be submitted from a separate thread.
     angle::Result processTasksImpl(bool *exitThread);
+    // Command processor thread, called when the queue is empty.  Spins for a little while, then
+    // sleeps until a task is queued.
+    void waitForTasks();
 
     // Command processor thread, process a task
     angle::Result processTask(CommandProcessorTask *task);
@@ -535,10 +613,17 @@ class CommandProcessor : public Context, public CommandQueueInterface
     VkResult getLastAndClearPresentResult(VkSwapchainKHR swapchain);
     VkResult present(egl::ContextPriority priority, const VkPresentInfoKHR &presentInfo);
 
-    std::queue<CommandProcessorTask> mTasks;
+    // Tasks are queued without locking, as every context thread submits through it.  The mutex and
+    // condition variables are only used for the worker thread to sleep and for other threads to
+    // wait for it to be idle.
+    static constexpr size_t kMaxQueuedTasks = 128;
+    angle::MPSCQueue<CommandProcessorTask, kMaxQueuedTasks> mTasks;
     mutable std::mutex mWorkerMutex;
-    // Signal worker thread when work is available
+    // Signal worker thread when work is available.  Only done when mWorkerSleeping is set, so a
+    // worker thread that keeps up with the submissions doesn't cost the submitting threads a
+    // notification each.
     std::condition_variable mWorkAvailableCondition;
+    std::atomic<bool> mWorkerSleeping;
     // Signal main thread when all work completed
     mutable std::condition_variable mWorkerIdleCondition;
     // Track worker thread Idle state for assertion purposes
@@ -407,6 +407,13 @@ void ContextVk::DriverUniformsDescriptorSet::destroy(RendererVk *renderer)
     descriptorSetCache.destroy(renderer);
 }
 
+// PendingReadPixels implementation.
+PendingReadPixels::PendingReadPixels()
+    : packBuffer(nullptr), sequence(0), readFormat(nullptr), packBufferOffset(0), inputPitch(0)
+{}
+
+PendingReadPixels::~PendingReadPixels() = default;
+
 // ContextVk implementation.
 ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk *renderer)
     : ContextImpl(state, errorSet),
@@ -451,7 +458,9 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mContextPerfCounters{},
       mCumulativeContextPerfCounters{},
       mContextPriority(renderer->getDriverPriority(GetContextPriority(state))),
-      mShareGroupVk(vk::GetImpl(state.getShareGroup()))
+      mShareGroupVk(vk::GetImpl(state.getShareGroup())),
+      mPendingReadPixelsSequence(0),
+      mPendingReadPixelsCount(0)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::ContextVk");
     memset(&mClearColorValue, 0, sizeof(mClearColorValue));
@@ -597,6 +606,15 @@ void ContextVk::onDestroy(const gl::Context *context)
     // This will not destroy any resources. It will release them to be collected after finish.
     mIncompleteTextures.onDestroy(context);
 
+    // Pack the pixels of the deferred readbacks, the pack buffers may outlive this context.
+    for (PendingReadPixels &pending : mPendingReadPixels)
+    {
+        if (pending.packBuffer != nullptr)
+        {
+            (void)resolvePendingReadPixels(pending.packBuffer);
+        }
+    }
+
     // Flush and complete current outstanding work before destruction.
     (void)finishImpl();
 
@@ -615,6 +633,16 @@ void ContextVk::onDestroy(const gl::Context *context)
     mDefaultUniformStorage.release(mRenderer);
     mEmptyBuffer.release(mRenderer);
     mStagingBuffer.release(mRenderer);
+    mStreamingBuffer.release(mRenderer);
+
+    for (PendingReadPixels &pending : mPendingReadPixels)
+    {
+        if (pending.packBuffer != nullptr)
+        {
+            dropPendingReadPixels(pending.packBuffer);
+        }
+        pending.readbackBuffer.release(mRenderer);
+    }
 
     for (vk::DynamicBuffer &defaultBuffer : mDefaultAttribBuffers)
     {
@@ -801,6 +829,11 @@ angle::Result ContextVk::initialize()
     mStagingBuffer.init(mRenderer, kStagingBufferUsageFlags, stagingBufferAlignment,
                         kStagingBufferSize, true, vk::DynamicBufferPolicy::SporadicTextureUpload);
 
+    constexpr size_t kStreamingBufferInitialSize = 1024u * 1024u;  // 1M
+    mStreamingBuffer.init(vk::kVertexBufferUsageFlags | vk::kIndexBufferUsageFlags,
+                          std::max(vk::kVertexBufferAlignment, vk::kIndexBufferAlignment),
+                          kStreamingBufferInitialSize);
+
     // Add context into the share group
     mShareGroupVk->getContexts()->insert(this);
 
@@ -1380,9 +1413,9 @@ angle::Result ContextVk::handleDirtyGraphicsDefaultAttribs(DirtyBits::Iterator *
 angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *dirtyBitsIterator,
                                                          DirtyBits dirtyBitMask)
 {
-    const VkPipeline previousPipeline = mCurrentGraphicsPipeline
-                                            ? mCurrentGraphicsPipeline->getPipeline().getHandle()
-                                            : VK_NULL_HANDLE;
+    // The pipelines are compared rather than their handles, as a pipeline may still be being
+    // created.
+    const vk::PipelineHelper *previousPipeline = mCurrentGraphicsPipeline;
 
     ASSERT(mExecutable);
 
@@ -1428,11 +1461,9 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
     // the actual serial used when this work is submitted.
     mCurrentGraphicsPipeline->updateSerial(getCurrentQueueSerial());
 
-    const VkPipeline newPipeline = mCurrentGraphicsPipeline->getPipeline().getHandle();
-
     // If there's no change in pipeline, avoid rebinding it later.  If the rebind is due to a new
     // command buffer or UtilsVk, it will happen anyway with DIRTY_BIT_PIPELINE_BINDING.
-    if (newPipeline == previousPipeline)
+    if (mCurrentGraphicsPipeline == previousPipeline)
     {
         return angle::Result::Continue;
     }
@@ -1486,6 +1517,19 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineBinding(DirtyBits::Iterator
 {
     ASSERT(mCurrentGraphicsPipeline);
 
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+    // Don't wait for a pipeline that is still being created.  The bind is patched once the
+    // pipeline is ready, before the render pass is submitted.
+    if (mCurrentGraphicsPipeline->isCreationPending())
+    {
+        VkPipeline *pipelineHandle = mRenderPassCommandBuffer->bindGraphicsPipelineDeferred();
+        mDeferredGraphicsPipelineBinds.push_back(
+            {mCurrentGraphicsPipeline->getCreationTask(), pipelineHandle});
+        return angle::Result::Continue;
+    }
+#endif
+
+    ANGLE_VK_TRY(this, mCurrentGraphicsPipeline->finishCreation());
     mRenderPassCommandBuffer->bindGraphicsPipeline(mCurrentGraphicsPipeline->getPipeline());
 
     return angle::Result::Continue;
@@ -1722,8 +1766,8 @@ angle::Result ContextVk::handleDirtyGraphicsIndexBuffer(DirtyBits::Iterator *dir
     VkDeviceSize offset =
         mVertexArray->getCurrentElementArrayBufferOffset() + mCurrentIndexBufferOffset;
 
-    mRenderPassCommandBuffer->bindIndexBuffer(elementArrayBuffer->getBuffer(), offset,
-                                              getVkIndexType(mCurrentDrawElementsType));
+    mRenderPassCommandBuffer->bindIndexBuffer(mVertexArray->getCurrentElementArrayBufferHandle(),
+                                              offset, getVkIndexType(mCurrentDrawElementsType));
 
     mRenderPassCommands->bufferRead(this, VK_ACCESS_INDEX_READ_BIT, vk::PipelineStage::VertexInput,
                                     elementArrayBuffer);
@@ -2046,6 +2090,11 @@ void ContextVk::syncObjectPerfCounters()
     mPerfCounters.descriptorSetAllocations              = 0;
     mPerfCounters.shaderBuffersDescriptorSetCacheHits   = 0;
     mPerfCounters.shaderBuffersDescriptorSetCacheMisses = 0;
+    mPerfCounters.textureDescriptorSetCacheHits         = 0;
+    mPerfCounters.textureDescriptorSetCacheMisses       = 0;
+    mPerfCounters.descriptorSetRecycles                 = 0;
+    mPerfCounters.descriptorPools                       = 0;
+    mPerfCounters.cachedDescriptorSets                  = 0;
 
     // ContextVk's descriptor set allocations
     ContextVkPerfCounters contextCounters = getAndResetObjectPerfCounters();
@@ -2081,7 +2130,38 @@ void ContextVk::syncObjectPerfCounters()
             progPerfCounters.descriptorSetCacheHits[DescriptorSetIndex::ShaderResource];
         mPerfCounters.shaderBuffersDescriptorSetCacheMisses +=
             progPerfCounters.descriptorSetCacheMisses[DescriptorSetIndex::ShaderResource];
+        mPerfCounters.textureDescriptorSetCacheHits +=
+            progPerfCounters.descriptorSetCacheHits[DescriptorSetIndex::Texture];
+        mPerfCounters.textureDescriptorSetCacheMisses +=
+            progPerfCounters.descriptorSetCacheMisses[DescriptorSetIndex::Texture];
+
+        for (DescriptorSetIndex descriptorSetIndex : angle::AllEnums<DescriptorSetIndex>())
+        {
+            mPerfCounters.descriptorSetRecycles +=
+                progPerfCounters.descriptorSetRecycles[descriptorSetIndex];
+            mPerfCounters.descriptorPools += progPerfCounters.descriptorPools[descriptorSetIndex];
+            mPerfCounters.cachedDescriptorSets +=
+                progPerfCounters.cachedDescriptorSets[descriptorSetIndex];
+        }
     }
+
+    // The buffer suballocator is shared by all contexts.
+    const vk::BufferSuballocatorStats suballocatorStats = mRenderer->getBufferSuballocatorStats();
+    mPerfCounters.suballocatedBuffers                   = suballocatorStats.liveBlocks;
+    mPerfCounters.bufferSlabs                           = suballocatorStats.slabs;
+    mPerfCounters.bufferSlabFragmentation               = 0;
+    if (suballocatorStats.slabBytes > 0)
+    {
+        mPerfCounters.bufferSlabFragmentation = static_cast<uint32_t>(
+            (suballocatorStats.slabBytes - suballocatorStats.liveBytes) * 100 /
+            suballocatorStats.slabBytes);
+    }
+
+    const vk::MemoryBudget memoryBudget     = mRenderer->getDeviceLocalMemoryBudget();
+    mPerfCounters.deviceLocalImageMemoryKB  = static_cast<uint32_t>(memoryBudget.imageBytes >> 10);
+    mPerfCounters.deviceLocalBufferMemoryKB = static_cast<uint32_t>(memoryBudget.bufferBytes >> 10);
+    mPerfCounters.deviceLocalMemoryUsageKB  = static_cast<uint32_t>(memoryBudget.usage >> 10);
+    mPerfCounters.deviceLocalMemoryBudgetKB = static_cast<uint32_t>(memoryBudget.budget >> 10);
 }
 
 void ContextVk::updateOverlayOnPresent()
@@ -2131,11 +2211,47 @@ void ContextVk::updateOverlayOnPresent()
         }
     }
 
+    {
+        gl::RunningGraphWidget *textureHitRate =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanTextureDSHitRate);
+        size_t numCacheAccesses = mPerfCounters.textureDescriptorSetCacheHits +
+                                  mPerfCounters.textureDescriptorSetCacheMisses;
+        if (numCacheAccesses > 0)
+        {
+            float hitRateFloat = static_cast<float>(mPerfCounters.textureDescriptorSetCacheHits) /
+                                 static_cast<float>(numCacheAccesses);
+            size_t hitRate = static_cast<size_t>(hitRateFloat * 100.0f);
+            textureHitRate->add(hitRate);
+            textureHitRate->next();
+        }
+    }
+
+    {
+        gl::RunningGraphWidget *descriptorPoolCount =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanDescriptorPoolCount);
+        descriptorPoolCount->add(mPerfCounters.descriptorPools);
+        descriptorPoolCount->next();
+    }
+
+    {
+        gl::RunningGraphWidget *cachedDescriptorSetCount =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanCachedDescriptorSetCount);
+        cachedDescriptorSetCount->add(mPerfCounters.cachedDescriptorSets);
+        cachedDescriptorSetCount->next();
+    }
+
     {
         gl::RunningGraphWidget *dynamicBufferAllocations =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanDynamicBufferAllocations);
         dynamicBufferAllocations->next();
     }
+
+    {
+        gl::RunningGraphWidget *deviceMemoryUsage =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanDeviceMemoryUsage);
+        deviceMemoryUsage->add(mPerfCounters.deviceLocalMemoryUsageKB >> 10);
+        deviceMemoryUsage->next();
+    }
 }
 
 void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelper *commandBuffer)
@@ -2523,6 +2639,7 @@ void ContextVk::handleDeviceLost()
 {
     mOutsideRenderPassCommands->reset();
     mRenderPassCommands->reset();
+    mDeferredGraphicsPipelineBinds.clear();
     mRenderer->handleDeviceLost();
     clearAllGarbage();
 
@@ -5242,6 +5359,79 @@ bool ContextVk::hasRecordedCommands()
     return !mOutsideRenderPassCommands->empty() || mRenderPassCommands->started();
 }
 
+angle::Result ContextVk::evictTexturesOverMemoryBudget()
+{
+    // Evicting frees nothing if the host copies take device-local memory as well.  Also wait for
+    // the memory of the previous eviction to be freed, or it would be made up for by evicting more
+    // textures.
+    if (mRenderer->isStagingMemoryDeviceLocal() ||
+        mLastTextureEvictionSerial > getLastCompletedQueueSerial())
+    {
+        return angle::Result::Continue;
+    }
+
+    const vk::MemoryBudget memoryBudget = mRenderer->getDeviceLocalMemoryBudget();
+    if (memoryBudget.usage <= memoryBudget.budget)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::evictTexturesOverMemoryBudget");
+
+    // Textures used by any context in the share group are likely to be used again soon.
+    std::set<const TextureVk *> activeTextures;
+    for (ContextVk *contextVk : *getShareGroupVk()->getContexts())
+    {
+        for (const vk::TextureUnit &unit : contextVk->getActiveTextures())
+        {
+            activeTextures.insert(unit.texture);
+        }
+    }
+
+    const Serial lastCompletedSerial = getLastCompletedQueueSerial();
+    std::vector<TextureVk *> candidates;
+    for (const auto &resource : mState.getTextureManagerForCapture())
+    {
+        gl::Texture *texture = resource.second;
+        if (texture == nullptr || texture->isEGLImageSource() || texture->isEGLImageTarget())
+        {
+            continue;
+        }
+
+        TextureVk *textureVk = vk::GetImpl(texture);
+        if (activeTextures.count(textureVk) == 0 && textureVk->canEvictImage(lastCompletedSerial))
+        {
+            candidates.push_back(textureVk);
+        }
+    }
+
+    // Evict the least recently used textures first.
+    std::sort(candidates.begin(), candidates.end(), [](TextureVk *lhs, TextureVk *rhs) {
+        return lhs->getImage().getLastUsedSerial() < rhs->getImage().getLastUsedSerial();
+    });
+
+    const VkDeviceSize bytesOverBudget = memoryBudget.usage - memoryBudget.budget;
+    VkDeviceSize bytesEvicted          = 0;
+    for (TextureVk *textureVk : candidates)
+    {
+        if (bytesEvicted >= bytesOverBudget)
+        {
+            break;
+        }
+
+        bytesEvicted += textureVk->getImage().getAllocationSize();
+        ANGLE_TRY(textureVk->evictImage(this));
+        ++mPerfCounters.evictedTextures;
+    }
+
+    if (bytesEvicted > 0)
+    {
+        mLastTextureEvictionSerial = getCurrentQueueSerial();
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::flushImpl");
@@ -5251,6 +5441,18 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
     mHasDeferredFlush = false;
     getShareGroupVk()->clearSyncObjectPendingFlush();
 
+    if (mPendingReadPixelsCount > 0)
+    {
+        ANGLE_TRY(resolvePendingReadPixelsUsedInRecordedCommands());
+    }
+
+    // Record the eviction copies before ending the render pass so they are part of this
+    // submission.
+    if (getFeatures().evictTexturesOverMemoryBudget.enabled)
+    {
+        ANGLE_TRY(evictTexturesOverMemoryBudget());
+    }
+
     ANGLE_TRY(flushCommandsAndEndRenderPass());
 
     if (mIsAnyHostVisibleBufferWritten)
@@ -5286,6 +5488,7 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
     }
     mDefaultUniformStorage.releaseInFlightBuffersToResourceUseList(this);
     mStagingBuffer.releaseInFlightBuffersToResourceUseList(this);
+    ANGLE_TRY(mStreamingBuffer.onSubmit(this));
 
     ANGLE_TRY(submitFrame(signalSemaphore));
 
@@ -5363,6 +5566,189 @@ angle::Result ContextVk::finishToSerial(Serial serial)
     return mRenderer->finishToSerial(this, serial);
 }
 
+angle::Result ContextVk::allocatePendingReadPixels(size_t readbackSize,
+                                                   PendingReadPixels **pendingOut)
+{
+    PendingReadPixels *pending = nullptr;
+    for (PendingReadPixels &candidate : mPendingReadPixels)
+    {
+        if (candidate.packBuffer == nullptr)
+        {
+            pending = &candidate;
+            break;
+        }
+    }
+
+    // If all the readback buffers are taken, pack the oldest readback now to free its buffer.
+    if (pending == nullptr)
+    {
+        pending = &mPendingReadPixels[0];
+        for (PendingReadPixels &candidate : mPendingReadPixels)
+        {
+            if (candidate.sequence < pending->sequence)
+            {
+                pending = &candidate;
+            }
+        }
+        ANGLE_TRY(packPendingReadPixels(pending));
+    }
+
+    if (pending->readbackBuffer.valid() && pending->readbackBuffer.getSize() < readbackSize)
+    {
+        pending->readbackBuffer.release(mRenderer);
+    }
+
+    if (!pending->readbackBuffer.valid())
+    {
+        // Round the size up, so the buffer doesn't need to grow for every larger readback.
+        constexpr size_t kReadbackBufferSizeGranularity = 64 * 1024;
+
+        VkBufferCreateInfo createInfo = {};
+        createInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.size               = roundUpPow2(readbackSize, kReadbackBufferSizeGranularity);
+        createInfo.usage              = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        createInfo.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+        // The pixels are only ever read by the CPU.
+        ANGLE_TRY(pending->readbackBuffer.init(
+            this, createInfo,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT));
+    }
+
+    *pendingOut = pending;
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::deferReadPixelsPacking(BufferVk *packBuffer, PendingReadPixels *pending)
+{
+    ASSERT(pending->packBuffer == nullptr);
+
+    // Submit the copy right away.  That way, the pixels can always be packed before the next
+    // submission that uses the pack buffer, without waiting for that same submission.
+    ANGLE_TRY(flushImpl(nullptr));
+
+    pending->packBuffer = packBuffer;
+    pending->sequence   = mPendingReadPixelsSequence++;
+    mPendingReadPixelsCount++;
+
+    packBuffer->onReadPixelsDeferred(this);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::resolvePendingReadPixels(BufferVk *packBuffer)
+{
+    // Pack in the order of the ReadPixels calls, in case they overlap.
+    while (true)
+    {
+        PendingReadPixels *oldest = nullptr;
+        for (PendingReadPixels &pending : mPendingReadPixels)
+        {
+            if (pending.packBuffer == packBuffer &&
+                (oldest == nullptr || pending.sequence < oldest->sequence))
+            {
+                oldest = &pending;
+            }
+        }
+
+        if (oldest == nullptr)
+        {
+            return angle::Result::Continue;
+        }
+
+        ANGLE_TRY(packPendingReadPixels(oldest));
+    }
+}
+
+void ContextVk::dropPendingReadPixels(BufferVk *packBuffer)
+{
+    for (PendingReadPixels &pending : mPendingReadPixels)
+    {
+        if (pending.packBuffer == packBuffer)
+        {
+            pending.packBuffer = nullptr;
+            mPendingReadPixelsCount--;
+        }
+    }
+
+    packBuffer->onPendingReadPixelsResolved();
+}
+
+angle::Result ContextVk::packPendingReadPixels(PendingReadPixels *pending)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::packPendingReadPixels");
+
+    BufferVk *packBufferVk           = pending->packBuffer;
+    VkDeviceSize packBufferOffset    = 0;
+    vk::BufferHelper &packBuffer     = packBufferVk->getBufferAndOffset(&packBufferOffset);
+    vk::BufferHelper &readbackBuffer = pending->readbackBuffer;
+
+    // The copy was submitted when the ReadPixels was deferred, so only wait for that submission,
+    // if the GPU isn't done with it already.  Whatever was submitted before it and uses the pack
+    // buffer must be done too, before the pixels are written to the pack buffer.
+    ASSERT(!readbackBuffer.usedInRecordedCommands());
+    if (readbackBuffer.usedInRunningCommands(getLastCompletedQueueSerial()))
+    {
+        ANGLE_PERF_WARNING(getDebug(), GL_DEBUG_SEVERITY_HIGH, "GPU stall due to ReadPixels");
+        ANGLE_TRY(readbackBuffer.finishRunningCommands(this));
+    }
+    if (packBuffer.usedInRunningCommands(getLastCompletedQueueSerial()))
+    {
+        ANGLE_TRY(packBuffer.finishRunningCommands(this));
+    }
+
+    uint8_t *readPixelBuffer = nullptr;
+    ANGLE_TRY(readbackBuffer.map(this, &readPixelBuffer));
+    ANGLE_TRY(readbackBuffer.invalidate(mRenderer, 0, VK_WHOLE_SIZE));
+
+    // Leave the pack buffer memory mapped if it already was.
+    const bool wasMapped = packBuffer.isMapped();
+    uint8_t *dest        = nullptr;
+    ANGLE_TRY(packBuffer.mapWithOffset(
+        this, &dest, static_cast<size_t>(packBufferOffset + pending->packBufferOffset)));
+
+    PackPixels(pending->params, *pending->readFormat, pending->inputPitch, readPixelBuffer, dest);
+
+    ANGLE_TRY(packBuffer.flush(mRenderer, 0, VK_WHOLE_SIZE));
+    if (!wasMapped)
+    {
+        packBuffer.unmap(mRenderer);
+    }
+
+    pending->packBuffer = nullptr;
+    mPendingReadPixelsCount--;
+
+    for (const PendingReadPixels &other : mPendingReadPixels)
+    {
+        if (other.packBuffer == packBufferVk)
+        {
+            return angle::Result::Continue;
+        }
+    }
+    packBufferVk->onPendingReadPixelsResolved();
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::resolvePendingReadPixelsUsedInRecordedCommands()
+{
+    // The commands about to be submitted expect the pixels in the pack buffer.  Their copies were
+    // submitted earlier, so it's enough to pack them before this submission.
+    for (PendingReadPixels &pending : mPendingReadPixels)
+    {
+        if (pending.packBuffer != nullptr)
+        {
+            VkDeviceSize offset = 0;
+            if (pending.packBuffer->getBufferAndOffset(&offset).usedInRecordedCommands())
+            {
+                ANGLE_TRY(resolvePendingReadPixels(pending.packBuffer));
+            }
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::getCompatibleRenderPass(const vk::RenderPassDesc &desc,
                                                  vk::RenderPass **renderPassOut)
 {
@@ -5666,6 +6052,8 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl()
 
     pauseTransformFeedbackIfActiveUnpaused();
 
+    ANGLE_TRY(resolveDeferredGraphicsPipelineBinds());
+
     mRenderPassCommands->endRenderPass(this);
 
     if (vk::CommandBufferHelper::kEnableCommandStreamDiagnostics)
@@ -5697,6 +6085,19 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl()
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::resolveDeferredGraphicsPipelineBinds()
+{
+    for (const DeferredGraphicsPipelineBind &bind : mDeferredGraphicsPipelineBinds)
+    {
+        bind.creationTask->wait();
+        ANGLE_VK_TRY(this, bind.creationTask->getResult());
+        *bind.pipelineHandle = bind.creationTask->getHandle();
+    }
+    mDeferredGraphicsPipelineBinds.clear();
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::flushCommandsAndEndRenderPass()
 {
     bool isRenderPassStarted = mRenderPassCommands->started();
@@ -29,6 +29,7 @@ struct FeaturesVk;
 
 namespace rx
 {
+class BufferVk;
 class ProgramExecutableVk;
 class RendererVk;
 class WindowSurfaceVk;
@@ -48,6 +49,28 @@ enum class PipelineType
 
 using ContextVkDescriptorSetList = angle::PackedEnumMap<PipelineType, uint32_t>;
 
+// A ReadPixels into a pixel pack buffer whose packing on the CPU is deferred until the pack buffer
+// is next accessed.  See FeaturesVk::deferReadPixelsPacking.
+struct PendingReadPixels final : angle::NonCopyable
+{
+    PendingReadPixels();
+    ~PendingReadPixels();
+
+    // The GPU copies the pixels here.  The buffer is kept for the next readbacks.
+    vk::BufferHelper readbackBuffer;
+
+    // nullptr if nothing is pending.
+    BufferVk *packBuffer;
+    // Orders the pending readbacks, to resolve the oldest one first.
+    uint64_t sequence;
+
+    PackPixelsParams params;
+    const angle::Format *readFormat;
+    // The offset of the pixels in the pack buffer, i.e. the pointer given to ReadPixels.
+    ptrdiff_t packBufferOffset;
+    int inputPitch;
+};
+
 struct ContextVkPerfCounters
 {
     ContextVkDescriptorSetList descriptorSetsAllocated;
@@ -619,6 +642,18 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     vk::BufferHelper &getEmptyBuffer() { return mEmptyBuffer; }
     vk::DynamicBuffer *getStagingBuffer() { return &mStagingBuffer; }
+    vk::StreamingRingBuffer *getStreamingBuffer() { return &mStreamingBuffer; }
+
+    // ReadPixels into a pixel pack buffer with deferred packing.  The caller records the copy into
+    // the readback buffer of the allocated PendingReadPixels, fills in how to pack the pixels, and
+    // then hands it back to deferReadPixelsPacking, which submits the copy.  The pixels are packed
+    // when the pack buffer is accessed on the CPU, before the buffer is used by commands that are
+    // submitted later, or when the readback buffers run out.
+    angle::Result allocatePendingReadPixels(size_t readbackSize, PendingReadPixels **pendingOut);
+    angle::Result deferReadPixelsPacking(BufferVk *packBuffer, PendingReadPixels *pending);
+    angle::Result resolvePendingReadPixels(BufferVk *packBuffer);
+    // Forgets the pending readbacks of a pack buffer whose storage is released.
+    void dropPendingReadPixels(BufferVk *packBuffer);
 
     const vk::PerfCounters &getPerfCounters() const { return mPerfCounters; }
     vk::PerfCounters &getPerfCounters() { return mPerfCounters; }
@@ -895,6 +930,13 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     angle::Result submitFrame(const vk::Semaphore *signalSemaphore);
 
+    angle::Result packPendingReadPixels(PendingReadPixels *pending);
+    angle::Result resolvePendingReadPixelsUsedInRecordedCommands();
+
+    // Evict idle textures to host memory, least recently used first, until the device-local
+    // heaps are back within budget.
+    angle::Result evictTexturesOverMemoryBudget();
+
     angle::Result synchronizeCpuGpuTime();
     angle::Result traceGpuEventImpl(vk::CommandBuffer *commandBuffer,
                                     char phase,
@@ -912,6 +954,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // directly or through the iterator respectively.  Outside those two functions, this shouldn't
     // be called directly.
     angle::Result flushCommandsAndEndRenderPassImpl();
+    angle::Result resolveDeferredGraphicsPipelineBinds();
     angle::Result flushDirtyGraphicsRenderPass(DirtyBits::Iterator *dirtyBitsIterator,
                                                DirtyBits dirtyBitMask);
     void flushDescriptorSetUpdates();
@@ -973,6 +1016,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     vk::PipelineHelper *mCurrentGraphicsPipeline;
     vk::PipelineAndSerial *mCurrentComputePipeline;
+
+    // Pipeline binds recorded in the render pass while the pipelines were still being created in
+    // the worker thread pool.  The pipelines are waited for and written into the commands when the
+    // render pass is flushed.
+    struct DeferredGraphicsPipelineBind
+    {
+        std::shared_ptr<vk::CreateGraphicsPipelineTask> creationTask;
+        VkPipeline *pipelineHandle;
+    };
+    std::vector<DeferredGraphicsPipelineBind> mDeferredGraphicsPipelineBinds;
     gl::PrimitiveMode mCurrentDrawMode;
 
     WindowSurfaceVk *mCurrentWindowSurface;
@@ -1145,6 +1198,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     gl::State::DirtyBits mPipelineDirtyBitsMask;
 
+    // The memory of evicted images is only freed once the submission that copies them out has
+    // completed.  Until then, the driver still counts it as in use.
+    Serial mLastTextureEvictionSerial;
+
     // List of all resources currently being used by this ContextVk's recorded commands.
     vk::ResourceUseList mResourceUseList;
 
@@ -1169,6 +1226,17 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // All staging buffer support is provided by a DynamicBuffer.
     vk::DynamicBuffer mStagingBuffer;
 
+    // Client-side vertex arrays and indices, and indices converted on the CPU, are streamed through
+    // this ring for the draw that uses them.
+    vk::StreamingRingBuffer mStreamingBuffer;
+
+    // Readbacks with deferred packing.  A handful is enough for an application that maps its pixel
+    // pack buffers a couple of frames after ReadPixels.
+    static constexpr size_t kMaxPendingReadPixels = 4;
+    std::array<PendingReadPixels, kMaxPendingReadPixels> mPendingReadPixels;
+    uint64_t mPendingReadPixelsSequence;
+    size_t mPendingReadPixelsCount;
+
     std::vector<std::string> mCommandBufferDiagnostics;
 
     // Record GL API calls for debuggers
@@ -64,8 +64,10 @@ angle::Result GlslangWrapperVk::TransformSpirV(
     const GlslangSpirvOptions &options,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
     const angle::spirv::Blob &initialSpirvBlob,
+    const GlslangSpirvInstructionIndex *instructionIndex,
     angle::spirv::Blob *shaderCodeOut)
 {
-    return GlslangTransformSpirvCode(options, variableInfoMap, initialSpirvBlob, shaderCodeOut);
+    return GlslangTransformSpirvCode(options, variableInfoMap, initialSpirvBlob, instructionIndex,
+                                     shaderCodeOut);
 }
 }  // namespace rx
@@ -40,6 +40,7 @@ class GlslangWrapperVk
     static angle::Result TransformSpirV(const GlslangSpirvOptions &options,
                                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
                                         const angle::spirv::Blob &initialSpirvBlob,
+                                        const GlslangSpirvInstructionIndex *instructionIndex,
                                         angle::spirv::Blob *shaderCodeOut);
 };
 }  // namespace rx
@@ -78,7 +78,7 @@ bool ValidateTransformedSpirV(const gl::ShaderBitSet &linkedShaderStages,
 
         angle::spirv::Blob transformed;
         if (GlslangWrapperVk::TransformSpirV(options, variableInfoMap, spirvBlobs[shaderType],
-                                             &transformed) != angle::Result::Continue)
+                                             nullptr, &transformed) != angle::Result::Continue)
         {
             return false;
         }
@@ -155,9 +155,58 @@ void ShaderInfo::release(ContextVk *contextVk)
     {
         spirvBlob.clear();
     }
+    for (GlslangSpirvInstructionIndex &instructionIndex : mSpirvInstructionIndices)
+    {
+        instructionIndex.clear();
+    }
+    for (TransformedSpirvBlobs &transformedSpirvBlobs : mTransformedSpirvBlobs)
+    {
+        transformedSpirvBlobs.clear();
+    }
     mIsInitialized = false;
 }
 
+angle::Result ShaderInfo::transformSpirv(const GlslangSpirvOptions &options,
+                                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                         bool cacheResult,
+                                         angle::spirv::Blob *spirvBlobOut)
+{
+    ASSERT(valid());
+
+    const gl::ShaderType shaderType              = options.shaderType;
+    const angle::spirv::Blob &originalSpirvBlob  = mSpirvBlobs[shaderType];
+    TransformedSpirvBlobs &transformedSpirvBlobs = mTransformedSpirvBlobs[shaderType];
+
+    if (cacheResult)
+    {
+        for (const auto &transformedSpirvBlob : transformedSpirvBlobs)
+        {
+            if (transformedSpirvBlob.first == options)
+            {
+                *spirvBlobOut = transformedSpirvBlob.second;
+                return angle::Result::Continue;
+            }
+        }
+    }
+
+    GlslangSpirvInstructionIndex &instructionIndex = mSpirvInstructionIndices[shaderType];
+    if (!instructionIndex.valid() && !originalSpirvBlob.empty())
+    {
+        instructionIndex.init(originalSpirvBlob);
+    }
+
+    ANGLE_TRY(GlslangWrapperVk::TransformSpirV(
+        options, variableInfoMap, originalSpirvBlob,
+        instructionIndex.valid() ? &instructionIndex : nullptr, spirvBlobOut));
+
+    if (cacheResult)
+    {
+        transformedSpirvBlobs.emplace_back(options, *spirvBlobOut);
+    }
+
+    return angle::Result::Continue;
+}
+
 void ShaderInfo::load(gl::BinaryInputStream *stream)
 {
     // Read in shader codes for all shader types
@@ -195,14 +244,12 @@ angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
                                        const gl::ShaderType shaderType,
                                        bool isLastPreFragmentStage,
                                        bool isTransformFeedbackProgram,
-                                       const ShaderInfo &shaderInfo,
+                                       bool cacheTransformedSpirv,
+                                       ShaderInfo *shaderInfo,
                                        ProgramTransformOptions optionBits,
                                        const ShaderInterfaceVariableInfoMap &variableInfoMap)
 {
-    const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
-    const angle::spirv::Blob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
-    gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
-    angle::spirv::Blob &transformedSpirvBlob = transformedSpirvBlobs[shaderType];
+    angle::spirv::Blob transformedSpirvBlob;
 
     GlslangSpirvOptions options;
     options.shaderType = shaderType;
@@ -219,8 +266,10 @@ angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
         options.transformPositionToVulkanClipSpace = optionBits.enableDepthCorrection;
     }
 
-    ANGLE_TRY(GlslangWrapperVk::TransformSpirV(options, variableInfoMap, originalSpirvBlob,
-                                               &transformedSpirvBlob));
+    // Only the last pre-fragment stage depends on most of the options, so the other stages are
+    // transformed once and reused by every variant.
+    ANGLE_TRY(shaderInfo->transformSpirv(options, variableInfoMap, cacheTransformedSpirv,
+                                         &transformedSpirvBlob));
     ANGLE_TRY(vk::InitShaderAndSerial(contextVk, &mShaders[shaderType].get(),
                                       transformedSpirvBlob.data(),
                                       transformedSpirvBlob.size() * sizeof(uint32_t)));
@@ -282,16 +331,17 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
         binding.reset();
     }
 
-    for (vk::DynamicDescriptorPool &descriptorPool : mDynamicDescriptorPools)
-    {
-        descriptorPool.release(contextVk);
-    }
-
+    // The cached descriptor sets hold references to their pools.
     RendererVk *rendererVk = contextVk->getRenderer();
     mTextureDescriptorsCache.destroy(rendererVk);
     mUniformsAndXfbDescriptorsCache.destroy(rendererVk);
     mShaderBufferDescriptorsCache.destroy(rendererVk);
 
+    for (vk::DynamicDescriptorPool &descriptorPool : mDynamicDescriptorPools)
+    {
+        descriptorPool.release(contextVk);
+    }
+
     // Initialize with a unique BufferSerial
     vk::ResourceSerialFactory &factory = rendererVk->getResourceSerialFactory();
     mCurrentDefaultUniformBufferSerial = factory.generateBufferSerial();
@@ -466,31 +516,21 @@ angle::Result ProgramExecutableVk::allocUniformAndXfbDescriptorSet(
     mCurrentDefaultUniformBufferSerial = xfbBufferDesc.getDefaultUniformBufferSerial();
 
     // Look up in the cache first
-    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
-    if (mUniformsAndXfbDescriptorsCache.get(xfbBufferDesc, &descriptorSet))
+    VkDescriptorSet descriptorSet  = VK_NULL_HANDLE;
+    vk::DescriptorPoolHelper *pool = nullptr;
+    if (mUniformsAndXfbDescriptorsCache.get(xfbBufferDesc, contextVk->getCurrentQueueSerial(),
+                                            &descriptorSet, &pool))
     {
         *newDescriptorSetAllocated                          = false;
         mDescriptorSets[DescriptorSetIndex::UniformsAndXfb] = descriptorSet;
         // The descriptor pool that this descriptor set was allocated from needs to be retained each
         // time the descriptor set is used in a new command.
-        mDescriptorPoolBindings[DescriptorSetIndex::UniformsAndXfb].get().retain(
-            &contextVk->getResourceUseList());
+        pool->retain(&contextVk->getResourceUseList());
         return angle::Result::Continue;
     }
 
-    bool newPoolAllocated;
-    ANGLE_TRY(allocateDescriptorSetAndGetInfo(contextVk, DescriptorSetIndex::UniformsAndXfb,
-                                              &newPoolAllocated));
-
-    // Clear descriptor set cache. It may no longer be valid.
-    if (newPoolAllocated)
-    {
-        mUniformsAndXfbDescriptorsCache.destroy(contextVk->getRenderer());
-    }
-
-    // Add the descriptor set into cache
-    mUniformsAndXfbDescriptorsCache.insert(xfbBufferDesc,
-                                           mDescriptorSets[DescriptorSetIndex::UniformsAndXfb]);
+    ANGLE_TRY(allocateCachedDescriptorSet(contextVk, DescriptorSetIndex::UniformsAndXfb,
+                                          xfbBufferDesc, &mUniformsAndXfbDescriptorsCache));
     *newDescriptorSetAllocated = true;
 
     return angle::Result::Continue;
@@ -498,23 +538,16 @@ angle::Result ProgramExecutableVk::allocUniformAndXfbDescriptorSet(
 
 angle::Result ProgramExecutableVk::allocateDescriptorSet(ContextVk *contextVk,
                                                          DescriptorSetIndex descriptorSetIndex)
-{
-    bool ignoreNewPoolAllocated;
-    return allocateDescriptorSetAndGetInfo(contextVk, descriptorSetIndex, &ignoreNewPoolAllocated);
-}
-
-angle::Result ProgramExecutableVk::allocateDescriptorSetAndGetInfo(
-    ContextVk *contextVk,
-    DescriptorSetIndex descriptorSetIndex,
-    bool *newPoolAllocatedOut)
 {
     vk::DynamicDescriptorPool &dynamicDescriptorPool = mDynamicDescriptorPools[descriptorSetIndex];
 
+    // Cached descriptor sets keep their pools referenced, so allocating a new pool doesn't
+    // invalidate them.
     const vk::DescriptorSetLayout &descriptorSetLayout =
         mDescriptorSetLayouts[descriptorSetIndex].get();
-    ANGLE_TRY(dynamicDescriptorPool.allocateSetsAndGetInfo(
-        contextVk, descriptorSetLayout.ptr(), 1, &mDescriptorPoolBindings[descriptorSetIndex],
-        &mDescriptorSets[descriptorSetIndex], newPoolAllocatedOut));
+    ANGLE_TRY(dynamicDescriptorPool.allocateSets(contextVk, descriptorSetLayout.ptr(), 1,
+                                                 &mDescriptorPoolBindings[descriptorSetIndex],
+                                                 &mDescriptorSets[descriptorSetIndex]));
     mEmptyDescriptorSets[descriptorSetIndex] = VK_NULL_HANDLE;
 
     ++mPerfCounters.descriptorSetAllocations[descriptorSetIndex];
@@ -522,6 +555,36 @@ angle::Result ProgramExecutableVk::allocateDescriptorSetAndGetInfo(
     return angle::Result::Continue;
 }
 
+template <typename Key, VulkanCacheType CacheType>
+angle::Result ProgramExecutableVk::allocateCachedDescriptorSet(
+    ContextVk *contextVk,
+    DescriptorSetIndex descriptorSetIndex,
+    const Key &desc,
+    DescriptorSetCache<Key, CacheType> *cache)
+{
+    Serial currentSerial = contextVk->getCurrentQueueSerial();
+
+    VkDescriptorSet descriptorSet  = VK_NULL_HANDLE;
+    vk::DescriptorPoolHelper *pool = nullptr;
+    if (cache->recycle(desc, currentSerial, contextVk->getLastCompletedQueueSerial(),
+                       &descriptorSet, &pool))
+    {
+        mDescriptorSets[descriptorSetIndex]      = descriptorSet;
+        mEmptyDescriptorSets[descriptorSetIndex] = VK_NULL_HANDLE;
+        pool->retain(&contextVk->getResourceUseList());
+
+        ++mPerfCounters.descriptorSetRecycles[descriptorSetIndex];
+
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(allocateDescriptorSet(contextVk, descriptorSetIndex));
+    cache->insert(desc, mDescriptorSets[descriptorSetIndex],
+                  mDescriptorPoolBindings[descriptorSetIndex], currentSerial);
+
+    return angle::Result::Continue;
+}
+
 void ProgramExecutableVk::addInterfaceBlockDescriptorSetDesc(
     const std::vector<gl::InterfaceBlock> &blocks,
     const gl::ShaderType shaderType,
@@ -810,6 +873,44 @@ void ProgramExecutableVk::updateEarlyFragmentTestsOptimization(ContextVk *contex
     }
 }
 
+angle::Result ProgramExecutableVk::initGraphicsShaderPrograms(
+    ContextVk *contextVk,
+    const gl::ShaderMap<ProgramVk *> &programs,
+    const gl::ShaderBitSet &linkedShaderStages,
+    ProgramTransformOptions transformOptions,
+    const vk::PackedExtent &drawableSize,
+    vk::ShaderProgramHelper **shaderProgramOut)
+{
+    ProgramInfo &programInfo                  = getGraphicsProgramInfo(transformOptions);
+    const gl::ShaderType lastPreFragmentStage = gl::GetLastPreFragmentStage(linkedShaderStages);
+
+    for (const gl::ShaderType shaderType : linkedShaderStages)
+    {
+        ProgramVk *programVk = programs[shaderType];
+        if (programVk)
+        {
+            ANGLE_TRY(programVk->initGraphicsShaderProgram(
+                contextVk, shaderType, shaderType == lastPreFragmentStage, transformOptions,
+                &programInfo, mVariableInfoMap));
+        }
+    }
+
+    vk::ShaderProgramHelper *shaderProgram = programInfo.getShaderProgram();
+    ASSERT(shaderProgram);
+
+    // Drawable size is part of specialization constant, but does not have its own dedicated
+    // programInfo entry. We pick the programInfo entry based on the transform options and then
+    // update drawable width/height specialization constant. It will go through desc matching and if
+    // spec constant does not match, it will recompile pipeline program.
+    shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableWidth,
+                                             drawableSize.width);
+    shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableHeight,
+                                             drawableSize.height);
+
+    *shaderProgramOut = shaderProgram;
+    return angle::Result::Continue;
+}
+
 angle::Result ProgramExecutableVk::getGraphicsPipeline(
     ContextVk *contextVk,
     gl::PrimitiveMode mode,
@@ -828,40 +929,121 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(
     mTransformOptions.surfaceRotation           = ToUnderlying(desc.getSurfaceRotation());
     mTransformOptions.enableDepthCorrection     = !glState.isClipControlDepthZeroToOne();
 
-    // This must be called after mTransformOptions have been set.
-    ProgramInfo &programInfo                  = getGraphicsProgramInfo(mTransformOptions);
     const gl::ShaderBitSet linkedShaderStages = glExecutable->getLinkedShaderStages();
-    const gl::ShaderType lastPreFragmentStage = gl::GetLastPreFragmentStage(linkedShaderStages);
-
+    gl::ShaderMap<ProgramVk *> programs;
     for (const gl::ShaderType shaderType : linkedShaderStages)
     {
-        ProgramVk *programVk = getShaderProgram(glState, shaderType);
-        if (programVk)
+        programs[shaderType] = getShaderProgram(glState, shaderType);
+    }
+
+    // This must be called after mTransformOptions have been set.
+    vk::ShaderProgramHelper *shaderProgram = nullptr;
+    ANGLE_TRY(initGraphicsShaderPrograms(contextVk, programs, linkedShaderStages,
+                                         mTransformOptions, desc.getDrawableSize(),
+                                         &shaderProgram));
+
+    ANGLE_TRY(renderer->getPipelineCache(&pipelineCache));
+    const size_t pipelineCount = shaderProgram->getGraphicsPipelineCache().getPipelineCount();
+    ANGLE_TRY(shaderProgram->getGraphicsPipeline(
+        contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(), desc,
+        activeAttribLocations, glExecutable->getAttributesTypeMask(), descPtrOut, pipelineOut));
+
+    // A new pipeline is recorded in the program's pipeline manifest.
+    if (shaderProgram->getGraphicsPipelineCache().getPipelineCount() != pipelineCount)
+    {
+        contextVk->getPerfCounters().coldGraphicsPipelines++;
+        if (mProgram)
         {
-            ANGLE_TRY(programVk->initGraphicsShaderProgram(
-                contextVk, shaderType, shaderType == lastPreFragmentStage, mTransformOptions,
-                &programInfo, mVariableInfoMap));
+            mProgram->onGraphicsPipelineCreated(contextVk);
         }
     }
 
-    vk::ShaderProgramHelper *shaderProgram = programInfo.getShaderProgram();
-    ASSERT(shaderProgram);
+    return angle::Result::Continue;
+}
 
-    // Drawable size is part of specialization constant, but does not have its own dedicated
-    // programInfo entry. We pick the programInfo entry based on the mTransformOptions and then
-    // update drawable width/height specialization constant. It will go through desc matching and if
-    // spec constant does not match, it will recompile pipeline program.
-    const vk::PackedExtent &dimensions = desc.getDrawableSize();
-    shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableWidth,
-                                             dimensions.width);
-    shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableHeight,
-                                             dimensions.height);
+size_t ProgramExecutableVk::getGraphicsPipelineCount() const
+{
+    size_t pipelineCount = 0;
+    for (const ProgramInfo &programInfo : mGraphicsProgramInfos)
+    {
+        const vk::ShaderProgramHelper *shaderProgram = programInfo.getShaderProgram();
+        pipelineCount += shaderProgram->getGraphicsPipelineCache().getPipelineCount();
+    }
+    return pipelineCount;
+}
 
+void ProgramExecutableVk::saveGraphicsPipelineManifest(gl::BinaryOutputStream *stream) const
+{
+    stream->writeInt(getGraphicsPipelineCount());
+
+    // The descs are written as is, which is fine as the manifest is keyed by the ANGLE version.
+    std::vector<vk::GraphicsPipelineDesc> descs;
+    for (uint32_t permutationIndex = 0;
+         permutationIndex < ProgramTransformOptions::kPermutationCount; ++permutationIndex)
+    {
+        const vk::ShaderProgramHelper *shaderProgram =
+            mGraphicsProgramInfos[permutationIndex].getShaderProgram();
+
+        descs.clear();
+        shaderProgram->getGraphicsPipelineCache().getPipelineDescs(&descs);
+
+        for (const vk::GraphicsPipelineDesc &desc : descs)
+        {
+            stream->writeInt(permutationIndex);
+            stream->writeBytes(reinterpret_cast<const uint8_t *>(&desc), sizeof(desc));
+        }
+    }
+}
+
+angle::Result ProgramExecutableVk::warmUpGraphicsPipelines(
+    ContextVk *contextVk,
+    ProgramVk *programVk,
+    const gl::ProgramExecutable &glExecutable,
+    gl::BinaryInputStream *stream)
+{
+    ASSERT(!glExecutable.isCompute());
+
+    RendererVk *renderer             = contextVk->getRenderer();
+    vk::PipelineCache *pipelineCache = nullptr;
     ANGLE_TRY(renderer->getPipelineCache(&pipelineCache));
-    return shaderProgram->getGraphicsPipeline(
-        contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(), desc,
-        activeAttribLocations, glState.getProgramExecutable()->getAttributesTypeMask(), descPtrOut,
-        pipelineOut);
+
+    // The program is being loaded, so it's not necessarily the current program.  All the stages
+    // come from it.
+    const gl::ShaderBitSet linkedShaderStages = glExecutable.getLinkedShaderStages();
+    gl::ShaderMap<ProgramVk *> programs;
+    for (const gl::ShaderType shaderType : linkedShaderStages)
+    {
+        programs[shaderType] = programVk;
+    }
+
+    const size_t pipelineCount = stream->readInt<size_t>();
+    for (size_t pipelineIndex = 0; pipelineIndex < pipelineCount; ++pipelineIndex)
+    {
+        const uint32_t permutationIndex = stream->readInt<uint32_t>();
+        vk::GraphicsPipelineDesc desc;
+        stream->readBytes(reinterpret_cast<uint8_t *>(&desc), sizeof(desc));
+
+        // A truncated or otherwise bad manifest only means fewer pipelines are warmed up.
+        if (stream->error() || permutationIndex >= ProgramTransformOptions::kPermutationCount)
+        {
+            break;
+        }
+
+        const ProgramTransformOptions transformOptions =
+            gl::bitCast<ProgramTransformOptions>(static_cast<uint8_t>(permutationIndex));
+
+        vk::ShaderProgramHelper *shaderProgram = nullptr;
+        ANGLE_TRY(initGraphicsShaderPrograms(contextVk, programs, linkedShaderStages,
+                                             transformOptions, desc.getDrawableSize(),
+                                             &shaderProgram));
+        ANGLE_TRY(shaderProgram->warmUpGraphicsPipeline(
+            contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(), desc,
+            glExecutable.getNonBuiltinAttribLocationsMask(), glExecutable.getAttributesTypeMask()));
+
+        contextVk->getPerfCounters().warmedUpGraphicsPipelines++;
+    }
+
+    return angle::Result::Continue;
 }
 
 angle::Result ProgramExecutableVk::getComputePipeline(ContextVk *contextVk,
@@ -1178,20 +1360,15 @@ angle::Result ProgramExecutableVk::getOrAllocateShaderResourcesDescriptorSet(
 {
     if (mDescriptorSets[DescriptorSetIndex::ShaderResource] == VK_NULL_HANDLE)
     {
-        bool newPoolAllocated = false;
-        ANGLE_TRY(allocateDescriptorSetAndGetInfo(contextVk, DescriptorSetIndex::ShaderResource,
-                                                  &newPoolAllocated));
-
         if (shaderBuffersDesc)
         {
-            // Clear descriptor set cache. It may no longer be valid.
-            if (newPoolAllocated)
-            {
-                mShaderBufferDescriptorsCache.destroy(contextVk->getRenderer());
-            }
-
-            mShaderBufferDescriptorsCache.insert(
-                *shaderBuffersDesc, mDescriptorSets[DescriptorSetIndex::ShaderResource]);
+            ANGLE_TRY(allocateCachedDescriptorSet(contextVk, DescriptorSetIndex::ShaderResource,
+                                                  *shaderBuffersDesc,
+                                                  &mShaderBufferDescriptorsCache));
+        }
+        else
+        {
+            ANGLE_TRY(allocateDescriptorSet(contextVk, DescriptorSetIndex::ShaderResource));
         }
     }
     *descriptorSetOut = mDescriptorSets[DescriptorSetIndex::ShaderResource];
@@ -1507,14 +1684,15 @@ angle::Result ProgramExecutableVk::updateShaderResourcesDescriptorSet(
 
     if (!executable->hasImages() && !executable->usesFramebufferFetch())
     {
-        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
-        if (mShaderBufferDescriptorsCache.get(shaderBuffersDesc, &descriptorSet))
+        VkDescriptorSet descriptorSet  = VK_NULL_HANDLE;
+        vk::DescriptorPoolHelper *pool = nullptr;
+        if (mShaderBufferDescriptorsCache.get(shaderBuffersDesc, contextVk->getCurrentQueueSerial(),
+                                              &descriptorSet, &pool))
         {
             mDescriptorSets[DescriptorSetIndex::ShaderResource] = descriptorSet;
             // The descriptor pool that this descriptor set was allocated from needs to be retained
             // each time the descriptor set is used in a new command.
-            mDescriptorPoolBindings[DescriptorSetIndex::ShaderResource].get().retain(
-                &contextVk->getResourceUseList());
+            pool->retain(&contextVk->getResourceUseList());
         }
     }
 
@@ -1671,14 +1849,15 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         return angle::Result::Continue;
     }
 
-    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
-    if (mTextureDescriptorsCache.get(texturesDesc, &descriptorSet))
+    VkDescriptorSet descriptorSet  = VK_NULL_HANDLE;
+    vk::DescriptorPoolHelper *pool = nullptr;
+    if (mTextureDescriptorsCache.get(texturesDesc, contextVk->getCurrentQueueSerial(),
+                                     &descriptorSet, &pool))
     {
         mDescriptorSets[DescriptorSetIndex::Texture] = descriptorSet;
         // The descriptor pool that this descriptor set was allocated from needs to be retained each
         // time the descriptor set is used in a new command.
-        mDescriptorPoolBindings[DescriptorSetIndex::Texture].get().retain(
-            &contextVk->getResourceUseList());
+        pool->retain(&contextVk->getResourceUseList());
         return angle::Result::Continue;
     }
 
@@ -1711,18 +1890,9 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
             // sampler uniforms are inactive.
             if (descriptorSet == VK_NULL_HANDLE)
             {
-                bool newPoolAllocated;
-                ANGLE_TRY(allocateDescriptorSetAndGetInfo(contextVk, DescriptorSetIndex::Texture,
-                                                          &newPoolAllocated));
-
-                // Clear descriptor set cache. It may no longer be valid.
-                if (newPoolAllocated)
-                {
-                    mTextureDescriptorsCache.destroy(contextVk->getRenderer());
-                }
-
+                ANGLE_TRY(allocateCachedDescriptorSet(contextVk, DescriptorSetIndex::Texture,
+                                                      texturesDesc, &mTextureDescriptorsCache));
                 descriptorSet = mDescriptorSets[DescriptorSetIndex::Texture];
-                mTextureDescriptorsCache.insert(texturesDesc, descriptorSet);
             }
             ASSERT(descriptorSet != VK_NULL_HANDLE);
 
@@ -1953,11 +2123,25 @@ ProgramExecutablePerfCounters ProgramExecutableVk::getAndResetObjectPerfCounters
     mCumulativePerfCounters.descriptorSetAllocations += mPerfCounters.descriptorSetAllocations;
     mCumulativePerfCounters.descriptorSetCacheHits += mPerfCounters.descriptorSetCacheHits;
     mCumulativePerfCounters.descriptorSetCacheMisses += mPerfCounters.descriptorSetCacheMisses;
+    mCumulativePerfCounters.descriptorSetRecycles += mPerfCounters.descriptorSetRecycles;
+
+    for (DescriptorSetIndex descriptorSetIndex : angle::AllEnums<DescriptorSetIndex>())
+    {
+        mPerfCounters.descriptorPools[descriptorSetIndex] = static_cast<uint32_t>(
+            mDynamicDescriptorPools[descriptorSetIndex].getPoolCount());
+    }
+    mPerfCounters.cachedDescriptorSets[DescriptorSetIndex::UniformsAndXfb] =
+        static_cast<uint32_t>(mUniformsAndXfbDescriptorsCache.size());
+    mPerfCounters.cachedDescriptorSets[DescriptorSetIndex::Texture] =
+        static_cast<uint32_t>(mTextureDescriptorsCache.size());
+    mPerfCounters.cachedDescriptorSets[DescriptorSetIndex::ShaderResource] =
+        static_cast<uint32_t>(mShaderBufferDescriptorsCache.size());
 
     ProgramExecutablePerfCounters counters = mPerfCounters;
     mPerfCounters.descriptorSetAllocations = {};
     mPerfCounters.descriptorSetCacheHits   = {};
     mPerfCounters.descriptorSetCacheMisses = {};
+    mPerfCounters.descriptorSetRecycles    = {};
     return counters;
 }
 
@@ -38,12 +38,26 @@ class ShaderInfo final : angle::NonCopyable
 
     const gl::ShaderMap<angle::spirv::Blob> &getSpirvBlobs() const { return mSpirvBlobs; }
 
+    // Transforms the SPIR-V of |options.shaderType|.  The instructions the transformation looks at
+    // are indexed the first time around, and later transformations only visit those.  With
+    // |cacheResult|, the result is also kept and handed out again for the same options, which is
+    // only correct if |variableInfoMap| is the same every time.
+    angle::Result transformSpirv(const GlslangSpirvOptions &options,
+                                 const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                 bool cacheResult,
+                                 angle::spirv::Blob *spirvBlobOut);
+
     // Save and load implementation for GLES Program Binary support.
     void load(gl::BinaryInputStream *stream);
     void save(gl::BinaryOutputStream *stream);
 
   private:
+    using TransformedSpirvBlobs = std::vector<std::pair<GlslangSpirvOptions, angle::spirv::Blob>>;
+
     gl::ShaderMap<angle::spirv::Blob> mSpirvBlobs;
+    gl::ShaderMap<GlslangSpirvInstructionIndex> mSpirvInstructionIndices;
+    // A handful of entries per stage at most, one per combination of the options that apply to it.
+    gl::ShaderMap<TransformedSpirvBlobs> mTransformedSpirvBlobs;
     bool mIsInitialized = false;
 };
 
@@ -69,7 +83,8 @@ class ProgramInfo final : angle::NonCopyable
                               const gl::ShaderType shaderType,
                               bool isLastPreFragmentStage,
                               bool isTransformFeedbackProgram,
-                              const ShaderInfo &shaderInfo,
+                              bool cacheTransformedSpirv,
+                              ShaderInfo *shaderInfo,
                               ProgramTransformOptions optionBits,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap);
     void release(ContextVk *contextVk);
@@ -80,6 +95,7 @@ class ProgramInfo final : angle::NonCopyable
     }
 
     vk::ShaderProgramHelper *getShaderProgram() { return &mProgramHelper; }
+    const vk::ShaderProgramHelper *getShaderProgram() const { return &mProgramHelper; }
 
   private:
     vk::ShaderProgramHelper mProgramHelper;
@@ -110,6 +126,10 @@ struct ProgramExecutablePerfCounters
     DescriptorSetCountList descriptorSetAllocations;
     DescriptorSetCountList descriptorSetCacheHits;
     DescriptorSetCountList descriptorSetCacheMisses;
+    DescriptorSetCountList descriptorSetRecycles;
+    // The current number of descriptor pools and cached descriptor sets.  These are not reset.
+    DescriptorSetCountList descriptorPools;
+    DescriptorSetCountList cachedDescriptorSets;
 };
 
 class ProgramExecutableVk
@@ -152,6 +172,16 @@ class ProgramExecutableVk
 
     angle::Result getComputePipeline(ContextVk *contextVk, vk::PipelineAndSerial **pipelineOut);
 
+    // The pipeline manifest lists the graphics pipelines created for this executable, along with
+    // the transform options of the program variant they were created for.  When the same program
+    // is loaded again, warmUpGraphicsPipelines() creates them before any draw needs them.
+    size_t getGraphicsPipelineCount() const;
+    void saveGraphicsPipelineManifest(gl::BinaryOutputStream *stream) const;
+    angle::Result warmUpGraphicsPipelines(ContextVk *contextVk,
+                                          ProgramVk *programVk,
+                                          const gl::ProgramExecutable &glExecutable,
+                                          gl::BinaryInputStream *stream);
+
     const vk::PipelineLayout &getPipelineLayout() const { return mPipelineLayout.get(); }
     angle::Result createPipelineLayout(const gl::Context *glContext,
                                        gl::ActiveTextureArray<vk::TextureUnit> *activeTextures);
@@ -215,9 +245,13 @@ class ProgramExecutableVk
 
     angle::Result allocateDescriptorSet(ContextVk *contextVk,
                                         DescriptorSetIndex descriptorSetIndex);
-    angle::Result allocateDescriptorSetAndGetInfo(ContextVk *contextVk,
-                                                  DescriptorSetIndex descriptorSetIndex,
-                                                  bool *newPoolAllocatedOut);
+    // Called on a cache miss.  Once |cache| is full, its least recently used set is handed out
+    // for |desc| instead of allocating a new one.
+    template <typename Key, VulkanCacheType CacheType>
+    angle::Result allocateCachedDescriptorSet(ContextVk *contextVk,
+                                              DescriptorSetIndex descriptorSetIndex,
+                                              const Key &desc,
+                                              DescriptorSetCache<Key, CacheType> *cache);
     void addInterfaceBlockDescriptorSetDesc(const std::vector<gl::InterfaceBlock> &blocks,
                                             const gl::ShaderType shaderType,
                                             VkDescriptorType descType,
@@ -237,6 +271,12 @@ class ProgramExecutableVk
                                      vk::DescriptorSetLayoutDesc *descOut);
 
     void resolvePrecisionMismatch(const gl::ProgramMergedVaryings &mergedVaryings);
+    angle::Result initGraphicsShaderPrograms(ContextVk *contextVk,
+                                             const gl::ShaderMap<ProgramVk *> &programs,
+                                             const gl::ShaderBitSet &linkedShaderStages,
+                                             ProgramTransformOptions transformOptions,
+                                             const vk::PackedExtent &drawableSize,
+                                             vk::ShaderProgramHelper **shaderProgramOut);
     void updateDefaultUniformsDescriptorSet(const gl::ShaderType shaderType,
                                             const DefaultUniformBlock &defaultUniformBlock,
                                             vk::BufferHelper *defaultUniformBuffer,
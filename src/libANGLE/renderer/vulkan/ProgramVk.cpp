@@ -9,9 +9,13 @@
 
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
 
+#include <anglebase/sha1.h>
+
+#include "common/angle_version.h"
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/ProgramLinkedResources.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/renderer_utils.h"
@@ -154,6 +158,10 @@ void ProgramVk::destroy(const gl::Context *context)
 
 void ProgramVk::reset(ContextVk *contextVk)
 {
+    // Record the pipelines before they are released with the executable.
+    savePipelineManifest(contextVk);
+    mSavedPipelineCount = 0;
+
     mOriginalShaderInfo.release(contextVk);
 
     GlslangWrapperVk::ResetGlslangProgramInterfaceInfo(&mGlslangProgramInterfaceInfo);
@@ -200,6 +208,12 @@ std::unique_ptr<rx::LinkEvent> ProgramVk::load(const gl::Context *context,
     }
 
     status = mExecutable.createPipelineLayout(context, nullptr);
+    if (status == angle::Result::Continue &&
+        contextVk->getFeatures().warmUpGraphicsPipelines.enabled)
+    {
+        initPipelineManifestKey(contextVk);
+        status = warmUpGraphicsPipelines(context);
+    }
     return std::make_unique<LinkEventDone>(status);
 }
 
@@ -252,19 +266,20 @@ void ProgramVk::fillProgramStateMap(gl::ShaderMap<const gl::ProgramState *> *pro
     }
 }
 
-std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
-                                           const gl::ProgramLinkedResources &resources,
-                                           gl::InfoLog &infoLog,
-                                           const gl::ProgramMergedVaryings &mergedVaryings)
+angle::Result ProgramVk::prepareLink(const gl::Context *context,
+                                     const gl::ProgramLinkedResources &resources)
 {
-    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::link");
+    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::prepareLink");
 
+    // This may run on a worker thread, so nothing that's owned by the context is touched here
+    // other than the renderer features.
     ContextVk *contextVk = vk::GetImpl(context);
     // Link resources before calling GetShaderSource to make sure they are ready for the set/binding
     // assignment done in that function.
     linkResources(resources);
 
-    reset(contextVk);
+    mOriginalShaderInfo.release(contextVk);
+    GlslangWrapperVk::ResetGlslangProgramInterfaceInfo(&mGlslangProgramInterfaceInfo);
     mExecutable.clearVariableInfoMap();
 
     // Gather variable info and compiled SPIR-V binaries.
@@ -274,14 +289,25 @@ std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
                                     &mExecutable.mVariableInfoMap);
 
     // Compile the shaders.
-    angle::Result status = mOriginalShaderInfo.initShaders(
-        mState.getExecutable().getLinkedShaderStages(), spirvBlobs, mExecutable.mVariableInfoMap);
-    if (status != angle::Result::Continue)
-    {
-        return std::make_unique<LinkEventDone>(status);
-    }
+    return mOriginalShaderInfo.initShaders(mState.getExecutable().getLinkedShaderStages(),
+                                           spirvBlobs, mExecutable.mVariableInfoMap);
+}
 
-    status = initDefaultUniformBlocks(context);
+std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
+                                           const gl::ProgramLinkedResources &resources,
+                                           gl::InfoLog &infoLog,
+                                           const gl::ProgramMergedVaryings &mergedVaryings)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::link");
+
+    // The shaders are already translated to SPIR-V by prepareLink().  What's left creates Vulkan
+    // objects through the context, so it stays on the context's thread.
+    ContextVk *contextVk = vk::GetImpl(context);
+    savePipelineManifest(contextVk);
+    mSavedPipelineCount = 0;
+    mExecutable.reset(contextVk);
+
+    angle::Result status = initDefaultUniformBlocks(context);
     if (status != angle::Result::Continue)
     {
         return std::make_unique<LinkEventDone>(status);
@@ -295,9 +321,119 @@ std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
     // TODO(jie.a.chen@intel.com): Parallelize linking.
     // http://crbug.com/849576
     status = mExecutable.createPipelineLayout(context, nullptr);
+    if (contextVk->getFeatures().warmUpGraphicsPipelines.enabled)
+    {
+        initPipelineManifestKey(contextVk);
+    }
     return std::make_unique<LinkEventDone>(status);
 }
 
+void ProgramVk::initPipelineManifestKey(ContextVk *contextVk)
+{
+    // The descs in the manifest are only meaningful to the same ANGLE version, and the formats
+    // they use depend on the device.
+    const VkPhysicalDeviceProperties &properties =
+        contextVk->getRenderer()->getPhysicalDeviceProperties();
+    std::ostringstream hashStream("ANGLE Pipeline Manifest: ", std::ios_base::ate);
+    hashStream << ANGLE_COMMIT_HASH << ':' << std::hex << properties.vendorID << ':'
+               << properties.deviceID << ':' << properties.driverVersion;
+
+    gl::BinaryOutputStream keyData;
+    keyData.writeString(hashStream.str());
+    for (const gl::ShaderType shaderType : mState.getExecutable().getLinkedShaderStages())
+    {
+        const angle::spirv::Blob &spirvBlob = mOriginalShaderInfo.getSpirvBlobs()[shaderType];
+        keyData.writeInt(static_cast<uint32_t>(shaderType));
+        keyData.writeBytes(reinterpret_cast<const uint8_t *>(spirvBlob.data()),
+                           spirvBlob.size() * sizeof(*spirvBlob.data()));
+    }
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(keyData.data()),
+                               keyData.length(), mPipelineManifestKey.data());
+}
+
+void ProgramVk::savePipelineManifest(ContextVk *contextVk)
+{
+    if (!contextVk->getFeatures().warmUpGraphicsPipelines.enabled)
+    {
+        return;
+    }
+
+    const size_t pipelineCount = mExecutable.getGraphicsPipelineCount();
+    egl::Display *display      = contextVk->getRenderer()->getDisplay();
+    egl::BlobCache &blobCache  = display->getBlobCache();
+    if (pipelineCount == mSavedPipelineCount || !blobCache.isCachingEnabled())
+    {
+        return;
+    }
+
+    gl::BinaryOutputStream stream;
+    mExecutable.saveGraphicsPipelineManifest(&stream);
+
+    angle::MemoryBuffer compressedData;
+    if (!egl::CompressBlobCacheData(stream.length(),
+                                    static_cast<const uint8_t *>(stream.data()), &compressedData))
+    {
+        WARN() << "Error compressing the pipeline manifest.";
+        return;
+    }
+
+    // The blob cache is shared by all contexts of the display, and this is reached both at draw
+    // time and while the program is loaded out of the program cache.
+    std::lock_guard<std::recursive_mutex> cacheLock(display->getProgramCacheMutex());
+    blobCache.put(mPipelineManifestKey, std::move(compressedData));
+    mSavedPipelineCount = pipelineCount;
+}
+
+angle::Result ProgramVk::warmUpGraphicsPipelines(const gl::Context *context)
+{
+    ContextVk *contextVk      = vk::GetImpl(context);
+    egl::BlobCache &blobCache = contextVk->getRenderer()->getDisplay()->getBlobCache();
+    if (mState.getExecutable().isCompute() || !blobCache.isCachingEnabled())
+    {
+        return angle::Result::Continue;
+    }
+
+    angle::MemoryBuffer manifestData;
+    {
+        std::lock_guard<std::recursive_mutex> cacheLock(context->getProgramCacheMutex());
+
+        egl::BlobCache::Value compressedData;
+        size_t compressedSize = 0;
+        if (!blobCache.get(context->getScratchBuffer(), mPipelineManifestKey, &compressedData,
+                           &compressedSize))
+        {
+            return angle::Result::Continue;
+        }
+
+        if (!egl::DecompressBlobCacheData(compressedData.data(), compressedSize, &manifestData))
+        {
+            WARN() << "Error decompressing the pipeline manifest.";
+            return angle::Result::Continue;
+        }
+    }
+
+    gl::BinaryInputStream stream(manifestData.data(), manifestData.size());
+    ANGLE_TRY(mExecutable.warmUpGraphicsPipelines(contextVk, this, mState.getExecutable(),
+                                                  &stream));
+
+    // The pipelines that were warmed up are already in the manifest.
+    mSavedPipelineCount = mExecutable.getGraphicsPipelineCount();
+    return angle::Result::Continue;
+}
+
+void ProgramVk::onGraphicsPipelineCreated(ContextVk *contextVk)
+{
+    // Programs are often never deleted, so the manifest is also saved as pipelines are created.
+    // Saving it whenever the pipeline count reaches a power of two keeps the cost per pipeline
+    // constant.
+    if (contextVk->getFeatures().warmUpGraphicsPipelines.enabled &&
+        gl::isPow2(mExecutable.getGraphicsPipelineCount()))
+    {
+        savePipelineManifest(contextVk);
+    }
+}
+
 void ProgramVk::linkResources(const gl::ProgramLinkedResources &resources)
 {
     Std140BlockLayoutEncoderFactory std140EncoderFactory;
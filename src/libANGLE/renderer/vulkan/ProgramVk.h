@@ -13,6 +13,7 @@
 #include <array>
 
 #include "common/utilities.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
@@ -44,6 +45,8 @@ class ProgramVk : public ProgramImpl
 
     void fillProgramStateMap(gl::ShaderMap<const gl::ProgramState *> *programStatesOut);
 
+    angle::Result prepareLink(const gl::Context *context,
+                              const gl::ProgramLinkedResources &resources) override;
     std::unique_ptr<LinkEvent> link(const gl::Context *context,
                                     const gl::ProgramLinkedResources &resources,
                                     gl::InfoLog &infoLog,
@@ -124,6 +127,9 @@ class ProgramVk : public ProgramImpl
     }
     void onProgramBind();
 
+    // Called when a draw created a new graphics pipeline for this program.
+    void onGraphicsPipelineCreated(ContextVk *contextVk);
+
     const ProgramExecutableVk &getExecutable() const { return mExecutable; }
     ProgramExecutableVk &getExecutable() { return mExecutable; }
 
@@ -189,6 +195,12 @@ class ProgramVk : public ProgramImpl
     void setUniformImpl(GLint location, GLsizei count, const T *v, GLenum entryPointType);
     void linkResources(const gl::ProgramLinkedResources &resources);
 
+    // With the warmUpGraphicsPipelines feature, the pipeline manifest of the executable is kept in
+    // the blob cache, keyed by the SPIR-V of the program.
+    void initPipelineManifestKey(ContextVk *contextVk);
+    void savePipelineManifest(ContextVk *contextVk);
+    angle::Result warmUpGraphicsPipelines(const gl::Context *context);
+
     ANGLE_INLINE angle::Result initProgram(ContextVk *contextVk,
                                            const gl::ShaderType shaderType,
                                            bool isLastPreFragmentStage,
@@ -204,9 +216,12 @@ class ProgramVk : public ProgramImpl
         {
             const bool isTransformFeedbackProgram =
                 !mState.getLinkedTransformFeedbackVaryings().empty();
+            // A program pipeline assigns its own locations and bindings, so only the SPIR-V
+            // transformed for the program's own executable is worth keeping.
+            const bool cacheTransformedSpirv = &variableInfoMap == &mExecutable.mVariableInfoMap;
             ANGLE_TRY(programInfo->initProgram(contextVk, shaderType, isLastPreFragmentStage,
-                                               isTransformFeedbackProgram, mOriginalShaderInfo,
-                                               optionBits, variableInfoMap));
+                                               isTransformFeedbackProgram, cacheTransformedSpirv,
+                                               &mOriginalShaderInfo, optionBits, variableInfoMap));
         }
         ASSERT(programInfo->valid(shaderType));
 
@@ -222,6 +237,10 @@ class ProgramVk : public ProgramImpl
     GlslangProgramInterfaceInfo mGlslangProgramInterfaceInfo;
 
     ProgramExecutableVk mExecutable;
+
+    egl::BlobCache::Key mPipelineManifestKey;
+    // The number of pipelines in the manifest last saved to the blob cache.
+    size_t mSavedPipelineCount = 0;
 };
 
 }  // namespace rx
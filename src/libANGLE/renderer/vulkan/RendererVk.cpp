@@ -709,6 +709,10 @@ RendererVk::RendererVk()
       mDefaultUniformBufferSize(kPreferredDefaultUniformBufferSize),
       mDevice(VK_NULL_HANDLE),
       mDeviceLost(false),
+      mImageMemorySize{},
+      mMemoryHeapBudgetForTesting(0),
+      mMemoryBudgetFetchIndex(0),
+      mStagingMemoryIsDeviceLocal(false),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
       mPipelineCacheDirty(false),
       mPipelineCacheInitialized(false),
@@ -764,6 +768,11 @@ void RendererVk::onDestroy(vk::Context *context)
     (void)cleanupGarbage(Serial::Infinite());
     ASSERT(!hasSharedGarbage());
 
+    {
+        std::lock_guard<std::mutex> lock(mBufferSuballocatorMutex);
+        mBufferSuballocator.destroy(this);
+    }
+
     for (PendingOneOffCommands &pending : mPendingOneOffCommands)
     {
         pending.commandBuffer.releaseHandle();
@@ -771,6 +780,10 @@ void RendererVk::onDestroy(vk::Context *context)
 
     mOneOffCommandPool.destroy(mDevice);
 
+    // All the pipelines have been waited for by the program caches that created them.
+    mGraphicsPipelineThreadPool.reset();
+    mCommandRecordingThreadPool.reset();
+
     mPipelineCache.destroy(mDevice);
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
@@ -1180,11 +1193,30 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
     // Create VMA allocator
     ANGLE_VK_TRY(displayVk,
                  mAllocator.init(mPhysicalDevice, mDevice, mInstance, applicationInfo.apiVersion,
-                                 preferredLargeHeapBlockSize));
+                                 preferredLargeHeapBlockSize,
+                                 mFeatures.supportsMemoryBudget.enabled));
 
     // Store the physical device memory properties so we can find the right memory pools.
     mMemoryProperties.init(mPhysicalDevice);
 
+    // Textures are evicted to staging buffers, which only frees device memory if they use a
+    // different heap.
+    {
+        VkBufferCreateInfo stagingBufferInfo = {};
+        stagingBufferInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        stagingBufferInfo.size               = vk::kStagingBufferSize;
+        stagingBufferInfo.usage              = vk::kStagingBufferFlags;
+        stagingBufferInfo.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+        uint32_t stagingMemoryTypeIndex = 0;
+        ANGLE_VK_TRY(displayVk, mAllocator.findMemoryTypeIndexForBufferInfo(
+                                    stagingBufferInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, 0,
+                                    mFeatures.persistentlyMappedBuffers.enabled,
+                                    &stagingMemoryTypeIndex));
+        mStagingMemoryIsDeviceLocal = mMemoryProperties.isDeviceLocalHeap(
+            mMemoryProperties.getHeapIndexForMemoryType(stagingMemoryTypeIndex));
+    }
+
     {
         ANGLE_TRACE_EVENT0("gpu.angle,startup", "GlslangWarmup");
         sh::InitializeGlslang();
@@ -1510,6 +1542,18 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     // Initialize features and workarounds.
     initFeatures(displayVk, deviceExtensionNames);
 
+    if (mFeatures.asyncGraphicsPipelineCreation.enabled ||
+        mFeatures.warmUpGraphicsPipelines.enabled)
+    {
+        mGraphicsPipelineThreadPool = angle::WorkerThreadPool::Create(true);
+    }
+
+    // Only the ANGLE command buffers can be split in chunks.
+    if (mFeatures.parallelCommandBufferRecording.enabled && vk::CommandBuffer::ExecutesInline())
+    {
+        mCommandRecordingThreadPool = angle::WorkerThreadPool::Create(true);
+    }
+
     // Enable VK_EXT_depth_clip_enable, if supported
     if (ExtensionFound(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME, deviceExtensionNames))
     {
@@ -1653,6 +1697,11 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         enabledDeviceExtensions.push_back(VK_QCOM_RENDER_PASS_STORE_OPS_EXTENSION_NAME);
     }
 
+    if (getFeatures().supportsMemoryBudget.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
     if (getFeatures().supportsImageFormatList.enabled)
     {
         enabledDeviceExtensions.push_back(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME);
@@ -2361,6 +2410,12 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         &mFeatures, supportsRenderPassStoreOpNoneQCOM,
         ExtensionFound(VK_QCOM_RENDER_PASS_STORE_OPS_EXTENSION_NAME, deviceExtensionNames));
 
+    // VMA queries the budget through vkGetPhysicalDeviceMemoryProperties2KHR.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsMemoryBudget,
+        ExtensionFound(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, deviceExtensionNames) &&
+            vkGetPhysicalDeviceMemoryProperties2KHR != nullptr);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsTransformFeedbackExtension,
                             mTransformFeedbackFeatures.transformFeedback == VK_TRUE);
 
@@ -2544,6 +2599,32 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // descriptor counts for such immutable samplers
     ANGLE_FEATURE_CONDITION(&mFeatures, useMultipleDescriptorsForExternalFormats, true);
 
+    // Disabled by default until the effect on drivers that compile pipelines lazily is measured.
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncGraphicsPipelineCreation, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, warmUpGraphicsPipelines, false);
+
+    // Executing secondary command buffers has a cost of its own, which only pays off for
+    // applications that draw a lot per render pass.
+    ANGLE_FEATURE_CONDITION(&mFeatures, parallelCommandBufferRecording, false);
+
+    // Holds on to a few readback buffers per context, and only helps applications that map their
+    // pixel pack buffers a few frames later.
+    ANGLE_FEATURE_CONDITION(&mFeatures, deferReadPixelsPacking, false);
+
+    // Rounding of half floats in the compute shader may differ from the CPU conversion.
+    ANGLE_FEATURE_CONDITION(&mFeatures, convertPixelsWithCompute, false);
+
+    // Out of bounds accesses to a buffer that shares its VkBuffer with others are not caught by
+    // robustBufferAccess, and may read the data of the neighbouring buffers.
+    ANGLE_FEATURE_CONDITION(&mFeatures, suballocateSmallBuffers, false);
+
+    // Evicting a texture costs a copy to host memory and another one back once it's used again.
+    ANGLE_FEATURE_CONDITION(&mFeatures, evictTexturesOverMemoryBudget, false);
+
+    // The transcoded images don't match the ETC2/EAC images that the application uploaded
+    // exactly.
+    ANGLE_FEATURE_CONDITION(&mFeatures, transcodeETCToBC, false);
+
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     platform->overrideFeaturesVk(platform, &mFeatures);
 
@@ -2719,7 +2800,8 @@ angle::Result RendererVk::syncPipelineCacheVk(DisplayVk *displayVk, const gl::Co
                 displayVk, contextVk, std::move(pipelineCacheData), kMaxTotalSize);
         mCompressEvent = std::make_shared<WaitableCompressEventImpl>(
             angle::WorkerThreadPool::PostWorkerTask(context->getWorkerThreadPool(),
-                                                    compressAndStorePipelineCacheTask),
+                                                    compressAndStorePipelineCacheTask,
+                                                    angle::TaskPriority::Low),
             compressAndStorePipelineCacheTask);
         mPipelineCacheDirty = false;
     }
@@ -2800,6 +2882,8 @@ angle::Result RendererVk::queueSubmitOneOff(vk::Context *context,
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::queueSubmitOneOff");
 
+    // Submissions must reach the queue in the order of their serials, so reserving the serial and
+    // queueing the submission is done under the lock.
     std::lock_guard<std::mutex> commandQueueLock(mCommandQueueMutex);
 
     Serial submitQueueSerial;
@@ -2889,23 +2973,121 @@ bool RendererVk::haveSameFormatFeatureBits(angle::FormatID formatID1,
 
 angle::Result RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
 {
-    std::lock_guard<std::mutex> lock(mGarbageMutex);
+    {
+        std::lock_guard<std::mutex> lock(mGarbageMutex);
+
+        for (auto garbageIter = mSharedGarbage.begin(); garbageIter != mSharedGarbage.end();)
+        {
+            // Possibly 'counter' should be always zero when we add the object to garbage.
+            vk::SharedGarbage &garbage = *garbageIter;
+            if (garbage.destroyIfComplete(this, lastCompletedQueueSerial))
+            {
+                garbageIter = mSharedGarbage.erase(garbageIter);
+            }
+            else
+            {
+                garbageIter++;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mBufferSuballocatorMutex);
+    mBufferSuballocator.cleanupGarbage(this, lastCompletedQueueSerial);
+
+    return angle::Result::Continue;
+}
+
+angle::Result RendererVk::allocateBufferSuballocation(ContextVk *contextVk,
+                                                      const vk::BufferSuballocationDesc &desc,
+                                                      VkDeviceSize size,
+                                                      vk::BufferHelper *bufferOut)
+{
+    // Queried before locking, as the garbage is otherwise cleaned up with the command queue
+    // locked.
+    const Serial lastCompletedQueueSerial = getLastCompletedQueueSerial();
+
+    std::lock_guard<std::mutex> lock(mBufferSuballocatorMutex);
+    return mBufferSuballocator.allocate(contextVk, desc, size, lastCompletedQueueSerial,
+                                        bufferOut);
+}
+
+void RendererVk::collectBufferSuballocationGarbageAndReinit(vk::SharedResourceUse *use,
+                                                            vk::BufferSlab *slab,
+                                                            VkDeviceSize offset,
+                                                            VkDeviceSize size)
+{
+    {
+        std::lock_guard<std::mutex> lock(mBufferSuballocatorMutex);
+        mBufferSuballocator.collectGarbage(std::move(*use), slab, offset, size);
+    }
+
+    // Keep "use" valid.
+    use->init();
+}
+
+void RendererVk::onImageMemoryAllocated(uint32_t memoryTypeIndex, VkDeviceSize size)
+{
+    uint32_t heapIndex = mMemoryProperties.getHeapIndexForMemoryType(memoryTypeIndex);
+
+    std::lock_guard<std::mutex> lock(mImageMemoryMutex);
+    mImageMemorySize[heapIndex] += size;
+}
 
-    for (auto garbageIter = mSharedGarbage.begin(); garbageIter != mSharedGarbage.end();)
+void RendererVk::onImageMemoryReleased(uint32_t memoryTypeIndex, VkDeviceSize size)
+{
+    uint32_t heapIndex = mMemoryProperties.getHeapIndexForMemoryType(memoryTypeIndex);
+
+    std::lock_guard<std::mutex> lock(mImageMemoryMutex);
+    ASSERT(mImageMemorySize[heapIndex] >= size);
+    mImageMemorySize[heapIndex] -= size;
+}
+
+vk::MemoryBudget RendererVk::getDeviceLocalMemoryBudget() const
+{
+    if (mFeatures.supportsMemoryBudget.enabled)
     {
-        // Possibly 'counter' should be always zero when we add the object to garbage.
-        vk::SharedGarbage &garbage = *garbageIter;
-        if (garbage.destroyIfComplete(this, lastCompletedQueueSerial))
+        // VMA only fetches the usage from the driver every so many of its own allocations, and
+        // adds the buffer allocations made since.  Images are allocated outside of VMA, so fetch
+        // the usage again to account for the images allocated and freed since.
+        mAllocator.setCurrentFrameIndex(mMemoryBudgetFetchIndex++ & 0x7FFFFFFFu);
+    }
+
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> bufferBytes = {};
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> usage       = {};
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> budget      = {};
+    mAllocator.getHeapBudgets(bufferBytes.data(), usage.data(), budget.data());
+
+    vk::MemoryBudget total = {};
+
+    std::lock_guard<std::mutex> lock(mImageMemoryMutex);
+    for (uint32_t heapIndex = 0; heapIndex < mMemoryProperties.getMemoryHeapCount(); ++heapIndex)
+    {
+        if (!mMemoryProperties.isDeviceLocalHeap(heapIndex))
         {
-            garbageIter = mSharedGarbage.erase(garbageIter);
+            continue;
         }
-        else
+
+        // With VK_EXT_memory_budget, the usage is reported by the driver and includes the images.
+        // Otherwise, VMA only knows about the buffers.
+        VkDeviceSize heapUsage = usage[heapIndex];
+        if (!mFeatures.supportsMemoryBudget.enabled)
+        {
+            heapUsage += mImageMemorySize[heapIndex];
+        }
+
+        VkDeviceSize heapBudget = budget[heapIndex];
+        if (mMemoryHeapBudgetForTesting != 0)
         {
-            garbageIter++;
+            heapBudget = std::min(heapBudget, mMemoryHeapBudgetForTesting);
         }
+
+        total.imageBytes += mImageMemorySize[heapIndex];
+        total.bufferBytes += bufferBytes[heapIndex];
+        total.usage += heapUsage;
+        total.budget += heapBudget;
     }
 
-    return angle::Result::Continue;
+    return total;
 }
 
 void RendererVk::cleanupCompletedCommandsGarbage()
@@ -3043,6 +3225,8 @@ angle::Result RendererVk::submitFrame(vk::Context *context,
                                       vk::GarbageList &&currentGarbage,
                                       vk::CommandPool *commandPool)
 {
+    // Submissions must reach the queue in the order of their serials, so reserving the serial and
+    // queueing the submission is done under the lock.
     std::lock_guard<std::mutex> commandQueueLock(mCommandQueueMutex);
 
     Serial submitQueueSerial;
@@ -3091,14 +3275,15 @@ void RendererVk::handleDeviceLost()
 
 angle::Result RendererVk::finishToSerial(vk::Context *context, Serial serial)
 {
-    std::lock_guard<std::mutex> lock(mCommandQueueMutex);
-
+    // Only submissions need to be ordered with the tasks of other contexts, see
+    // mCommandQueueMutex.
     if (mFeatures.asyncCommandQueue.enabled)
     {
         ANGLE_TRY(mCommandProcessor.finishToSerial(context, serial, getMaxFenceWaitTimeNs()));
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         ANGLE_TRY(mCommandQueue.finishToSerial(context, serial, getMaxFenceWaitTimeNs()));
     }
 
@@ -3112,13 +3297,13 @@ angle::Result RendererVk::waitForSerialWithUserTimeout(vk::Context *context,
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::waitForSerialWithUserTimeout");
 
-    std::lock_guard<std::mutex> lock(mCommandQueueMutex);
     if (mFeatures.asyncCommandQueue.enabled)
     {
         ANGLE_TRY(mCommandProcessor.waitForSerialWithUserTimeout(context, serial, timeout, result));
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         ANGLE_TRY(mCommandQueue.waitForSerialWithUserTimeout(context, serial, timeout, result));
     }
 
@@ -3132,7 +3317,6 @@ angle::Result RendererVk::finish(vk::Context *context, bool hasProtectedContent)
 
 angle::Result RendererVk::checkCompletedCommands(vk::Context *context)
 {
-    std::lock_guard<std::mutex> lock(mCommandQueueMutex);
     // TODO: https://issuetracker.google.com/169788986 - would be better if we could just wait
     // for the work we need but that requires QueryHelper to use the actual serial for the
     // query.
@@ -3142,6 +3326,7 @@ angle::Result RendererVk::checkCompletedCommands(vk::Context *context)
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         ANGLE_TRY(mCommandQueue.checkCompletedCommands(context));
     }
 
@@ -3155,7 +3340,6 @@ angle::Result RendererVk::flushRenderPassCommands(vk::Context *context,
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::flushRenderPassCommands");
 
-    std::lock_guard<std::mutex> lock(mCommandQueueMutex);
     if (mFeatures.asyncCommandQueue.enabled)
     {
         ANGLE_TRY(mCommandProcessor.flushRenderPassCommands(context, hasProtectedContent,
@@ -3163,6 +3347,7 @@ angle::Result RendererVk::flushRenderPassCommands(vk::Context *context,
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         ANGLE_TRY(mCommandQueue.flushRenderPassCommands(context, hasProtectedContent, renderPass,
                                                         renderPassCommands));
     }
@@ -3176,7 +3361,6 @@ angle::Result RendererVk::flushOutsideRPCommands(vk::Context *context,
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::flushOutsideRPCommands");
 
-    std::lock_guard<std::mutex> lock(mCommandQueueMutex);
     if (mFeatures.asyncCommandQueue.enabled)
     {
         ANGLE_TRY(mCommandProcessor.flushOutsideRPCommands(context, hasProtectedContent,
@@ -3184,6 +3368,7 @@ angle::Result RendererVk::flushOutsideRPCommands(vk::Context *context,
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         ANGLE_TRY(
             mCommandQueue.flushOutsideRPCommands(context, hasProtectedContent, outsideRPCommands));
     }
@@ -3195,8 +3380,6 @@ VkResult RendererVk::queuePresent(vk::Context *context,
                                   egl::ContextPriority priority,
                                   const VkPresentInfoKHR &presentInfo)
 {
-    std::lock_guard<std::mutex> lock(mCommandQueueMutex);
-
     VkResult result = VK_SUCCESS;
     if (mFeatures.asyncCommandQueue.enabled)
     {
@@ -3204,6 +3387,7 @@ VkResult RendererVk::queuePresent(vk::Context *context,
     }
     else
     {
+        std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         result = mCommandQueue.queuePresent(priority, presentInfo);
     }
 
@@ -3257,6 +3441,11 @@ void RendererVk::logCacheStats() const
     for (const CacheStats &stats : mVulkanCacheStats)
     {
         INFO() << "    CacheType " << cacheType++ << ": " << stats.getHitRatio();
+        if (stats.getHitchCount() > 0)
+        {
+            INFO() << "        Hitches: " << stats.getHitchCount()
+                   << ", worst: " << stats.getMaxHitchLatency() * 1000.0 << " ms";
+        }
     }
 }
 
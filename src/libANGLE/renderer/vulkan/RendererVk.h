@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -267,7 +268,49 @@ class RendererVk : angle::NonCopyable
         }
     }
 
+    // Small buffers are suballocated from slabs shared by the whole renderer with the
+    // suballocateSmallBuffers feature.
+    angle::Result allocateBufferSuballocation(ContextVk *contextVk,
+                                              const vk::BufferSuballocationDesc &desc,
+                                              VkDeviceSize size,
+                                              vk::BufferHelper *bufferOut);
+    void collectBufferSuballocationGarbageAndReinit(vk::SharedResourceUse *use,
+                                                    vk::BufferSlab *slab,
+                                                    VkDeviceSize offset,
+                                                    VkDeviceSize size);
+    vk::BufferSuballocatorStats getBufferSuballocatorStats()
+    {
+        std::lock_guard<std::mutex> lock(mBufferSuballocatorMutex);
+        return mBufferSuballocator.getStats();
+    }
+
+    // Images are allocated outside of VMA, so their memory is accounted for here.  The memory is
+    // considered freed as soon as the image is released.
+    void onImageMemoryAllocated(uint32_t memoryTypeIndex, VkDeviceSize size);
+    void onImageMemoryReleased(uint32_t memoryTypeIndex, VkDeviceSize size);
+    // Usage and budget of the device-local heaps, added together.
+    vk::MemoryBudget getDeviceLocalMemoryBudget() const;
+    // With unified memory, host-visible staging buffers come out of the device-local heaps too.
+    bool isStagingMemoryDeviceLocal() const { return mStagingMemoryIsDeviceLocal; }
+    // Caps the budget of every device-local heap.  Zero removes the cap.
+    void setMemoryHeapBudgetForTesting(VkDeviceSize budget)
+    {
+        mMemoryHeapBudgetForTesting = budget;
+    }
+
     angle::Result getPipelineCache(vk::PipelineCache **pipelineCache);
+    // Only created with the asyncGraphicsPipelineCreation or warmUpGraphicsPipelines features.
+    // Shared by all the contexts, as pipelines are created for the program caches rather than for a
+    // context.
+    const std::shared_ptr<angle::WorkerThreadPool> &getGraphicsPipelineThreadPool() const
+    {
+        return mGraphicsPipelineThreadPool;
+    }
+    // Only created with the parallelCommandBufferRecording feature.
+    const std::shared_ptr<angle::WorkerThreadPool> &getCommandRecordingThreadPool() const
+    {
+        return mCommandRecordingThreadPool;
+    }
     void onNewGraphicsPipeline()
     {
         std::lock_guard<std::mutex> lock(mPipelineCacheMutex);
@@ -489,6 +532,19 @@ class RendererVk : angle::NonCopyable
     std::mutex mGarbageMutex;
     vk::SharedGarbageList mSharedGarbage;
 
+    // Buffers may be created and released by contexts of different share groups concurrently.
+    std::mutex mBufferSuballocatorMutex;
+    vk::BufferSuballocator mBufferSuballocator;
+
+    // Memory of the images per memory heap.  Images are created and released by contexts of
+    // different share groups concurrently.
+    mutable std::mutex mImageMemoryMutex;
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> mImageMemorySize;
+    VkDeviceSize mMemoryHeapBudgetForTesting;
+    // VMA fetches the budget from the driver again whenever the frame index changes.
+    mutable std::atomic<uint32_t> mMemoryBudgetFetchIndex;
+    bool mStagingMemoryIsDeviceLocal;
+
     vk::MemoryProperties mMemoryProperties;
     vk::FormatTable mFormatTable;
 
@@ -524,6 +580,8 @@ class RendererVk : angle::NonCopyable
     };
     std::deque<PendingOneOffCommands> mPendingOneOffCommands;
 
+    // With asyncCommandQueue, only submissions take this lock, to queue them in the order of their
+    // serials.  The other tasks go to the command processor's lock-free queue directly.
     std::mutex mCommandQueueMutex;
     vk::CommandQueue mCommandQueue;
 
@@ -563,6 +621,12 @@ class RendererVk : angle::NonCopyable
 
     // Use thread pool to compress cache data.
     std::shared_ptr<rx::WaitableCompressEvent> mCompressEvent;
+
+    // Creates graphics pipelines that missed the cache.
+    std::shared_ptr<angle::WorkerThreadPool> mGraphicsPipelineThreadPool;
+
+    // Records chunks of large render passes when they are flushed.
+    std::shared_ptr<angle::WorkerThreadPool> mCommandRecordingThreadPool;
 };
 
 }  // namespace rx
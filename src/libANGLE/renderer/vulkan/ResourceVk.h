@@ -180,6 +180,9 @@ class Resource : angle::NonCopyable
         return mUse.isCurrentlyInUse(lastCompletedSerial);
     }
 
+    // Returns the serial of the last submission that used this resource.
+    Serial getLastUsedSerial() const { return mUse.getSerial(); }
+
     // Ensures the driver is caught up to this resource and it is only in use by ANGLE.
     angle::Result finishRunningCommands(ContextVk *contextVk);
 
@@ -8,6 +8,9 @@
 //
 
 #include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 #include "libANGLE/trace.h"
@@ -80,12 +83,18 @@ const char *GetCommandString(CommandID id)
             return "DrawIndexedInstancedBaseVertex";
         case CommandID::DrawIndexedInstancedBaseVertexBaseInstance:
             return "DrawIndexedInstancedBaseVertexBaseInstance";
+        case CommandID::DrawIndexedInstancedPacked:
+            return "DrawIndexedInstancedPacked";
         case CommandID::DrawIndirect:
             return "DrawIndirect";
         case CommandID::DrawInstanced:
             return "DrawInstanced";
         case CommandID::DrawInstancedBaseInstance:
             return "DrawInstancedBaseInstance";
+        case CommandID::DrawInstancedPacked:
+            return "DrawInstancedPacked";
+        case CommandID::DrawPacked:
+            return "DrawPacked";
         case CommandID::EndDebugUtilsLabel:
             return "EndDebugUtilsLabel";
         case CommandID::EndQuery:
@@ -130,6 +139,29 @@ const char *GetCommandString(CommandID id)
             return "--unreachable--";
     }
 }
+
+bool IsDrawCommand(CommandID id)
+{
+    switch (id)
+    {
+        case CommandID::Draw:
+        case CommandID::DrawIndexed:
+        case CommandID::DrawIndexedBaseVertex:
+        case CommandID::DrawIndexedIndirect:
+        case CommandID::DrawIndexedInstanced:
+        case CommandID::DrawIndexedInstancedBaseVertex:
+        case CommandID::DrawIndexedInstancedBaseVertexBaseInstance:
+        case CommandID::DrawIndexedInstancedPacked:
+        case CommandID::DrawIndirect:
+        case CommandID::DrawInstanced:
+        case CommandID::DrawInstancedBaseInstance:
+        case CommandID::DrawInstancedPacked:
+        case CommandID::DrawPacked:
+            return true;
+        default:
+            return false;
+    }
+}
 }  // namespace
 
 ANGLE_INLINE const CommandHeader *NextCommand(const CommandHeader *command)
@@ -138,13 +170,196 @@ ANGLE_INLINE const CommandHeader *NextCommand(const CommandHeader *command)
                                                    command->size);
 }
 
+namespace
+{
+// Whether |command| overrides all the state set by |olderCommand|, both being state cmds.
+bool OverridesStateCommand(const CommandHeader *command, const CommandHeader *olderCommand)
+{
+    if (command->id != olderCommand->id)
+    {
+        return false;
+    }
+
+    switch (command->id)
+    {
+        case CommandID::BindDescriptorSets:
+        {
+            const BindDescriptorSetParams *params =
+                Offset<BindDescriptorSetParams>(command, sizeof(CommandHeader));
+            const BindDescriptorSetParams *olderParams =
+                Offset<BindDescriptorSetParams>(olderCommand, sizeof(CommandHeader));
+            return params->pipelineBindPoint == olderParams->pipelineBindPoint &&
+                   params->firstSet == olderParams->firstSet &&
+                   params->descriptorSetCount >= olderParams->descriptorSetCount;
+        }
+        case CommandID::BindTransformFeedbackBuffers:
+        case CommandID::BindVertexBuffers:
+        {
+            // Buffers are always bound starting from binding 0.
+            const BindVertexBuffersParams *params =
+                Offset<BindVertexBuffersParams>(command, sizeof(CommandHeader));
+            const BindVertexBuffersParams *olderParams =
+                Offset<BindVertexBuffersParams>(olderCommand, sizeof(CommandHeader));
+            return params->bindingCount >= olderParams->bindingCount;
+        }
+        case CommandID::PushConstants:
+        {
+            const PushConstantsParams *params =
+                Offset<PushConstantsParams>(command, sizeof(CommandHeader));
+            const PushConstantsParams *olderParams =
+                Offset<PushConstantsParams>(olderCommand, sizeof(CommandHeader));
+            return params->flag == olderParams->flag && params->offset <= olderParams->offset &&
+                   params->offset + params->size >= olderParams->offset + olderParams->size;
+        }
+        default:
+            // Pipelines, the index buffer, the viewport and the scissor are set as a whole.
+            return true;
+    }
+}
+
+// Add |command| to the state cmds, dropping those it overrides.  The others are kept in recording
+// order, so executing them again leads to the same state.
+void UpdateStateCommands(const CommandHeader *command,
+                         std::vector<const CommandHeader *> *stateCommands)
+{
+    stateCommands->erase(std::remove_if(stateCommands->begin(), stateCommands->end(),
+                                        [command](const CommandHeader *olderCommand) {
+                                            return OverridesStateCommand(command, olderCommand);
+                                        }),
+                         stateCommands->end());
+    stateCommands->push_back(command);
+}
+
+// Copy the state cmds into a single block of cmds, terminated like any other.
+void CopyStateCommands(const std::vector<const CommandHeader *> &stateCommands,
+                       std::vector<uint8_t> *blockOut)
+{
+    size_t blockSize = sizeof(CommandHeader);
+    for (const CommandHeader *command : stateCommands)
+    {
+        blockSize += command->size;
+    }
+
+    blockOut->resize(blockSize);
+    uint8_t *writePointer = blockOut->data();
+    for (const CommandHeader *command : stateCommands)
+    {
+        memcpy(writePointer, command, command->size);
+        writePointer += command->size;
+    }
+    reinterpret_cast<CommandHeader *>(writePointer)->id = CommandID::Invalid;
+}
+}  // namespace
+
 // Parse the cmds in this cmd buffer into given primary cmd buffer
 void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeCommands");
-    for (const CommandHeader *command : mCommands)
+    executeBlocks(cmdBuffer, mCommands.data(), mCommands.size());
+}
+
+bool SecondaryCommandBuffer::splitIntoChunks(size_t maxChunkCount,
+                                             std::vector<CommandChunk> *chunksOut) const
+{
+    ASSERT(maxChunkCount > 1);
+    chunksOut->clear();
+
+    const size_t blocksPerChunk = (mCommands.size() + maxChunkCount - 1) / maxChunkCount;
+
+    // The state cmds a chunk starting at the current block depends on, in recording order.
+    std::vector<const CommandHeader *> stateCommands;
+    // The number of queries, transform feedbacks and debug labels active at the current cmd.
+    // Those have to begin and end in the same command buffer, so chunks can't start while any is
+    // active.
+    int activeScopeCount = 0;
+
+    for (size_t blockIndex = 0; blockIndex < mCommands.size(); ++blockIndex)
     {
-        for (const CommandHeader *currentCommand                      = command;
+        if (activeScopeCount == 0 &&
+            (chunksOut->empty() || blockIndex - chunksOut->back().firstBlock >= blocksPerChunk))
+        {
+            if (!chunksOut->empty())
+            {
+                chunksOut->back().blockCount = blockIndex - chunksOut->back().firstBlock;
+            }
+            chunksOut->emplace_back();
+            chunksOut->back().firstBlock = blockIndex;
+            CopyStateCommands(stateCommands, &chunksOut->back().stateCommands);
+        }
+
+        for (const CommandHeader *currentCommand                      = mCommands[blockIndex];
+             currentCommand->id != CommandID::Invalid; currentCommand = NextCommand(currentCommand))
+        {
+            switch (currentCommand->id)
+            {
+                case CommandID::BeginDebugUtilsLabel:
+                case CommandID::BeginQuery:
+                case CommandID::BeginTransformFeedback:
+                    activeScopeCount++;
+                    break;
+                case CommandID::EndDebugUtilsLabel:
+                case CommandID::EndQuery:
+                case CommandID::EndTransformFeedback:
+                    activeScopeCount--;
+                    break;
+                case CommandID::NextSubpass:
+                    // Secondary command buffers are recorded for a single subpass.
+                    chunksOut->clear();
+                    return false;
+                case CommandID::BindComputePipeline:
+                case CommandID::BindDescriptorSets:
+                case CommandID::BindGraphicsPipeline:
+                case CommandID::BindIndexBuffer:
+                case CommandID::BindTransformFeedbackBuffers:
+                case CommandID::BindVertexBuffers:
+                case CommandID::PushConstants:
+                case CommandID::SetScissor:
+                case CommandID::SetViewport:
+                    UpdateStateCommands(currentCommand, &stateCommands);
+                    break;
+                default:
+                    break;
+            }
+
+            // A scope that was begun before these cmds, or that isn't ended by them, can't be
+            // handled by separate command buffers either.
+            if (activeScopeCount < 0)
+            {
+                chunksOut->clear();
+                return false;
+            }
+        }
+    }
+
+    if (activeScopeCount != 0 || chunksOut->size() < 2)
+    {
+        chunksOut->clear();
+        return false;
+    }
+
+    chunksOut->back().blockCount = mCommands.size() - chunksOut->back().firstBlock;
+    return true;
+}
+
+void SecondaryCommandBuffer::executeChunk(VkCommandBuffer cmdBuffer,
+                                          const CommandChunk &chunk) const
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeChunk");
+    ASSERT(chunk.firstBlock + chunk.blockCount <= mCommands.size());
+
+    const CommandHeader *stateCommands =
+        reinterpret_cast<const CommandHeader *>(chunk.stateCommands.data());
+    executeBlocks(cmdBuffer, &stateCommands, 1);
+    executeBlocks(cmdBuffer, mCommands.data() + chunk.firstBlock, chunk.blockCount);
+}
+
+void SecondaryCommandBuffer::executeBlocks(VkCommandBuffer cmdBuffer,
+                                           const CommandHeader *const *blocks,
+                                           size_t blockCount) const
+{
+    for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+    {
+        for (const CommandHeader *currentCommand                      = blocks[blockIndex];
              currentCommand->id != CommandID::Invalid; currentCommand = NextCommand(currentCommand))
         {
             switch (currentCommand->id)
@@ -385,6 +600,13 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
                                      params->firstInstance);
                     break;
                 }
+                case CommandID::DrawIndexedInstancedPacked:
+                {
+                    const DrawIndexedInstancedPackedParams *params =
+                        getParamPtr<DrawIndexedInstancedPackedParams>(currentCommand);
+                    vkCmdDrawIndexed(cmdBuffer, params->indexCount, params->instanceCount, 0, 0, 0);
+                    break;
+                }
                 case CommandID::DrawIndirect:
                 {
                     const DrawIndirectParams *params =
@@ -408,6 +630,20 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
                               params->firstVertex, params->firstInstance);
                     break;
                 }
+                case CommandID::DrawInstancedPacked:
+                {
+                    const DrawInstancedPackedParams *params =
+                        getParamPtr<DrawInstancedPackedParams>(currentCommand);
+                    vkCmdDraw(cmdBuffer, params->vertexCount, params->instanceCount,
+                              params->firstVertex, 0);
+                    break;
+                }
+                case CommandID::DrawPacked:
+                {
+                    const DrawPackedParams *params = getParamPtr<DrawPackedParams>(currentCommand);
+                    vkCmdDraw(cmdBuffer, params->vertexCount, 1, params->firstVertex, 0);
+                    break;
+                }
                 case CommandID::EndDebugUtilsLabel:
                 {
                     ASSERT(vkCmdEndDebugUtilsLabelEXT);
@@ -614,6 +850,23 @@ void SecondaryCommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
     ASSERT(*usedMemoryOut <= *allocatedMemoryOut);
 }
 
+size_t SecondaryCommandBuffer::getDrawCount() const
+{
+    size_t drawCount = 0;
+    for (const CommandHeader *command : mCommands)
+    {
+        for (const CommandHeader *currentCommand                      = command;
+             currentCommand->id != CommandID::Invalid; currentCommand = NextCommand(currentCommand))
+        {
+            if (IsDrawCommand(currentCommand->id))
+            {
+                drawCount++;
+            }
+        }
+    }
+    return drawCount;
+}
+
 std::string SecondaryCommandBuffer::dumpCommands(const char *separator) const
 {
     std::stringstream result;
@@ -625,6 +878,18 @@ std::string SecondaryCommandBuffer::dumpCommands(const char *separator) const
             result << GetCommandString(currentCommand->id) << separator;
         }
     }
+
+    size_t usedMemory;
+    size_t allocatedMemory;
+    getMemoryUsageStats(&usedMemory, &allocatedMemory);
+    result << "Memory: " << usedMemory << "/" << allocatedMemory << " bytes";
+    const size_t drawCount = getDrawCount();
+    if (drawCount > 0)
+    {
+        result << ", " << usedMemory / drawCount << " bytes/draw";
+    }
+    result << separator;
+
     return result.str();
 }
 
@@ -56,9 +56,12 @@ enum class CommandID : uint16_t
     DrawIndexedInstanced,
     DrawIndexedInstancedBaseVertex,
     DrawIndexedInstancedBaseVertexBaseInstance,
+    DrawIndexedInstancedPacked,
     DrawIndirect,
     DrawInstanced,
     DrawInstancedBaseInstance,
+    DrawInstancedPacked,
+    DrawPacked,
     EndDebugUtilsLabel,
     EndQuery,
     EndTransformFeedback,
@@ -286,6 +289,13 @@ struct DrawIndexedInstancedBaseVertexBaseInstanceParams
 };
 VERIFY_4_BYTE_ALIGNMENT(DrawIndexedInstancedBaseVertexBaseInstanceParams)
 
+struct DrawIndexedInstancedPackedParams
+{
+    uint16_t indexCount;
+    uint16_t instanceCount;
+};
+VERIFY_4_BYTE_ALIGNMENT(DrawIndexedInstancedPackedParams)
+
 struct DrawIndirectParams
 {
     VkBuffer buffer;
@@ -310,6 +320,26 @@ struct DrawInstancedBaseInstanceParams
 };
 VERIFY_4_BYTE_ALIGNMENT(DrawInstancedBaseInstanceParams)
 
+struct DrawInstancedPackedParams
+{
+    uint16_t vertexCount;
+    uint16_t instanceCount;
+    uint16_t firstVertex;
+    uint16_t padding;
+};
+VERIFY_4_BYTE_ALIGNMENT(DrawInstancedPackedParams)
+
+struct DrawPackedParams
+{
+    uint16_t vertexCount;
+    uint16_t firstVertex;
+};
+VERIFY_4_BYTE_ALIGNMENT(DrawPackedParams)
+
+// The Packed variants of the draw cmds are used when all their params fit in 16 bits, which is
+// the case of most draws.
+constexpr uint32_t kMaxPackedDrawParam = std::numeric_limits<uint16_t>::max();
+
 // A special struct used with commands that don't have params
 struct EmptyParams
 {};
@@ -465,6 +495,22 @@ ANGLE_INLINE const DestT *Offset(const T *ptr, size_t bytes)
     return reinterpret_cast<const DestT *>((reinterpret_cast<const uint8_t *>(ptr) + bytes));
 }
 
+// Compare |size| bytes of cmd data, which may be null if |size| is 0.
+ANGLE_INLINE bool IsSameCommandData(const void *data, const void *otherData, size_t size)
+{
+    return size == 0 || memcmp(data, otherData, size) == 0;
+}
+
+// A range of blocks of a SecondaryCommandBuffer that can be executed in a command buffer of its
+// own.  |stateCommands| holds copies of the commands that set up the state the range starts with,
+// which are executed before the range.
+struct CommandChunk
+{
+    size_t firstBlock;
+    size_t blockCount;
+    std::vector<uint8_t> stateCommands;
+};
+
 class SecondaryCommandBuffer final : angle::NonCopyable
 {
   public:
@@ -498,8 +544,11 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                             const uint32_t *dynamicOffsets);
 
     void bindGraphicsPipeline(const Pipeline &pipeline);
+    // Records a bind of a pipeline that doesn't exist yet.  The returned handle must be filled in
+    // before the commands are executed.
+    VkPipeline *bindGraphicsPipelineDeferred();
 
-    void bindIndexBuffer(const Buffer &buffer, VkDeviceSize offset, VkIndexType indexType);
+    void bindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType);
 
     void bindTransformFeedbackBuffers(uint32_t firstBinding,
                                       uint32_t bindingCount,
@@ -680,8 +729,20 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     // Parse the cmds in this cmd buffer into given primary cmd buffer for execution
     void executeCommands(VkCommandBuffer cmdBuffer);
 
+    // Split the cmds in up to |maxChunkCount| chunks that can be executed in separate command
+    // buffers, so they can be recorded in parallel.  Chunks start at block boundaries where no
+    // query, transform feedback or debug label is active.  Returns false if the cmds can't be
+    // split in at least two chunks, e.g. because they span several subpasses.
+    bool splitIntoChunks(size_t maxChunkCount, std::vector<CommandChunk> *chunksOut) const;
+
+    // Parse the cmds of one of the chunks returned by splitIntoChunks into the given cmd buffer.
+    // Chunks of the same cmd buffer can be executed concurrently.
+    void executeChunk(VkCommandBuffer cmdBuffer, const CommandChunk &chunk) const;
+
     // Calculate memory usage of this command buffer for diagnostics.
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
+    // Count the draw cmds, to calculate the memory usage per draw for diagnostics.
+    size_t getDrawCount() const;
 
     // Traverse the list of commands and build a summary for diagnostics.
     std::string dumpCommands(const char *separator) const;
@@ -698,6 +759,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         ASSERT(allocator);
         ASSERT(mCommands.empty());
         mAllocator = allocator;
+        resetBoundState();
         allocateNewBlock();
         // Set first command to Invalid to start
         reinterpret_cast<CommandHeader *>(mCurrentWritePointer)->id = CommandID::Invalid;
@@ -729,6 +791,18 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     }
 
   private:
+    void executeBlocks(VkCommandBuffer cmdBuffer,
+                       const CommandHeader *const *blocks,
+                       size_t blockCount) const;
+
+    void resetBoundState()
+    {
+        mBoundGraphicsPipeline = nullptr;
+        mBoundDescriptorSets   = nullptr;
+        mBoundIndexBuffer      = nullptr;
+        mBoundVertexBuffers    = nullptr;
+    }
+
     void commonDebugUtilsLabel(CommandID cmd, const VkDebugUtilsLabelEXT &label);
     template <class StructType>
     ANGLE_INLINE StructType *commonInit(CommandID cmdID, size_t allocationSize)
@@ -826,10 +900,25 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     uint8_t *mCurrentWritePointer;
     size_t mCurrentBytesRemaining;
+
+    // The params of the last bind cmds recorded, so binding the same state again can be skipped.
+    // Descriptor sets are only compared with the last BindDescriptorSets cmd, whatever its
+    // pipeline bind point, as binding other sets may disturb them.
+    const BindPipelineParams *mBoundGraphicsPipeline;
+    const BindDescriptorSetParams *mBoundDescriptorSets;
+    const BindIndexBufferParams *mBoundIndexBuffer;
+    const BindVertexBuffersParams *mBoundVertexBuffers;
 };
 
 ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer()
-    : mIsOpen(true), mAllocator(nullptr), mCurrentWritePointer(nullptr), mCurrentBytesRemaining(0)
+    : mIsOpen(true),
+      mAllocator(nullptr),
+      mCurrentWritePointer(nullptr),
+      mCurrentBytesRemaining(0),
+      mBoundGraphicsPipeline(nullptr),
+      mBoundDescriptorSets(nullptr),
+      mBoundIndexBuffer(nullptr),
+      mBoundVertexBuffers(nullptr)
 {}
 
 ANGLE_INLINE SecondaryCommandBuffer::~SecondaryCommandBuffer() {}
@@ -898,9 +987,27 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorSets(const PipelineLayou
 {
     size_t descSize   = descriptorSetCount * sizeof(VkDescriptorSet);
     size_t offsetSize = dynamicOffsetCount * sizeof(uint32_t);
+
+    // Skip binding the same descriptor sets again
+    if (mBoundDescriptorSets != nullptr && mBoundDescriptorSets->layout == layout.getHandle() &&
+        mBoundDescriptorSets->pipelineBindPoint == pipelineBindPoint &&
+        mBoundDescriptorSets->firstSet == ToUnderlying(firstSet) &&
+        mBoundDescriptorSets->descriptorSetCount == descriptorSetCount &&
+        mBoundDescriptorSets->dynamicOffsetCount == dynamicOffsetCount)
+    {
+        const uint8_t *boundData =
+            Offset<uint8_t>(mBoundDescriptorSets, sizeof(BindDescriptorSetParams));
+        if (IsSameCommandData(boundData, descriptorSets, descSize) &&
+            IsSameCommandData(boundData + descSize, dynamicOffsets, offsetSize))
+        {
+            return;
+        }
+    }
+
     uint8_t *writePtr;
     BindDescriptorSetParams *paramStruct = initCommand<BindDescriptorSetParams>(
         CommandID::BindDescriptorSets, descSize + offsetSize, &writePtr);
+    mBoundDescriptorSets = paramStruct;
     // Copy params into memory
     paramStruct->layout             = layout.getHandle();
     paramStruct->pipelineBindPoint  = pipelineBindPoint;
@@ -914,20 +1021,44 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorSets(const PipelineLayou
 
 ANGLE_INLINE void SecondaryCommandBuffer::bindGraphicsPipeline(const Pipeline &pipeline)
 {
+    if (mBoundGraphicsPipeline != nullptr &&
+        mBoundGraphicsPipeline->pipeline == pipeline.getHandle())
+    {
+        return;
+    }
+
     BindPipelineParams *paramStruct =
         initCommand<BindPipelineParams>(CommandID::BindGraphicsPipeline);
-    paramStruct->pipeline = pipeline.getHandle();
+    paramStruct->pipeline  = pipeline.getHandle();
+    mBoundGraphicsPipeline = paramStruct;
 }
 
-ANGLE_INLINE void SecondaryCommandBuffer::bindIndexBuffer(const Buffer &buffer,
+ANGLE_INLINE VkPipeline *SecondaryCommandBuffer::bindGraphicsPipelineDeferred()
+{
+    BindPipelineParams *paramStruct =
+        initCommand<BindPipelineParams>(CommandID::BindGraphicsPipeline);
+    paramStruct->pipeline = VK_NULL_HANDLE;
+    // The pipeline isn't known until later, so the next bind can't be skipped.
+    mBoundGraphicsPipeline = nullptr;
+    return &paramStruct->pipeline;
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::bindIndexBuffer(VkBuffer buffer,
                                                           VkDeviceSize offset,
                                                           VkIndexType indexType)
 {
+    if (mBoundIndexBuffer != nullptr && mBoundIndexBuffer->buffer == buffer &&
+        mBoundIndexBuffer->offset == offset && mBoundIndexBuffer->indexType == indexType)
+    {
+        return;
+    }
+
     BindIndexBufferParams *paramStruct =
         initCommand<BindIndexBufferParams>(CommandID::BindIndexBuffer);
-    paramStruct->buffer    = buffer.getHandle();
+    paramStruct->buffer    = buffer;
     paramStruct->offset    = offset;
     paramStruct->indexType = indexType;
+    mBoundIndexBuffer      = paramStruct;
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::bindTransformFeedbackBuffers(uint32_t firstBinding,
@@ -958,11 +1089,25 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindVertexBuffers(uint32_t firstBindin
                                                             const VkDeviceSize *offsets)
 {
     ASSERT(firstBinding == 0);
+    size_t buffersSize = bindingCount * sizeof(VkBuffer);
+    size_t offsetsSize = bindingCount * sizeof(VkDeviceSize);
+
+    // Skip binding the same vertex buffers again
+    if (mBoundVertexBuffers != nullptr && mBoundVertexBuffers->bindingCount == bindingCount)
+    {
+        const uint8_t *boundData =
+            Offset<uint8_t>(mBoundVertexBuffers, sizeof(BindVertexBuffersParams));
+        if (IsSameCommandData(boundData, buffers, buffersSize) &&
+            IsSameCommandData(boundData + buffersSize, offsets, offsetsSize))
+        {
+            return;
+        }
+    }
+
     uint8_t *writePtr;
-    size_t buffersSize                   = bindingCount * sizeof(VkBuffer);
-    size_t offsetsSize                   = bindingCount * sizeof(VkDeviceSize);
     BindVertexBuffersParams *paramStruct = initCommand<BindVertexBuffersParams>(
         CommandID::BindVertexBuffers, buffersSize + offsetsSize, &writePtr);
+    mBoundVertexBuffers = paramStruct;
     // Copy params
     paramStruct->bindingCount = bindingCount;
     writePtr                  = storePointerParameter(writePtr, buffers, buffersSize);
@@ -1129,6 +1274,14 @@ ANGLE_INLINE void SecondaryCommandBuffer::dispatchIndirect(const Buffer &buffer,
 
 ANGLE_INLINE void SecondaryCommandBuffer::draw(uint32_t vertexCount, uint32_t firstVertex)
 {
+    if (vertexCount <= kMaxPackedDrawParam && firstVertex <= kMaxPackedDrawParam)
+    {
+        DrawPackedParams *paramStruct = initCommand<DrawPackedParams>(CommandID::DrawPacked);
+        paramStruct->vertexCount      = static_cast<uint16_t>(vertexCount);
+        paramStruct->firstVertex      = static_cast<uint16_t>(firstVertex);
+        return;
+    }
+
     DrawParams *paramStruct  = initCommand<DrawParams>(CommandID::Draw);
     paramStruct->vertexCount = vertexCount;
     paramStruct->firstVertex = firstVertex;
@@ -1164,6 +1317,15 @@ ANGLE_INLINE void SecondaryCommandBuffer::drawIndexedIndirect(const Buffer &buff
 ANGLE_INLINE void SecondaryCommandBuffer::drawIndexedInstanced(uint32_t indexCount,
                                                                uint32_t instanceCount)
 {
+    if (indexCount <= kMaxPackedDrawParam && instanceCount <= kMaxPackedDrawParam)
+    {
+        DrawIndexedInstancedPackedParams *paramStruct =
+            initCommand<DrawIndexedInstancedPackedParams>(CommandID::DrawIndexedInstancedPacked);
+        paramStruct->indexCount    = static_cast<uint16_t>(indexCount);
+        paramStruct->instanceCount = static_cast<uint16_t>(instanceCount);
+        return;
+    }
+
     DrawIndexedInstancedParams *paramStruct =
         initCommand<DrawIndexedInstancedParams>(CommandID::DrawIndexedInstanced);
     paramStruct->indexCount    = indexCount;
@@ -1217,6 +1379,18 @@ ANGLE_INLINE void SecondaryCommandBuffer::drawInstanced(uint32_t vertexCount,
                                                         uint32_t instanceCount,
                                                         uint32_t firstVertex)
 {
+    if (vertexCount <= kMaxPackedDrawParam && instanceCount <= kMaxPackedDrawParam &&
+        firstVertex <= kMaxPackedDrawParam)
+    {
+        DrawInstancedPackedParams *paramStruct =
+            initCommand<DrawInstancedPackedParams>(CommandID::DrawInstancedPacked);
+        paramStruct->vertexCount   = static_cast<uint16_t>(vertexCount);
+        paramStruct->instanceCount = static_cast<uint16_t>(instanceCount);
+        paramStruct->firstVertex   = static_cast<uint16_t>(firstVertex);
+        paramStruct->padding       = 0;
+        return;
+    }
+
     DrawInstancedParams *paramStruct = initCommand<DrawInstancedParams>(CommandID::DrawInstanced);
     paramStruct->vertexCount         = vertexCount;
     paramStruct->instanceCount       = instanceCount;
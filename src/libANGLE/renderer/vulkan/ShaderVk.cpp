@@ -24,6 +24,12 @@ ShaderVk::~ShaderVk() {}
 std::shared_ptr<WaitableCompileEvent> ShaderVk::compile(const gl::Context *context,
                                                         gl::ShCompilerInstance *compilerInstance,
                                                         ShCompileOptions options)
+{
+    return compileImpl(context, compilerInstance, mState.getSource(),
+                       getBackendCompileOptions(context) | options);
+}
+
+ShCompileOptions ShaderVk::getBackendCompileOptions(const gl::Context *context) const
 {
     ShCompileOptions compileOptions = 0;
 
@@ -106,7 +112,7 @@ std::shared_ptr<WaitableCompileEvent> ShaderVk::compile(const gl::Context *conte
         compileOptions |= SH_GENERATE_SPIRV_DIRECTLY;
     }
 
-    return compileImpl(context, compilerInstance, mState.getSource(), compileOptions | options);
+    return compileOptions;
 }
 
 std::string ShaderVk::getDebugInfo() const
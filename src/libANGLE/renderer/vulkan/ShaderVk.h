@@ -26,6 +26,9 @@ class ShaderVk : public ShaderImpl
                                                   ShCompileOptions options) override;
 
     std::string getDebugInfo() const override;
+
+    bool supportsShaderCache() const override { return true; }
+    ShCompileOptions getBackendCompileOptions(const gl::Context *context) const override;
 };
 
 }  // namespace rx
@@ -395,7 +395,9 @@ angle::Result TextureVk::setImageImpl(const gl::Context *context,
                            unpackBuffer, pixels, vkFormat);
 }
 
-bool TextureVk::isFastUnpackPossible(const vk::Format &vkFormat, size_t offset) const
+bool TextureVk::isFastUnpackPossible(const vk::Format &vkFormat,
+                                     size_t offset,
+                                     GLuint inputPixelBytes) const
 {
     // Conditions to determine if fast unpacking is possible
     // 1. Image must be well defined to unpack directly to it
@@ -406,6 +408,9 @@ bool TextureVk::isFastUnpackPossible(const vk::Format &vkFormat, size_t offset)
     // 2. Can't perform a fast copy for emulated formats, except from non-emulated depth or stencil
     //    to emulated depth/stencil.
     // 3. vkCmdCopyBufferToImage requires byte offset to be a multiple of 4
+    // 4. The pixels in the buffer must not need a conversion, such as float to half float.  The
+    //    size of the pixels is checked, as format and type are otherwise validated to match the
+    //    image.  Doesn't apply to compressed formats, where inputPixelBytes is 0.
     const angle::Format &bufferFormat = vkFormat.actualBufferFormat(false);
     const bool isCombinedDepthStencil = bufferFormat.depthBits > 0 && bufferFormat.stencilBits > 0;
     const bool isDepthXorStencil = (bufferFormat.depthBits > 0 && bufferFormat.stencilBits == 0) ||
@@ -414,7 +419,55 @@ bool TextureVk::isFastUnpackPossible(const vk::Format &vkFormat, size_t offset)
     return mImage->valid() && !isCombinedDepthStencil &&
            (vkFormat.intendedFormatID == vkFormat.actualImageFormatID ||
             (isDepthXorStencil && isCompatibleDepth)) &&
-           (offset & (kBufferOffsetMultiple - 1)) == 0;
+           (offset & (kBufferOffsetMultiple - 1)) == 0 &&
+           (inputPixelBytes == 0 || inputPixelBytes == bufferFormat.pixelBytes);
+}
+
+bool TextureVk::isComputeUnpackPossible(ContextVk *contextVk,
+                                        const vk::Format &vkFormat,
+                                        const gl::InternalFormat &formatInfo,
+                                        GLenum type,
+                                        const gl::ImageIndex &index,
+                                        const gl::Box &area,
+                                        size_t offset,
+                                        GLuint inputRowPitch,
+                                        UtilsVk::ConvertPixelsParameters *paramsOut) const
+{
+    // Conditions to determine if unpacking with a format conversion in compute is possible
+    // 1. Image must be well defined to unpack directly to it
+    // 2. Only a single 2D slice is converted at a time
+    // 3. The formats, offset and pitch must be supported by UtilsVk::convertPixels()
+    if (!contextVk->getFeatures().convertPixelsWithCompute.enabled || !mImage->valid() ||
+        formatInfo.compressed || area.depth != 1 || index.usesTex3D())
+    {
+        return false;
+    }
+
+    const GLenum srcInternalFormat =
+        gl::GetInternalFormatInfo(formatInfo.format, type).sizedInternalFormat;
+    const angle::Format &srcFormat =
+        angle::Format::Get(angle::Format::InternalFormatToID(srcInternalFormat));
+    const angle::Format &destFormat = vkFormat.actualImageFormat();
+
+    // The converted rows are 4-byte aligned, and must still be made of whole pixels for
+    // vkCmdCopyBufferToImage.
+    const uint32_t destPitch = roundUpPow2<uint32_t>(area.width * destFormat.pixelBytes, 4);
+    if (destPitch % destFormat.pixelBytes != 0)
+    {
+        return false;
+    }
+
+    paramsOut->srcFormat       = &srcFormat;
+    paramsOut->destFormat      = &destFormat;
+    paramsOut->width           = area.width;
+    paramsOut->height          = area.height;
+    paramsOut->srcOffset       = offset;
+    paramsOut->srcPitch        = inputRowPitch;
+    paramsOut->destOffset      = 0;
+    paramsOut->destPitch       = destPitch;
+    paramsOut->reverseRowOrder = false;
+
+    return UtilsVk::CanConvertPixels(*paramsOut);
 }
 
 bool TextureVk::shouldUpdateBeStaged(gl::LevelIndex textureLevelIndexGL) const
@@ -478,8 +531,12 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
         // to be packed, while Vulkan requires them to be separate.
         const VkImageAspectFlags aspectFlags = vk::GetFormatAspectFlags(vkFormat.intendedFormat());
 
-        if (!shouldUpdateBeStaged(gl::LevelIndex(index.getLevelIndex())) &&
-            isFastUnpackPossible(vkFormat, offsetBytes))
+        const bool isUpdateStaged = shouldUpdateBeStaged(gl::LevelIndex(index.getLevelIndex()));
+        const GLuint inputPixelBytes =
+            formatInfo.compressed ? 0 : formatInfo.computePixelBytes(type);
+        UtilsVk::ConvertPixelsParameters convertParams;
+
+        if (!isUpdateStaged && isFastUnpackPossible(vkFormat, offsetBytes, inputPixelBytes))
         {
             GLuint pixelSize   = formatInfo.pixelBytes;
             GLuint blockWidth  = formatInfo.compressedBlockWidth;
@@ -498,6 +555,13 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
             ANGLE_TRY(copyBufferDataToImage(contextVk, &bufferHelper, index, rowLengthPixels,
                                             imageHeightPixels, area, offsetBytes, aspectFlags));
         }
+        else if (!isUpdateStaged &&
+                 isComputeUnpackPossible(contextVk, vkFormat, formatInfo, type, index, area,
+                                         offsetBytes, inputRowPitch, &convertParams))
+        {
+            ANGLE_TRY(
+                convertBufferDataToImage(contextVk, &bufferHelper, index, area, convertParams));
+        }
         else
         {
             ANGLE_PERF_WARNING(contextVk->getDebug(), GL_DEBUG_SEVERITY_HIGH,
@@ -515,17 +579,18 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
                 contextVk, getNativeImageIndex(index),
                 gl::Extents(area.width, area.height, area.depth),
                 gl::Offset(area.x, area.y, area.z), formatInfo, unpack, stagingBuffer, type, source,
-                vkFormat, inputRowPitch, inputDepthPitch, inputSkipBytes));
+                vkFormat, inputRowPitch, inputDepthPitch, inputSkipBytes,
+                context->getWorkerThreadPool()));
 
             ANGLE_TRY(unpackBufferVk->unmapImpl(contextVk));
         }
     }
     else if (pixels)
     {
-        ANGLE_TRY(mImage->stageSubresourceUpdate(contextVk, getNativeImageIndex(index),
-                                                 gl::Extents(area.width, area.height, area.depth),
-                                                 gl::Offset(area.x, area.y, area.z), formatInfo,
-                                                 unpack, stagingBuffer, type, pixels, vkFormat));
+        ANGLE_TRY(mImage->stageSubresourceUpdate(
+            contextVk, getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
+            gl::Offset(area.x, area.y, area.z), formatInfo, unpack, stagingBuffer, type, pixels,
+            vkFormat, context->getWorkerThreadPool()));
     }
 
     // If we used context's staging buffer, flush out the updates
@@ -1709,6 +1774,38 @@ angle::Result TextureVk::copyBufferDataToImage(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result TextureVk::convertBufferDataToImage(ContextVk *contextVk,
+                                                  vk::BufferHelper *srcBuffer,
+                                                  const gl::ImageIndex index,
+                                                  const gl::Box &sourceArea,
+                                                  const UtilsVk::ConvertPixelsParameters &params)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "TextureVk::convertBufferDataToImage");
+
+    // Convert the pixels into a temporary buffer, which is then copied to the image.
+    vk::RendererScoped<vk::BufferHelper> convertBuffer(contextVk->getRenderer());
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.flags              = 0;
+    bufferInfo.size               = static_cast<VkDeviceSize>(params.destPitch) * params.height;
+    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    bufferInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    bufferInfo.queueFamilyIndexCount = 0;
+    bufferInfo.pQueueFamilyIndices   = nullptr;
+
+    ANGLE_TRY(
+        convertBuffer.get().init(contextVk, bufferInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+    convertBuffer.get().retain(&contextVk->getResourceUseList());
+
+    ANGLE_TRY(
+        contextVk->getUtils().convertPixels(contextVk, &convertBuffer.get(), srcBuffer, params));
+
+    return copyBufferDataToImage(contextVk, &convertBuffer.get(), index,
+                                 params.destPitch / params.destFormat->pixelBytes, params.height,
+                                 sourceArea, 0, VK_IMAGE_ASPECT_COLOR_BIT);
+}
+
 angle::Result TextureVk::generateMipmapsWithCompute(ContextVk *contextVk)
 {
     RendererVk *renderer = contextVk->getRenderer();
@@ -2885,6 +2982,55 @@ void TextureVk::releaseImage(ContextVk *contextVk)
     mRedefinedLevels.reset();
 }
 
+bool TextureVk::canEvictImage(Serial lastCompletedSerial) const
+{
+    if (!mOwnsImage || mImage == nullptr || !mImage->valid() || mImage->getAllocationSize() == 0)
+    {
+        return false;
+    }
+
+    // Images that are rendered to or written by shaders are likely to be used again soon.
+    if (mState.hasBeenBoundAsImage() || !mMultiLayerRenderTargets.empty())
+    {
+        return false;
+    }
+    for (const std::vector<RenderTargetVector> &renderTargets : mSingleLayerRenderTargets)
+    {
+        if (!renderTargets.empty())
+        {
+            return false;
+        }
+    }
+    for (const vk::ImageHelper &image : mMultisampledImages)
+    {
+        if (image.valid())
+        {
+            return false;
+        }
+    }
+
+    // Block-compressed and depth/stencil formats cannot be round-tripped through a tightly packed
+    // buffer as simply.
+    const angle::Format &format = mImage->getFormat().actualImageFormat();
+    if (format.isBlock || format.hasDepthOrStencilBits())
+    {
+        return false;
+    }
+
+    return !mImage->hasStagedUpdatesInAllocatedLevels() &&
+           mImage->getLastUsedSerial().valid() && !mImage->isCurrentlyInUse(lastCompletedSerial);
+}
+
+angle::Result TextureVk::evictImage(ContextVk *contextVk)
+{
+    ASSERT(canEvictImage(contextVk->getLastCompletedQueueSerial()));
+
+    ANGLE_TRY(mImage->stageSelfToHostMemory(contextVk));
+    releaseImage(contextVk);
+
+    return angle::Result::Continue;
+}
+
 void TextureVk::releaseStagingBuffer(ContextVk *contextVk)
 {
     if (mImage)
@@ -14,6 +14,7 @@
 #include "libANGLE/renderer/vulkan/RenderTargetVk.h"
 #include "libANGLE/renderer/vulkan/ResourceVk.h"
 #include "libANGLE/renderer/vulkan/SamplerVk.h"
+#include "libANGLE/renderer/vulkan/UtilsVk.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
 namespace rx
@@ -209,6 +210,13 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
 
     void releaseOwnershipOfImage(const gl::Context *context);
 
+    // Whether the image is idle, not used as an attachment or storage image, and can be evicted
+    // with evictImage().
+    bool canEvictImage(Serial lastCompletedSerial) const;
+    // Copy the image contents to host memory and release the image to free its device memory.
+    // The image is recreated from the copy on next use.
+    angle::Result evictImage(ContextVk *contextVk);
+
     const vk::ImageView &getReadImageViewAndRecordUse(ContextVk *contextVk,
                                                       GLenum srgbDecode,
                                                       bool texelFetchStaticUse) const;
@@ -352,6 +360,14 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
                                         size_t offset,
                                         VkImageAspectFlags aspectFlags);
 
+    // Converts the pixels of |srcBuffer| to the format of the image with a compute shader, and
+    // copies them to the image.
+    angle::Result convertBufferDataToImage(ContextVk *contextVk,
+                                           vk::BufferHelper *srcBuffer,
+                                           const gl::ImageIndex index,
+                                           const gl::Box &sourceArea,
+                                           const UtilsVk::ConvertPixelsParameters &params);
+
     // Called from syncState to prepare the image for mipmap generation.
     void prepareForGenerateMipmap(ContextVk *contextVk);
 
@@ -464,7 +480,18 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
                                       bool baseLevelChanged,
                                       bool maxLevelChanged);
 
-    bool isFastUnpackPossible(const vk::Format &vkFormat, size_t offset) const;
+    bool isFastUnpackPossible(const vk::Format &vkFormat,
+                              size_t offset,
+                              GLuint inputPixelBytes) const;
+    bool isComputeUnpackPossible(ContextVk *contextVk,
+                                 const vk::Format &vkFormat,
+                                 const gl::InternalFormat &formatInfo,
+                                 GLenum type,
+                                 const gl::ImageIndex &index,
+                                 const gl::Box &area,
+                                 size_t offset,
+                                 GLuint inputRowPitch,
+                                 UtilsVk::ConvertPixelsParameters *paramsOut) const;
 
     bool shouldUpdateBeStaged(gl::LevelIndex textureLevelIndexGL) const;
 
@@ -23,6 +23,7 @@ namespace rx
 {
 
 namespace ConvertVertex_comp                = vk::InternalShader::ConvertVertex_comp;
+namespace ConvertPixels_comp                = vk::InternalShader::ConvertPixels_comp;
 namespace ImageClear_frag                   = vk::InternalShader::ImageClear_frag;
 namespace ImageCopy_frag                    = vk::InternalShader::ImageCopy_frag;
 namespace BlitResolve_frag                  = vk::InternalShader::BlitResolve_frag;
@@ -41,6 +42,9 @@ constexpr uint32_t kConvertIndexDestinationBinding = 0;
 constexpr uint32_t kConvertVertexDestinationBinding = 0;
 constexpr uint32_t kConvertVertexSourceBinding      = 1;
 
+constexpr uint32_t kConvertPixelsDestinationBinding = 0;
+constexpr uint32_t kConvertPixelsSourceBinding      = 1;
+
 constexpr uint32_t kImageCopySourceBinding = 0;
 
 constexpr uint32_t kBlitResolveColorOrDepthBinding = 0;
@@ -74,6 +78,93 @@ bool ValidateFloatOneAsUint()
     return one.asFloat == 1.0f;
 }
 
+// Layout of the pixels of a format, as understood by ConvertPixels.comp.  The shift and size of
+// each RGBA channel is in bits, and a size of 0 means the channel is not present.
+struct ConvertPixelsFormatLayout
+{
+    uint32_t channelShift[4];
+    uint32_t channelBits[4];
+    bool isFloat;
+};
+
+bool GetConvertPixelsFormatLayout(angle::FormatID formatID, ConvertPixelsFormatLayout *layoutOut)
+{
+    switch (formatID)
+    {
+        case angle::FormatID::R8_UNORM:
+            *layoutOut = {{0, 0, 0, 0}, {8, 0, 0, 0}, false};
+            return true;
+        case angle::FormatID::R8G8_UNORM:
+            *layoutOut = {{0, 8, 0, 0}, {8, 8, 0, 0}, false};
+            return true;
+        case angle::FormatID::R8G8B8_UNORM:
+            *layoutOut = {{0, 8, 16, 0}, {8, 8, 8, 0}, false};
+            return true;
+        case angle::FormatID::R8G8B8A8_UNORM:
+            *layoutOut = {{0, 8, 16, 24}, {8, 8, 8, 8}, false};
+            return true;
+        case angle::FormatID::B8G8R8A8_UNORM:
+            *layoutOut = {{16, 8, 0, 24}, {8, 8, 8, 8}, false};
+            return true;
+        case angle::FormatID::R5G6B5_UNORM:
+            *layoutOut = {{11, 5, 0, 0}, {5, 6, 5, 0}, false};
+            return true;
+        case angle::FormatID::R4G4B4A4_UNORM:
+            *layoutOut = {{12, 8, 4, 0}, {4, 4, 4, 4}, false};
+            return true;
+        case angle::FormatID::R5G5B5A1_UNORM:
+            *layoutOut = {{11, 6, 1, 0}, {5, 5, 5, 1}, false};
+            return true;
+        case angle::FormatID::R16_FLOAT:
+            *layoutOut = {{0, 0, 0, 0}, {16, 0, 0, 0}, true};
+            return true;
+        case angle::FormatID::R16G16_FLOAT:
+            *layoutOut = {{0, 16, 0, 0}, {16, 16, 0, 0}, true};
+            return true;
+        case angle::FormatID::R16G16B16_FLOAT:
+            *layoutOut = {{0, 16, 32, 0}, {16, 16, 16, 0}, true};
+            return true;
+        case angle::FormatID::R16G16B16A16_FLOAT:
+            *layoutOut = {{0, 16, 32, 48}, {16, 16, 16, 16}, true};
+            return true;
+        case angle::FormatID::R32_FLOAT:
+            *layoutOut = {{0, 0, 0, 0}, {32, 0, 0, 0}, true};
+            return true;
+        case angle::FormatID::R32G32_FLOAT:
+            *layoutOut = {{0, 32, 0, 0}, {32, 32, 0, 0}, true};
+            return true;
+        case angle::FormatID::R32G32B32_FLOAT:
+            *layoutOut = {{0, 32, 64, 0}, {32, 32, 32, 0}, true};
+            return true;
+        case angle::FormatID::R32G32B32A32_FLOAT:
+            *layoutOut = {{0, 32, 64, 96}, {32, 32, 32, 32}, true};
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The alignment the shader needs for the offset and pitch of the source.  The channels must not
+// cross a 4-byte boundary, so for example a 16-bit channel must be 2-byte aligned.
+uint32_t GetConvertPixelsSourceAlignment(const ConvertPixelsFormatLayout &layout,
+                                         uint32_t pixelBytes)
+{
+    uint32_t alignment = 4;
+    for (uint32_t bits : layout.channelBits)
+    {
+        if (bits % 8 != 0)
+        {
+            // The channels of packed formats are anywhere within the pixel.
+            return pixelBytes;
+        }
+        if (bits != 0)
+        {
+            alignment = std::min(alignment, bits / 8);
+        }
+    }
+    return alignment;
+}
+
 uint32_t GetConvertVertexFlags(const UtilsVk::ConvertVertexParameters &params)
 {
     bool srcIsSint      = params.srcFormat->isSint();
@@ -1010,6 +1101,8 @@ const uint32_t UtilsVk::kGenerateMipmapMaxLevels;
 
 UtilsVk::ConvertVertexShaderParams::ConvertVertexShaderParams() = default;
 
+UtilsVk::ConvertPixelsShaderParams::ConvertPixelsShaderParams() = default;
+
 UtilsVk::ImageCopyShaderParams::ImageCopyShaderParams() = default;
 
 uint32_t UtilsVk::GetGenerateMipmapMaxLevels(ContextVk *contextVk)
@@ -1030,6 +1123,32 @@ uint32_t UtilsVk::GetGenerateMipmapMaxLevels(ContextVk *contextVk)
                : kGenerateMipmapMaxLevels;
 }
 
+bool UtilsVk::CanConvertPixels(const ConvertPixelsParameters &params)
+{
+    ConvertPixelsFormatLayout srcLayout;
+    ConvertPixelsFormatLayout destLayout;
+    if (!GetConvertPixelsFormatLayout(params.srcFormat->id, &srcLayout) ||
+        !GetConvertPixelsFormatLayout(params.destFormat->id, &destLayout))
+    {
+        return false;
+    }
+
+    const uint32_t srcAlignment =
+        GetConvertPixelsSourceAlignment(srcLayout, params.srcFormat->pixelBytes);
+    const bool isSrcAligned =
+        params.srcOffset % srcAlignment == 0 && params.srcPitch % srcAlignment == 0;
+    const bool isDestAligned = params.destOffset % 4 == 0 && params.destPitch % 4 == 0;
+
+    // The shader calculates the offsets in 32 bits.
+    const size_t srcEnd = params.srcOffset + static_cast<size_t>(params.srcPitch) * params.height;
+    const size_t destEnd =
+        params.destOffset + static_cast<size_t>(params.destPitch) * params.height;
+    const bool fitsInUint32 = srcEnd <= std::numeric_limits<uint32_t>::max() &&
+                              destEnd <= std::numeric_limits<uint32_t>::max();
+
+    return isSrcAligned && isDestAligned && fitsInUint32;
+}
+
 UtilsVk::UtilsVk() : mPerfCounters{}, mCumulativePerfCounters{} {}
 
 UtilsVk::~UtilsVk() = default;
@@ -1066,6 +1185,10 @@ void UtilsVk::destroy(RendererVk *renderer)
     {
         program.destroy(renderer);
     }
+    for (vk::ShaderProgramHelper &program : mConvertPixelsPrograms)
+    {
+        program.destroy(renderer);
+    }
     mImageClearProgramVSOnly.destroy(renderer);
     for (vk::ShaderProgramHelper &program : mImageClearProgram)
     {
@@ -1268,6 +1391,22 @@ angle::Result UtilsVk::ensureConvertVertexResourcesInitialized(ContextVk *contex
                                       ArraySize(setSizes), sizeof(ConvertVertexShaderParams));
 }
 
+angle::Result UtilsVk::ensureConvertPixelsResourcesInitialized(ContextVk *contextVk)
+{
+    if (mPipelineLayouts[Function::ConvertPixels].valid())
+    {
+        return angle::Result::Continue;
+    }
+
+    VkDescriptorPoolSize setSizes[2] = {
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+    };
+
+    return ensureResourcesInitialized(contextVk, Function::ConvertPixels, setSizes,
+                                      ArraySize(setSizes), sizeof(ConvertPixelsShaderParams));
+}
+
 angle::Result UtilsVk::ensureImageClearResourcesInitialized(ContextVk *contextVk)
 {
     if (mPipelineLayouts[Function::ImageClear].valid())
@@ -1491,6 +1630,7 @@ angle::Result UtilsVk::setupProgram(ContextVk *contextVk,
             contextVk, &contextVk->getRenderPassCache(), *pipelineCache, pipelineLayout.get(),
             *pipelineDesc, gl::AttributesMask(), gl::ComponentTypeMask(), &descPtr, &helper));
         helper->updateSerial(serial);
+        ANGLE_VK_TRY(contextVk, helper->finishCreation());
         commandBuffer->bindGraphicsPipeline(helper->getPipeline());
 
         contextVk->invalidateGraphicsPipelineBinding();
@@ -1930,6 +2070,87 @@ angle::Result UtilsVk::convertVertexBufferImpl(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result UtilsVk::convertPixels(ContextVk *contextVk,
+                                     vk::BufferHelper *dest,
+                                     vk::BufferHelper *src,
+                                     const ConvertPixelsParameters &params)
+{
+    ASSERT(CanConvertPixels(params));
+
+    ANGLE_TRY(ensureConvertPixelsResourcesInitialized(contextVk));
+
+    vk::CommandBufferAccess access;
+    access.onBufferComputeShaderRead(src);
+    access.onBufferComputeShaderWrite(dest);
+
+    vk::CommandBuffer *commandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+
+    ConvertPixelsFormatLayout srcLayout;
+    ConvertPixelsFormatLayout destLayout;
+    GetConvertPixelsFormatLayout(params.srcFormat->id, &srcLayout);
+    GetConvertPixelsFormatLayout(params.destFormat->id, &destLayout);
+
+    ConvertPixelsShaderParams shaderParams;
+    for (size_t channel = 0; channel < 4; ++channel)
+    {
+        shaderParams.srcChannelShift[channel]  = srcLayout.channelShift[channel];
+        shaderParams.srcChannelBits[channel]   = srcLayout.channelBits[channel];
+        shaderParams.destChannelShift[channel] = destLayout.channelShift[channel];
+        shaderParams.destChannelBits[channel]  = destLayout.channelBits[channel];
+    }
+    shaderParams.srcOffset      = static_cast<uint32_t>(params.srcOffset);
+    shaderParams.srcPitch       = params.srcPitch;
+    shaderParams.destOffset     = static_cast<uint32_t>(params.destOffset);
+    shaderParams.destPitch      = params.destPitch;
+    shaderParams.srcPixelBytes  = params.srcFormat->pixelBytes;
+    shaderParams.destPixelBytes = params.destFormat->pixelBytes;
+    shaderParams.width          = params.width;
+    shaderParams.height         = params.height;
+    // Each invocation of the shader outputs one 4-byte value of a row.
+    shaderParams.outputsPerRow = UnsignedCeilDivide(params.width * shaderParams.destPixelBytes, 4);
+    shaderParams.reverseRowOrder = params.reverseRowOrder;
+
+    uint32_t flags = 0;
+    flags |= srcLayout.isFloat ? ConvertPixels_comp::kSrcIsFloat : 0;
+    flags |= destLayout.isFloat ? ConvertPixels_comp::kDestIsFloat : 0;
+
+    VkDescriptorSet descriptorSet;
+    vk::RefCountedDescriptorPoolBinding descriptorPoolBinding;
+    ANGLE_TRY(allocateDescriptorSet(contextVk, Function::ConvertPixels, &descriptorPoolBinding,
+                                    &descriptorSet));
+
+    VkWriteDescriptorSet writeInfo    = {};
+    VkDescriptorBufferInfo buffers[2] = {
+        {dest->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
+        {src->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
+    };
+    static_assert(kConvertPixelsDestinationBinding + 1 == kConvertPixelsSourceBinding,
+                  "Update write info");
+
+    writeInfo.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeInfo.dstSet          = descriptorSet;
+    writeInfo.dstBinding      = kConvertPixelsDestinationBinding;
+    writeInfo.descriptorCount = 2;
+    writeInfo.descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writeInfo.pBufferInfo     = buffers;
+
+    vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfo, 0, nullptr);
+
+    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+    ANGLE_TRY(contextVk->getShaderLibrary().getConvertPixels_comp(contextVk, flags, &shader));
+
+    ANGLE_TRY(setupProgram(contextVk, Function::ConvertPixels, shader, nullptr,
+                           &mConvertPixelsPrograms[flags], nullptr, descriptorSet, &shaderParams,
+                           sizeof(shaderParams), commandBuffer));
+
+    commandBuffer->dispatch(UnsignedCeilDivide(shaderParams.outputsPerRow, 64), params.height, 1);
+
+    descriptorPoolBinding.reset();
+
+    return angle::Result::Continue;
+}
+
 angle::Result UtilsVk::startRenderPass(ContextVk *contextVk,
                                        vk::ImageHelper *image,
                                        const vk::ImageView *imageView,
@@ -12,6 +12,9 @@
 //    - Convert vertex buffer:
 //      * Used by VertexArrayVk::convertVertexBufferGPU() to convert vertex attributes from
 //        unsupported formats to their fallbacks.
+//    - Convert pixels:
+//      * Used by ImageHelper::readPixels() and TextureVk::setSubImageImpl() to convert pixels
+//        between the image format and the format of a pixel pack or unpack buffer.
 //    - Image clear: Used by FramebufferVk::clearWithDraw().
 //    - Image copy: Used by TextureVk::copySubImageImplWithDraw().
 //    - Image copy bits: Used by ImageHelper::CopyImageSubData() to perform bitwise copies between
@@ -90,6 +93,19 @@ class UtilsVk : angle::NonCopyable
         size_t destOffset;
     };
 
+    struct ConvertPixelsParameters
+    {
+        const angle::Format *srcFormat;
+        const angle::Format *destFormat;
+        uint32_t width;
+        uint32_t height;
+        size_t srcOffset;
+        uint32_t srcPitch;
+        size_t destOffset;
+        uint32_t destPitch;
+        bool reverseRowOrder;
+    };
+
     struct ClearFramebufferParameters
     {
         // Satisfy chromium-style with a constructor that does what = {} was already doing in a
@@ -190,6 +206,11 @@ class UtilsVk : angle::NonCopyable
     static constexpr uint32_t kGenerateMipmapMaxLevels = 6;
     static uint32_t GetGenerateMipmapMaxLevels(ContextVk *contextVk);
 
+    // Whether convertPixels() supports the formats, offsets and pitches of |params|.  The
+    // destination rows are written in 4-byte units, so any padding at the end of a row may be
+    // overwritten.
+    static bool CanConvertPixels(const ConvertPixelsParameters &params);
+
     angle::Result convertIndexBuffer(ContextVk *contextVk,
                                      vk::BufferHelper *dest,
                                      vk::BufferHelper *src,
@@ -221,6 +242,11 @@ class UtilsVk : angle::NonCopyable
                                       vk::BufferHelper *src,
                                       const ConvertVertexParameters &params);
 
+    angle::Result convertPixels(ContextVk *contextVk,
+                                vk::BufferHelper *dest,
+                                vk::BufferHelper *src,
+                                const ConvertPixelsParameters &params);
+
     angle::Result clearFramebuffer(ContextVk *contextVk,
                                    FramebufferVk *framebuffer,
                                    const ClearFramebufferParameters &params);
@@ -348,6 +374,27 @@ class UtilsVk : angle::NonCopyable
         uint32_t _padding         = 0;
     };
 
+    struct ConvertPixelsShaderParams
+    {
+        ConvertPixelsShaderParams();
+
+        // Structure matching PushConstants in ConvertPixels.comp
+        uint32_t srcChannelShift[4]  = {};
+        uint32_t srcChannelBits[4]   = {};
+        uint32_t destChannelShift[4] = {};
+        uint32_t destChannelBits[4]  = {};
+        uint32_t srcOffset           = 0;
+        uint32_t srcPitch            = 0;
+        uint32_t destOffset          = 0;
+        uint32_t destPitch           = 0;
+        uint32_t srcPixelBytes       = 0;
+        uint32_t destPixelBytes      = 0;
+        uint32_t width               = 0;
+        uint32_t height              = 0;
+        uint32_t outputsPerRow       = 0;
+        uint32_t reverseRowOrder     = 0;
+    };
+
     struct ImageClearShaderParams
     {
         // Structure matching PushConstants in ImageClear.frag
@@ -459,9 +506,10 @@ class UtilsVk : angle::NonCopyable
         ConvertIndexIndirectLineLoopBuffer = 19,
         ConvertIndirectLineLoopBuffer      = 20,
         GenerateMipmap                     = 21,
+        ConvertPixels                      = 22,
 
-        InvalidEnum = 22,
-        EnumCount   = 22,
+        InvalidEnum = 23,
+        EnumCount   = 23,
     };
 
     // Common function that creates the pipeline for the specified function, binds it and prepares
@@ -498,6 +546,7 @@ class UtilsVk : angle::NonCopyable
     angle::Result ensureConvertIndexIndirectLineLoopResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureConvertIndirectLineLoopResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureConvertVertexResourcesInitialized(ContextVk *contextVk);
+    angle::Result ensureConvertPixelsResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureImageClearResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureImageCopyResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureBlitResolveResourcesInitialized(ContextVk *contextVk);
@@ -554,6 +603,8 @@ class UtilsVk : angle::NonCopyable
         [vk::InternalShader::ConvertIndirectLineLoop_comp::kArrayLen];
     vk::ShaderProgramHelper
         mConvertVertexPrograms[vk::InternalShader::ConvertVertex_comp::kArrayLen];
+    vk::ShaderProgramHelper
+        mConvertPixelsPrograms[vk::InternalShader::ConvertPixels_comp::kArrayLen];
     vk::ShaderProgramHelper mImageClearProgramVSOnly;
     vk::ShaderProgramHelper mImageClearProgram[vk::InternalShader::ImageClear_frag::kArrayLen];
     vk::ShaderProgramHelper mImageCopyPrograms[vk::InternalShader::ImageCopy_frag::kArrayLen];
@@ -24,7 +24,6 @@ namespace rx
 {
 namespace
 {
-constexpr size_t kDynamicVertexDataSize   = 1024 * 1024;
 constexpr size_t kDynamicIndexDataSize    = 1024 * 8;
 constexpr size_t kDynamicIndirectDataSize = sizeof(VkDrawIndexedIndirectCommand) * 8;
 
@@ -74,25 +73,22 @@ angle::Result WarnOnVertexFormatConversion(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
-angle::Result StreamVertexData(ContextVk *contextVk,
-                               vk::DynamicBuffer *dynamicBuffer,
-                               const uint8_t *sourceData,
-                               size_t bytesToAllocate,
-                               size_t destOffset,
-                               size_t vertexCount,
-                               size_t sourceStride,
-                               size_t destStride,
-                               VertexCopyFunction vertexLoadFunction,
-                               vk::BufferHelper **bufferOut,
-                               VkDeviceSize *bufferOffsetOut,
-                               uint32_t replicateCount)
+void LoadVertexData(const uint8_t *sourceData,
+                    size_t bytesToLoad,
+                    size_t vertexCount,
+                    size_t sourceStride,
+                    size_t destStride,
+                    bool loadRequiresConversion,
+                    VertexCopyFunction vertexLoadFunction,
+                    uint32_t replicateCount,
+                    uint8_t *dst)
 {
-    uint8_t *dst = nullptr;
-    ANGLE_TRY(dynamicBuffer->allocate(contextVk, bytesToAllocate, &dst, nullptr, bufferOffsetOut,
-                                      nullptr));
-    *bufferOut = dynamicBuffer->getCurrentBuffer();
-    dst += destOffset;
-    if (replicateCount == 1)
+    if (replicateCount == 1 && !loadRequiresConversion && sourceStride == destStride)
+    {
+        // Tightly packed data that needs no conversion is a single copy.
+        vk::CopyToWriteCombinedMemory(dst, sourceData, vertexCount * destStride);
+    }
+    else if (replicateCount == 1)
     {
         vertexLoadFunction(sourceData, sourceStride, vertexCount, dst);
     }
@@ -100,7 +96,7 @@ angle::Result StreamVertexData(ContextVk *contextVk,
     {
         ASSERT(replicateCount > 1);
         uint32_t sourceRemainingCount = replicateCount - 1;
-        for (size_t dataCopied = 0; dataCopied < bytesToAllocate;
+        for (size_t dataCopied = 0; dataCopied < bytesToLoad;
              dataCopied += destStride, dst += destStride, sourceRemainingCount--)
         {
             vertexLoadFunction(sourceData, sourceStride, 1, dst);
@@ -111,8 +107,27 @@ angle::Result StreamVertexData(ContextVk *contextVk,
             }
         }
     }
+}
 
-    ANGLE_TRY(dynamicBuffer->flush(contextVk));
+// Streams vertex data for a single draw through the context's streaming buffer.
+angle::Result StreamVertexData(ContextVk *contextVk,
+                               const uint8_t *sourceData,
+                               size_t bytesToAllocate,
+                               size_t destOffset,
+                               size_t vertexCount,
+                               size_t sourceStride,
+                               size_t destStride,
+                               bool loadRequiresConversion,
+                               VertexCopyFunction vertexLoadFunction,
+                               vk::BufferHelper **bufferOut,
+                               VkDeviceSize *bufferOffsetOut,
+                               uint32_t replicateCount)
+{
+    uint8_t *dst = nullptr;
+    ANGLE_TRY(contextVk->getStreamingBuffer()->allocate(contextVk, bytesToAllocate, &dst,
+                                                        bufferOut, bufferOffsetOut));
+    LoadVertexData(sourceData, bytesToAllocate - destOffset, vertexCount, sourceStride, destStride,
+                   loadRequiresConversion, vertexLoadFunction, replicateCount, dst + destOffset);
     return angle::Result::Continue;
 }
 
@@ -143,6 +158,7 @@ VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &s
       mCurrentArrayBuffers{},
       mCurrentElementArrayBufferOffset(0),
       mCurrentElementArrayBuffer(nullptr),
+      mCurrentElementArrayBufferHandle(VK_NULL_HANDLE),
       mLineLoopHelper(contextVk->getRenderer()),
       mDirtyLineLoopTranslation(true)
 {
@@ -154,13 +170,8 @@ VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &s
     mCurrentArrayBufferRelativeOffsets.fill(0);
     mCurrentArrayBuffers.fill(&emptyBuffer);
 
-    mDynamicVertexData.init(renderer, vk::kVertexBufferUsageFlags, vk::kVertexBufferAlignment,
-                            kDynamicVertexDataSize, true, vk::DynamicBufferPolicy::OneShotUse);
-
     // We use an alignment of four for index data. This ensures that compute shaders can read index
     // elements from "uint" aligned addresses.
-    mDynamicIndexData.init(renderer, vk::kIndexBufferUsageFlags, vk::kIndexBufferAlignment,
-                           kDynamicIndexDataSize, true, vk::DynamicBufferPolicy::OneShotUse);
     mTranslatedByteIndexData.init(renderer, vk::kIndexBufferUsageFlags, vk::kIndexBufferAlignment,
                                   kDynamicIndexDataSize, true, vk::DynamicBufferPolicy::OneShotUse);
     mTranslatedByteIndirectData.init(renderer, vk::kIndirectBufferUsageFlags,
@@ -176,8 +187,6 @@ void VertexArrayVk::destroy(const gl::Context *context)
 
     RendererVk *renderer = contextVk->getRenderer();
 
-    mDynamicVertexData.release(renderer);
-    mDynamicIndexData.release(renderer);
     mTranslatedByteIndexData.release(renderer);
     mTranslatedByteIndirectData.release(renderer);
     mLineLoopHelper.release(contextVk);
@@ -195,7 +204,8 @@ angle::Result VertexArrayVk::convertIndexBufferGPU(ContextVk *contextVk,
     ANGLE_TRY(mTranslatedByteIndexData.allocate(contextVk, sizeof(GLushort) * srcDataSize, nullptr,
                                                 nullptr, &mCurrentElementArrayBufferOffset,
                                                 nullptr));
-    mCurrentElementArrayBuffer = mTranslatedByteIndexData.getCurrentBuffer();
+    mCurrentElementArrayBuffer       = mTranslatedByteIndexData.getCurrentBuffer();
+    mCurrentElementArrayBufferHandle = mCurrentElementArrayBuffer->getBuffer().getHandle();
 
     vk::BufferHelper *dest       = mTranslatedByteIndexData.getCurrentBuffer();
     VkDeviceSize srcBufferOffset = 0;
@@ -243,6 +253,7 @@ angle::Result VertexArrayVk::convertIndexBufferIndirectGPU(ContextVk *contextVk,
     // Save new element array buffer
     mCurrentElementArrayBuffer       = dstIndexBuf;
     mCurrentElementArrayBufferOffset = dstIndexBufOffset;
+    mCurrentElementArrayBufferHandle = dstIndexBuf->getBuffer().getHandle();
 
     // Tell caller what new indirect buffer is
     *indirectBufferVkOut       = dstIndirectBuf;
@@ -272,6 +283,7 @@ angle::Result VertexArrayVk::handleLineLoopIndexIndirect(ContextVk *contextVk,
         contextVk, glIndexType, mCurrentElementArrayBuffer, mCurrentElementArrayBufferOffset,
         srcIndirectBuf, indirectBufferOffset, &mCurrentElementArrayBuffer,
         &mCurrentElementArrayBufferOffset, indirectBufferOut, indirectBufferOffsetOut));
+    mCurrentElementArrayBufferHandle = mCurrentElementArrayBuffer->getBuffer().getHandle();
 
     return angle::Result::Continue;
 }
@@ -307,6 +319,7 @@ angle::Result VertexArrayVk::handleLineLoopIndirectDraw(const gl::Context *conte
                                                   indirectBufferOffset, &mCurrentElementArrayBuffer,
                                                   &mCurrentElementArrayBufferOffset,
                                                   indirectBufferOut, indirectBufferOffsetOut));
+    mCurrentElementArrayBufferHandle = mCurrentElementArrayBuffer->getBuffer().getHandle();
 
     return angle::Result::Continue;
 }
@@ -318,15 +331,15 @@ angle::Result VertexArrayVk::convertIndexBufferCPU(ContextVk *contextVk,
 {
     ASSERT(!mState.getElementArrayBuffer() || indexType == gl::DrawElementsType::UnsignedByte);
 
-    mDynamicIndexData.releaseInFlightBuffers(contextVk);
-
     size_t elementSize  = contextVk->getVkIndexTypeSize(indexType);
     const size_t amount = elementSize * indexCount;
     GLubyte *dst        = nullptr;
 
-    ANGLE_TRY(mDynamicIndexData.allocate(contextVk, amount, &dst, nullptr,
-                                         &mCurrentElementArrayBufferOffset, nullptr));
-    mCurrentElementArrayBuffer = mDynamicIndexData.getCurrentBuffer();
+    ANGLE_TRY(contextVk->getStreamingBuffer()->allocate(contextVk, amount, &dst,
+                                                        &mCurrentElementArrayBuffer,
+                                                        &mCurrentElementArrayBufferOffset));
+    mCurrentElementArrayBufferHandle = mCurrentElementArrayBuffer->getBuffer().getHandle();
+
     if (contextVk->shouldConvertUint8VkIndexType(indexType))
     {
         // Unsigned bytes don't have direct support in Vulkan so we have to expand the
@@ -364,9 +377,9 @@ angle::Result VertexArrayVk::convertIndexBufferCPU(ContextVk *contextVk,
     {
         // The primitive restart value is the same for OpenGL and Vulkan,
         // so there's no need to perform any conversion.
-        memcpy(dst, sourcePointer, amount);
+        vk::CopyToWriteCombinedMemory(dst, static_cast<const uint8_t *>(sourcePointer), amount);
     }
-    return mDynamicIndexData.flush(contextVk);
+    return angle::Result::Continue;
 }
 
 // We assume the buffer is completely full of the same kind of data and convert
@@ -450,10 +463,15 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
     const uint8_t *srcBytes = reinterpret_cast<const uint8_t *>(src);
     srcBytes += binding.getOffset() + relativeOffset;
     ASSERT(GetVertexInputAlignment(vertexFormat, compressed) <= vk::kVertexBufferAlignment);
-    ANGLE_TRY(StreamVertexData(
-        contextVk, &conversion->data, srcBytes, numVertices * dstFormatSize, 0, numVertices,
-        binding.getStride(), srcFormatSize, vertexFormat.getVertexLoadFunction(compressed),
-        &mCurrentArrayBuffers[attribIndex], &conversion->lastAllocationOffset, 1));
+
+    // The converted data is kept for later draws, so it goes in the conversion buffer.
+    uint8_t *dst = nullptr;
+    ANGLE_TRY(conversion->data.allocate(contextVk, numVertices * dstFormatSize, &dst, nullptr,
+                                        &conversion->lastAllocationOffset, nullptr));
+    mCurrentArrayBuffers[attribIndex] = conversion->data.getCurrentBuffer();
+    LoadVertexData(srcBytes, numVertices * dstFormatSize, numVertices, binding.getStride(),
+                   srcFormatSize, true, vertexFormat.getVertexLoadFunction(compressed), 1, dst);
+    ANGLE_TRY(conversion->data.flush(contextVk));
     ANGLE_TRY(srcBuffer->unmapImpl(contextVk));
 
     ASSERT(conversion->dirty);
@@ -489,11 +507,14 @@ angle::Result VertexArrayVk::syncState(const gl::Context *context,
                     BufferVk *bufferVk = vk::GetImpl(bufferGL);
                     mCurrentElementArrayBuffer =
                         &bufferVk->getBufferAndOffset(&mCurrentElementArrayBufferOffset);
+                    mCurrentElementArrayBufferHandle =
+                        mCurrentElementArrayBuffer->getBuffer().getHandle();
                 }
                 else
                 {
                     mCurrentElementArrayBuffer       = nullptr;
                     mCurrentElementArrayBufferOffset = 0;
+                    mCurrentElementArrayBufferHandle = VK_NULL_HANDLE;
                 }
 
                 mLineLoopBufferFirstIndex.reset();
@@ -780,7 +801,6 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                                  indices, 0, &startVertex, &vertexCount));
 
     RendererVk *renderer = contextVk->getRenderer();
-    mDynamicVertexData.releaseInFlightBuffers(contextVk);
 
     const auto &attribs  = mState.getVertexAttributes();
     const auto &bindings = mState.getVertexBindings();
@@ -797,6 +817,8 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
         GLuint stride                  = vertexFormat.actualBufferFormat(false).pixelBytes;
 
         bool compressed = false;
+        const bool loadRequiresConversion =
+            vertexFormat.getVertexLoadRequiresConversion(compressed);
         ANGLE_TRY(WarnOnVertexFormatConversion(contextVk, vertexFormat, compressed, false));
 
         ASSERT(GetVertexInputAlignment(vertexFormat, false) <= vk::kVertexBufferAlignment);
@@ -821,8 +843,8 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                 // Divisor will be set to 1 & so update buffer to have 1 attrib per instance
                 size_t bytesToAllocate = instanceCount * stride;
 
-                ANGLE_TRY(StreamVertexData(contextVk, &mDynamicVertexData, src, bytesToAllocate, 0,
-                                           instanceCount, binding.getStride(), stride,
+                ANGLE_TRY(StreamVertexData(contextVk, src, bytesToAllocate, 0, instanceCount,
+                                           binding.getStride(), stride, loadRequiresConversion,
                                            vertexFormat.vertexLoadFunction,
                                            &mCurrentArrayBuffers[attribIndex],
                                            &mCurrentArrayBufferOffsets[attribIndex], divisor));
@@ -837,8 +859,8 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                 size_t count           = UnsignedCeilDivide(instanceCount, divisor);
                 size_t bytesToAllocate = count * stride;
 
-                ANGLE_TRY(StreamVertexData(contextVk, &mDynamicVertexData, src, bytesToAllocate, 0,
-                                           count, binding.getStride(), stride,
+                ANGLE_TRY(StreamVertexData(contextVk, src, bytesToAllocate, 0, count,
+                                           binding.getStride(), stride, loadRequiresConversion,
                                            vertexFormat.vertexLoadFunction,
                                            &mCurrentArrayBuffers[attribIndex],
                                            &mCurrentArrayBufferOffsets[attribIndex], 1));
@@ -854,10 +876,11 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             src += startVertex * binding.getStride();
             size_t destOffset = startVertex * stride;
 
-            ANGLE_TRY(StreamVertexData(
-                contextVk, &mDynamicVertexData, src, bytesToAllocate, destOffset, vertexCount,
-                binding.getStride(), stride, vertexFormat.vertexLoadFunction,
-                &mCurrentArrayBuffers[attribIndex], &mCurrentArrayBufferOffsets[attribIndex], 1));
+            ANGLE_TRY(StreamVertexData(contextVk, src, bytesToAllocate, destOffset, vertexCount,
+                                       binding.getStride(), stride, loadRequiresConversion,
+                                       vertexFormat.vertexLoadFunction,
+                                       &mCurrentArrayBuffers[attribIndex],
+                                       &mCurrentArrayBufferOffsets[attribIndex], 1));
         }
 
         mCurrentArrayBufferHandles[attribIndex] =
@@ -897,6 +920,7 @@ angle::Result VertexArrayVk::handleLineLoop(ContextVk *contextVk,
                     contextVk, elementArrayBufferVk, indexTypeOrInvalid, vertexOrIndexCount, offset,
                     &mCurrentElementArrayBuffer, &mCurrentElementArrayBufferOffset, indexCountOut));
             }
+            mCurrentElementArrayBufferHandle = mCurrentElementArrayBuffer->getBuffer().getHandle();
         }
 
         // If we've had a drawArrays call with a line loop before, we want to make sure this is
@@ -918,6 +942,7 @@ angle::Result VertexArrayVk::handleLineLoop(ContextVk *contextVk,
         ANGLE_TRY(mLineLoopHelper.getIndexBufferForDrawArrays(
             contextVk, clampedVertexCount, firstVertex, &mCurrentElementArrayBuffer,
             &mCurrentElementArrayBufferOffset));
+        mCurrentElementArrayBufferHandle = mCurrentElementArrayBuffer->getBuffer().getHandle();
 
         mLineLoopBufferFirstIndex = firstVertex;
         mLineLoopBufferLastIndex  = lastVertex;
@@ -89,6 +89,11 @@ class VertexArrayVk : public VertexArrayImpl
 
     vk::BufferHelper *getCurrentElementArrayBuffer() const { return mCurrentElementArrayBuffer; }
 
+    VkBuffer getCurrentElementArrayBufferHandle() const
+    {
+        return mCurrentElementArrayBufferHandle;
+    }
+
     angle::Result convertIndexBufferGPU(ContextVk *contextVk,
                                         BufferVk *bufferVk,
                                         const void *indices);
@@ -145,9 +150,10 @@ class VertexArrayVk : public VertexArrayImpl
     gl::AttributesMask mCurrentArrayBufferCompressed;
     VkDeviceSize mCurrentElementArrayBufferOffset;
     vk::BufferHelper *mCurrentElementArrayBuffer;
+    // The handle is cached when the indices are allocated.  The streaming buffer keeps its
+    // BufferHelper but may replace its VkBuffer when it grows later in the same draw.
+    VkBuffer mCurrentElementArrayBufferHandle;
 
-    vk::DynamicBuffer mDynamicVertexData;
-    vk::DynamicBuffer mDynamicIndexData;
     vk::DynamicBuffer mTranslatedByteIndexData;
     vk::DynamicBuffer mTranslatedByteIndirectData;
 
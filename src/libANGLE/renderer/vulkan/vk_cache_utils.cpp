@@ -11,6 +11,7 @@
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 #include "common/aligned_memory.h"
+#include "common/system_utils.h"
 #include "common/vulkan/vk_google_filtering_precision.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/VertexAttribute.h"
@@ -21,6 +22,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
+#include "libANGLE/trace.h"
 
 #include <type_traits>
 
@@ -1690,22 +1692,52 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     const SpecializationConstants &specConsts,
     Pipeline *pipelineOut) const
 {
-    angle::FixedVector<VkPipelineShaderStageCreateInfo, 5> shaderStages;
-    VkPipelineVertexInputStateCreateInfo vertexInputState     = {};
-    VkPipelineInputAssemblyStateCreateInfo inputAssemblyState = {};
-    VkPipelineViewportStateCreateInfo viewportState           = {};
-    VkPipelineRasterizationStateCreateInfo rasterState        = {};
-    VkPipelineMultisampleStateCreateInfo multisampleState     = {};
-    VkPipelineDepthStencilStateCreateInfo depthStencilState   = {};
-    gl::DrawBuffersArray<VkPipelineColorBlendAttachmentState> blendAttachmentState;
-    VkPipelineTessellationStateCreateInfo tessellationState             = {};
-    VkPipelineTessellationDomainOriginStateCreateInfo domainOriginState = {};
-    VkPipelineColorBlendStateCreateInfo blendState                      = {};
-    VkSpecializationInfo specializationInfo                             = {};
-    VkGraphicsPipelineCreateInfo createInfo                             = {};
-
-    SpecializationConstantMap<VkSpecializationMapEntry> specializationEntries;
-    InitializeSpecializationInfo(specConsts, &specializationEntries, &specializationInfo);
+    GraphicsPipelineCreateInfoStorage storage;
+    initializePipelineCreateInfo(contextVk, compatibleRenderPass, pipelineLayout,
+                                 activeAttribLocationsMask, programAttribsTypeMask, vertexModule,
+                                 fragmentModule, geometryModule, tessControlModule,
+                                 tessEvaluationModule, specConsts, &storage);
+
+    ANGLE_VK_TRY(contextVk, pipelineOut->initGraphics(contextVk->getDevice(), storage.createInfo,
+                                                      pipelineCacheVk));
+    return angle::Result::Continue;
+}
+
+void GraphicsPipelineDesc::initializePipelineCreateInfo(
+    ContextVk *contextVk,
+    const RenderPass &compatibleRenderPass,
+    const PipelineLayout &pipelineLayout,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    const ShaderModule *vertexModule,
+    const ShaderModule *fragmentModule,
+    const ShaderModule *geometryModule,
+    const ShaderModule *tessControlModule,
+    const ShaderModule *tessEvaluationModule,
+    const SpecializationConstants &specConsts,
+    GraphicsPipelineCreateInfoStorage *storageOut) const
+{
+    angle::FixedVector<VkPipelineShaderStageCreateInfo, 5> &shaderStages = storageOut->shaderStages;
+    VkPipelineVertexInputStateCreateInfo &vertexInputState     = storageOut->vertexInputState;
+    VkPipelineInputAssemblyStateCreateInfo &inputAssemblyState = storageOut->inputAssemblyState;
+    VkPipelineViewportStateCreateInfo &viewportState           = storageOut->viewportState;
+    VkPipelineRasterizationStateCreateInfo &rasterState        = storageOut->rasterState;
+    VkPipelineMultisampleStateCreateInfo &multisampleState     = storageOut->multisampleState;
+    VkPipelineDepthStencilStateCreateInfo &depthStencilState   = storageOut->depthStencilState;
+    gl::DrawBuffersArray<VkPipelineColorBlendAttachmentState> &blendAttachmentState =
+        storageOut->blendAttachmentState;
+    VkPipelineTessellationStateCreateInfo &tessellationState = storageOut->tessellationState;
+    VkPipelineTessellationDomainOriginStateCreateInfo &domainOriginState =
+        storageOut->domainOriginState;
+    VkPipelineColorBlendStateCreateInfo &blendState = storageOut->blendState;
+    VkSpecializationInfo &specializationInfo        = storageOut->specializationInfo;
+    VkGraphicsPipelineCreateInfo &createInfo        = storageOut->createInfo;
+
+    // The specialization info points to the constants, so keep a copy of them with the rest of
+    // the create info.
+    storageOut->specConsts = specConsts;
+    InitializeSpecializationInfo(storageOut->specConsts, &storageOut->specializationEntries,
+                                 &specializationInfo);
 
     // Vertex shader is always expected to be present.
     ASSERT(vertexModule != nullptr);
@@ -1756,8 +1788,8 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     }
 
     // TODO(jmadill): Possibly use different path for ES 3.1 split bindings/attribs.
-    gl::AttribArray<VkVertexInputBindingDescription> bindingDescs;
-    gl::AttribArray<VkVertexInputAttributeDescription> attributeDescs;
+    gl::AttribArray<VkVertexInputBindingDescription> &bindingDescs     = storageOut->bindingDescs;
+    gl::AttribArray<VkVertexInputAttributeDescription> &attributeDescs = storageOut->attributeDescs;
 
     uint32_t vertexAttribCount = 0;
 
@@ -1768,8 +1800,9 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
                           sizeof(blendState) + sizeof(bindingDescs) + sizeof(attributeDescs);
     ANGLE_UNUSED_VARIABLE(unpackedSize);
 
-    gl::AttribArray<VkVertexInputBindingDivisorDescriptionEXT> divisorDesc;
-    VkPipelineVertexInputDivisorStateCreateInfoEXT divisorState = {};
+    gl::AttribArray<VkVertexInputBindingDivisorDescriptionEXT> &divisorDesc =
+        storageOut->divisorDesc;
+    VkPipelineVertexInputDivisorStateCreateInfoEXT &divisorState = storageOut->divisorState;
     divisorState.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT;
     divisorState.pVertexBindingDivisors = divisorDesc.data();
     for (size_t attribIndexSizeT : activeAttribLocationsMask)
@@ -1909,7 +1942,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     rasterState.lineWidth               = rasterAndMS.lineWidth;
     const void **pNextPtr               = &rasterState.pNext;
 
-    VkPipelineRasterizationLineStateCreateInfoEXT rasterLineState = {};
+    VkPipelineRasterizationLineStateCreateInfoEXT &rasterLineState = storageOut->rasterLineState;
     rasterLineState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT;
     // Enable Bresenham line rasterization if available and the following conditions are met:
     // 1.) not multisampling
@@ -1930,7 +1963,8 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
         pNextPtr                              = &rasterLineState.pNext;
     }
 
-    VkPipelineRasterizationProvokingVertexStateCreateInfoEXT provokingVertexState = {};
+    VkPipelineRasterizationProvokingVertexStateCreateInfoEXT &provokingVertexState =
+        storageOut->provokingVertexState;
     provokingVertexState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT;
     // Always set provoking vertex mode to last if available.
@@ -1945,7 +1979,8 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     // When the 'depthClamping' feature is enabled, we'll be using depth clamping
     // to work around a driver issue, not as an alternative to depth clipping. Therefore we need to
     // explicitly re-enable depth clipping.
-    VkPipelineRasterizationDepthClipStateCreateInfoEXT depthClipState = {};
+    VkPipelineRasterizationDepthClipStateCreateInfoEXT &depthClipState =
+        storageOut->depthClipState;
     depthClipState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT;
     if (contextVk->getFeatures().depthClamping.enabled)
@@ -1955,7 +1990,8 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
         pNextPtr                       = &depthClipState.pNext;
     }
 
-    VkPipelineRasterizationStateStreamCreateInfoEXT rasterStreamState = {};
+    VkPipelineRasterizationStateStreamCreateInfoEXT &rasterStreamState =
+        storageOut->rasterStreamState;
     rasterStreamState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT;
     if (contextVk->getFeatures().supportsTransformFeedbackExtension.enabled)
     {
@@ -1972,7 +2008,9 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     multisampleState.sampleShadingEnable =
         static_cast<VkBool32>(rasterAndMS.bits.sampleShadingEnable);
     multisampleState.minSampleShading = rasterAndMS.minSampleShading;
-    multisampleState.pSampleMask      = rasterAndMS.sampleMask;
+    std::copy(std::begin(rasterAndMS.sampleMask), std::end(rasterAndMS.sampleMask),
+              storageOut->sampleMask.begin());
+    multisampleState.pSampleMask = storageOut->sampleMask.data();
     multisampleState.alphaToCoverageEnable =
         static_cast<VkBool32>(rasterAndMS.bits.alphaToCoverageEnable);
     multisampleState.alphaToOneEnable = static_cast<VkBool32>(rasterAndMS.bits.alphaToOneEnable);
@@ -2051,11 +2089,11 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     }
 
     // Dynamic state
-    angle::FixedVector<VkDynamicState, 2> dynamicStateList;
+    angle::FixedVector<VkDynamicState, 2> &dynamicStateList = storageOut->dynamicStateList;
     dynamicStateList.push_back(VK_DYNAMIC_STATE_VIEWPORT);
     dynamicStateList.push_back(VK_DYNAMIC_STATE_SCISSOR);
 
-    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    VkPipelineDynamicStateCreateInfo &dynamicState = storageOut->dynamicState;
     dynamicState.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStateList.size());
     dynamicState.pDynamicStates    = dynamicStateList.data();
@@ -2093,10 +2131,6 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     createInfo.subpass             = mRasterizationAndMultisampleStateInfo.bits.subpass;
     createInfo.basePipelineHandle  = VK_NULL_HANDLE;
     createInfo.basePipelineIndex   = 0;
-
-    ANGLE_VK_TRY(contextVk,
-                 pipelineOut->initGraphics(contextVk->getDevice(), createInfo, pipelineCacheVk));
-    return angle::Result::Continue;
 }
 
 void GraphicsPipelineDesc::updateVertexInput(GraphicsPipelineTransitionBits *transition,
@@ -2838,15 +2872,63 @@ const PushConstantRangeArray<PackedPushConstantRange> &PipelineLayoutDesc::getPu
 }
 
 // PipelineHelper implementation.
+CreateGraphicsPipelineTask::CreateGraphicsPipelineTask(VkDevice device,
+                                                       const PipelineCache &pipelineCache,
+                                                       CacheStats *cacheStats)
+    : mDevice(device),
+      mPipelineCache(pipelineCache),
+      mCacheStats(cacheStats),
+      mHandle(VK_NULL_HANDLE),
+      mResult(VK_NOT_READY)
+{}
+
+CreateGraphicsPipelineTask::~CreateGraphicsPipelineTask()
+{
+    ASSERT(!mPipeline.valid());
+}
+
+void CreateGraphicsPipelineTask::operator()()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CreateGraphicsPipelineTask");
+    mResult = mPipeline.initGraphics(mDevice, mCreateInfoStorage.createInfo, mPipelineCache);
+    mHandle = mPipeline.getHandle();
+}
+
+void CreateGraphicsPipelineTask::wait()
+{
+    if (mWaitableEvent->isReady())
+    {
+        mWaitableEvent->wait();
+        return;
+    }
+
+    double startTime = angle::GetCurrentTime();
+    mWaitableEvent->wait();
+    mCacheStats->hitch(angle::GetCurrentTime() - startTime);
+}
+
 PipelineHelper::PipelineHelper() = default;
 
 PipelineHelper::~PipelineHelper() = default;
 
 void PipelineHelper::destroy(VkDevice device)
 {
+    (void)finishCreation();
     mPipeline.destroy(device);
 }
 
+VkResult PipelineHelper::finishCreationImpl()
+{
+    ASSERT(mCreationTask);
+
+    mCreationTask->wait();
+    VkResult result = mCreationTask->getResult();
+    mPipeline       = std::move(mCreationTask->getPipeline());
+    mCreationTask.reset();
+
+    return result;
+}
+
 void PipelineHelper::addTransition(GraphicsPipelineTransitionBits bits,
                                    const GraphicsPipelineDesc *desc,
                                    PipelineHelper *pipeline)
@@ -3531,6 +3613,7 @@ void GraphicsPipelineCache::release(ContextVk *context)
     for (auto &item : mPayload)
     {
         vk::PipelineHelper &pipeline = item.second;
+        (void)pipeline.finishCreation();
         context->addGarbage(&pipeline.getPipeline());
     }
 
@@ -3554,16 +3637,28 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut)
 {
+    if (contextVk != nullptr && contextVk->getFeatures().asyncGraphicsPipelineCreation.enabled)
+    {
+        return insertPipelineAsync(contextVk, pipelineCacheVk, compatibleRenderPass,
+                                   pipelineLayout, activeAttribLocationsMask,
+                                   programAttribsTypeMask, vertexModule, fragmentModule,
+                                   geometryModule, tessControlModule, tessEvaluationModule,
+                                   specConsts, desc, descPtrOut, pipelineOut);
+    }
+
     vk::Pipeline newPipeline;
 
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
     if (contextVk != nullptr)
     {
         contextVk->getRenderer()->onNewGraphicsPipeline();
+
+        double startTime = angle::GetCurrentTime();
         ANGLE_TRY(desc.initializePipeline(
             contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
             activeAttribLocationsMask, programAttribsTypeMask, vertexModule, fragmentModule,
             geometryModule, tessControlModule, tessEvaluationModule, specConsts, &newPipeline));
+        mCacheStats.hitch(angle::GetCurrentTime() - startTime);
     }
 
     // The Serial will be updated outside of this query.
@@ -3574,6 +3669,85 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     return angle::Result::Continue;
 }
 
+angle::Result GraphicsPipelineCache::insertPipelineAsync(
+    ContextVk *contextVk,
+    const vk::PipelineCache &pipelineCacheVk,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    const vk::ShaderModule *vertexModule,
+    const vk::ShaderModule *fragmentModule,
+    const vk::ShaderModule *geometryModule,
+    const vk::ShaderModule *tessControlModule,
+    const vk::ShaderModule *tessEvaluationModule,
+    const vk::SpecializationConstants &specConsts,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    renderer->onNewGraphicsPipeline();
+
+    // The create info is filled in here, as it depends on the context state.  Only the pipeline
+    // creation itself, which is where the driver compiles the shaders, runs in the thread pool.
+    // The shader modules, the pipeline layout and the render pass outlive the task, as the cache
+    // waits for the task before it's released.
+    auto creationTask = std::make_shared<vk::CreateGraphicsPipelineTask>(
+        contextVk->getDevice(), pipelineCacheVk, &mCacheStats);
+    desc.initializePipelineCreateInfo(contextVk, compatibleRenderPass, pipelineLayout,
+                                      activeAttribLocationsMask, programAttribsTypeMask,
+                                      vertexModule, fragmentModule, geometryModule,
+                                      tessControlModule, tessEvaluationModule, specConsts,
+                                      creationTask->getCreateInfoStorage());
+    creationTask->setWaitableEvent(angle::WorkerThreadPool::PostWorkerTask(
+        renderer->getGraphicsPipelineThreadPool(), creationTask, angle::TaskPriority::High));
+
+    // The pipeline is added to the cache right away, so it can be linked in the transition graph
+    // and bound before it's done.
+    auto insertedItem = mPayload.emplace(desc, std::move(creationTask));
+    *descPtrOut       = &insertedItem.first->first;
+    *pipelineOut      = &insertedItem.first->second;
+
+    return angle::Result::Continue;
+}
+
+angle::Result GraphicsPipelineCache::warmUpPipeline(
+    ContextVk *contextVk,
+    const vk::PipelineCache &pipelineCacheVk,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    const vk::ShaderModule *vertexModule,
+    const vk::ShaderModule *fragmentModule,
+    const vk::ShaderModule *geometryModule,
+    const vk::ShaderModule *tessControlModule,
+    const vk::ShaderModule *tessEvaluationModule,
+    const vk::SpecializationConstants &specConsts,
+    const vk::GraphicsPipelineDesc &desc)
+{
+    if (mPayload.find(desc) != mPayload.end())
+    {
+        return angle::Result::Continue;
+    }
+
+    const vk::GraphicsPipelineDesc *descPtr = nullptr;
+    vk::PipelineHelper *pipeline            = nullptr;
+    return insertPipelineAsync(contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
+                               activeAttribLocationsMask, programAttribsTypeMask, vertexModule,
+                               fragmentModule, geometryModule, tessControlModule,
+                               tessEvaluationModule, specConsts, desc, &descPtr, &pipeline);
+}
+
+void GraphicsPipelineCache::getPipelineDescs(std::vector<vk::GraphicsPipelineDesc> *descsOut) const
+{
+    for (const auto &item : mPayload)
+    {
+        descsOut->push_back(item.first);
+    }
+}
+
 void GraphicsPipelineCache::populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline)
 {
     auto item = mPayload.find(desc);
@@ -3921,7 +4095,55 @@ template <typename Key, VulkanCacheType CacheType>
 void DescriptorSetCache<Key, CacheType>::destroy(RendererVk *rendererVk)
 {
     this->accumulateCacheStats(rendererVk);
-    mPayload.clear();
+    // Drops the references to the pools.
+    mPayload.Clear();
+}
+
+template <typename Key, VulkanCacheType CacheType>
+void DescriptorSetCache<Key, CacheType>::insert(
+    const Key &desc,
+    VkDescriptorSet descriptorSet,
+    const vk::BindingPointer<vk::DescriptorPoolHelper> &poolBinding,
+    Serial currentSerial)
+{
+    CachedDescriptorSet cachedSet;
+    cachedSet.descriptorSet = descriptorSet;
+    cachedSet.pool.copy(poolBinding);
+    cachedSet.lastUseSerial = currentSerial;
+    mPayload.Put(desc, std::move(cachedSet));
+
+    // The dropped set stays allocated until its pool is reset, which happens once none of the
+    // pool's sets are cached anymore.
+    mPayload.ShrinkToSize(kMaxCachedDescriptorSets);
+}
+
+template <typename Key, VulkanCacheType CacheType>
+bool DescriptorSetCache<Key, CacheType>::recycle(const Key &desc,
+                                                 Serial currentSerial,
+                                                 Serial lastCompletedSerial,
+                                                 VkDescriptorSet *descriptorSetOut,
+                                                 vk::DescriptorPoolHelper **poolOut)
+{
+    if (mPayload.size() < kMaxCachedDescriptorSets)
+    {
+        return false;
+    }
+
+    auto leastRecentlyUsed = mPayload.rbegin();
+    if (leastRecentlyUsed->second.lastUseSerial > lastCompletedSerial)
+    {
+        return false;
+    }
+
+    CachedDescriptorSet cachedSet = std::move(leastRecentlyUsed->second);
+    mPayload.Erase(leastRecentlyUsed);
+
+    *descriptorSetOut       = cachedSet.descriptorSet;
+    *poolOut                = &cachedSet.pool.get();
+    cachedSet.lastUseSerial = currentSerial;
+    mPayload.Put(desc, std::move(cachedSet));
+
+    return true;
 }
 
 // RendererVk's methods are not accessible in vk_cache_utils.h
@@ -11,12 +11,16 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 
+#include <anglebase/containers/mru_cache.h>
+
 #include "common/Color.h"
 #include "common/FixedVector.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 namespace rx
 {
+class CacheStats;
 
 // Some descriptor set and pipeline layout constants.
 //
@@ -48,9 +52,11 @@ enum class DescriptorSetIndex : uint32_t
 
 namespace vk
 {
+class DescriptorPoolHelper;
 class DynamicDescriptorPool;
 class ImageHelper;
 enum class ImageLayout;
+struct GraphicsPipelineCreateInfoStorage;
 
 using PipelineAndSerial = ObjectAndSerial<Pipeline>;
 
@@ -582,6 +588,21 @@ class GraphicsPipelineDesc final
                                      const SpecializationConstants &specConsts,
                                      Pipeline *pipelineOut) const;
 
+    // Fills in the create info of the pipeline without creating it.  The storage doesn't point
+    // back into this desc, so the pipeline can be created from it on another thread.
+    void initializePipelineCreateInfo(ContextVk *contextVk,
+                                      const RenderPass &compatibleRenderPass,
+                                      const PipelineLayout &pipelineLayout,
+                                      const gl::AttributesMask &activeAttribLocationsMask,
+                                      const gl::ComponentTypeMask &programAttribsTypeMask,
+                                      const ShaderModule *vertexModule,
+                                      const ShaderModule *fragmentModule,
+                                      const ShaderModule *geometryModule,
+                                      const ShaderModule *tessControlModule,
+                                      const ShaderModule *tessEvaluationModule,
+                                      const SpecializationConstants &specConsts,
+                                      GraphicsPipelineCreateInfoStorage *storageOut) const;
+
     // Vertex input state. For ES 3.1 this should be separated into binding and attribute.
     void updateVertexInput(GraphicsPipelineTransitionBits *transition,
                            uint32_t attribIndex,
@@ -965,19 +986,120 @@ ANGLE_INLINE bool GraphicsPipelineTransitionMatch(GraphicsPipelineTransitionBits
     return true;
 }
 
+// A VkGraphicsPipelineCreateInfo together with all the state it points to.
+struct GraphicsPipelineCreateInfoStorage final : angle::NonCopyable
+{
+    SpecializationConstants specConsts;
+    SpecializationConstantMap<VkSpecializationMapEntry> specializationEntries;
+    VkSpecializationInfo specializationInfo = {};
+    angle::FixedVector<VkPipelineShaderStageCreateInfo, 5> shaderStages;
+
+    gl::AttribArray<VkVertexInputBindingDescription> bindingDescs;
+    gl::AttribArray<VkVertexInputAttributeDescription> attributeDescs;
+    gl::AttribArray<VkVertexInputBindingDivisorDescriptionEXT> divisorDesc;
+    VkPipelineVertexInputDivisorStateCreateInfoEXT divisorState = {};
+    VkPipelineVertexInputStateCreateInfo vertexInputState       = {};
+    VkPipelineInputAssemblyStateCreateInfo inputAssemblyState   = {};
+    VkPipelineViewportStateCreateInfo viewportState             = {};
+
+    VkPipelineRasterizationStateCreateInfo rasterState                            = {};
+    VkPipelineRasterizationLineStateCreateInfoEXT rasterLineState                 = {};
+    VkPipelineRasterizationProvokingVertexStateCreateInfoEXT provokingVertexState = {};
+    VkPipelineRasterizationDepthClipStateCreateInfoEXT depthClipState             = {};
+    VkPipelineRasterizationStateStreamCreateInfoEXT rasterStreamState             = {};
+
+    std::array<VkSampleMask, gl::MAX_SAMPLE_MASK_WORDS> sampleMask;
+    VkPipelineMultisampleStateCreateInfo multisampleState   = {};
+    VkPipelineDepthStencilStateCreateInfo depthStencilState = {};
+    gl::DrawBuffersArray<VkPipelineColorBlendAttachmentState> blendAttachmentState;
+    VkPipelineColorBlendStateCreateInfo blendState = {};
+
+    angle::FixedVector<VkDynamicState, 2> dynamicStateList;
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+
+    VkPipelineTessellationStateCreateInfo tessellationState             = {};
+    VkPipelineTessellationDomainOriginStateCreateInfo domainOriginState = {};
+
+    VkGraphicsPipelineCreateInfo createInfo = {};
+};
+
+// Creates a graphics pipeline in the worker thread pool.  The task owns the pipeline until the
+// PipelineHelper it was created for takes it.
+class CreateGraphicsPipelineTask final : public angle::Closure
+{
+  public:
+    CreateGraphicsPipelineTask(VkDevice device,
+                               const PipelineCache &pipelineCache,
+                               CacheStats *cacheStats);
+    ~CreateGraphicsPipelineTask() override;
+
+    void operator()() override;
+
+    GraphicsPipelineCreateInfoStorage *getCreateInfoStorage() { return &mCreateInfoStorage; }
+
+    void setWaitableEvent(std::shared_ptr<angle::WaitableEvent> &&waitableEvent)
+    {
+        mWaitableEvent = std::move(waitableEvent);
+    }
+    bool isReady() { return mWaitableEvent->isReady(); }
+
+    // Waits for the pipeline to be created.  If this blocks, the wait is recorded as a hitch in
+    // the stats of the cache the pipeline belongs to.  The cache waits for its pending pipelines
+    // before it's released, so a task that outlives its cache never blocks.
+    void wait();
+
+    // Only valid after wait().
+    VkResult getResult() const { return mResult; }
+    VkPipeline getHandle() const { return mHandle; }
+    Pipeline &getPipeline() { return mPipeline; }
+
+  private:
+    VkDevice mDevice;
+    const PipelineCache &mPipelineCache;
+    CacheStats *mCacheStats;
+    GraphicsPipelineCreateInfoStorage mCreateInfoStorage;
+    std::shared_ptr<angle::WaitableEvent> mWaitableEvent;
+
+    Pipeline mPipeline;
+    // The handle is kept separately, as the pipeline is moved out of the task.
+    VkPipeline mHandle;
+    VkResult mResult;
+};
+
 class PipelineHelper final : angle::NonCopyable
 {
   public:
     PipelineHelper();
     ~PipelineHelper();
     inline explicit PipelineHelper(Pipeline &&pipeline);
+    inline explicit PipelineHelper(std::shared_ptr<CreateGraphicsPipelineTask> &&creationTask);
 
     void destroy(VkDevice device);
 
     void updateSerial(Serial serial) { mSerial = serial; }
-    bool valid() const { return mPipeline.valid(); }
+    bool valid() const { return mPipeline.valid() || mCreationTask; }
     Serial getSerial() const { return mSerial; }
-    Pipeline &getPipeline() { return mPipeline; }
+
+    // A pipeline that is still being created must be waited for with finishCreation() first.
+    Pipeline &getPipeline()
+    {
+        ASSERT(!mCreationTask);
+        return mPipeline;
+    }
+
+    // Whether the pipeline is being created in the worker thread pool and isn't done yet.
+    bool isCreationPending() const { return mCreationTask && !mCreationTask->isReady(); }
+    const std::shared_ptr<CreateGraphicsPipelineTask> &getCreationTask() const
+    {
+        return mCreationTask;
+    }
+
+    // Waits for the pipeline if it's being created in the worker thread pool and takes it from
+    // the creation task.
+    ANGLE_INLINE VkResult finishCreation()
+    {
+        return mCreationTask ? finishCreationImpl() : VK_SUCCESS;
+    }
 
     ANGLE_INLINE bool findTransition(GraphicsPipelineTransitionBits bits,
                                      const GraphicsPipelineDesc &desc,
@@ -1001,13 +1123,21 @@ class PipelineHelper final : angle::NonCopyable
                        PipelineHelper *pipeline);
 
   private:
+    VkResult finishCreationImpl();
+
     std::vector<GraphicsPipelineTransition> mTransitions;
     Serial mSerial;
     Pipeline mPipeline;
+    std::shared_ptr<CreateGraphicsPipelineTask> mCreationTask;
 };
 
 ANGLE_INLINE PipelineHelper::PipelineHelper(Pipeline &&pipeline) : mPipeline(std::move(pipeline)) {}
 
+ANGLE_INLINE PipelineHelper::PipelineHelper(
+    std::shared_ptr<CreateGraphicsPipelineTask> &&creationTask)
+    : mCreationTask(std::move(creationTask))
+{}
+
 struct ImageSubresourceRange
 {
     // GL max is 1000 (fits in 10 bits).
@@ -1420,14 +1550,25 @@ class CacheStats final : angle::NonCopyable
 
     ANGLE_INLINE void hit() { mHitCount++; }
     ANGLE_INLINE void miss() { mMissCount++; }
+    // A miss that stalled the calling thread while the object was being created.  The latency is
+    // in seconds.
+    ANGLE_INLINE void hitch(double latency)
+    {
+        mHitchCount++;
+        mMaxHitchLatency = std::max(mMaxHitchLatency, latency);
+    }
     ANGLE_INLINE void accumulate(const CacheStats &stats)
     {
         mHitCount += stats.mHitCount;
         mMissCount += stats.mMissCount;
+        mHitchCount += stats.mHitchCount;
+        mMaxHitchLatency = std::max(mMaxHitchLatency, stats.mMaxHitchLatency);
     }
 
     uint64_t getHitCount() const { return mHitCount; }
     uint64_t getMissCount() const { return mMissCount; }
+    uint64_t getHitchCount() const { return mHitchCount; }
+    double getMaxHitchLatency() const { return mMaxHitchLatency; }
 
     ANGLE_INLINE double getHitRatio() const
     {
@@ -1443,13 +1584,17 @@ class CacheStats final : angle::NonCopyable
 
     void reset()
     {
-        mHitCount  = 0;
-        mMissCount = 0;
+        mHitCount        = 0;
+        mMissCount       = 0;
+        mHitchCount      = 0;
+        mMaxHitchLatency = 0;
     }
 
   private:
     uint64_t mHitCount;
     uint64_t mMissCount;
+    uint64_t mHitchCount;
+    double mMaxHitchLatency;
 };
 
 template <VulkanCacheType CacheType>
@@ -1537,6 +1682,8 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
 
     void populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline);
 
+    // With the asyncGraphicsPipelineCreation feature, a miss returns a pipeline that is still
+    // being created in the worker thread pool.  See PipelineHelper::finishCreation().
     ANGLE_INLINE angle::Result getPipeline(ContextVk *contextVk,
                                            const vk::PipelineCache &pipelineCacheVk,
                                            const vk::RenderPass &compatibleRenderPass,
@@ -1569,6 +1716,26 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                               tessEvaluationModule, specConsts, desc, descPtrOut, pipelineOut);
     }
 
+    // Starts creating a pipeline that's expected to be needed soon, for example one that was
+    // recorded in the program's pipeline manifest.  The pipeline is created in the worker thread
+    // pool, and the call doesn't count as a miss.  Does nothing if the pipeline is already cached.
+    angle::Result warmUpPipeline(ContextVk *contextVk,
+                                 const vk::PipelineCache &pipelineCacheVk,
+                                 const vk::RenderPass &compatibleRenderPass,
+                                 const vk::PipelineLayout &pipelineLayout,
+                                 const gl::AttributesMask &activeAttribLocationsMask,
+                                 const gl::ComponentTypeMask &programAttribsTypeMask,
+                                 const vk::ShaderModule *vertexModule,
+                                 const vk::ShaderModule *fragmentModule,
+                                 const vk::ShaderModule *geometryModule,
+                                 const vk::ShaderModule *tessControlModule,
+                                 const vk::ShaderModule *tessEvaluationModule,
+                                 const vk::SpecializationConstants &specConsts,
+                                 const vk::GraphicsPipelineDesc &desc);
+
+    size_t getPipelineCount() const { return mPayload.size(); }
+    void getPipelineDescs(std::vector<vk::GraphicsPipelineDesc> *descsOut) const;
+
   private:
     angle::Result insertPipeline(ContextVk *contextVk,
                                  const vk::PipelineCache &pipelineCacheVk,
@@ -1585,6 +1752,21 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                                  const vk::GraphicsPipelineDesc &desc,
                                  const vk::GraphicsPipelineDesc **descPtrOut,
                                  vk::PipelineHelper **pipelineOut);
+    angle::Result insertPipelineAsync(ContextVk *contextVk,
+                                      const vk::PipelineCache &pipelineCacheVk,
+                                      const vk::RenderPass &compatibleRenderPass,
+                                      const vk::PipelineLayout &pipelineLayout,
+                                      const gl::AttributesMask &activeAttribLocationsMask,
+                                      const gl::ComponentTypeMask &programAttribsTypeMask,
+                                      const vk::ShaderModule *vertexModule,
+                                      const vk::ShaderModule *fragmentModule,
+                                      const vk::ShaderModule *geometryModule,
+                                      const vk::ShaderModule *tessControlModule,
+                                      const vk::ShaderModule *tessEvaluationModule,
+                                      const vk::SpecializationConstants &specConsts,
+                                      const vk::GraphicsPipelineDesc &desc,
+                                      const vk::GraphicsPipelineDesc **descPtrOut,
+                                      vk::PipelineHelper **pipelineOut);
 
     std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper> mPayload;
 };
@@ -1712,22 +1894,34 @@ class DriverUniformsDescriptorSetCache final
     angle::FastIntegerMap<VkDescriptorSet> mPayload;
 };
 
+// The number of descriptor sets a DescriptorSetCache holds on to.  Past that, the least recently
+// used set is rewritten for the new key if the GPU is done with it, or dropped from the cache
+// otherwise.  Either way, the cache stops keeping more pools alive.
+constexpr size_t kMaxCachedDescriptorSets = 512;
+
 // Templated Descriptors Cache
 template <typename Key, VulkanCacheType CacheType>
 class DescriptorSetCache final : public HasCacheStats<CacheType>
 {
   public:
-    DescriptorSetCache() = default;
+    DescriptorSetCache() : mPayload(Payload::NO_AUTO_EVICT) {}
     ~DescriptorSetCache() override { ASSERT(mPayload.empty()); }
 
     void destroy(RendererVk *rendererVk);
 
-    ANGLE_INLINE bool get(const Key &desc, VkDescriptorSet *descriptorSet)
+    // On a hit, the set becomes the most recently used one.  The pool it was allocated from is
+    // returned in |poolOut|, as it needs to be retained each time the set is used in a new command.
+    ANGLE_INLINE bool get(const Key &desc,
+                          Serial currentSerial,
+                          VkDescriptorSet *descriptorSet,
+                          vk::DescriptorPoolHelper **poolOut)
     {
-        auto iter = mPayload.find(desc);
+        auto iter = mPayload.Get(desc);
         if (iter != mPayload.end())
         {
-            *descriptorSet = iter->second;
+            iter->second.lastUseSerial = currentSerial;
+            *descriptorSet             = iter->second.descriptorSet;
+            *poolOut                   = &iter->second.pool.get();
             this->mCacheStats.hit();
             return true;
         }
@@ -1735,13 +1929,35 @@ class DescriptorSetCache final : public HasCacheStats<CacheType>
         return false;
     }
 
-    ANGLE_INLINE void insert(const Key &desc, VkDescriptorSet descriptorSet)
-    {
-        mPayload.emplace(desc, descriptorSet);
-    }
+    // The cache keeps a reference to the pool of |poolBinding|, so the pool isn't reset while the
+    // set is cached.  If the cache grows past kMaxCachedDescriptorSets, the least recently used set
+    // is dropped.
+    void insert(const Key &desc,
+                VkDescriptorSet descriptorSet,
+                const vk::BindingPointer<vk::DescriptorPoolHelper> &poolBinding,
+                Serial currentSerial);
+
+    // Once the cache is full, hands out the least recently used set for |desc| instead of having
+    // the caller allocate a new one, provided the GPU is done with it.  The caller must rewrite the
+    // descriptors of the set.
+    bool recycle(const Key &desc,
+                 Serial currentSerial,
+                 Serial lastCompletedSerial,
+                 VkDescriptorSet *descriptorSetOut,
+                 vk::DescriptorPoolHelper **poolOut);
+
+    size_t size() const { return mPayload.size(); }
 
   private:
-    angle::HashMap<Key, VkDescriptorSet> mPayload;
+    struct CachedDescriptorSet
+    {
+        VkDescriptorSet descriptorSet;
+        vk::BindingPointer<vk::DescriptorPoolHelper> pool;
+        Serial lastUseSerial;
+    };
+    using Payload = angle::base::HashingMRUCache<Key, CachedDescriptorSet>;
+
+    Payload mPayload;
 };
 
 // Only 1 driver uniform binding is used.
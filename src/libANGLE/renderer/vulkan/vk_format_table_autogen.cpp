@@ -798,6 +798,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11G11_SNORM_BLOCK, nullptr},
+                    {angle::FormatID::BC5_RG_SNORM_BLOCK, nullptr},
                     {angle::FormatID::R16G16_SNORM, nullptr},
                     {angle::FormatID::R16G16_FLOAT, nullptr}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -813,6 +814,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11G11_UNORM_BLOCK, nullptr},
+                    {angle::FormatID::BC5_RG_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R16G16_UNORM, nullptr},
                     {angle::FormatID::R16G16_FLOAT, nullptr}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -828,6 +830,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11_SNORM_BLOCK, nullptr},
+                    {angle::FormatID::BC4_RED_SNORM_BLOCK, nullptr},
                     {angle::FormatID::R16_SNORM, nullptr},
                     {angle::FormatID::R16_FLOAT, nullptr}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -843,6 +846,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11_UNORM_BLOCK, nullptr},
+                    {angle::FormatID::BC4_RED_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R16_UNORM, nullptr},
                     {angle::FormatID::R16_FLOAT, nullptr}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -862,6 +866,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8_UNORM_BLOCK, nullptr},
+                    {angle::FormatID::BC1_RGB_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -877,6 +882,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8A1_SRGB_BLOCK, nullptr},
+                    {angle::FormatID::BC1_RGBA_UNORM_SRGB_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM_SRGB, nullptr}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
             }
@@ -892,6 +898,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8A1_UNORM_BLOCK,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>},
+                    {angle::FormatID::BC1_RGBA_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -907,6 +914,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8A8_SRGB_BLOCK, nullptr},
+                    {angle::FormatID::BC3_RGBA_UNORM_SRGB_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM_SRGB, nullptr}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
             }
@@ -921,6 +929,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8A8_UNORM_BLOCK, nullptr},
+                    {angle::FormatID::BC3_RGBA_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM, nullptr}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
             }
@@ -935,6 +944,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8_SRGB_BLOCK, nullptr},
+                    {angle::FormatID::BC1_RGB_UNORM_SRGB_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM_SRGB,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -950,6 +960,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8_UNORM_BLOCK, nullptr},
+                    {angle::FormatID::BC1_RGB_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
                 initImageFallback(renderer, kInfo, ArraySize(kInfo));
@@ -106,6 +106,19 @@ int FindSupportedFormat(RendererVk *renderer,
     return last;
 }
 
+bool IsBCFormat(angle::FormatID formatID)
+{
+    const GLenum glFormat = angle::Format::Get(formatID).glInternalFormat;
+    return gl::IsS3TCFormat(glFormat) || gl::IsRGTCFormat(glFormat);
+}
+
+// ETC2/EAC images only fall back to the BC formats they can be transcoded to with the
+// transcodeETCToBC feature.
+bool HasNonRenderableNonBCTextureFormatSupport(RendererVk *renderer, angle::FormatID formatID)
+{
+    return !IsBCFormat(formatID) && HasNonRenderableTextureFormatSupport(renderer, formatID);
+}
+
 bool HasNonFilterableTextureFormatSupport(RendererVk *renderer, angle::FormatID formatID)
 {
     constexpr uint32_t kBitsColor =
@@ -157,6 +170,12 @@ void Format::initImageFallback(RendererVk *renderer, const ImageFormatInitInfo *
         // Compressed textures also need to perform this check.
         testFunction = HasNonRenderableTextureFormatSupport;
     }
+    if ((gl::IsETC2EACFormat(format.glInternalFormat) ||
+         format.glInternalFormat == GL_ETC1_RGB8_OES) &&
+        !renderer->getFeatures().transcodeETCToBC.enabled)
+    {
+        testFunction = HasNonRenderableNonBCTextureFormatSupport;
+    }
     int i = FindSupportedFormat(renderer, info, skip, static_cast<uint32_t>(numInfo), testFunction);
 
     actualImageFormatID      = info[i].format;
@@ -14,6 +14,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
+#include "libANGLE/renderer/vulkan/CommandProcessor.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
@@ -796,6 +797,24 @@ bool CanCopyWithTransformForReadPixels(const PackPixelsParams &packPixelsParams,
            isPitchMultipleOfTexelSize;
 }
 
+bool CanConvertWithComputeForReadPixels(const PackPixelsParams &packPixelsParams,
+                                        const vk::Format *imageFormat,
+                                        const angle::Format *readFormat)
+{
+    // Don't allow conversions from emulated formats for simplicity.
+    const bool isEmulatedFormat = imageFormat->hasEmulatedImageFormat();
+
+    // The shader can reverse the row order, but not rotate.
+    const bool isRotated = packPixelsParams.rotation != SurfaceRotation::Identity;
+
+    // The shader writes whole 4-byte values, which must not overwrite the padding at the end of
+    // the rows.
+    const bool isRowMultipleOfFour =
+        (packPixelsParams.area.width * packPixelsParams.destFormat->pixelBytes) % 4 == 0;
+
+    return !isEmulatedFormat && !isRotated && isRowMultipleOfFour;
+}
+
 void ReleaseBufferListToRenderer(RendererVk *renderer, BufferHelperPointerVector *buffers)
 {
     for (std::unique_ptr<BufferHelper> &toFree : *buffers)
@@ -1715,15 +1734,21 @@ void CommandBufferHelper::invalidateRenderPassStencilAttachment(
     ExtendRenderPassInvalidateArea(invalidateArea, &mStencilInvalidateArea);
 }
 
-angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &features,
+angle::Result CommandBufferHelper::flushToPrimary(Context *context,
                                                   PrimaryCommandBuffer *primary,
-                                                  const RenderPass *renderPass)
+                                                  const RenderPass *renderPass,
+                                                  ParallelCommandRecorder *parallelRecorder)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandBufferHelper::flushToPrimary");
     ASSERT(!empty());
 
     // Commands that are added to primary before beginRenderPass command
-    executeBarriers(features, primary);
+    executeBarriers(context->getRenderer()->getFeatures(), primary);
+
+    // Large command buffers are split in chunks that are recorded in parallel, and the secondary
+    // command buffers they are recorded in are executed instead.
+    const bool recordInParallel =
+        parallelRecorder != nullptr && parallelRecorder->splitIntoChunks(mCommandBuffer);
 
     if (mIsRenderPassCommandBuffer)
     {
@@ -1741,10 +1766,24 @@ angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &featu
         beginInfo.pClearValues    = mClearValues.data();
 
         // Run commands inside the RenderPass.
-        primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_INLINE);
-        mCommandBuffer.executeCommands(primary->getHandle());
+        if (recordInParallel)
+        {
+            primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            ANGLE_TRY(parallelRecorder->recordChunks(context, mCommandBuffer, renderPass,
+                                                     mFramebuffer.getHandle(), primary));
+        }
+        else
+        {
+            primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+            mCommandBuffer.executeCommands(primary->getHandle());
+        }
         primary->endRenderPass();
     }
+    else if (recordInParallel)
+    {
+        ANGLE_TRY(parallelRecorder->recordChunks(context, mCommandBuffer, nullptr, VK_NULL_HANDLE,
+                                                 primary));
+    }
     else
     {
         mCommandBuffer.executeCommands(primary->getHandle());
@@ -2305,6 +2344,260 @@ void DynamicBuffer::reset()
     mLastFlushOrInvalidateOffset = 0;
 }
 
+void CopyToWriteCombinedMemory(uint8_t *dst, const uint8_t *src, size_t size)
+{
+#if defined(ANGLE_USE_SSE)
+    // Write the destination in whole, aligned 16-byte chunks that bypass the cache, so that the
+    // write-combining buffers are flushed full.
+    constexpr size_t kChunkSize = 16;
+    const size_t headSize =
+        std::min(size, (kChunkSize - (reinterpret_cast<uintptr_t>(dst) % kChunkSize)) % kChunkSize);
+    memcpy(dst, src, headSize);
+    dst += headSize;
+    src += headSize;
+    size -= headSize;
+
+    for (; size >= kChunkSize; size -= kChunkSize, dst += kChunkSize, src += kChunkSize)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst), chunk);
+    }
+
+    // Make the non-temporal stores visible before the data is submitted to the GPU.
+    _mm_sfence();
+#endif  // defined(ANGLE_USE_SSE)
+
+    memcpy(dst, src, size);
+}
+
+// StreamingRingBuffer implementation.
+StreamingRingBuffer::StreamingRingBuffer()
+    : mUsage(0),
+      mAlignment(0),
+      mInitialSize(0),
+      mMappedMemory(nullptr),
+      mSize(0),
+      mCurrentRegionBegin(0),
+      mCurrentRegionHasData(false),
+      mHead(0)
+{}
+
+StreamingRingBuffer::~StreamingRingBuffer()
+{
+    ASSERT(mRegions.empty());
+}
+
+void StreamingRingBuffer::init(VkBufferUsageFlags usage, size_t alignment, size_t initialSize)
+{
+    ASSERT(gl::isPow2(alignment));
+    mUsage       = usage;
+    mAlignment   = alignment;
+    mInitialSize = initialSize;
+}
+
+angle::Result StreamingRingBuffer::createBuffer(ContextVk *contextVk, VkDeviceSize size)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    if (!mBuffer)
+    {
+        mBuffer = std::make_unique<BufferHelper>();
+    }
+    else if (mBuffer->valid())
+    {
+        // The commands recorded so far may still use the previous buffer, and read the data
+        // written to it since the last submission.  The memory may not be host-coherent, so the
+        // data is flushed before the buffer is given up.
+        if (mCurrentRegionHasData)
+        {
+            ANGLE_TRY(flushCurrentRegion(contextVk));
+        }
+        mBuffer->retain(&contextVk->getResourceUseList());
+        mBuffer->release(renderer);
+    }
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = size;
+    createInfo.usage                 = mUsage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    ANGLE_TRY(mBuffer->init(contextVk, createInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+    ANGLE_TRY(mBuffer->map(contextVk, &mMappedMemory));
+
+    // The regions of the previous buffer are tracked by the buffer itself from now on.
+    releaseRegions();
+    mSize                 = size;
+    mCurrentRegionBegin   = 0;
+    mCurrentRegionHasData = false;
+    mHead                 = 0;
+
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingRingBuffer::flushCurrentRegion(ContextVk *contextVk)
+{
+    ASSERT(mCurrentRegionHasData);
+
+    // Flush the current region with as few calls as possible, it may wrap around the end of the
+    // buffer.
+    RendererVk *renderer = contextVk->getRenderer();
+    if (mHead > mCurrentRegionBegin)
+    {
+        return mBuffer->flush(renderer, mCurrentRegionBegin, mHead - mCurrentRegionBegin);
+    }
+
+    ANGLE_TRY(mBuffer->flush(renderer, mCurrentRegionBegin, mSize - mCurrentRegionBegin));
+    return mBuffer->flush(renderer, 0, mHead);
+}
+
+void StreamingRingBuffer::retireCompletedRegions(Serial lastCompletedQueueSerial)
+{
+    while (!mRegions.empty() && !mRegions.front().use.isCurrentlyInUse(lastCompletedQueueSerial))
+    {
+        mRegions.front().use.release();
+        mRegions.pop_front();
+    }
+
+    if (isEmpty())
+    {
+        // Nothing is in use, so the next allocations can start from the beginning of the buffer.
+        mCurrentRegionBegin = 0;
+        mHead               = 0;
+    }
+}
+
+void StreamingRingBuffer::releaseRegions()
+{
+    for (Region &region : mRegions)
+    {
+        region.use.release();
+    }
+    mRegions.clear();
+}
+
+bool StreamingRingBuffer::allocateFromRing(VkDeviceSize sizeInBytes, VkDeviceSize *offsetOut)
+{
+    const VkDeviceSize tail = !mRegions.empty()     ? mRegions.front().begin
+                              : mCurrentRegionHasData ? mCurrentRegionBegin
+                                                      : mHead;
+    // The head and tail only meet when the ring is empty, as allocations are never empty.
+    ASSERT(sizeInBytes > 0);
+    if (isEmpty() || mHead > tail)
+    {
+        // Free space is from the head to the end of the buffer, and from the beginning of the
+        // buffer to the tail.
+        if (mHead + sizeInBytes <= mSize)
+        {
+            *offsetOut = mHead;
+        }
+        else if (sizeInBytes < tail)
+        {
+            // Wrap around.  The head never catches up with the tail, or the ring would look empty.
+            *offsetOut = 0;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        // Free space is from the head to the tail.
+        if (mHead + sizeInBytes >= tail)
+        {
+            return false;
+        }
+        *offsetOut = mHead;
+    }
+
+    if (!mCurrentRegionHasData)
+    {
+        mCurrentRegionBegin   = *offsetOut;
+        mCurrentRegionHasData = true;
+    }
+    mHead = *offsetOut + sizeInBytes;
+
+    return true;
+}
+
+angle::Result StreamingRingBuffer::allocate(ContextVk *contextVk,
+                                            size_t sizeInBytes,
+                                            uint8_t **ptrOut,
+                                            BufferHelper **bufferOut,
+                                            VkDeviceSize *offsetOut)
+{
+    const VkDeviceSize sizeToAllocate =
+        std::max<VkDeviceSize>(roundUpPow2(sizeInBytes, mAlignment), mAlignment);
+
+    if (mBuffer == nullptr || !mBuffer->valid())
+    {
+        VkDeviceSize size = std::max<VkDeviceSize>(
+            mInitialSize, gl::ceilPow2(static_cast<unsigned int>(sizeToAllocate)));
+        ANGLE_TRY(createBuffer(contextVk, size));
+    }
+
+    retireCompletedRegions(contextVk->getLastCompletedQueueSerial());
+
+    if (!allocateFromRing(sizeToAllocate, offsetOut))
+    {
+        // The GPU is still using too much of the ring, so replace it with a larger one instead of
+        // waiting.
+        VkDeviceSize size = std::max<VkDeviceSize>(
+            mSize * 2, gl::ceilPow2(static_cast<unsigned int>(sizeToAllocate)));
+        ANGLE_TRY(createBuffer(contextVk, size));
+
+        bool allocated = allocateFromRing(sizeToAllocate, offsetOut);
+        ASSERT(allocated);
+    }
+
+    *ptrOut    = mMappedMemory + *offsetOut;
+    *bufferOut = mBuffer.get();
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingRingBuffer::onSubmit(ContextVk *contextVk)
+{
+    if (!mCurrentRegionHasData)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(flushCurrentRegion(contextVk));
+
+    // Tie the region to this submission.  The buffer itself is retained too, in case the ring
+    // is later replaced while the submission is still in flight.
+    Region region;
+    region.use.init();
+    region.begin = mCurrentRegionBegin;
+    contextVk->getResourceUseList().add(region.use);
+    mRegions.push_back(std::move(region));
+    mBuffer->retain(&contextVk->getResourceUseList());
+
+    mCurrentRegionBegin   = mHead;
+    mCurrentRegionHasData = false;
+
+    return angle::Result::Continue;
+}
+
+void StreamingRingBuffer::release(RendererVk *renderer)
+{
+    releaseRegions();
+    if (mBuffer)
+    {
+        mBuffer->release(renderer);
+        mBuffer.reset();
+    }
+    mMappedMemory         = nullptr;
+    mSize                 = 0;
+    mCurrentRegionBegin   = 0;
+    mCurrentRegionHasData = false;
+    mHead                 = 0;
+}
+
 // DynamicShadowBuffer implementation.
 DynamicShadowBuffer::DynamicShadowBuffer() : mInitialSize(0), mSize(0) {}
 
@@ -3385,7 +3678,11 @@ void PipelineBarrier::addDiagnosticsString(std::ostringstream &out) const
 
 // BufferHelper implementation.
 BufferHelper::BufferHelper()
-    : mMemoryPropertyFlags{},
+    : mSlab(nullptr),
+      mSlabBuffer(nullptr),
+      mSuballocationOffset(0),
+      mSuballocationSize(0),
+      mMemoryPropertyFlags{},
       mSize(0),
       mCurrentQueueFamilyIndex(std::numeric_limits<uint32_t>::max()),
       mCurrentWriteAccess(0),
@@ -3611,6 +3908,24 @@ angle::Result BufferHelper::initExternal(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+void BufferHelper::initSuballocation(RendererVk *renderer,
+                                     BufferSlab *slab,
+                                     VkDeviceSize offset,
+                                     VkDeviceSize size)
+{
+    ASSERT(!valid());
+
+    mSlab                = slab;
+    mSlabBuffer          = &slab->getBuffer();
+    mSuballocationOffset = offset;
+    mSuballocationSize   = size;
+
+    mSerial                  = renderer->getResourceSerialFactory().generateBufferSerial();
+    mSize                    = mSlabBuffer->getSize();
+    mMemoryPropertyFlags     = mSlabBuffer->mMemoryPropertyFlags;
+    mCurrentQueueFamilyIndex = renderer->getQueueFamilyIndex();
+}
+
 angle::Result BufferHelper::initializeNonZeroMemory(Context *context, VkDeviceSize size)
 {
     // Staging buffer memory is non-zero-initialized in 'init'.
@@ -3645,6 +3960,13 @@ angle::Result BufferHelper::initializeNonZeroMemory(Context *context, VkDeviceSi
 
 void BufferHelper::destroy(RendererVk *renderer)
 {
+    if (isSuballocated())
+    {
+        // The slab owns the Vulkan objects, only the block needs to be returned to it.
+        release(renderer);
+        return;
+    }
+
     VkDevice device = renderer->getDevice();
     unmap(renderer);
     mSize = 0;
@@ -3658,6 +3980,17 @@ void BufferHelper::release(RendererVk *renderer)
     unmap(renderer);
     mSize = 0;
 
+    if (isSuballocated())
+    {
+        renderer->collectBufferSuballocationGarbageAndReinit(&mUse, mSlab, mSuballocationOffset,
+                                                             mSuballocationSize);
+        mSlab                = nullptr;
+        mSlabBuffer          = nullptr;
+        mSuballocationOffset = 0;
+        mSuballocationSize   = 0;
+        return;
+    }
+
     renderer->collectGarbageAndReinit(&mUse, &mBuffer, mMemory.getExternalMemoryObject(),
                                       mMemory.getMemoryObject());
 }
@@ -3682,18 +4015,27 @@ angle::Result BufferHelper::copyFromBuffer(ContextVk *contextVk,
     CommandBuffer *commandBuffer;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
-    commandBuffer->copyBuffer(srcBuffer->getBuffer(), mBuffer, regionCount, copyRegions);
+    commandBuffer->copyBuffer(srcBuffer->getBuffer(), getBuffer(), regionCount, copyRegions);
 
     return angle::Result::Continue;
 }
 
 void BufferHelper::unmap(RendererVk *renderer)
 {
-    mMemory.unmap(renderer);
+    // Suballocated buffers share the slab's mapping, which lives as long as the slab.
+    if (!isSuballocated())
+    {
+        mMemory.unmap(renderer);
+    }
 }
 
 angle::Result BufferHelper::flush(RendererVk *renderer, VkDeviceSize offset, VkDeviceSize size)
 {
+    if (isSuballocated())
+    {
+        return mSlabBuffer->flush(renderer, offset, size);
+    }
+
     bool hostVisible  = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
     bool hostCoherent = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     if (hostVisible && !hostCoherent)
@@ -3705,6 +4047,11 @@ angle::Result BufferHelper::flush(RendererVk *renderer, VkDeviceSize offset, VkD
 
 angle::Result BufferHelper::invalidate(RendererVk *renderer, VkDeviceSize offset, VkDeviceSize size)
 {
+    if (isSuballocated())
+    {
+        return mSlabBuffer->invalidate(renderer, offset, size);
+    }
+
     bool hostVisible  = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
     bool hostCoherent = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     if (hostVisible && !hostCoherent)
@@ -3722,7 +4069,7 @@ void BufferHelper::changeQueue(uint32_t newQueueFamilyIndex, CommandBuffer *comm
     bufferMemoryBarrier.dstAccessMask         = 0;
     bufferMemoryBarrier.srcQueueFamilyIndex   = mCurrentQueueFamilyIndex;
     bufferMemoryBarrier.dstQueueFamilyIndex   = newQueueFamilyIndex;
-    bufferMemoryBarrier.buffer                = mBuffer.getHandle();
+    bufferMemoryBarrier.buffer                = getBuffer().getHandle();
     bufferMemoryBarrier.offset                = 0;
     bufferMemoryBarrier.size                  = VK_WHOLE_SIZE;
 
@@ -3807,8 +4154,247 @@ bool BufferHelper::recordWriteBarrier(VkAccessFlags writeAccessType,
     return barrierModified;
 }
 
+// BufferSlab implementation.
+BufferSlab::BufferSlab() : mBlockSize(0), mBlockCount(0) {}
+
+BufferSlab::~BufferSlab() = default;
+
+angle::Result BufferSlab::init(ContextVk *contextVk,
+                               const BufferSuballocationDesc &desc,
+                               VkDeviceSize blockSize,
+                               VkDeviceSize slabSize)
+{
+    ASSERT(slabSize % blockSize == 0);
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = slabSize;
+    createInfo.usage                 = desc.usage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    ANGLE_TRY(mBuffer.init(contextVk, createInfo, desc.memoryPropertyFlags));
+
+    if (mBuffer.isHostVisible())
+    {
+        // The buffers suballocated from the slab share this mapping.
+        uint8_t *mappedMemory = nullptr;
+        ANGLE_TRY(mBuffer.map(contextVk, &mappedMemory));
+    }
+
+    mBlockSize  = blockSize;
+    mBlockCount = static_cast<uint32_t>(slabSize / blockSize);
+
+    // Initially, blocks are allocated from the start of the slab.
+    mFreeBlocks.resize(mBlockCount);
+    for (uint32_t blockIndex = 0; blockIndex < mBlockCount; ++blockIndex)
+    {
+        mFreeBlocks[blockIndex] = mBlockCount - 1 - blockIndex;
+    }
+
+    return angle::Result::Continue;
+}
+
+void BufferSlab::destroy(RendererVk *renderer)
+{
+    mBuffer.destroy(renderer);
+    mFreeBlocks.clear();
+    mBlockCount = 0;
+}
+
+VkDeviceSize BufferSlab::allocateBlock()
+{
+    ASSERT(hasFreeBlock());
+    const uint32_t blockIndex = mFreeBlocks.back();
+    mFreeBlocks.pop_back();
+    return blockIndex * mBlockSize;
+}
+
+void BufferSlab::freeBlock(VkDeviceSize offset)
+{
+    ASSERT(offset % mBlockSize == 0 && offset / mBlockSize < mBlockCount);
+    ASSERT(mFreeBlocks.size() < mBlockCount);
+    mFreeBlocks.push_back(static_cast<uint32_t>(offset / mBlockSize));
+}
+
+// BufferSuballocator implementation.
+BufferSuballocator::BufferSuballocator() : mStats{} {}
+
+BufferSuballocator::~BufferSuballocator() = default;
+
+void BufferSuballocator::destroy(RendererVk *renderer)
+{
+    // The device is idle by now, so whatever garbage is left can go along with its slab.
+    for (Garbage &garbage : mGarbage)
+    {
+        garbage.use.release();
+    }
+    mGarbage.clear();
+
+    for (Pool &pool : mPools)
+    {
+        for (SlabList &slabs : pool.sizeClasses)
+        {
+            for (std::unique_ptr<BufferSlab> &slab : slabs)
+            {
+                slab->destroy(renderer);
+            }
+        }
+    }
+
+    mPools.clear();
+    mStats = {};
+}
+
+BufferSuballocator::Pool &BufferSuballocator::getPool(const BufferSuballocationDesc &desc)
+{
+    for (Pool &pool : mPools)
+    {
+        if (pool.desc.usage == desc.usage &&
+            pool.desc.memoryPropertyFlags == desc.memoryPropertyFlags &&
+            pool.desc.alignment == desc.alignment)
+        {
+            return pool;
+        }
+    }
+
+    mPools.emplace_back();
+    mPools.back().desc = desc;
+    return mPools.back();
+}
+
+// static
+BufferSlab *BufferSuballocator::FindSlabWithFreeBlock(const SlabList &slabs)
+{
+    // Allocate from the oldest slab with a free block, so the newest slabs are the first to become
+    // empty.
+    for (const std::unique_ptr<BufferSlab> &slab : slabs)
+    {
+        if (slab->hasFreeBlock())
+        {
+            return slab.get();
+        }
+    }
+    return nullptr;
+}
+
+angle::Result BufferSuballocator::allocate(ContextVk *contextVk,
+                                           const BufferSuballocationDesc &desc,
+                                           VkDeviceSize size,
+                                           Serial lastCompletedQueueSerial,
+                                           BufferHelper *bufferOut)
+{
+    ASSERT(size > 0 && size <= kMaxBufferSuballocationSize);
+    ASSERT(gl::isPow2(desc.alignment));
+
+    // Blocks are aligned to their size, which is a multiple of the alignment.
+    const VkDeviceSize blockSize =
+        std::max<VkDeviceSize>(gl::ceilPow2(static_cast<unsigned int>(size)), desc.alignment);
+    ASSERT(blockSize <= kBufferSlabSize);
+
+    const size_t sizeClass = gl::log2(blockSize);
+    ASSERT(sizeClass < kMaxSizeClassCount);
+    SlabList &slabs = getPool(desc).sizeClasses[sizeClass];
+
+    BufferSlab *slab = FindSlabWithFreeBlock(slabs);
+    if (slab == nullptr && !mGarbage.empty())
+    {
+        cleanupGarbage(contextVk->getRenderer(), lastCompletedQueueSerial);
+        slab = FindSlabWithFreeBlock(slabs);
+    }
+
+    if (slab == nullptr)
+    {
+        std::unique_ptr<BufferSlab> newSlab = std::make_unique<BufferSlab>();
+        ANGLE_TRY(newSlab->init(contextVk, desc, blockSize, kBufferSlabSize));
+        slab = newSlab.get();
+        slabs.push_back(std::move(newSlab));
+
+        ++mStats.slabs;
+        mStats.slabBytes += slab->getSize();
+    }
+
+    bufferOut->initSuballocation(contextVk->getRenderer(), slab, slab->allocateBlock(), size);
+
+    ++mStats.liveBlocks;
+    mStats.liveBytes += size;
+
+    return angle::Result::Continue;
+}
+
+void BufferSuballocator::collectGarbage(SharedResourceUse &&use,
+                                        BufferSlab *slab,
+                                        VkDeviceSize offset,
+                                        VkDeviceSize size)
+{
+    ASSERT(mStats.liveBlocks > 0 && mStats.liveBytes >= size);
+    --mStats.liveBlocks;
+    mStats.liveBytes -= size;
+
+    mGarbage.push_back({std::move(use), slab, offset, size});
+}
+
+void BufferSuballocator::cleanupGarbage(RendererVk *renderer, Serial lastCompletedQueueSerial)
+{
+    bool anyBlockFreed = false;
+
+    for (size_t garbageIndex = 0; garbageIndex < mGarbage.size();)
+    {
+        Garbage &garbage = mGarbage[garbageIndex];
+        if (garbage.use.isCurrentlyInUse(lastCompletedQueueSerial))
+        {
+            ++garbageIndex;
+            continue;
+        }
+
+        garbage.use.release();
+        garbage.slab->freeBlock(garbage.offset);
+        anyBlockFreed = true;
+
+        // The order of the garbage doesn't matter, replace it with the last one.
+        if (garbageIndex + 1 < mGarbage.size())
+        {
+            garbage = std::move(mGarbage.back());
+        }
+        mGarbage.pop_back();
+    }
+
+    if (anyBlockFreed)
+    {
+        destroyEmptySlabs(renderer);
+    }
+}
+
+void BufferSuballocator::destroyEmptySlabs(RendererVk *renderer)
+{
+    for (Pool &pool : mPools)
+    {
+        for (SlabList &slabs : pool.sizeClasses)
+        {
+            // The first slab is kept even if empty, so that a size class that is used again
+            // doesn't need to create a new slab right away.
+            for (size_t slabIndex = 1; slabIndex < slabs.size();)
+            {
+                if (!slabs[slabIndex]->isEmpty())
+                {
+                    ++slabIndex;
+                    continue;
+                }
+
+                --mStats.slabs;
+                mStats.slabBytes -= slabs[slabIndex]->getSize();
+
+                slabs[slabIndex]->destroy(renderer);
+                slabs.erase(slabs.begin() + slabIndex);
+            }
+        }
+    }
+}
+
 // ImageHelper implementation.
-ImageHelper::ImageHelper()
+ImageHelper::ImageHelper() : mAllocationSize(0), mMemoryTypeIndex(0)
 {
     resetCachedProperties();
 }
@@ -3817,6 +4403,8 @@ ImageHelper::ImageHelper(ImageHelper &&other)
     : Resource(std::move(other)),
       mImage(std::move(other.mImage)),
       mDeviceMemory(std::move(other.mDeviceMemory)),
+      mAllocationSize(other.mAllocationSize),
+      mMemoryTypeIndex(other.mMemoryTypeIndex),
       mImageType(other.mImageType),
       mTilingMode(other.mTilingMode),
       mCreateFlags(other.mCreateFlags),
@@ -3842,6 +4430,7 @@ ImageHelper::ImageHelper(ImageHelper &&other)
       mStencilContentDefined(std::move(other.mStencilContentDefined))
 {
     ASSERT(this != &other);
+    other.mAllocationSize = 0;
     other.resetCachedProperties();
 }
 
@@ -3875,6 +4464,15 @@ void ImageHelper::resetCachedProperties()
     setEntireContentUndefined();
 }
 
+void ImageHelper::onMemoryReleased(RendererVk *renderer)
+{
+    if (mAllocationSize > 0)
+    {
+        renderer->onImageMemoryReleased(mMemoryTypeIndex, mAllocationSize);
+        mAllocationSize = 0;
+    }
+}
+
 void ImageHelper::setEntireContentDefined()
 {
     for (LevelContentDefinedMask &levelContentDefined : mContentDefined)
@@ -4157,6 +4755,7 @@ angle::Result ImageHelper::initExternal(Context *context,
 
 void ImageHelper::releaseImage(RendererVk *renderer)
 {
+    onMemoryReleased(renderer);
     renderer->collectGarbageAndReinit(&mUse, &mImage, &mDeviceMemory);
     mImageSerial = kInvalidImageSerial;
 
@@ -4328,10 +4927,18 @@ angle::Result ImageHelper::initMemory(Context *context,
     {
         flags |= VK_MEMORY_PROPERTY_PROTECTED_BIT;
     }
-    ANGLE_TRY(AllocateImageMemory(context, flags, &flags, nullptr, &mImage, &mDeviceMemory, &size));
+    uint32_t memoryTypeIndex;
+    ANGLE_TRY(AllocateImageMemory(context, flags, &flags, nullptr, &mImage, &mDeviceMemory,
+                                  &memoryTypeIndex, &size));
     mCurrentQueueFamilyIndex = context->getRenderer()->getQueueFamilyIndex();
 
     RendererVk *renderer = context->getRenderer();
+
+    ASSERT(mAllocationSize == 0);
+    mAllocationSize  = size;
+    mMemoryTypeIndex = memoryTypeIndex;
+    renderer->onImageMemoryAllocated(mMemoryTypeIndex, mAllocationSize);
+
     if (renderer->getFeatures().allocateNonZeroMemory.enabled)
     {
         // Can't map the memory. Use a staging resource.
@@ -4524,6 +5131,7 @@ void ImageHelper::destroy(RendererVk *renderer)
 {
     VkDevice device = renderer->getDevice();
 
+    onMemoryReleased(renderer);
     mImage.destroy(device);
     mDeviceMemory.destroy(device);
     mStagingBuffer.destroy(renderer);
@@ -5399,19 +6007,21 @@ void ImageHelper::removeStagedUpdates(Context *context,
     ASSERT(validateSubresourceUpdateImageRefsConsistent());
 }
 
-angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
-                                                      const gl::ImageIndex &index,
-                                                      const gl::Extents &glExtents,
-                                                      const gl::Offset &offset,
-                                                      const gl::InternalFormat &formatInfo,
-                                                      const gl::PixelUnpackState &unpack,
-                                                      DynamicBuffer *stagingBufferOverride,
-                                                      GLenum type,
-                                                      const uint8_t *pixels,
-                                                      const Format &vkFormat,
-                                                      const GLuint inputRowPitch,
-                                                      const GLuint inputDepthPitch,
-                                                      const GLuint inputSkipBytes)
+angle::Result ImageHelper::stageSubresourceUpdateImpl(
+    ContextVk *contextVk,
+    const gl::ImageIndex &index,
+    const gl::Extents &glExtents,
+    const gl::Offset &offset,
+    const gl::InternalFormat &formatInfo,
+    const gl::PixelUnpackState &unpack,
+    DynamicBuffer *stagingBufferOverride,
+    GLenum type,
+    const uint8_t *pixels,
+    const Format &vkFormat,
+    const GLuint inputRowPitch,
+    const GLuint inputDepthPitch,
+    const GLuint inputSkipBytes,
+    const std::shared_ptr<angle::WorkerThreadPool> &workerPool)
 {
     const angle::Format &storageFormat = vkFormat.actualImageFormat();
 
@@ -5521,9 +6131,30 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
 
     const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
 
-    loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
-                                  inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
-                                  outputDepthPitch);
+    // Large images are converted in parallel, directly into the staging buffer.  This includes
+    // the decoding and transcoding of emulated compressed formats, which are split along rows of
+    // blocks.  The load functions of YUV and 3D block formats don't convert rows independently of
+    // each other.
+    const gl::InternalFormat &storageFormatInfo =
+        gl::GetSizedInternalFormatInfo(storageFormat.glInternalFormat);
+    if (!storageFormat.isYUV && formatInfo.compressedBlockDepth <= 1 &&
+        storageFormatInfo.compressedBlockDepth <= 1)
+    {
+        const GLuint inputBlockHeight =
+            formatInfo.compressed ? formatInfo.compressedBlockHeight : 1;
+        const GLuint outputBlockHeight =
+            storageFormat.isBlock ? storageFormatInfo.compressedBlockHeight : 1;
+        LoadImageInParallel(workerPool, loadFunctionInfo.loadFunction, inputBlockHeight,
+                            outputBlockHeight, glExtents.width, glExtents.height, glExtents.depth,
+                            source, inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
+                            outputDepthPitch);
+    }
+    else
+    {
+        loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
+                                      inputRowPitch, inputDepthPitch, stagingPointer,
+                                      outputRowPitch, outputDepthPitch);
+    }
 
     // YUV formats need special handling.
     if (vkFormat.actualImageFormat().isYUV)
@@ -5787,16 +6418,18 @@ void ImageHelper::restoreSubresourceStencilContent(gl::LevelIndex level,
     }
 }
 
-angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
-                                                  const gl::ImageIndex &index,
-                                                  const gl::Extents &glExtents,
-                                                  const gl::Offset &offset,
-                                                  const gl::InternalFormat &formatInfo,
-                                                  const gl::PixelUnpackState &unpack,
-                                                  DynamicBuffer *stagingBufferOverride,
-                                                  GLenum type,
-                                                  const uint8_t *pixels,
-                                                  const Format &vkFormat)
+angle::Result ImageHelper::stageSubresourceUpdate(
+    ContextVk *contextVk,
+    const gl::ImageIndex &index,
+    const gl::Extents &glExtents,
+    const gl::Offset &offset,
+    const gl::InternalFormat &formatInfo,
+    const gl::PixelUnpackState &unpack,
+    DynamicBuffer *stagingBufferOverride,
+    GLenum type,
+    const uint8_t *pixels,
+    const Format &vkFormat,
+    const std::shared_ptr<angle::WorkerThreadPool> &workerPool)
 {
     GLuint inputRowPitch   = 0;
     GLuint inputDepthPitch = 0;
@@ -5806,7 +6439,8 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
 
     ANGLE_TRY(stageSubresourceUpdateImpl(contextVk, index, glExtents, offset, formatInfo, unpack,
                                          stagingBufferOverride, type, pixels, vkFormat,
-                                         inputRowPitch, inputDepthPitch, inputSkipBytes));
+                                         inputRowPitch, inputDepthPitch, inputSkipBytes,
+                                         workerPool));
 
     return angle::Result::Continue;
 }
@@ -6141,8 +6775,11 @@ void ImageHelper::stageSelfAsSubresourceUpdates(ContextVk *contextVk,
     // object.
 
     // Vulkan objects
-    prevImage->get().mImage        = std::move(mImage);
-    prevImage->get().mDeviceMemory = std::move(mDeviceMemory);
+    prevImage->get().mImage           = std::move(mImage);
+    prevImage->get().mDeviceMemory    = std::move(mDeviceMemory);
+    prevImage->get().mAllocationSize  = mAllocationSize;
+    prevImage->get().mMemoryTypeIndex = mMemoryTypeIndex;
+    mAllocationSize                   = 0;
 
     // Barrier information.  Note: mLevelCount is set to levelCount so that only the necessary
     // levels are transitioned when flushing the update.
@@ -6183,6 +6820,40 @@ void ImageHelper::stageSelfAsSubresourceUpdates(ContextVk *contextVk,
     prevImage.release();
 }
 
+angle::Result ImageHelper::stageSelfToHostMemory(ContextVk *contextVk)
+{
+    ASSERT(valid());
+    ASSERT(!isCombinedDepthStencilFormat());
+
+    for (LevelIndex levelVk(0); levelVk < LevelIndex(mLevelCount); ++levelVk)
+    {
+        const gl::LevelIndex levelGL = toGLLevel(levelVk);
+        const gl::Extents extents    = getLevelExtents(levelVk);
+        const gl::Box area(0, 0, 0, extents.width, extents.height, extents.depth);
+
+        BufferHelper *buffer = nullptr;
+        size_t bufferSize    = 0;
+        StagingBufferOffsetArray bufferOffsets;
+        uint8_t *dataPtr = nullptr;
+        ANGLE_TRY(copyImageDataToBuffer(contextVk, levelGL, mLayerCount, 0, area, &buffer,
+                                        &bufferSize, &bufferOffsets, &dataPtr));
+
+        VkBufferImageCopy copy               = {};
+        copy.bufferOffset                    = bufferOffsets[0];
+        copy.bufferRowLength                 = 0;
+        copy.bufferImageHeight               = 0;
+        copy.imageSubresource.aspectMask     = getAspectFlags();
+        copy.imageSubresource.mipLevel       = levelGL.get();
+        copy.imageSubresource.baseArrayLayer = 0;
+        copy.imageSubresource.layerCount     = mLayerCount;
+        gl_vk::GetExtent(extents, &copy.imageExtent);
+
+        appendSubresourceUpdate(levelGL, SubresourceUpdate(buffer, copy));
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::flushSingleSubresourceStagedUpdates(ContextVk *contextVk,
                                                                gl::LevelIndex levelGL,
                                                                uint32_t layer,
@@ -7024,13 +7695,94 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
         return angle::Result::Continue;
     }
 
+    // If PBO and the formats differ, convert on the GPU if possible.
+    if (packPixelsParams.packBuffer && renderer->getFeatures().convertPixelsWithCompute.enabled &&
+        CanConvertWithComputeForReadPixels(packPixelsParams, mFormat, readFormat))
+    {
+        VkDeviceSize packBufferOffset = 0;
+        BufferHelper &packBuffer =
+            GetImpl(packPixelsParams.packBuffer)->getBufferAndOffset(&packBufferOffset);
+
+        UtilsVk::ConvertPixelsParameters convertParams;
+        convertParams.srcFormat  = readFormat;
+        convertParams.destFormat = packPixelsParams.destFormat;
+        convertParams.width      = area.width;
+        convertParams.height     = area.height;
+        convertParams.srcOffset  = 0;
+        convertParams.srcPitch   = area.width * readFormat->pixelBytes;
+        convertParams.destOffset =
+            packBufferOffset + packPixelsParams.offset + reinterpret_cast<ptrdiff_t>(pixels);
+        convertParams.destPitch       = packPixelsParams.outputPitch;
+        convertParams.reverseRowOrder = packPixelsParams.reverseRowOrder;
+
+        if (UtilsVk::CanConvertPixels(convertParams))
+        {
+            // Copy the pixels tightly packed to a temporary buffer, and convert them from there
+            // into the PBO.
+            RendererScoped<BufferHelper> convertBuffer(renderer);
+
+            VkBufferCreateInfo bufferInfo = {};
+            bufferInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.flags              = 0;
+            bufferInfo.size               = roundUpPow2<VkDeviceSize>(
+                static_cast<VkDeviceSize>(convertParams.srcPitch) * area.height, sizeof(uint32_t));
+            bufferInfo.usage =
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            bufferInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+            bufferInfo.queueFamilyIndexCount = 0;
+            bufferInfo.pQueueFamilyIndices   = nullptr;
+
+            ANGLE_TRY(convertBuffer.get().init(contextVk, bufferInfo,
+                                               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+            convertBuffer.get().retain(&contextVk->getResourceUseList());
+
+            CommandBufferAccess convertAccess;
+            convertAccess.onBufferTransferWrite(&convertBuffer.get());
+            convertAccess.onImageTransferRead(copyAspectFlags, src);
+
+            CommandBuffer *convertCommandBuffer;
+            ANGLE_TRY(
+                contextVk->getOutsideRenderPassCommandBuffer(convertAccess, &convertCommandBuffer));
+
+            VkBufferImageCopy region = {};
+            region.imageExtent       = srcExtent;
+            region.imageOffset       = srcOffset;
+            region.imageSubresource  = srcSubresource;
+
+            convertCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(),
+                                                    convertBuffer.get().getBuffer().getHandle(), 1,
+                                                    &region);
+
+            return contextVk->getUtils().convertPixels(contextVk, &packBuffer,
+                                                       &convertBuffer.get(), convertParams);
+        }
+    }
+
     VkBuffer bufferHandle      = VK_NULL_HANDLE;
     uint8_t *readPixelBuffer   = nullptr;
     VkDeviceSize stagingOffset = 0;
     size_t allocationSize      = readFormat->pixelBytes * area.width * area.height;
 
-    ANGLE_TRY(stagingBuffer->allocate(contextVk, allocationSize, &readPixelBuffer, &bufferHandle,
-                                      &stagingOffset, nullptr));
+    // With a PBO, packing the pixels can wait until the PBO is next accessed, so the application
+    // can keep several readbacks in flight.
+    BufferVk *packBufferVk =
+        packPixelsParams.packBuffer ? GetImpl(packPixelsParams.packBuffer) : nullptr;
+    PendingReadPixels *pendingReadPixels = nullptr;
+    BufferHelper *readbackBuffer         = nullptr;
+
+    if (packBufferVk && renderer->getFeatures().deferReadPixelsPacking.enabled &&
+        packBufferVk->canDeferReadPixelsPacking(contextVk))
+    {
+        ANGLE_TRY(contextVk->allocatePendingReadPixels(allocationSize, &pendingReadPixels));
+        readbackBuffer = &pendingReadPixels->readbackBuffer;
+        bufferHandle   = readbackBuffer->getBuffer().getHandle();
+    }
+    else
+    {
+        ANGLE_TRY(stagingBuffer->allocate(contextVk, allocationSize, &readPixelBuffer,
+                                          &bufferHandle, &stagingOffset, nullptr));
+        readbackBuffer = stagingBuffer->getCurrentBuffer();
+    }
 
     VkBufferImageCopy region = {};
     region.bufferImageHeight = srcExtent.height;
@@ -7041,7 +7793,7 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
     region.imageSubresource  = srcSubresource;
 
     CommandBufferAccess readbackAccess;
-    readbackAccess.onBufferTransferWrite(stagingBuffer->getCurrentBuffer());
+    readbackAccess.onBufferTransferWrite(readbackBuffer);
 
     CommandBuffer *readbackCommandBuffer;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(readbackAccess, &readbackCommandBuffer));
@@ -7049,22 +7801,26 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
     readbackCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(), bufferHandle,
                                              1, &region);
 
-    ANGLE_PERF_WARNING(contextVk->getDebug(), GL_DEBUG_SEVERITY_HIGH,
-                       "GPU stall due to ReadPixels");
+    if (pendingReadPixels)
+    {
+        pendingReadPixels->params           = packPixelsParams;
+        pendingReadPixels->readFormat       = readFormat;
+        pendingReadPixels->packBufferOffset = reinterpret_cast<ptrdiff_t>(pixels);
+        pendingReadPixels->inputPitch       = area.width * readFormat->pixelBytes;
+        return contextVk->deferReadPixelsPacking(packBufferVk, pendingReadPixels);
+    }
 
-    // Triggers a full finish.
-    // TODO(jmadill): Don't block on asynchronous readback.
-    ANGLE_TRY(contextVk->finishImpl());
+    // Submit the copy, and wait only for the submission that contains it.
+    ANGLE_TRY(readbackBuffer->waitForIdle(contextVk, "GPU stall due to ReadPixels"));
 
     // The buffer we copied to needs to be invalidated before we read from it because its not been
     // created with the host coherent bit.
     ANGLE_TRY(stagingBuffer->invalidate(contextVk));
 
-    if (packPixelsParams.packBuffer)
+    if (packBufferVk)
     {
         // Must map the PBO in order to read its contents (and then unmap it later)
-        BufferVk *packBufferVk = GetImpl(packPixelsParams.packBuffer);
-        void *mapPtr           = nullptr;
+        void *mapPtr = nullptr;
         ANGLE_TRY(packBufferVk->mapImpl(contextVk, &mapPtr));
         uint8_t *dest = static_cast<uint8_t *>(mapPtr) + reinterpret_cast<ptrdiff_t>(pixels);
         PackPixels(packPixelsParams, *readFormat, area.width * readFormat->pixelBytes,
@@ -8019,6 +8775,34 @@ void ShaderProgramHelper::setSpecializationConstant(sh::vk::SpecializationConsta
     }
 }
 
+angle::Result ShaderProgramHelper::warmUpGraphicsPipeline(
+    ContextVk *contextVk,
+    RenderPassCache *renderPassCache,
+    const PipelineCache &pipelineCache,
+    const PipelineLayout &pipelineLayout,
+    const GraphicsPipelineDesc &pipelineDesc,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask)
+{
+    RenderPass *compatibleRenderPass = nullptr;
+    ANGLE_TRY(renderPassCache->getCompatibleRenderPass(
+        contextVk, pipelineDesc.getRenderPassDesc(), &compatibleRenderPass));
+
+    gl::ShaderMap<const ShaderModule *> shaderModules;
+    for (const gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        shaderModules[shaderType] =
+            mShaders[shaderType].valid() ? &mShaders[shaderType].get().get() : nullptr;
+    }
+
+    return mGraphicsPipelines.warmUpPipeline(
+        contextVk, pipelineCache, *compatibleRenderPass, pipelineLayout, activeAttribLocationsMask,
+        programAttribsTypeMask, shaderModules[gl::ShaderType::Vertex],
+        shaderModules[gl::ShaderType::Fragment], shaderModules[gl::ShaderType::Geometry],
+        shaderModules[gl::ShaderType::TessControl], shaderModules[gl::ShaderType::TessEvaluation],
+        mSpecializationConstants, pipelineDesc);
+}
+
 angle::Result ShaderProgramHelper::getComputePipeline(Context *context,
                                                       const PipelineLayout &pipelineLayout,
                                                       PipelineAndSerial **pipelineOut)
@@ -9,6 +9,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 
+#include <deque>
+
 #include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/vulkan/ResourceVk.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
@@ -182,6 +184,78 @@ class DynamicBuffer : angle::NonCopyable
     BufferHelperPointerVector mBufferFreeList;
 };
 
+// Copies data to memory that may be write-combined, such as a mapped buffer that is not
+// HOST_CACHED.  The destination is written sequentially and never read, and where possible with
+// non-temporal stores.
+void CopyToWriteCombinedMemory(uint8_t *dst, const uint8_t *src, size_t size);
+
+// A persistently mapped, host-visible buffer used as a ring, for data that is written by the CPU
+// once per draw and read by the GPU only by that draw, such as client-side vertex arrays and
+// indices.  Unlike DynamicBuffer, allocations don't create buffers in the steady state, and the
+// data written since the last submission is flushed all at once by onSubmit(), or when the ring
+// is replaced.
+//
+// The allocations of every submission are tracked as a region of the ring, which is reused once
+// the GPU has finished with the submission.  If an allocation doesn't fit in the space that is not
+// in use, the ring is replaced with one twice as large.  The same BufferHelper is reused for it, so
+// pointers to getBuffer() stay valid, but its VkBuffer changes: users cache the VkBuffer handle
+// when they allocate.
+class StreamingRingBuffer : angle::NonCopyable
+{
+  public:
+    StreamingRingBuffer();
+    ~StreamingRingBuffer();
+
+    // The buffer is created on first allocation.
+    void init(VkBufferUsageFlags usage, size_t alignment, size_t initialSize);
+
+    angle::Result allocate(ContextVk *contextVk,
+                           size_t sizeInBytes,
+                           uint8_t **ptrOut,
+                           BufferHelper **bufferOut,
+                           VkDeviceSize *offsetOut);
+
+    // Called before every submission: flushes the data written since the last submission, and ties
+    // its region of the ring to the submission.
+    angle::Result onSubmit(ContextVk *contextVk);
+
+    // This releases resources when they might currently be in use.
+    void release(RendererVk *renderer);
+
+    BufferHelper *getBuffer() const { return mBuffer.get(); }
+    VkDeviceSize getSize() const { return mSize; }
+
+  private:
+    struct Region
+    {
+        SharedResourceUse use;
+        VkDeviceSize begin;
+    };
+
+    angle::Result createBuffer(ContextVk *contextVk, VkDeviceSize size);
+    angle::Result flushCurrentRegion(ContextVk *contextVk);
+    void retireCompletedRegions(Serial lastCompletedQueueSerial);
+    void releaseRegions();
+    bool allocateFromRing(VkDeviceSize sizeInBytes, VkDeviceSize *offsetOut);
+    bool isEmpty() const { return mRegions.empty() && !mCurrentRegionHasData; }
+
+    VkBufferUsageFlags mUsage;
+    size_t mAlignment;
+    size_t mInitialSize;
+    std::unique_ptr<BufferHelper> mBuffer;
+    uint8_t *mMappedMemory;
+    VkDeviceSize mSize;
+
+    // The ring contains the regions of the submissions in flight, from oldest to newest, followed
+    // by the region of the upcoming submission, which starts at mCurrentRegionBegin and ends at
+    // mHead.  Data is in use from the beginning of the oldest region to mHead, possibly wrapping
+    // around the end of the buffer.
+    std::deque<Region> mRegions;
+    VkDeviceSize mCurrentRegionBegin;
+    bool mCurrentRegionHasData;
+    VkDeviceSize mHead;
+};
+
 // Based off of the DynamicBuffer class, DynamicShadowBuffer provides
 // a similar conceptually infinitely long buffer that will only be written
 // to and read by the CPU. This can be used to provide CPU cached copies of
@@ -325,6 +399,8 @@ class DynamicDescriptorPool final : angle::NonCopyable
                                          VkDescriptorSet *descriptorSetsOut,
                                          bool *newPoolAllocatedOut);
 
+    size_t getPoolCount() const { return mDescriptorPools.size(); }
+
     // For testing only!
     static uint32_t GetMaxSetsPerPoolForTesting();
     static void SetMaxSetsPerPoolForTesting(uint32_t maxSetsPerPool);
@@ -844,6 +920,17 @@ class BufferMemory : angle::NonCopyable
     uint8_t *mMappedMemory;
 };
 
+class BufferSlab;
+
+// Buffers suballocated from the same BufferSlabs have the same usage and memory properties, and
+// offsets aligned to |alignment|.
+struct BufferSuballocationDesc
+{
+    VkBufferUsageFlags usage;
+    VkMemoryPropertyFlags memoryPropertyFlags;
+    VkDeviceSize alignment;
+};
+
 class BufferHelper final : public Resource
 {
   public:
@@ -857,18 +944,28 @@ class BufferHelper final : public Resource
                                VkMemoryPropertyFlags memoryProperties,
                                const VkBufferCreateInfo &requestedCreateInfo,
                                GLeglClientBufferEXT clientBuffer);
+    // Initializes the buffer as a block of |slab|, see BufferSuballocator.  The VkBuffer and its
+    // memory belong to the slab, so the buffer behaves like the whole slab buffer: its data starts
+    // at getSuballocationOffset(), and getSize(), map() and flush() refer to the slab buffer.
+    void initSuballocation(RendererVk *renderer,
+                           BufferSlab *slab,
+                           VkDeviceSize offset,
+                           VkDeviceSize size);
     void destroy(RendererVk *renderer);
 
     void release(RendererVk *renderer);
 
     BufferSerial getBufferSerial() const { return mSerial; }
-    bool valid() const { return mBuffer.valid(); }
-    const Buffer &getBuffer() const { return mBuffer; }
+    bool valid() const { return isSuballocated() || mBuffer.valid(); }
+    const Buffer &getBuffer() const
+    {
+        return isSuballocated() ? mSlabBuffer->getBuffer() : mBuffer;
+    }
     VkDeviceSize getSize() const { return mSize; }
     uint8_t *getMappedMemory() const
     {
         ASSERT(isMapped());
-        return mMemory.getMappedMemory();
+        return isSuballocated() ? mSlabBuffer->getMappedMemory() : mMemory.getMappedMemory();
     }
     bool isHostVisible() const
     {
@@ -879,9 +976,15 @@ class BufferHelper final : public Resource
         return (mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
     }
 
-    bool isMapped() const { return mMemory.getMappedMemory() != nullptr; }
+    bool isMapped() const
+    {
+        return isSuballocated() ? mSlabBuffer->isMapped() : mMemory.getMappedMemory() != nullptr;
+    }
     bool isExternalBuffer() const { return mMemory.isExternalBuffer(); }
 
+    bool isSuballocated() const { return mSlab != nullptr; }
+    VkDeviceSize getSuballocationOffset() const { return mSuballocationOffset; }
+
     // Also implicitly sets up the correct barriers.
     angle::Result copyFromBuffer(ContextVk *contextVk,
                                  BufferHelper *srcBuffer,
@@ -890,13 +993,19 @@ class BufferHelper final : public Resource
 
     angle::Result map(ContextVk *contextVk, uint8_t **ptrOut)
     {
+        if (isSuballocated())
+        {
+            // Host visible slabs stay mapped for as long as they exist.
+            *ptrOut = getMappedMemory();
+            return angle::Result::Continue;
+        }
         return mMemory.map(contextVk, mSize, ptrOut);
     }
 
     angle::Result mapWithOffset(ContextVk *contextVk, uint8_t **ptrOut, size_t offset)
     {
         uint8_t *mapBufPointer;
-        ANGLE_TRY(mMemory.map(contextVk, mSize, &mapBufPointer));
+        ANGLE_TRY(map(contextVk, &mapBufPointer));
         *ptrOut = mapBufPointer + offset;
         return angle::Result::Continue;
     }
@@ -941,6 +1050,13 @@ class BufferHelper final : public Resource
     Buffer mBuffer;
     BufferMemory mMemory;
 
+    // For suballocated buffers, the slab that owns the Vulkan objects instead, and the range of
+    // the slab's buffer that this buffer uses.
+    BufferSlab *mSlab;
+    BufferHelper *mSlabBuffer;
+    VkDeviceSize mSuballocationOffset;
+    VkDeviceSize mSuballocationSize;
+
     // Cached properties.
     VkMemoryPropertyFlags mMemoryPropertyFlags;
     VkDeviceSize mSize;
@@ -955,6 +1071,122 @@ class BufferHelper final : public Resource
     BufferSerial mSerial;
 };
 
+// A large buffer divided into blocks of the same size, each of which holds the data of a small
+// buffer.  See BufferSuballocator.
+class BufferSlab final : angle::NonCopyable
+{
+  public:
+    BufferSlab();
+    ~BufferSlab();
+
+    angle::Result init(ContextVk *contextVk,
+                       const BufferSuballocationDesc &desc,
+                       VkDeviceSize blockSize,
+                       VkDeviceSize slabSize);
+    void destroy(RendererVk *renderer);
+
+    BufferHelper &getBuffer() { return mBuffer; }
+    VkDeviceSize getBlockSize() const { return mBlockSize; }
+    VkDeviceSize getSize() const { return mBlockSize * mBlockCount; }
+
+    bool hasFreeBlock() const { return !mFreeBlocks.empty(); }
+    bool isEmpty() const { return mFreeBlocks.size() == mBlockCount; }
+
+    // Returns the offset of the block.
+    VkDeviceSize allocateBlock();
+    void freeBlock(VkDeviceSize offset);
+
+  private:
+    BufferHelper mBuffer;
+    VkDeviceSize mBlockSize;
+    uint32_t mBlockCount;
+    // Indices of the free blocks.  The lowest indices are at the back, so blocks are allocated
+    // from the start of the slab first.
+    std::vector<uint32_t> mFreeBlocks;
+};
+
+// Buffers of up to this size are suballocated.
+constexpr VkDeviceSize kMaxBufferSuballocationSize = 16 * 1024;
+// The size of the slabs of every size class.
+constexpr VkDeviceSize kBufferSlabSize = 256 * 1024;
+
+struct BufferSuballocatorStats
+{
+    // The number of live suballocated buffers.
+    uint32_t liveBlocks;
+    // The number of slabs, and their total size.
+    uint32_t slabs;
+    VkDeviceSize slabBytes;
+    // The total size of the live suballocated buffers.  The rest of the slabs is either free, or
+    // lost to the rounding up of the buffer sizes to their size class.
+    VkDeviceSize liveBytes;
+};
+
+// Suballocates small buffers from BufferSlabs, instead of creating a VkBuffer for each of them.
+// Slabs are grouped by BufferSuballocationDesc, then by size class.  The size classes are the
+// powers of two between the alignment of the buffers and kMaxBufferSuballocationSize, and a slab
+// only holds buffers of one size class, so no slab is ever fragmented into blocks that are too
+// small to be used.
+//
+// Every suballocated buffer has its own BufferHelper, which tracks the buffer's use by the GPU and
+// its memory barriers.  When a buffer is released, its block is returned to its slab once the GPU
+// is done with it.  Slabs that have become empty are destroyed, except for the first one of each
+// size class.
+//
+// Not thread safe, RendererVk locks around it.
+class BufferSuballocator final : angle::NonCopyable
+{
+  public:
+    BufferSuballocator();
+    ~BufferSuballocator();
+
+    void destroy(RendererVk *renderer);
+
+    // Before creating a new slab, returns the blocks of the buffers that the GPU is done with to
+    // their slab, according to |lastCompletedQueueSerial|.
+    angle::Result allocate(ContextVk *contextVk,
+                           const BufferSuballocationDesc &desc,
+                           VkDeviceSize size,
+                           Serial lastCompletedQueueSerial,
+                           BufferHelper *bufferOut);
+
+    // Takes the use of a released buffer, and returns its block to |slab| once it completes.
+    void collectGarbage(SharedResourceUse &&use,
+                        BufferSlab *slab,
+                        VkDeviceSize offset,
+                        VkDeviceSize size);
+    void cleanupGarbage(RendererVk *renderer, Serial lastCompletedQueueSerial);
+    bool hasGarbage() const { return !mGarbage.empty(); }
+
+    const BufferSuballocatorStats &getStats() const { return mStats; }
+
+  private:
+    static constexpr size_t kMaxSizeClassCount = 32;
+    using SlabList                              = std::vector<std::unique_ptr<BufferSlab>>;
+
+    struct Pool
+    {
+        BufferSuballocationDesc desc;
+        std::array<SlabList, kMaxSizeClassCount> sizeClasses;
+    };
+
+    struct Garbage
+    {
+        SharedResourceUse use;
+        BufferSlab *slab;
+        VkDeviceSize offset;
+        VkDeviceSize size;
+    };
+
+    Pool &getPool(const BufferSuballocationDesc &desc);
+    static BufferSlab *FindSlabWithFreeBlock(const SlabList &slabs);
+    void destroyEmptySlabs(RendererVk *renderer);
+
+    std::vector<Pool> mPools;
+    std::vector<Garbage> mGarbage;
+    BufferSuballocatorStats mStats;
+};
+
 enum class BufferAccess
 {
     Read,
@@ -1016,6 +1248,8 @@ constexpr uint32_t kInfiniteCmdSize = 0xFFFFFFFF;
 //  into the CBH and then pass the CBH off to a worker thread that will
 //  process the commands into a primary command buffer and then submit
 //  those commands to the queue.
+class ParallelCommandRecorder;
+
 class CommandBufferHelper : angle::NonCopyable
 {
   public:
@@ -1061,9 +1295,12 @@ class CommandBufferHelper : angle::NonCopyable
 
     CommandBuffer &getCommandBuffer() { return mCommandBuffer; }
 
-    angle::Result flushToPrimary(const angle::FeaturesVk &features,
+    // If |parallelRecorder| is not null, large command buffers are recorded in parallel in
+    // secondary command buffers instead of being executed inline.
+    angle::Result flushToPrimary(Context *context,
                                  PrimaryCommandBuffer *primary,
-                                 const RenderPass *renderPass);
+                                 const RenderPass *renderPass,
+                                 ParallelCommandRecorder *parallelRecorder);
 
     void executeBarriers(const angle::FeaturesVk &features, PrimaryCommandBuffer *primary);
 
@@ -1576,6 +1813,7 @@ class ImageHelper final : public Resource, public angle::Subject
 
     const Image &getImage() const { return mImage; }
     const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    VkDeviceSize getAllocationSize() const { return mAllocationSize; }
 
     void setTilingMode(VkImageTiling tilingMode) { mTilingMode = tilingMode; }
     VkImageTiling getTilingMode() const { return mTilingMode; }
@@ -1663,30 +1901,35 @@ class ImageHelper final : public Resource, public angle::Subject
                              gl::LevelIndex levelGLStart,
                              gl::LevelIndex levelGLEnd);
 
-    angle::Result stageSubresourceUpdateImpl(ContextVk *contextVk,
-                                             const gl::ImageIndex &index,
-                                             const gl::Extents &glExtents,
-                                             const gl::Offset &offset,
-                                             const gl::InternalFormat &formatInfo,
-                                             const gl::PixelUnpackState &unpack,
-                                             DynamicBuffer *stagingBufferOverride,
-                                             GLenum type,
-                                             const uint8_t *pixels,
-                                             const Format &vkFormat,
-                                             const GLuint inputRowPitch,
-                                             const GLuint inputDepthPitch,
-                                             const GLuint inputSkipBytes);
-
-    angle::Result stageSubresourceUpdate(ContextVk *contextVk,
-                                         const gl::ImageIndex &index,
-                                         const gl::Extents &glExtents,
-                                         const gl::Offset &offset,
-                                         const gl::InternalFormat &formatInfo,
-                                         const gl::PixelUnpackState &unpack,
-                                         DynamicBuffer *stagingBufferOverride,
-                                         GLenum type,
-                                         const uint8_t *pixels,
-                                         const Format &vkFormat);
+    angle::Result stageSubresourceUpdateImpl(
+        ContextVk *contextVk,
+        const gl::ImageIndex &index,
+        const gl::Extents &glExtents,
+        const gl::Offset &offset,
+        const gl::InternalFormat &formatInfo,
+        const gl::PixelUnpackState &unpack,
+        DynamicBuffer *stagingBufferOverride,
+        GLenum type,
+        const uint8_t *pixels,
+        const Format &vkFormat,
+        const GLuint inputRowPitch,
+        const GLuint inputDepthPitch,
+        const GLuint inputSkipBytes,
+        const std::shared_ptr<angle::WorkerThreadPool> &workerPool);
+
+    // Large images are converted to the staging buffer in parallel in |workerPool|.
+    angle::Result stageSubresourceUpdate(
+        ContextVk *contextVk,
+        const gl::ImageIndex &index,
+        const gl::Extents &glExtents,
+        const gl::Offset &offset,
+        const gl::InternalFormat &formatInfo,
+        const gl::PixelUnpackState &unpack,
+        DynamicBuffer *stagingBufferOverride,
+        GLenum type,
+        const uint8_t *pixels,
+        const Format &vkFormat,
+        const std::shared_ptr<angle::WorkerThreadPool> &workerPool);
 
     angle::Result stageSubresourceUpdateAndGetData(ContextVk *contextVk,
                                                    size_t allocationSize,
@@ -1738,6 +1981,11 @@ class ImageHelper final : public Resource, public angle::Subject
                                        uint32_t levelCount,
                                        gl::TexLevelMask skipLevelsMask);
 
+    // Copy every level of the image to the host-visible staging buffer and stage the copies as
+    // updates, so the image can be released and recreated later without losing its contents.
+    // Used to evict images when device memory is over budget.
+    angle::Result stageSelfToHostMemory(ContextVk *contextVk);
+
     // Flush staged updates for a single subresource. Can optionally take a parameter to defer
     // clears to a subsequent RenderPass load op.
     angle::Result flushSingleSubresourceStagedUpdates(ContextVk *contextVk,
@@ -2027,6 +2275,7 @@ class ImageHelper final : public Resource, public angle::Subject
     bool validateSubresourceUpdateImageRefsConsistent() const;
 
     void resetCachedProperties();
+    void onMemoryReleased(RendererVk *renderer);
     void setEntireContentDefined();
     void setEntireContentUndefined();
     void setContentDefined(LevelIndex levelStart,
@@ -2071,6 +2320,11 @@ class ImageHelper final : public Resource, public angle::Subject
     Image mImage;
     DeviceMemory mDeviceMemory;
 
+    // Size and memory type of mDeviceMemory, if allocated by initMemory().  Used to account for
+    // image memory in the renderer's memory budget.
+    VkDeviceSize mAllocationSize;
+    uint32_t mMemoryTypeIndex;
+
     // Image properties.
     VkImageType mImageType;
     VkImageTiling mTilingMode;
@@ -2531,6 +2785,18 @@ class ShaderProgramHelper : angle::NonCopyable
             pipelineDesc, descPtrOut, pipelineOut);
     }
 
+    // For creating a Pipeline ahead of the draw that needs it.  See
+    // GraphicsPipelineCache::warmUpPipeline().
+    angle::Result warmUpGraphicsPipeline(ContextVk *contextVk,
+                                         RenderPassCache *renderPassCache,
+                                         const PipelineCache &pipelineCache,
+                                         const PipelineLayout &pipelineLayout,
+                                         const GraphicsPipelineDesc &pipelineDesc,
+                                         const gl::AttributesMask &activeAttribLocationsMask,
+                                         const gl::ComponentTypeMask &programAttribsTypeMask);
+
+    const GraphicsPipelineCache &getGraphicsPipelineCache() const { return mGraphicsPipelines; }
+
     angle::Result getComputePipeline(Context *context,
                                      const PipelineLayout &pipelineLayout,
                                      PipelineAndSerial **pipelineOut);
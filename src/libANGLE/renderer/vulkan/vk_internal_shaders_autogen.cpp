@@ -55,6 +55,10 @@ namespace
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertIndexIndirectLineLoop.comp.00000001.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertIndexIndirectLineLoop.comp.00000002.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertIndirectLineLoop.comp.00000000.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/ConvertPixels.comp.00000000.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/ConvertPixels.comp.00000001.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/ConvertPixels.comp.00000002.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/ConvertPixels.comp.00000003.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertVertex.comp.00000000.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertVertex.comp.00000001.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertVertex.comp.00000002.inc"
@@ -214,6 +218,12 @@ constexpr CompressedShaderBlob kConvertIndexIndirectLineLoop_comp_shaders[] = {
 constexpr CompressedShaderBlob kConvertIndirectLineLoop_comp_shaders[] = {
     {kConvertIndirectLineLoop_comp_00000000, sizeof(kConvertIndirectLineLoop_comp_00000000)},
 };
+constexpr CompressedShaderBlob kConvertPixels_comp_shaders[] = {
+    {kConvertPixels_comp_00000000, sizeof(kConvertPixels_comp_00000000)},
+    {kConvertPixels_comp_00000001, sizeof(kConvertPixels_comp_00000001)},
+    {kConvertPixels_comp_00000002, sizeof(kConvertPixels_comp_00000002)},
+    {kConvertPixels_comp_00000003, sizeof(kConvertPixels_comp_00000003)},
+};
 constexpr CompressedShaderBlob kConvertVertex_comp_shaders[] = {
     {kConvertVertex_comp_00000000, sizeof(kConvertVertex_comp_00000000)},
     {kConvertVertex_comp_00000001, sizeof(kConvertVertex_comp_00000001)},
@@ -412,6 +422,10 @@ void ShaderLibrary::destroy(VkDevice device)
     {
         shader.get().destroy(device);
     }
+    for (RefCounted<ShaderAndSerial> &shader : mConvertPixels_comp_shaders)
+    {
+        shader.get().destroy(device);
+    }
     for (RefCounted<ShaderAndSerial> &shader : mConvertVertex_comp_shaders)
     {
         shader.get().destroy(device);
@@ -488,6 +502,14 @@ angle::Result ShaderLibrary::getConvertIndirectLineLoop_comp(
                      ArraySize(kConvertIndirectLineLoop_comp_shaders), shaderFlags, shaderOut);
 }
 
+angle::Result ShaderLibrary::getConvertPixels_comp(Context *context,
+                                                   uint32_t shaderFlags,
+                                                   RefCounted<ShaderAndSerial> **shaderOut)
+{
+    return GetShader(context, mConvertPixels_comp_shaders, kConvertPixels_comp_shaders,
+                     ArraySize(kConvertPixels_comp_shaders), shaderFlags, shaderOut);
+}
+
 angle::Result ShaderLibrary::getConvertVertex_comp(Context *context,
                                                    uint32_t shaderFlags,
                                                    RefCounted<ShaderAndSerial> **shaderOut)
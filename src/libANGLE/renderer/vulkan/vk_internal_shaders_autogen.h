@@ -74,6 +74,16 @@ namespace ConvertIndirectLineLoop_comp
 constexpr size_t kArrayLen = 0x00000001;
 }  // namespace ConvertIndirectLineLoop_comp
 
+namespace ConvertPixels_comp
+{
+enum flags
+{
+    kSrcIsFloat  = 0x00000001,
+    kDestIsFloat = 0x00000002,
+};
+constexpr size_t kArrayLen = 0x00000004;
+}  // namespace ConvertPixels_comp
+
 namespace ConvertVertex_comp
 {
 enum Conversion
@@ -213,6 +223,9 @@ class ShaderLibrary final : angle::NonCopyable
     angle::Result getConvertIndirectLineLoop_comp(Context *context,
                                                   uint32_t shaderFlags,
                                                   RefCounted<ShaderAndSerial> **shaderOut);
+    angle::Result getConvertPixels_comp(Context *context,
+                                        uint32_t shaderFlags,
+                                        RefCounted<ShaderAndSerial> **shaderOut);
     angle::Result getConvertVertex_comp(Context *context,
                                         uint32_t shaderFlags,
                                         RefCounted<ShaderAndSerial> **shaderOut);
@@ -246,6 +259,8 @@ class ShaderLibrary final : angle::NonCopyable
         [InternalShader::ConvertIndexIndirectLineLoop_comp::kArrayLen];
     RefCounted<ShaderAndSerial> mConvertIndirectLineLoop_comp_shaders
         [InternalShader::ConvertIndirectLineLoop_comp::kArrayLen];
+    RefCounted<ShaderAndSerial>
+        mConvertPixels_comp_shaders[InternalShader::ConvertPixels_comp::kArrayLen];
     RefCounted<ShaderAndSerial>
         mConvertVertex_comp_shaders[InternalShader::ConvertVertex_comp::kArrayLen];
     RefCounted<ShaderAndSerial>
@@ -18,6 +18,7 @@ VkResult InitAllocator(VkPhysicalDevice physicalDevice,
                        VkInstance instance,
                        uint32_t apiVersion,
                        VkDeviceSize preferredLargeHeapBlockSize,
+                       bool useMemoryBudget,
                        VmaAllocator *pAllocator)
 {
     VmaVulkanFunctions funcs                  = {};
@@ -64,6 +65,11 @@ VkResult InitAllocator(VkPhysicalDevice physicalDevice,
     allocatorInfo.vulkanApiVersion            = apiVersion;
     allocatorInfo.preferredLargeHeapBlockSize = preferredLargeHeapBlockSize;
 
+    if (useMemoryBudget)
+    {
+        allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
+
     return vmaCreateAllocator(&allocatorInfo, pAllocator);
 }
 
@@ -149,6 +155,30 @@ void InvalidateAllocation(VmaAllocator allocator,
     vmaInvalidateAllocation(allocator, allocation, offset, size);
 }
 
+void GetHeapBudgets(VmaAllocator allocator,
+                    VkDeviceSize *pAllocationBytes,
+                    VkDeviceSize *pUsage,
+                    VkDeviceSize *pBudget)
+{
+    const VkPhysicalDeviceMemoryProperties *memoryProperties = nullptr;
+    vmaGetMemoryProperties(allocator, &memoryProperties);
+
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+    vmaGetBudget(allocator, budgets);
+
+    for (uint32_t heapIndex = 0; heapIndex < memoryProperties->memoryHeapCount; ++heapIndex)
+    {
+        pAllocationBytes[heapIndex] = budgets[heapIndex].allocationBytes;
+        pUsage[heapIndex]           = budgets[heapIndex].usage;
+        pBudget[heapIndex]          = budgets[heapIndex].budget;
+    }
+}
+
+void SetCurrentFrameIndex(VmaAllocator allocator, uint32_t frameIndex)
+{
+    vmaSetCurrentFrameIndex(allocator, frameIndex);
+}
+
 void BuildStatsString(VmaAllocator allocator, char **statsString, VkBool32 detailedMap)
 {
     vmaBuildStatsString(allocator, statsString, detailedMap);
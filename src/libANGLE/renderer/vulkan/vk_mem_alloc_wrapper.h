@@ -22,6 +22,7 @@ VkResult InitAllocator(VkPhysicalDevice physicalDevice,
                        VkInstance instance,
                        uint32_t apiVersion,
                        VkDeviceSize preferredLargeHeapBlockSize,
+                       bool useMemoryBudget,
                        VmaAllocator *pAllocator);
 
 void DestroyAllocator(VmaAllocator allocator);
@@ -62,6 +63,16 @@ void InvalidateAllocation(VmaAllocator allocator,
                           VkDeviceSize offset,
                           VkDeviceSize size);
 
+// Each output array has an entry per memory heap.  Without VK_EXT_memory_budget, usage only counts
+// the memory allocated through VMA and budget is an estimate based on the heap size.
+void GetHeapBudgets(VmaAllocator allocator,
+                    VkDeviceSize *pAllocationBytes,
+                    VkDeviceSize *pUsage,
+                    VkDeviceSize *pBudget);
+
+// With VK_EXT_memory_budget, also fetches the budget from the driver again.
+void SetCurrentFrameIndex(VmaAllocator allocator, uint32_t frameIndex);
+
 void BuildStatsString(VmaAllocator allocator, char **statsString, VkBool32 detailedMap);
 void FreeStatsString(VmaAllocator allocator, char *statsString);
 
@@ -84,7 +84,8 @@ angle::Result FindAndAllocateCompatibleMemory(vk::Context *context,
                                               VkMemoryPropertyFlags *memoryPropertyFlagsOut,
                                               const VkMemoryRequirements &memoryRequirements,
                                               const void *extraAllocationInfo,
-                                              vk::DeviceMemory *deviceMemoryOut)
+                                              vk::DeviceMemory *deviceMemoryOut,
+                                              uint32_t *memoryTypeIndexOut)
 {
     VkDevice device = context->getDevice();
 
@@ -100,6 +101,7 @@ angle::Result FindAndAllocateCompatibleMemory(vk::Context *context,
     allocInfo.allocationSize       = memoryRequirements.size;
 
     ANGLE_VK_TRY(context, deviceMemoryOut->allocate(device, allocInfo));
+    *memoryTypeIndexOut = memoryTypeIndex;
 
     // Wipe memory to an invalid value when the 'allocateNonZeroMemory' feature is enabled. The
     // invalid values ensures our testing doesn't assume zero-initialized memory.
@@ -125,13 +127,14 @@ angle::Result AllocateAndBindBufferOrImageMemory(vk::Context *context,
                                                  const VkMemoryRequirements &memoryRequirements,
                                                  const void *extraAllocationInfo,
                                                  T *bufferOrImage,
-                                                 vk::DeviceMemory *deviceMemoryOut)
+                                                 vk::DeviceMemory *deviceMemoryOut,
+                                                 uint32_t *memoryTypeIndexOut)
 {
     const vk::MemoryProperties &memoryProperties = context->getRenderer()->getMemoryProperties();
 
     ANGLE_TRY(FindAndAllocateCompatibleMemory(
         context, memoryProperties, requestedMemoryPropertyFlags, memoryPropertyFlagsOut,
-        memoryRequirements, extraAllocationInfo, deviceMemoryOut));
+        memoryRequirements, extraAllocationInfo, deviceMemoryOut, memoryTypeIndexOut));
     ANGLE_VK_TRY(context, bufferOrImage->bindMemory(context->getDevice(), *deviceMemoryOut));
     return angle::Result::Continue;
 }
@@ -143,6 +146,7 @@ angle::Result AllocateBufferOrImageMemory(vk::Context *context,
                                           const void *extraAllocationInfo,
                                           T *bufferOrImage,
                                           vk::DeviceMemory *deviceMemoryOut,
+                                          uint32_t *memoryTypeIndexOut,
                                           VkDeviceSize *sizeOut)
 {
     // Call driver to determine memory requirements.
@@ -151,7 +155,7 @@ angle::Result AllocateBufferOrImageMemory(vk::Context *context,
 
     ANGLE_TRY(AllocateAndBindBufferOrImageMemory(
         context, requestedMemoryPropertyFlags, memoryPropertyFlagsOut, memoryRequirements,
-        extraAllocationInfo, bufferOrImage, deviceMemoryOut));
+        extraAllocationInfo, bufferOrImage, deviceMemoryOut, memoryTypeIndexOut));
 
     *sizeOut = memoryRequirements.size;
 
@@ -548,9 +552,10 @@ angle::Result AllocateBufferMemory(Context *context,
                                    DeviceMemory *deviceMemoryOut,
                                    VkDeviceSize *sizeOut)
 {
+    uint32_t memoryTypeIndex = 0;
     return AllocateBufferOrImageMemory(context, requestedMemoryPropertyFlags,
                                        memoryPropertyFlagsOut, extraAllocationInfo, buffer,
-                                       deviceMemoryOut, sizeOut);
+                                       deviceMemoryOut, &memoryTypeIndex, sizeOut);
 }
 
 angle::Result AllocateImageMemory(Context *context,
@@ -559,10 +564,12 @@ angle::Result AllocateImageMemory(Context *context,
                                   const void *extraAllocationInfo,
                                   Image *image,
                                   DeviceMemory *deviceMemoryOut,
+                                  uint32_t *memoryTypeIndexOut,
                                   VkDeviceSize *sizeOut)
 {
     return AllocateBufferOrImageMemory(context, memoryPropertyFlags, memoryPropertyFlagsOut,
-                                       extraAllocationInfo, image, deviceMemoryOut, sizeOut);
+                                       extraAllocationInfo, image, deviceMemoryOut,
+                                       memoryTypeIndexOut, sizeOut);
 }
 
 angle::Result AllocateImageMemoryWithRequirements(Context *context,
@@ -573,9 +580,10 @@ angle::Result AllocateImageMemoryWithRequirements(Context *context,
                                                   DeviceMemory *deviceMemoryOut)
 {
     VkMemoryPropertyFlags memoryPropertyFlagsOut = 0;
+    uint32_t memoryTypeIndex                     = 0;
     return AllocateAndBindBufferOrImageMemory(context, memoryPropertyFlags, &memoryPropertyFlagsOut,
                                               memoryRequirements, extraAllocationInfo, image,
-                                              deviceMemoryOut);
+                                              deviceMemoryOut, &memoryTypeIndex);
 }
 
 angle::Result AllocateBufferMemoryWithRequirements(Context *context,
@@ -586,9 +594,10 @@ angle::Result AllocateBufferMemoryWithRequirements(Context *context,
                                                    VkMemoryPropertyFlags *memoryPropertyFlagsOut,
                                                    DeviceMemory *deviceMemoryOut)
 {
+    uint32_t memoryTypeIndex = 0;
     return AllocateAndBindBufferOrImageMemory(context, memoryPropertyFlags, memoryPropertyFlagsOut,
                                               memoryRequirements, extraAllocationInfo, buffer,
-                                              deviceMemoryOut);
+                                              deviceMemoryOut, &memoryTypeIndex);
 }
 
 angle::Result InitShaderAndSerial(Context *context,
@@ -352,10 +352,32 @@ class MemoryProperties final : angle::NonCopyable
         return mMemoryProperties.memoryHeaps[heapIndex].size;
     }
 
+    uint32_t getMemoryHeapCount() const { return mMemoryProperties.memoryHeapCount; }
+    uint32_t getHeapIndexForMemoryType(uint32_t memoryType) const
+    {
+        return mMemoryProperties.memoryTypes[memoryType].heapIndex;
+    }
+    bool isDeviceLocalHeap(uint32_t heapIndex) const
+    {
+        return (mMemoryProperties.memoryHeaps[heapIndex].flags &
+                VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+    }
+
   private:
     VkPhysicalDeviceMemoryProperties mMemoryProperties;
 };
 
+// Memory usage of the device-local heaps by resource class, and their budget, in bytes.  Buffers
+// are allocated through VMA, which keeps track of their memory.  Images are allocated directly and
+// their memory is tracked by RendererVk.
+struct MemoryBudget
+{
+    VkDeviceSize imageBytes;
+    VkDeviceSize bufferBytes;
+    VkDeviceSize usage;
+    VkDeviceSize budget;
+};
+
 // Similar to StagingImage, for Buffers.
 class StagingBuffer final : angle::NonCopyable
 {
@@ -404,6 +426,7 @@ angle::Result AllocateImageMemory(Context *context,
                                   const void *extraAllocationInfo,
                                   Image *image,
                                   DeviceMemory *deviceMemoryOut,
+                                  uint32_t *memoryTypeIndexOut,
                                   VkDeviceSize *sizeOut);
 
 angle::Result AllocateImageMemoryWithRequirements(Context *context,
@@ -569,6 +592,9 @@ class BindingPointer final : angle::NonCopyable
 
     void reset() { set(nullptr); }
 
+    // Points to the same object as |other|, adding a reference to it.
+    void copy(const BindingPointer &other) { set(other.mRefCounted); }
+
     T &get() { return mRefCounted->get(); }
     const T &get() const { return mRefCounted->get(); }
 
@@ -882,6 +908,29 @@ struct PerfCounters
     uint32_t descriptorSetAllocations;
     uint32_t shaderBuffersDescriptorSetCacheHits;
     uint32_t shaderBuffersDescriptorSetCacheMisses;
+    uint32_t textureDescriptorSetCacheHits;
+    uint32_t textureDescriptorSetCacheMisses;
+    // Cached descriptor sets that were rewritten for a new key instead of allocating a new set.
+    uint32_t descriptorSetRecycles;
+    // The current number of descriptor pools and cached descriptor sets of all programs.
+    uint32_t descriptorPools;
+    uint32_t cachedDescriptorSets;
+    // Graphics pipelines created ahead of time from the program's pipeline manifest, and ones
+    // created when a draw needed them.
+    uint32_t warmedUpGraphicsPipelines;
+    uint32_t coldGraphicsPipelines;
+    // The current number of suballocated buffers and of the slabs they are carved from, and the
+    // percentage of the slabs' memory that is not used by a buffer.
+    uint32_t suballocatedBuffers;
+    uint32_t bufferSlabs;
+    uint32_t bufferSlabFragmentation;
+    // Memory of the device-local heaps used by images and buffers, their total usage and budget,
+    // in KB.  Also the number of textures evicted to host memory because of the budget.
+    uint32_t deviceLocalImageMemoryKB;
+    uint32_t deviceLocalBufferMemoryKB;
+    uint32_t deviceLocalMemoryUsageKB;
+    uint32_t deviceLocalMemoryBudgetKB;
+    uint32_t evictedTextures;
 };
 
 // A Vulkan image level index.
@@ -210,7 +210,7 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void bindComputePipeline(const Pipeline &pipeline);
     void bindPipeline(VkPipelineBindPoint pipelineBindPoint, const Pipeline &pipeline);
 
-    void bindIndexBuffer(const Buffer &buffer, VkDeviceSize offset, VkIndexType indexType);
+    void bindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType);
     void bindVertexBuffers(uint32_t firstBinding,
                            uint32_t bindingCount,
                            const VkBuffer *buffers,
@@ -478,7 +478,8 @@ class Allocator : public WrappedObject<Allocator, VmaAllocator>
                   VkDevice device,
                   VkInstance instance,
                   uint32_t apiVersion,
-                  VkDeviceSize preferredLargeHeapBlockSize);
+                  VkDeviceSize preferredLargeHeapBlockSize,
+                  bool useMemoryBudget);
 
     // Initializes the buffer handle and memory allocation.
     VkResult createBuffer(const VkBufferCreateInfo &bufferCreateInfo,
@@ -496,6 +497,12 @@ class Allocator : public WrappedObject<Allocator, VmaAllocator>
                                               bool persistentlyMappedBuffers,
                                               uint32_t *memoryTypeIndexOut) const;
 
+    // The output arrays have VK_MAX_MEMORY_HEAPS entries.
+    void getHeapBudgets(VkDeviceSize *allocationBytesOut,
+                        VkDeviceSize *usageOut,
+                        VkDeviceSize *budgetOut) const;
+    void setCurrentFrameIndex(uint32_t frameIndex) const;
+
     void buildStatsString(char **statsString, VkBool32 detailedMap);
     void freeStatsString(char *statsString);
 };
@@ -915,12 +922,12 @@ ANGLE_INLINE void CommandBuffer::endRenderPass()
     vkCmdEndRenderPass(mHandle);
 }
 
-ANGLE_INLINE void CommandBuffer::bindIndexBuffer(const Buffer &buffer,
+ANGLE_INLINE void CommandBuffer::bindIndexBuffer(VkBuffer buffer,
                                                  VkDeviceSize offset,
                                                  VkIndexType indexType)
 {
     ASSERT(valid());
-    vkCmdBindIndexBuffer(mHandle, buffer.getHandle(), offset, indexType);
+    vkCmdBindIndexBuffer(mHandle, buffer, offset, indexType);
 }
 
 ANGLE_INLINE void CommandBuffer::bindDescriptorSets(const PipelineLayout &layout,
@@ -1441,11 +1448,12 @@ ANGLE_INLINE VkResult Allocator::init(VkPhysicalDevice physicalDevice,
                                       VkDevice device,
                                       VkInstance instance,
                                       uint32_t apiVersion,
-                                      VkDeviceSize preferredLargeHeapBlockSize)
+                                      VkDeviceSize preferredLargeHeapBlockSize,
+                                      bool useMemoryBudget)
 {
     ASSERT(!valid());
     return vma::InitAllocator(physicalDevice, device, instance, apiVersion,
-                              preferredLargeHeapBlockSize, &mHandle);
+                              preferredLargeHeapBlockSize, useMemoryBudget, &mHandle);
 }
 
 ANGLE_INLINE VkResult Allocator::createBuffer(const VkBufferCreateInfo &bufferCreateInfo,
@@ -1484,6 +1492,20 @@ Allocator::findMemoryTypeIndexForBufferInfo(const VkBufferCreateInfo &bufferCrea
                                                  memoryTypeIndexOut);
 }
 
+ANGLE_INLINE void Allocator::getHeapBudgets(VkDeviceSize *allocationBytesOut,
+                                            VkDeviceSize *usageOut,
+                                            VkDeviceSize *budgetOut) const
+{
+    ASSERT(valid());
+    vma::GetHeapBudgets(mHandle, allocationBytesOut, usageOut, budgetOut);
+}
+
+ANGLE_INLINE void Allocator::setCurrentFrameIndex(uint32_t frameIndex) const
+{
+    ASSERT(valid());
+    vma::SetCurrentFrameIndex(mHandle, frameIndex);
+}
+
 ANGLE_INLINE void Allocator::buildStatsString(char **statsString, VkBool32 detailedMap)
 {
     ASSERT(valid());
@@ -8207,8 +8207,8 @@ void GL_APIENTRY GL_EGLImageTargetRenderbufferStorageOES(GLenum target, GLeglIma
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
-        bool isCallValid                                      = (context->skipValidation() ||
+        ANGLE_SCOPED_GLOBAL_LOCK();
+        bool isCallValid = (context->skipValidation() ||
                             ValidateEGLImageTargetRenderbufferStorageOES(context, target, image));
         if (isCallValid)
         {
@@ -8231,9 +8231,9 @@ void GL_APIENTRY GL_EGLImageTargetTexture2DOES(GLenum target, GLeglImageOES imag
 
     if (context)
     {
-        TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
-        bool isCallValid                                      = (context->skipValidation() ||
+        TextureType targetPacked = PackParam<TextureType>(target);
+        ANGLE_SCOPED_GLOBAL_LOCK();
+        bool isCallValid = (context->skipValidation() ||
                             ValidateEGLImageTargetTexture2DOES(context, targetPacked, image));
         if (isCallValid)
         {
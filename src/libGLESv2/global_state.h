@@ -11,6 +11,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Thread.h"
 #include "libANGLE/features.h"
 
@@ -110,8 +111,11 @@ class ScopedSyncCurrentContextFromThread
 
 }  // namespace egl
 
-#define ANGLE_SCOPED_GLOBAL_LOCK() \
-    std::lock_guard<angle::GlobalMutex> globalMutexLock(egl::GetGlobalMutex())
+// EGL calls hold the global mutex, and the mutex of the share group of the current context so that
+// they don't race with the GL calls of the other contexts of the group.
+#define ANGLE_SCOPED_GLOBAL_LOCK()                                               \
+    std::lock_guard<angle::GlobalMutex> globalMutexLock(egl::GetGlobalMutex()); \
+    egl::ScopedShareGroupLock currentShareGroupLock(egl::GetCurrentThread()->getContext())
 
 namespace gl
 {
@@ -173,8 +177,31 @@ ANGLE_INLINE std::unique_lock<angle::GlobalMutex> GetContextLock(Context *contex
     DirtyContextIfNeeded(context);
     return lock;
 #else
-    return context->isShared() ? std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex())
-                               : std::unique_lock<angle::GlobalMutex>();
+    if (!context->isShared())
+    {
+        return std::unique_lock<angle::GlobalMutex>();
+    }
+
+    // Share groups that share objects with the whole display are serialized with every other
+    // context.  Otherwise, only the contexts of the same share group are.
+    if (context->usingDisplayTextureShareGroup() || context->usingDisplaySemaphoreShareGroup())
+    {
+        return std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex());
+    }
+
+    egl::ShareGroup *shareGroup = context->getShareGroup();
+    std::unique_lock<angle::GlobalMutex> lock(*shareGroup->getMutex());
+
+    // Objects that are EGL image siblings can be shared with other share groups through the image,
+    // so share groups that have any are serialized with every other context too.  The flag is only
+    // set with both mutexes held, so it can't change while the share group mutex is held.  The
+    // share group mutex is released first to keep the lock order.
+    if (shareGroup->hasImageSiblings())
+    {
+        lock.unlock();
+        return std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex());
+    }
+    return lock;
 #endif
 }
 
@@ -0,0 +1,93 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ParallelFunctionPasses_test.cpp:
+//   Tests that running the function-local transformations of a large shader in several threads
+//   produces the same output as running them in one.
+//
+
+#include <sstream>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+// Enough functions for the passes to be split among several threads.
+constexpr int kFunctionCount = 128;
+
+std::string GenerateShader()
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision mediump float;\n"
+              "uniform int ui;\n"
+              "out vec4 my_FragColor;\n"
+              "vec4 f0(int x)\n"
+              "{\n"
+              "    return vec4(x);\n"
+              "}\n";
+
+    // Every function has a switch with trailing empty cases and repeated assignments to a swizzle,
+    // which the passes rewrite.
+    for (int function = 1; function < kFunctionCount; ++function)
+    {
+        shader << "vec4 f" << function << "(int x)\n"
+               << "{\n"
+               << "    vec4 v = f" << function - 1 << "(x + 1);\n"
+               << "    float a;\n"
+               << "    switch (x)\n"
+               << "    {\n"
+               << "        case " << function << ":\n"
+               << "            v.x = a = float(x);\n"
+               << "            break;\n"
+               << "        case " << kFunctionCount + function << ":\n"
+               << "        default:\n"
+               << "            { {} }\n"
+               << "    }\n"
+               << "    return v;\n"
+               << "}\n";
+    }
+
+    shader << "void main()\n"
+              "{\n"
+              "    my_FragColor = f"
+           << kFunctionCount - 1
+           << "(ui);\n"
+              "}\n";
+    return shader.str();
+}
+
+// Test that the output is the same with and without SH_PARALLELIZE_FUNCTION_PASSES.
+TEST(ParallelFunctionPassesTest, SameOutput)
+{
+    const std::string shaderString = GenerateShader();
+    const ShCompileOptions compileOptions =
+        SH_OBJECT_CODE | SH_VALIDATE_AST | SH_REWRITE_REPEATED_ASSIGN_TO_SWIZZLED;
+
+    std::string serialCode;
+    std::string infoLog;
+    ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_GLSL_COMPATIBILITY_OUTPUT,
+                                  shaderString, compileOptions, &serialCode, &infoLog))
+        << infoLog;
+
+    std::string parallelCode;
+    ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_GLSL_COMPATIBILITY_OUTPUT,
+                                  shaderString, compileOptions | SH_PARALLELIZE_FUNCTION_PASSES,
+                                  &parallelCode, &infoLog))
+        << infoLog;
+
+    EXPECT_EQ(serialCode, parallelCode);
+
+    // Make sure the passes did run on the functions.
+    EXPECT_EQ(std::string::npos, parallelCode.find("default"));
+}
+
+}  // namespace
@@ -7,7 +7,9 @@
 //   Test the sh::Compile interface with different parameters.
 //
 
+#include <algorithm>
 #include <clocale>
+#include <cstring>
 #include "GLSLANG/ShaderLang.h"
 #include "angle_gl.h"
 #include "common/angleutils.h"
@@ -137,6 +139,50 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
     testCompile(shaderStrings, 3, true);
 }
 
+// Test that SH_RECORD_PASS_METRICS records the phases of the compilation, and that nothing is
+// recorded without it.
+TEST_F(ShCompileTest, PassMetrics)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u;\n"
+        "void main() {\n"
+        "    gl_FragColor = u * 2.0;\n"
+        "}";
+    const ShCompileOptions options = SH_OBJECT_CODE | SH_VARIABLES;
+
+    ASSERT_TRUE(sh::Compile(mCompiler, &shaderString, 1, options | SH_RECORD_PASS_METRICS))
+        << sh::GetInfoLog(mCompiler);
+
+    const std::vector<sh::PassMetrics> &passMetrics = sh::GetPassMetrics(mCompiler);
+    ASSERT_GE(passMetrics.size(), 2u);
+    EXPECT_STREQ("Parse", passMetrics.front().name);
+    EXPECT_STREQ("Output", passMetrics.back().name);
+
+    // The AST transformations are recorded one by one.
+    EXPECT_NE(passMetrics.end(),
+              std::find_if(passMetrics.begin(), passMetrics.end(),
+                           [](const sh::PassMetrics &metrics) {
+                               return strcmp(metrics.name, "PruneNoOps") == 0;
+                           }));
+
+    // Parsing builds the AST from the pool.
+    EXPECT_GT(passMetrics.front().poolBytesAllocated, 0u);
+
+    double previousStartTime = passMetrics.front().startTime;
+    for (const sh::PassMetrics &metrics : passMetrics)
+    {
+        EXPECT_GT(metrics.astNodeCount, 0u) << metrics.name;
+        EXPECT_GE(metrics.wallTime, 0.0) << metrics.name;
+        EXPECT_GE(metrics.startTime, previousStartTime) << metrics.name;
+        EXPECT_GE(metrics.poolPeakBytesInUse, metrics.poolBytesAllocated) << metrics.name;
+        previousStartTime = metrics.startTime;
+    }
+
+    ASSERT_TRUE(sh::Compile(mCompiler, &shaderString, 1, options)) << sh::GetInfoLog(mCompiler);
+    EXPECT_TRUE(sh::GetPassMetrics(mCompiler).empty());
+}
+
 // Parsing floats in shaders can run afoul of locale settings.
 // Eg. in de_DE, `strtof("1.9")` will yield `1.0f`. (It's expecting "1,9")
 TEST_F(ShCompileTest, DecimalSepLocale)
@@ -281,4 +281,57 @@ void main() {
     }
 }
 
+// Tests that shaders compiled again from the same source are loaded from the shader cache and
+// still link into a working program.
+TEST_P(EGLBlobCacheTest, ShaderCache)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    ANGLE_SKIP_TEST_IF(!programBinaryAvailable());
+
+    // Compile the shaders so they are put in the cache.
+    GLuint vertexShader   = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, essl1_shaders::fs::UniformColor());
+    ASSERT_NE(0u, vertexShader);
+    ASSERT_NE(0u, fragmentShader);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    const size_t cacheSize = gApplicationCache.size();
+
+    // Compile the same sources again.  The back-ends that cache shaders don't add entries.
+    vertexShader   = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    fragmentShader = CompileShader(GL_FRAGMENT_SHADER, essl1_shaders::fs::UniformColor());
+    ASSERT_NE(0u, vertexShader);
+    ASSERT_NE(0u, fragmentShader);
+    if (IsVulkan())
+    {
+        EXPECT_EQ(cacheSize, gApplicationCache.size());
+        EXPECT_EQ(CacheOpResult::GetSuccess, gLastCacheOpResult);
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    ASSERT_GL_TRUE(linkStatus);
+
+    glUseProgram(program);
+    glUniform4f(glGetUniformLocation(program, essl1_shaders::ColorUniform()), 0.0f, 1.0f, 0.0f,
+                1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glDeleteProgram(program);
+    ASSERT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(EGLBlobCacheTest);
@@ -253,5 +253,7 @@ TEST_P(ETCTextureTest, ETC2SRGB8A1Validation)
     }
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(ETCTextureTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(ETCTextureTest,
+                                       WithTranscodeETCToBC(ES2_VULKAN()),
+                                       WithTranscodeETCToBC(ES3_VULKAN()));
 }  // anonymous namespace
@@ -445,7 +445,57 @@ void main()
     EXPECT_GL_NO_ERROR();
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(LinkAndRelinkTest);
+// Recompiling a shader right after linking a program it is attached to must not affect the
+// program, even if the link is still running in a worker thread.
+TEST_P(LinkAndRelinkTest, RecompileShaderWhileLinking)
+{
+    constexpr char kRedFS[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+})";
+    constexpr char kGreenFS[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+})";
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kRedFS);
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    // Recompile the fragment shader without waiting for the link.
+    const char *greenSource = kGreenFS;
+    glShaderSource(fs, 1, &greenSource, nullptr);
+    glCompileShader(fs);
+
+    GLint compileStatus;
+    glGetShaderiv(fs, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_TRUE(compileStatus);
+
+    GLint linkStatus;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+
+    glUseProgram(program);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    glDeleteProgram(program);
+    EXPECT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(LinkAndRelinkTest,
+                                       WithAsyncLinkProgram(ES2_VULKAN()),
+                                       WithAsyncLinkProgram(ES3_VULKAN()));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(LinkAndRelinkTestES31);
 ANGLE_INSTANTIATE_TEST_ES31(LinkAndRelinkTestES31);
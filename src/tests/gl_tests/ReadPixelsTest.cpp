@@ -493,6 +493,90 @@ TEST_P(ReadPixelsPBOTest, SubDataOffsetPreservesContents)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test reading back into a ring of PBOs and mapping each one two frames later, like an application
+// that keeps several readbacks in flight.
+TEST_P(ReadPixelsPBOTest, RingOfPBOs)
+{
+    constexpr size_t kPBOCount   = 3;
+    constexpr size_t kFrameCount = 8;
+    constexpr GLsizei kSize      = 16;
+    const GLColor kColors[]      = {GLColor::red, GLColor::green, GLColor::blue, GLColor::yellow};
+
+    std::array<GLBuffer, kPBOCount> pbos;
+    for (GLBuffer &pbo : pbos)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, 4 * kSize * kSize, nullptr, GL_STREAM_READ);
+    }
+
+    for (size_t frame = 0; frame < kFrameCount + kPBOCount - 1; ++frame)
+    {
+        if (frame < kFrameCount)
+        {
+            const angle::Vector4 color = kColors[frame % ArraySize(kColors)].toNormalizedVector();
+            glClearColor(color[0], color[1], color[2], color[3]);
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[frame % kPBOCount]);
+            glReadPixels(0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        }
+
+        if (frame + 1 >= kPBOCount)
+        {
+            const size_t readFrame = frame + 1 - kPBOCount;
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[readFrame % kPBOCount]);
+
+            const GLColor *dataColor = static_cast<const GLColor *>(
+                glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, 4 * kSize * kSize, GL_MAP_READ_BIT));
+            ASSERT_NE(nullptr, dataColor);
+
+            const GLColor &expected = kColors[readFrame % ArraySize(kColors)];
+            EXPECT_EQ(expected, dataColor[0]);
+            EXPECT_EQ(expected, dataColor[kSize * kSize - 1]);
+
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+    }
+
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test reading back into a PBO in a format that differs from the framebuffer's, and that the rows
+// come out in the right order.
+TEST_P(ReadPixelsPBOTest, BGRA)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_EXT_read_format_bgra"));
+
+    constexpr GLsizei kSize = 16;
+
+    // Clear the bottom half to blue and the top half to red.
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, kSize, kSize / 2);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+    EXPECT_GL_NO_ERROR();
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPBO);
+    glReadPixels(0, 0, kSize, kSize, GL_BGRA_EXT, GL_UNSIGNED_BYTE, 0);
+    EXPECT_GL_NO_ERROR();
+
+    const GLColor *dataColor = static_cast<const GLColor *>(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, 4 * kSize * kSize, GL_MAP_READ_BIT));
+    ASSERT_NE(nullptr, dataColor);
+
+    // GLColor is RGBA, so blue and red come out swapped.
+    EXPECT_EQ(GLColor::red, dataColor[0]);
+    EXPECT_EQ(GLColor::red, dataColor[kSize * kSize / 2 - 1]);
+    EXPECT_EQ(GLColor::blue, dataColor[kSize * kSize / 2]);
+    EXPECT_EQ(GLColor::blue, dataColor[kSize * kSize - 1]);
+
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test that uploading data to buffer that's in use then writing to it as PBO works.
 TEST_P(ReadPixelsPBOTest, UseAsUBOThenUpdateThenReadFromFBO)
 {
@@ -1002,10 +1086,12 @@ ANGLE_INSTANTIATE_TEST_ES2(ReadPixelsTest);
 ANGLE_INSTANTIATE_TEST_ES2(ReadPixelsPBONVTest);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ReadPixelsPBOTest);
-ANGLE_INSTANTIATE_TEST_ES3(ReadPixelsPBOTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(ReadPixelsPBOTest,
+                               WithDeferReadPixelsPacking(ES3_VULKAN()),
+                               WithConvertPixelsWithCompute(ES3_VULKAN()));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ReadPixelsPBODrawTest);
-ANGLE_INSTANTIATE_TEST_ES3(ReadPixelsPBODrawTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(ReadPixelsPBODrawTest, WithDeferReadPixelsPacking(ES3_VULKAN()));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ReadPixelsMultisampleTest);
 ANGLE_INSTANTIATE_TEST_ES3(ReadPixelsMultisampleTest);
@@ -2653,6 +2653,48 @@ TEST_P(Texture2DTest, TexImageWithRGBA5551PBO)
 
 // Test that glTexSubImage2D combined with a PBO works properly when glTexStorage2D has
 // initialized the image with a depth-only format.
+// Test that glTexSubImage2D combined with a PBO works properly when the float data in the PBO is
+// converted to the half float format of the texture.
+TEST_P(Texture2DTestES3, TexImageWithFloatToHalfFloatPBO)
+{
+    constexpr GLsizei kSize = 16;
+
+    int width  = getWindowWidth();
+    int height = getWindowHeight();
+
+    // Fill PBO with red, with middle one as green
+    std::vector<GLfloat> pixels(kSize * kSize * 4);
+    for (size_t pixelId = 0; pixelId < kSize * kSize; ++pixelId)
+    {
+        const bool isMiddle     = pixelId == kSize * 7 + 7;
+        pixels[pixelId * 4 + 0] = isMiddle ? 0.0f : 1.0f;
+        pixels[pixelId * 4 + 1] = isMiddle ? 1.0f : 0.0f;
+        pixels[pixelId * 4 + 2] = 0.0f;
+        pixels[pixelId * 4 + 3] = 1.0f;
+    }
+
+    GLBuffer pbo;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, pixels.size() * sizeof(pixels[0]), pixels.data(),
+                 GL_STATIC_DRAW);
+
+    GLTexture tex;
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA16F, kSize, kSize);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_EQ(width / 4, height / 4, 255, 0, 0, 255);
+    EXPECT_PIXEL_EQ(width / 2 - 1, height / 2 - 1, 0, 255, 0, 255);
+}
+
 TEST_P(Texture2DTestES3, TexImageWithDepthPBO)
 {
     ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_NV_pixel_buffer_object"));
@@ -9673,7 +9715,10 @@ void main()
 #define ES3_EMULATE_COPY_TEX_IMAGE()                          \
     WithEmulateCopyTexImage2DFromRenderbuffers(ES3_OPENGL()), \
         WithEmulateCopyTexImage2DFromRenderbuffers(ES3_OPENGLES())
-ANGLE_INSTANTIATE_TEST(Texture2DTest, ANGLE_ALL_TEST_PLATFORMS_ES2, ES2_EMULATE_COPY_TEX_IMAGE());
+ANGLE_INSTANTIATE_TEST(Texture2DTest,
+                       ANGLE_ALL_TEST_PLATFORMS_ES2,
+                       ES2_EMULATE_COPY_TEX_IMAGE(),
+                       WithConvertPixelsWithCompute(ES2_VULKAN()));
 ANGLE_INSTANTIATE_TEST_ES2_AND(TextureCubeTest, WithDirectSPIRVGeneration(ES2_VULKAN()));
 ANGLE_INSTANTIATE_TEST_ES2(Texture2DTestWithDrawScale);
 ANGLE_INSTANTIATE_TEST_ES2(Sampler2DAsFunctionParameterTest);
@@ -9682,7 +9727,9 @@ ANGLE_INSTANTIATE_TEST_ES2_AND(SamplerArrayAsFunctionParameterTest,
                                WithDirectSPIRVGeneration(ES2_VULKAN()));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DTestES3);
-ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DTestES3, WithAllocateNonZeroMemory(ES3_VULKAN()));
+ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DTestES3,
+                               WithAllocateNonZeroMemory(ES3_VULKAN()),
+                               WithConvertPixelsWithCompute(ES3_VULKAN()));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DTestES31PPO);
 ANGLE_INSTANTIATE_TEST_ES31(Texture2DTestES31PPO);
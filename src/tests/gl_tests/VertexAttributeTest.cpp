@@ -379,6 +379,100 @@ class VertexAttributeTest : public ANGLETest
         glUseProgram(mProgram);
     }
 
+    // Issues many draws from large client-side arrays in a single submission.  The data exceeds the
+    // initial size of the buffer client arrays are streamed through, so it has to grow, or wrap
+    // around, before the data is submitted.
+    void drawManyLargeClientArraysInOneSubmission(bool useClientIndices)
+    {
+        constexpr char kVS[] = R"(attribute vec2 a_position;
+attribute vec4 a_color;
+varying vec4 v_color;
+void main()
+{
+    v_color = a_color;
+    gl_Position = vec4(a_position, 0, 1);
+})";
+
+        constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_color;
+void main()
+{
+    gl_FragColor = v_color;
+})";
+
+        ANGLE_GL_PROGRAM(program, kVS, kFS);
+        glBindAttribLocation(program, 0, "a_position");
+        glBindAttribLocation(program, 1, "a_color");
+        glLinkProgram(program);
+        glUseProgram(program);
+        ASSERT_GL_NO_ERROR();
+
+        // Each draw is a quad covering one horizontal strip of the window, followed by degenerate
+        // triangles that only make the arrays large.
+        constexpr GLsizei kLargeVertexCount = 1 << 16;
+        constexpr int kStripCount           = 8;
+
+        const std::array<GLColor, 4> kColors = {
+            {GLColor::red, GLColor::green, GLColor::blue, GLColor::yellow}};
+
+        std::vector<GLfloat> positions(kLargeVertexCount * 2, 0.0f);
+        std::vector<GLColor> colors(kLargeVertexCount);
+
+        // The indices are streamed before the vertices they reference, so the vertices are what
+        // make the buffer grow.  The last triangle references the last vertex, so all vertices are
+        // streamed.
+        constexpr GLushort kLastIndex         = kLargeVertexCount - 1;
+        const std::array<GLushort, 9> indices = {
+            {0, 1, 2, 3, 4, 5, kLastIndex, kLastIndex, kLastIndex}};
+
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, positions.data());
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, colors.data());
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        // The arrays are overwritten between draws, which is only correct if each draw's data is
+        // copied when the draw is issued.
+        auto drawStrip = [&](int strip) {
+            const GLfloat bottom = -1.0f + 2.0f * strip / kStripCount;
+            const GLfloat top    = bottom + 2.0f / kStripCount;
+
+            const std::array<GLfloat, 12> quad = {
+                {-1.0f, bottom, 1.0f, bottom, 1.0f, top, -1.0f, bottom, 1.0f, top, -1.0f, top}};
+            std::copy(quad.begin(), quad.end(), positions.begin());
+            std::fill(colors.begin(), colors.end(), kColors[strip % kColors.size()]);
+            if (useClientIndices)
+            {
+                glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()),
+                               GL_UNSIGNED_SHORT, indices.data());
+            }
+            else
+            {
+                glDrawArrays(GL_TRIANGLES, 0, kLargeVertexCount);
+            }
+        };
+
+        // Leave a submission in flight, so the allocations that follow start in the middle of the
+        // ring.
+        drawStrip(0);
+        glFlush();
+
+        for (int strip = 1; strip < kStripCount; ++strip)
+        {
+            drawStrip(strip);
+        }
+        ASSERT_GL_NO_ERROR();
+
+        const int stripHeight = getWindowHeight() / kStripCount;
+        for (int strip = 0; strip < kStripCount; ++strip)
+        {
+            EXPECT_PIXEL_RECT_EQ(0, strip * stripHeight, getWindowWidth(), stripHeight,
+                                 kColors[strip % kColors.size()]);
+        }
+    }
+
     static constexpr size_t kVertexCount = 24;
 
     static void InitTestData(std::array<GLfloat, kVertexCount> &inputData,
@@ -1733,6 +1827,19 @@ void main()
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
 }
 
+// Test that many draws from large client-side arrays in a single submission render correctly.
+TEST_P(VertexAttributeTest, ManyLargeClientArrayDrawsInOneSubmission)
+{
+    drawManyLargeClientArraysInOneSubmission(false);
+}
+
+// Same as above, with client-side indices.  The indices of a draw must still be read from where
+// they were streamed when the vertices that follow them make the streaming buffer grow.
+TEST_P(VertexAttributeTest, ManyLargeClientArrayDrawElementsInOneSubmission)
+{
+    drawManyLargeClientArraysInOneSubmission(true);
+}
+
 // Tests that rendering is fine if GL_ANGLE_relaxed_vertex_attribute_type is enabled
 // and mismatched integer signedness between the program's attribute type and the
 // attribute type specified by VertexAttribIPointer are used.
@@ -203,6 +203,71 @@ TEST_P(VulkanMultithreadingTest, MultiContextDrawSmallDescriptorPools)
     runMultithreadedGLTest(testBody, 4);
 }
 
+class VulkanMultithreadingTest_ParallelRecording : public VulkanMultithreadingTest
+{};
+
+// Test that a render pass large enough to be recorded in parallel in secondary command buffers
+// renders the same as when it's executed inline.  Every draw changes the scissor and the color
+// uniform, so every chunk depends on the state set by the previous ones.
+TEST_P(VulkanMultithreadingTest_ParallelRecording, LargeRenderPass)
+{
+    constexpr int kCellSize     = 4;
+    constexpr int kCellsPerSide = kSize / kCellSize;
+    constexpr int kCellCount    = kCellsPerSide * kCellsPerSide;
+    // Draw every cell several times, so the render pass has over 10k draws.
+    constexpr int kPassCount = 4;
+
+    auto cellColor = [](int cell, int pass) {
+        return GLColor(static_cast<GLubyte>(cell % 256),
+                       static_cast<GLubyte>((cell / 256) * 16 + pass), 0, 255);
+    };
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+
+    auto quadVertices = GetQuadVertices();
+
+    GLBuffer vertexBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 3 * 6, quadVertices.data(), GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    glEnableVertexAttribArray(positionLocation);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glEnable(GL_SCISSOR_TEST);
+    for (int pass = 0; pass < kPassCount; ++pass)
+    {
+        for (int cell = 0; cell < kCellCount; ++cell)
+        {
+            glScissor((cell % kCellsPerSide) * kCellSize, (cell / kCellsPerSide) * kCellSize,
+                      kCellSize, kCellSize);
+            const angle::Vector4 floatColor = cellColor(cell, pass).toNormalizedVector();
+            glUniform4fv(colorLocation, 1, floatColor.data());
+            glDrawArrays(GL_TRIANGLES, 0, 6);
+        }
+    }
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    std::vector<GLColor> pixels(kSize * kSize);
+    glReadPixels(0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    ASSERT_GL_NO_ERROR();
+
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        const int x = (cell % kCellsPerSide) * kCellSize + kCellSize / 2;
+        const int y = (cell / kCellsPerSide) * kCellSize + kCellSize / 2;
+        ASSERT_EQ(cellColor(cell, kPassCount - 1), pixels[y * kSize + x]) << "cell " << cell;
+    }
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanMultithreadingTest, ES2_VULKAN(), ES3_VULKAN());
+ANGLE_INSTANTIATE_TEST(VulkanMultithreadingTest_ParallelRecording,
+                       WithParallelCommandBufferRecording(ES3_VULKAN()));
 
 }  // namespace angle
@@ -175,6 +175,28 @@ class VulkanPerformanceCounterTest : public ANGLETest
 class VulkanPerformanceCounterTest_ES31 : public VulkanPerformanceCounterTest
 {};
 
+class VulkanPerformanceCounterTest_WarmUpPipelines : public VulkanPerformanceCounterTest
+{};
+
+class VulkanPerformanceCounterTest_SuballocateSmallBuffers : public VulkanPerformanceCounterTest
+{};
+
+class VulkanPerformanceCounterTest_EvictTextures : public VulkanPerformanceCounterTest
+{
+  protected:
+    // Fake a device-local memory budget, or restore the real one with 0.
+    void setMemoryHeapBudget(VkDeviceSize budget)
+    {
+        getRenderer()->setMemoryHeapBudgetForTesting(budget);
+    }
+
+    rx::RendererVk *getRenderer()
+    {
+        const gl::Context *context = static_cast<const gl::Context *>(getEGLWindow()->getContext());
+        return rx::GetImplAs<rx::ContextVk>(context)->getRenderer();
+    }
+};
+
 // Tests that texture updates to unused textures don't break the RP.
 TEST_P(VulkanPerformanceCounterTest, NewTextureDoesNotBreakRenderPass)
 {
@@ -3046,7 +3068,202 @@ void main()
     EXPECT_EQ(descriptorSetAllocationsAfter, 0u);
 }
 
+// Tests that drawing with a stream of new textures rewrites the least recently used texture
+// descriptor sets once the descriptor set cache is full, instead of allocating more sets.
+TEST_P(VulkanPerformanceCounterTest, TextureChurnRecyclesDescriptorSets)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+    glUseProgram(program);
+    GLint textureLoc = glGetUniformLocation(program, essl1_shaders::Texture2DUniform());
+    ASSERT_NE(-1, textureLoc);
+    glUniform1i(textureLoc, 0);
+
+    // Finish every now and then, so the GPU is done with the least recently used sets.
+    constexpr size_t kFinishInterval = 64;
+
+    auto drawWithNewTextures = [&](size_t textureCount) {
+        for (size_t textureIndex = 0; textureIndex < textureCount; ++textureIndex)
+        {
+            GLTexture texture;
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                         &GLColor::green);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+            if ((textureIndex + 1) % kFinishInterval == 0)
+            {
+                glFinish();
+            }
+        }
+        glFinish();
+    };
+
+    // Fill the cache.
+    drawWithNewTextures(rx::kMaxCachedDescriptorSets);
+    ASSERT_GL_NO_ERROR();
+    uint32_t descriptorPoolsBefore = hackANGLE().descriptorPools;
+
+    // Every new texture now reuses a cached set.
+    drawWithNewTextures(rx::kMaxCachedDescriptorSets);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    const rx::vk::PerfCounters &counters = hackANGLE();
+    EXPECT_GE(counters.descriptorSetRecycles, rx::kMaxCachedDescriptorSets);
+    EXPECT_LE(counters.descriptorPools, descriptorPoolsBefore);
+}
+
+// Tests that the pipelines a program needed are created ahead of time when the same program is
+// loaded from the program cache, so that the draws don't create any.
+TEST_P(VulkanPerformanceCounterTest_WarmUpPipelines, ProgramCacheHitWarmsUpPipelines)
+{
+    // A shader that no other test uses, so the program isn't in the program cache yet.
+    constexpr char kFS[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(0.0, 0.8125, 0.0, 1.0);
+})";
+
+    auto drawWithProgram = [this](GLuint program) {
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ZERO);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        glDisable(GL_BLEND);
+        glUseProgram(0);
+    };
+
+    // The first program creates its pipelines as it draws.
+    uint32_t coldPipelinesBefore = hackANGLE().coldGraphicsPipelines;
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+        drawWithProgram(program);
+        ASSERT_GL_NO_ERROR();
+    }
+    uint32_t coldPipelines = hackANGLE().coldGraphicsPipelines - coldPipelinesBefore;
+    EXPECT_GT(coldPipelines, 0u);
+
+    // Deleting the program recorded its pipelines.  The same program is loaded from the program
+    // cache, and the recorded pipelines are created right away.
+    uint32_t warmedUpPipelinesBefore = hackANGLE().warmedUpGraphicsPipelines;
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+    EXPECT_EQ(hackANGLE().warmedUpGraphicsPipelines - warmedUpPipelinesBefore, coldPipelines);
+
+    coldPipelinesBefore = hackANGLE().coldGraphicsPipelines;
+    drawWithProgram(program);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(hackANGLE().coldGraphicsPipelines, coldPipelinesBefore);
+    EXPECT_PIXEL_NEAR(0, 0, 0, 207, 0, 255, 1);
+}
+
+// Tests that small buffers are suballocated from a few shared slabs, and that their blocks are
+// reused once the buffers are deleted.
+TEST_P(VulkanPerformanceCounterTest_SuballocateSmallBuffers, SmallBuffersShareSlabs)
+{
+    constexpr size_t kBufferCount = 256;
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    const std::array<Vector3, 6> quadVertices = GetQuadVertices();
+
+    uint32_t suballocatedBuffersBefore = hackANGLE().suballocatedBuffers;
+
+    std::vector<GLBuffer> buffers(kBufferCount);
+    for (GLBuffer &buffer : buffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    const rx::vk::PerfCounters &counters = hackANGLE();
+    EXPECT_EQ(counters.suballocatedBuffers - suballocatedBuffersBefore, kBufferCount);
+    // Every buffer fits in the same size class, so a handful of slabs holds all of them.
+    EXPECT_LT(counters.bufferSlabs, kBufferCount / 16);
+    uint32_t bufferSlabsBefore = counters.bufferSlabs;
+
+    // Once the GPU is done with the deleted buffers, new buffers take over their blocks.
+    glDisableVertexAttribArray(positionLocation);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    buffers.clear();
+    glFinish();
+
+    buffers.resize(kBufferCount);
+    for (GLBuffer &buffer : buffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(hackANGLE().suballocatedBuffers - suballocatedBuffersBefore, kBufferCount);
+    EXPECT_LE(hackANGLE().bufferSlabs, bufferSlabsBefore);
+}
+
+// Tests that idle textures are evicted when device memory is over budget, and that their contents
+// survive the round trip through host memory.
+TEST_P(VulkanPerformanceCounterTest_EvictTextures, IdleTexturesAreEvicted)
+{
+    // With unified memory, such as on SwiftShader, evicting doesn't free anything and is skipped.
+    ANGLE_SKIP_TEST_IF(getRenderer()->isStagingMemoryDeviceLocal());
+
+    constexpr size_t kTextureCount = 4;
+    constexpr GLsizei kTextureSize = 16;
+    const std::array<GLColor, kTextureCount> kColors = {GLColor::red, GLColor::green,
+                                                        GLColor::blue, GLColor::yellow};
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+    std::array<GLTexture, kTextureCount> textures;
+    for (size_t index = 0; index < kTextureCount; ++index)
+    {
+        std::vector<GLColor> data(kTextureSize * kTextureSize, kColors[index]);
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, data.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, kColors[index]);
+    }
+    ASSERT_GL_NO_ERROR();
+    glFinish();
+
+    uint32_t evictedTexturesBefore = hackANGLE().evictedTextures;
+
+    // With a tiny budget, every idle texture but the one in use is evicted on the next flush.
+    setMemoryHeapBudget(1);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glFinish();
+    setMemoryHeapBudget(0);
+
+    EXPECT_EQ(hackANGLE().evictedTextures - evictedTexturesBefore, kTextureCount - 1);
+
+    // Evicted textures are recreated with their contents on next use.
+    for (size_t index = 0; index < kTextureCount; ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, kColors[index]);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest, ES3_VULKAN());
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_ES31, ES31_VULKAN());
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_WarmUpPipelines,
+                       WithWarmUpGraphicsPipelines(ES3_VULKAN()));
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_SuballocateSmallBuffers,
+                       WithSuballocateSmallBuffers(ES3_VULKAN()));
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_EvictTextures,
+                       WithEvictTexturesOverMemoryBudget(ES3_VULKAN()));
 
 }  // anonymous namespace
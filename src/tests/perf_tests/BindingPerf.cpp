@@ -39,11 +39,15 @@ struct BindingsParams final : public RenderTestParams
         numObjects        = 100;
         allocationStyle   = EVERY_ITERATION;
         iterationsPerStep = kIterationsPerStep;
+        bufferSize        = 0;
     }
 
     std::string story() const override;
     size_t numObjects;
     AllocationStyle allocationStyle;
+    // If non-zero, every bound buffer is given storage of this size with glBufferData, or updated
+    // with glBufferSubData if it was allocated at initialization.
+    size_t bufferSize;
 };
 
 std::ostream &operator<<(std::ostream &os, const BindingsParams &params)
@@ -72,6 +76,16 @@ std::string BindingsParams::story() const
             break;
     }
 
+    if (bufferSize > 0)
+    {
+        strstr << "_" << bufferSize << "_bytes";
+    }
+
+    if (eglParameters.suballocateSmallBuffers == EGL_TRUE)
+    {
+        strstr << "_suballocated";
+    }
+
     return strstr.str();
 }
 
@@ -89,6 +103,7 @@ class BindingsBenchmark : public ANGLERenderTest,
     // TODO: Test binding perf of more than just buffers
     std::vector<GLuint> mBuffers;
     std::vector<GLenum> mBindingPoints;
+    std::vector<GLubyte> mBufferData;
 };
 
 BindingsBenchmark::BindingsBenchmark() : ANGLERenderTest("Bindings", GetParam())
@@ -105,12 +120,18 @@ void BindingsBenchmark::initializeBenchmark()
     const auto &params = GetParam();
 
     mBuffers.resize(params.numObjects, 0);
+    mBufferData.resize(params.bufferSize, 0x7F);
     if (params.allocationStyle == AT_INITIALIZATION)
     {
         glGenBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
         for (size_t bufferIdx = 0; bufferIdx < mBuffers.size(); bufferIdx++)
         {
             glBindBuffer(GL_ARRAY_BUFFER, mBuffers[bufferIdx]);
+            if (params.bufferSize > 0)
+            {
+                glBufferData(GL_ARRAY_BUFFER, params.bufferSize, mBufferData.data(),
+                             GL_STATIC_DRAW);
+            }
         }
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
@@ -164,11 +185,25 @@ void BindingsBenchmark::drawBenchmark()
         size_t bindingPointsSize    = mBindingPoints.size();
         size_t buffersSize          = mBuffers.size();
         size_t bindingIndex         = it % bindingPointsSize;
+        size_t bufferSize           = params.bufferSize;
+        const GLubyte *bufferData   = mBufferData.data();
         for (size_t bufferIdx = 0; bufferIdx < buffersSize; bufferIdx++)
         {
             GLenum binding = bindingPoints[bindingIndex];
             glBindBuffer(binding, buffers[bufferIdx]);
 
+            if (bufferSize > 0)
+            {
+                if (params.allocationStyle == EVERY_ITERATION)
+                {
+                    glBufferData(binding, bufferSize, bufferData, GL_STATIC_DRAW);
+                }
+                else
+                {
+                    glBufferSubData(binding, 0, bufferSize, bufferData);
+                }
+            }
+
             // Instead of doing a costly division to get an index in the range [0,bindingPointsSize)
             // do a bounds-check and reset the index.
             ++bindingIndex;
@@ -209,6 +244,23 @@ BindingsParams VulkanParams(AllocationStyle allocationStyle)
     return params;
 }
 
+// Many small buffers with storage, suballocated from shared slabs or not.  Each step touches every
+// buffer once, which is already plenty of work.
+BindingsParams VulkanSmallBuffersParams(AllocationStyle allocationStyle, bool suballocate)
+{
+    BindingsParams params;
+    params.eglParameters     = egl_platform::VULKAN_NULL();
+    params.allocationStyle   = allocationStyle;
+    params.numObjects        = 10000;
+    params.bufferSize        = 64;
+    params.iterationsPerStep = 1;
+    if (suballocate)
+    {
+        params.eglParameters.suballocateSmallBuffers = EGL_TRUE;
+    }
+    return params;
+}
+
 TEST_P(BindingsBenchmark, Run)
 {
     run();
@@ -220,6 +272,10 @@ ANGLE_INSTANTIATE_TEST(BindingsBenchmark,
                        OpenGLOrGLESParams(EVERY_ITERATION),
                        OpenGLOrGLESParams(AT_INITIALIZATION),
                        VulkanParams(EVERY_ITERATION),
-                       VulkanParams(AT_INITIALIZATION));
+                       VulkanParams(AT_INITIALIZATION),
+                       VulkanSmallBuffersParams(EVERY_ITERATION, false),
+                       VulkanSmallBuffersParams(EVERY_ITERATION, true),
+                       VulkanSmallBuffersParams(AT_INITIALIZATION, false),
+                       VulkanSmallBuffersParams(AT_INITIALIZATION, true));
 
 }  // namespace angle
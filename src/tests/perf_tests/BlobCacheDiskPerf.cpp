@@ -0,0 +1,190 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskPerf:
+//   Performance test for linking programs with the on-disk blob cache enabled.  The cold variant
+//   links programs that were never seen before, and pays for storing them to disk.  The warm
+//   variant links programs that are already in the pack file.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "common/system_utils.h"
+#include "util/shader_utils.h"
+#include "util/test_utils.h"
+
+using namespace angle;
+
+namespace
+{
+// Number of distinct programs linked in the warm variant.
+constexpr GLuint kWarmProgramCount = 64;
+
+enum class CacheOption
+{
+    Cold,
+    Warm,
+};
+
+struct BlobCacheDiskParams final : public RenderTestParams
+{
+    BlobCacheDiskParams(CacheOption cacheOptionIn)
+    {
+        iterationsPerStep = 1;
+
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+        cacheOption  = cacheOptionIn;
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story();
+        strstr << (cacheOption == CacheOption::Cold ? "_cold" : "_warm");
+        return strstr.str();
+    }
+
+    CacheOption cacheOption;
+};
+
+std::ostream &operator<<(std::ostream &os, const BlobCacheDiskParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class BlobCacheDiskBenchmark : public ANGLERenderTest,
+                               public ::testing::WithParamInterface<BlobCacheDiskParams>
+{
+  public:
+    BlobCacheDiskBenchmark();
+    ~BlobCacheDiskBenchmark() override;
+
+    void initializeBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void linkProgram(GLuint variant);
+
+    std::string mCachePath;
+    GLuint mVariant = 0;
+};
+
+BlobCacheDiskBenchmark::BlobCacheDiskBenchmark() : ANGLERenderTest("BlobCacheDisk", GetParam())
+{
+    // The cache file has to be set up before the display is initialized.
+    char cachePath[1024];
+    if (!CreateTemporaryFile(cachePath, sizeof(cachePath)))
+    {
+        mSkipTest = true;
+        return;
+    }
+
+    mCachePath = cachePath;
+    SetEnvironmentVar("ANGLE_BLOB_CACHE_PATH", mCachePath.c_str());
+}
+
+BlobCacheDiskBenchmark::~BlobCacheDiskBenchmark()
+{
+    if (!mCachePath.empty())
+    {
+        UnsetEnvironmentVar("ANGLE_BLOB_CACHE_PATH");
+        DeleteFile(mCachePath.c_str());
+    }
+}
+
+void BlobCacheDiskBenchmark::initializeBenchmark()
+{
+    if (GetParam().cacheOption == CacheOption::Warm)
+    {
+        for (GLuint variant = 0; variant < kWarmProgramCount; ++variant)
+        {
+            linkProgram(variant);
+        }
+        glFinish();
+    }
+    else
+    {
+        // Make sure cold links never see a program stored by a previous run.
+        mVariant = kWarmProgramCount;
+    }
+}
+
+void BlobCacheDiskBenchmark::drawBenchmark()
+{
+    if (GetParam().cacheOption == CacheOption::Warm)
+    {
+        linkProgram(mVariant++ % kWarmProgramCount);
+    }
+    else
+    {
+        linkProgram(mVariant++);
+    }
+}
+
+void BlobCacheDiskBenchmark::linkProgram(GLuint variant)
+{
+    constexpr char kVS[] = R"(attribute vec2 position;
+varying vec2 texCoord;
+void main()
+{
+    texCoord = position * 0.5 + 0.5;
+    gl_Position = vec4(position, 0, 1);
+})";
+
+    // Each variant gets a unique source, hence a unique program hash.
+    std::stringstream fsStream;
+    fsStream << R"(precision mediump float;
+varying vec2 texCoord;
+uniform sampler2D tex;
+void main()
+{
+    vec4 color = texture2D(tex, texCoord);
+    gl_FragColor = color * float()"
+             << variant << R"() + vec4(texCoord, 0.0, 1.0);
+})";
+
+    GLuint program = CompileProgram(kVS, fsStream.str().c_str());
+    ASSERT_NE(0u, program);
+
+    // Query the link status to make sure the link is done.
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    ASSERT_EQ(GL_TRUE, linkStatus);
+
+    glDeleteProgram(program);
+}
+
+BlobCacheDiskParams BlobCacheDiskVulkanParams(CacheOption cacheOption)
+{
+    BlobCacheDiskParams params(cacheOption);
+    params.eglParameters = egl_platform::VULKAN();
+    return params;
+}
+
+BlobCacheDiskParams BlobCacheDiskOpenGLOrGLESParams(CacheOption cacheOption)
+{
+    BlobCacheDiskParams params(cacheOption);
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+
+TEST_P(BlobCacheDiskBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(BlobCacheDiskBenchmark,
+                       BlobCacheDiskVulkanParams(CacheOption::Cold),
+                       BlobCacheDiskVulkanParams(CacheOption::Warm),
+                       BlobCacheDiskOpenGLOrGLESParams(CacheOption::Cold),
+                       BlobCacheDiskOpenGLOrGLESParams(CacheOption::Warm));
+
+}  // anonymous namespace
@@ -6,15 +6,24 @@
 // CompilerPerfTest:
 //   Performance test for the shader translator. The test initializes the compiler once and then
 //   compiles the same shader repeatedly. There are different variations of the tests using
-//   different shaders.
+//   different shaders, including a large generated uber-shader that is also compiled with the
+//   function-local transformations running in parallel.
+// ShaderCacheBenchmark:
+//   Performance test for glCompileShader through the shader cache, either compiling the same
+//   shader repeatedly so that every compile hits the cache, or making every shader unique.
 //
 
 #include "ANGLEPerfTest.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include "GLSLANG/ShaderLang.h"
+#include "common/system_utils.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
+#include "util/shader_utils.h"
 
 namespace
 {
@@ -162,7 +171,61 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// An uber-shader with hundreds of functions, each with the loops, switches and swizzles the
+// translator's transformations work on.
+const char *GetUberESSL300FragSource()
+{
+    constexpr int kFunctionCount = 512;
+
+    static const std::string source = []() {
+        std::stringstream shader;
+        shader << "#version 300 es\n"
+                  "precision highp float;\n"
+                  "uniform int ui;\n"
+                  "uniform vec4 uv;\n"
+                  "out vec4 outColor;\n"
+                  "vec4 f0(int x)\n"
+                  "{\n"
+                  "    return uv * float(x);\n"
+                  "}\n";
+        for (int function = 1; function < kFunctionCount; ++function)
+        {
+            shader << "vec4 f" << function << "(int x)\n"
+                   << "{\n"
+                   << "    vec4 v = f" << function - 1 << "(x + 1);\n"
+                   << "    float a = 0.0;\n"
+                   << "    for (int i = 0; i < x % 4; ++i)\n"
+                   << "    {\n"
+                   << "        v.xy = v.yx * a;\n"
+                   << "        a += v.z;\n"
+                   << "    }\n"
+                   << "    switch (x)\n"
+                   << "    {\n"
+                   << "        case " << function << ":\n"
+                   << "            v.x = a = v.w + float(x);\n"
+                   << "            break;\n"
+                   << "        default:\n"
+                   << "            { {} }\n"
+                   << "    }\n"
+                   << "    return v;\n"
+                   << "}\n";
+        }
+        shader << "void main()\n"
+                  "{\n"
+                  "    outColor = f"
+               << kFunctionCount - 1 << "(ui);\n"
+               << "}\n";
+        return shader.str();
+    }();
+
+    return source.c_str();
+}
+
+const char *kUberESSL300Id = "UberESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
+// The number of compiles the time of each pass is averaged over.
+constexpr int kNumPassMetricsCompiles = 16;
 
 struct CompilerParameters
 {
@@ -223,15 +286,23 @@ struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           ShCompileOptions extraCompileOptions = 0)
+        : CompilerParameters(output),
+          shaderSource(shaderSource),
+          extraCompileOptions(extraCompileOptions)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += CompilerParameters::str();
+        if ((extraCompileOptions & SH_PARALLELIZE_FUNCTION_PASSES) != 0)
+        {
+            testId += "_parallel_function_passes";
+        }
     }
 
     const char *shaderSource;
+    ShCompileOptions extraCompileOptions;
     std::string testId;
 };
 
@@ -256,6 +327,9 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
+    ShCompileOptions getCompileOptions() const;
+    void reportPassMetrics();
+
     const char *mTestShader;
 
     ShBuiltInResources mResources;
@@ -290,6 +364,11 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator)
+    {
+        reportPassMetrics();
+    }
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -300,12 +379,65 @@ void CompilerPerfTest::TearDown()
     ANGLEPerfTest::TearDown();
 }
 
-void CompilerPerfTest::step()
+ShCompileOptions CompilerPerfTest::getCompileOptions() const
+{
+    return SH_OBJECT_CODE | SH_VARIABLES | SH_INITIALIZE_UNINITIALIZED_LOCALS |
+           SH_INIT_OUTPUT_VARIABLES | GetParam().extraCompileOptions;
+}
+
+void CompilerPerfTest::reportPassMetrics()
 {
-    const char *shaderStrings[] = {mTestShader};
+    // The passes are measured in compiles of their own, so recording them doesn't add to the time
+    // of the steps.
+    const char *shaderStrings[]           = {mTestShader};
+    const ShCompileOptions compileOptions = getCompileOptions() | SH_RECORD_PASS_METRICS;
 
-    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
-                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+    std::vector<double> passTimes;
+    for (int compile = 0; compile < kNumPassMetricsCompiles; ++compile)
+    {
+        if (!mTranslator->compile(shaderStrings, 1, compileOptions))
+        {
+            return;
+        }
+
+        const std::vector<sh::PassMetrics> &passMetrics = mTranslator->getPassMetrics();
+        passTimes.resize(passMetrics.size(), 0);
+        for (size_t passIndex = 0; passIndex < passMetrics.size(); ++passIndex)
+        {
+            passTimes[passIndex] += passMetrics[passIndex].wallTime;
+        }
+    }
+
+    // The AST and the pool usage are the same in every compile.
+    const std::vector<sh::PassMetrics> &passMetrics = mTranslator->getPassMetrics();
+    size_t poolBytesAllocated                       = 0;
+    size_t poolPeakBytesInUse                       = 0;
+    for (size_t passIndex = 0; passIndex < passMetrics.size(); ++passIndex)
+    {
+        const sh::PassMetrics &metrics = passMetrics[passIndex];
+        const std::string timeMetric   = std::string(".") + metrics.name + "_time";
+        mReporter->RegisterFyiMetric(timeMetric, "us");
+        mReporter->AddResult(timeMetric, passTimes[passIndex] * 1e6 / kNumPassMetricsCompiles);
+
+        poolBytesAllocated += metrics.poolBytesAllocated;
+        poolPeakBytesInUse = std::max(poolPeakBytesInUse, metrics.poolPeakBytesInUse);
+    }
+
+    if (!passMetrics.empty())
+    {
+        mReporter->RegisterFyiMetric(".ast_node_count", "count");
+        mReporter->AddResult(".ast_node_count", passMetrics.back().astNodeCount);
+    }
+    mReporter->RegisterFyiMetric(".pool_bytes_allocated", "bytes");
+    mReporter->AddResult(".pool_bytes_allocated", poolBytesAllocated);
+    mReporter->RegisterImportantMetric(".pool_peak_bytes_in_use", "bytes");
+    mReporter->AddResult(".pool_peak_bytes_in_use", poolPeakBytesInUse);
+}
+
+void CompilerPerfTest::step()
+{
+    const char *shaderStrings[]     = {mTestShader};
+    ShCompileOptions compileOptions = getCompileOptions();
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
@@ -342,6 +474,116 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, GetUberESSL300FragSource(), kUberESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           GetUberESSL300FragSource(),
+                           kUberESSL300Id,
+                           SH_PARALLELIZE_FUNCTION_PASSES),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, GetUberESSL300FragSource(), kUberESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           GetUberESSL300FragSource(),
+                           kUberESSL300Id,
+                           SH_PARALLELIZE_FUNCTION_PASSES));
+
+struct ShaderCacheParams final : public RenderTestParams
+{
+    ShaderCacheParams(const EGLPlatformParameters &eglParametersIn, bool cacheHitIn)
+    {
+        iterationsPerStep = kNumIterationsPerStep;
+
+        majorVersion  = 2;
+        minorVersion  = 0;
+        windowWidth   = 64;
+        windowHeight  = 64;
+        eglParameters = eglParametersIn;
+        cacheHit      = cacheHitIn;
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story() << (cacheHit ? "_cache_hit" : "_cache_miss");
+        return strstr.str();
+    }
+
+    // Whether every compile uses the same source, so all but the first are cache hits.
+    bool cacheHit;
+};
+
+std::ostream &operator<<(std::ostream &os, const ShaderCacheParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class ShaderCacheBenchmark : public ANGLERenderTest,
+                             public ::testing::WithParamInterface<ShaderCacheParams>
+{
+  public:
+    ShaderCacheBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    uint32_t mShaderIndex = 0;
+    double mCompileTime   = 0;
+    size_t mCompileCount  = 0;
+};
+
+ShaderCacheBenchmark::ShaderCacheBenchmark() : ANGLERenderTest("ShaderCache", GetParam()) {}
+
+void ShaderCacheBenchmark::initializeBenchmark()
+{
+    mReporter->RegisterImportantMetric(".compile_latency", "ns");
+}
+
+void ShaderCacheBenchmark::destroyBenchmark()
+{
+    if (mCompileCount > 0)
+    {
+        mReporter->AddResult(".compile_latency", mCompileTime * 1e9 / mCompileCount);
+    }
+}
+
+void ShaderCacheBenchmark::drawBenchmark()
+{
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        // A comment is enough to change the cache key.
+        std::stringstream source;
+        if (!GetParam().cacheHit)
+        {
+            source << "// " << mShaderIndex++ << "\n";
+        }
+        source << kRealWorldESSL100FragSource;
+
+        double startTime = angle::GetCurrentTime();
+
+        // Querying the compile status waits for the compile.
+        GLuint shader = CompileShader(GL_FRAGMENT_SHADER, source.str().c_str());
+
+        mCompileTime += angle::GetCurrentTime() - startTime;
+        mCompileCount++;
+
+        ASSERT_NE(0u, shader);
+        glDeleteShader(shader);
+    }
+}
+
+TEST_P(ShaderCacheBenchmark, Run)
+{
+    run();
+}
+
+using namespace angle::egl_platform;
+
+ANGLE_INSTANTIATE_TEST(ShaderCacheBenchmark,
+                       ShaderCacheParams(VULKAN(), false),
+                       ShaderCacheParams(VULKAN(), true),
+                       ShaderCacheParams(VULKAN_NULL(), false),
+                       ShaderCacheParams(VULKAN_NULL(), true));
 
 }  // anonymous namespace
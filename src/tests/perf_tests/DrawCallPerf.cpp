@@ -11,8 +11,13 @@
 #include "DrawCallPerfParams.h"
 #include "common/PackedEnums.h"
 #include "test_utils/draw_call_perf_utils.h"
+#include "util/EGLWindow.h"
 #include "util/shader_utils.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace
 {
 enum class StateChange
@@ -25,12 +30,16 @@ enum class StateChange
     Program,
     VertexBufferCycle,
     Scissor,
+    ClientVertexArray,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
 
 constexpr size_t kCycleVBOPoolSize = 200;
 
+// Enough draws for a render pass to be recorded in parallel, when that's enabled.
+constexpr unsigned int kLargeRenderPassDrawCount = 20000;
+
 struct DrawArraysPerfParams : public DrawCallPerfParams
 {
     DrawArraysPerfParams() = default;
@@ -70,10 +79,18 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Scissor:
             strstr << "_scissor_change";
             break;
+        case StateChange::ClientVertexArray:
+            strstr << "_client_array";
+            break;
         default:
             break;
     }
 
+    if (eglParameters.parallelCommandBufferRecording == EGL_TRUE)
+    {
+        strstr << "_parallel_recording";
+    }
+
     return strstr.str();
 }
 
@@ -135,6 +152,7 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     int mNumTris       = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
     size_t mCurrentVBO = 0;
+    std::vector<GLfloat> mClientVertexData;
 };
 
 DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam()) {}
@@ -225,6 +243,15 @@ void main()
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
 
+    if (params.stateChange == StateChange::ClientVertexArray)
+    {
+        // Every draw streams the vertices from client memory, like a GLES2 application that
+        // doesn't use buffers would.
+        Generate2DTriangleData(mNumTris, &mClientVertexData);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, mClientVertexData.data());
+    }
+
     // Set the viewport
     glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
 
@@ -515,6 +542,9 @@ void DrawCallPerfBenchmark::drawBenchmark()
             ChangeScissorThenDraw(params.iterationsPerStep, numElements, getWindow()->getWidth(),
                                   getWindow()->getHeight());
             break;
+        case StateChange::ClientVertexArray:
+            ClearThenDraw(params.iterationsPerStep, numElements);
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
@@ -553,6 +583,250 @@ std::vector<P> gTestsWithRenderer =
 std::vector<P> gTestsWithDevice =
     CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
 
-ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
+// Every step draws in a single render pass, which is split in chunks that are recorded in
+// parallel.  Compare with the same tests on Vulkan without parallel recording.
+DrawArraysPerfParams ParallelRecording(const DrawArraysPerfParams &in)
+{
+    DrawArraysPerfParams out                         = Vulkan(in);
+    out.eglParameters.parallelCommandBufferRecording = EGL_TRUE;
+    out.iterationsPerStep                            = kLargeRenderPassDrawCount;
+    return out;
+}
+
+std::vector<P> gParallelRecordingTests = CombineWithFuncs(
+    CombineWithValues({P()}, {StateChange::NoChange, StateChange::Texture, StateChange::Scissor},
+                      CombineStateChange),
+    {ParallelRecording});
+
+std::vector<P> GetDrawCallTests()
+{
+    std::vector<P> tests = gTestsWithDevice;
+    tests.insert(tests.end(), gParallelRecordingTests.begin(), gParallelRecordingTests.end());
+    return tests;
+}
+
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, GetDrawCallTests());
+
+// Draws from one context per thread, in parallel, to measure how the draw call overhead scales with
+// the number of contexts.  The contexts are shared, either in a single share group, or each with an
+// idle context in its own share group.
+struct MultithreadedDrawCallPerfParams : public DrawCallPerfParams
+{
+    MultithreadedDrawCallPerfParams() = default;
+    MultithreadedDrawCallPerfParams(const DrawCallPerfParams &base) : DrawCallPerfParams(base) {}
+
+    std::string story() const override;
+
+    size_t contextCount   = 1;
+    bool singleShareGroup = false;
+};
+
+std::string MultithreadedDrawCallPerfParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << DrawCallPerfParams::story() << "_" << contextCount << "_contexts"
+           << (singleShareGroup ? "_one_share_group" : "_share_group_each");
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const MultithreadedDrawCallPerfParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class MultithreadedDrawCallPerfBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<MultithreadedDrawCallPerfParams>
+{
+  public:
+    MultithreadedDrawCallPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void threadLoop(size_t threadIndex);
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+    std::vector<EGLSurface> mSurfaces;
+    std::vector<EGLContext> mContexts;
+    // Contexts that only make the contexts of the threads part of their own share group.
+    std::vector<EGLContext> mIdleContexts;
+    std::vector<std::thread> mThreads;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    size_t mStep          = 0;
+    size_t mFinishedCount = 0;
+    bool mStopping        = false;
+};
+
+MultithreadedDrawCallPerfBenchmark::MultithreadedDrawCallPerfBenchmark()
+    : ANGLERenderTest("MultithreadedDrawCallPerf", GetParam())
+{}
+
+void MultithreadedDrawCallPerfBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    EGLWindow *window = static_cast<EGLWindow *>(getGLWindow());
+    mDisplay          = window->getDisplay();
+
+    const EGLint pbufferAttributes[] = {
+        EGL_WIDTH,  static_cast<EGLint>(getWindow()->getWidth()),
+        EGL_HEIGHT, static_cast<EGLint>(getWindow()->getHeight()),
+        EGL_NONE,
+    };
+
+    for (size_t threadIndex = 0; threadIndex < params.contextCount; ++threadIndex)
+    {
+        EGLContext context = EGL_NO_CONTEXT;
+        if (params.singleShareGroup)
+        {
+            context = window->createContext(window->getContext());
+        }
+        else
+        {
+            context = window->createContext(EGL_NO_CONTEXT);
+            mIdleContexts.push_back(window->createContext(context));
+            ASSERT_NE(EGL_NO_CONTEXT, mIdleContexts.back());
+        }
+        ASSERT_NE(EGL_NO_CONTEXT, context);
+        mContexts.push_back(context);
+
+        EGLSurface surface = eglCreatePbufferSurface(mDisplay, window->getConfig(),
+                                                     pbufferAttributes);
+        ASSERT_NE(EGL_NO_SURFACE, surface);
+        mSurfaces.push_back(surface);
+    }
+
+    for (size_t threadIndex = 0; threadIndex < params.contextCount; ++threadIndex)
+    {
+        mThreads.emplace_back(&MultithreadedDrawCallPerfBenchmark::threadLoop, this, threadIndex);
+    }
+}
+
+void MultithreadedDrawCallPerfBenchmark::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+
+    for (EGLSurface surface : mSurfaces)
+    {
+        eglDestroySurface(mDisplay, surface);
+    }
+    for (EGLContext context : mContexts)
+    {
+        eglDestroyContext(mDisplay, context);
+    }
+    for (EGLContext context : mIdleContexts)
+    {
+        eglDestroyContext(mDisplay, context);
+    }
+}
+
+void MultithreadedDrawCallPerfBenchmark::threadLoop(size_t threadIndex)
+{
+    const auto &params  = GetParam();
+    GLsizei numElements = static_cast<GLsizei>(3 * params.numTris);
+
+    EGLSurface surface = mSurfaces[threadIndex];
+    eglMakeCurrent(mDisplay, surface, surface, mContexts[threadIndex]);
+
+    // Every context has its own objects, so that the draws only touch context-local state.
+    GLuint program = SetupSimpleDrawProgram();
+    GLuint buffer  = Create2DTriangleBuffer(params.numTris, GL_STATIC_DRAW);
+    glBindAttribLocation(program, 0, "vPosition");
+    glLinkProgram(program);
+    glUseProgram(program);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+    size_t step = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this, step]() { return mStopping || mStep != step; });
+            if (mStopping)
+            {
+                break;
+            }
+            step = mStep;
+        }
+
+        ClearThenDraw(params.iterationsPerStep, numElements);
+        glFlush();
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFinishedCount++;
+        }
+        mCondition.notify_all();
+    }
+
+    glDeleteProgram(program);
+    glDeleteBuffers(1, &buffer);
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+void MultithreadedDrawCallPerfBenchmark::drawBenchmark()
+{
+    // Every context does the whole step's draws, so that the time of the steps stays the same as
+    // long as the contexts scale.
+    std::unique_lock<std::mutex> lock(mMutex);
+    mStep++;
+    mFinishedCount = 0;
+    mCondition.notify_all();
+    mCondition.wait(lock, [this]() { return mFinishedCount == mThreads.size(); });
+}
+
+TEST_P(MultithreadedDrawCallPerfBenchmark, Run)
+{
+    run();
+}
+
+MultithreadedDrawCallPerfParams CombineContextCount(const MultithreadedDrawCallPerfParams &in,
+                                                    size_t contextCount)
+{
+    MultithreadedDrawCallPerfParams out = in;
+    out.contextCount                    = contextCount;
+    return out;
+}
+
+MultithreadedDrawCallPerfParams CombineSingleShareGroup(const MultithreadedDrawCallPerfParams &in,
+                                                        bool singleShareGroup)
+{
+    MultithreadedDrawCallPerfParams out = in;
+    out.singleShareGroup                = singleShareGroup;
+    return out;
+}
+
+using MP = MultithreadedDrawCallPerfParams;
+
+std::vector<MP> gMultithreadedTestsWithContextCount =
+    CombineWithValues({MP()}, {size_t(1), size_t(2), size_t(4), size_t(8)}, CombineContextCount);
+std::vector<MP> gMultithreadedTestsWithShareGroup =
+    CombineWithValues(gMultithreadedTestsWithContextCount, {false, true}, CombineSingleShareGroup);
+std::vector<MP> gMultithreadedTestsWithRenderer =
+    CombineWithFuncs(gMultithreadedTestsWithShareGroup, {GL<MP>, Vulkan<MP>});
+std::vector<MP> gMultithreadedTestsWithDevice =
+    CombineWithFuncs(gMultithreadedTestsWithRenderer, {Passthrough<MP>, NullDevice<MP>});
+
+ANGLE_INSTANTIATE_TEST_ARRAY(MultithreadedDrawCallPerfBenchmark, gMultithreadedTestsWithDevice);
 
 }  // anonymous namespace
@@ -0,0 +1,189 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ETCDecodePerf:
+//   Performance test for the software decoding of ETC2 and EAC images to uncompressed formats,
+//   and their transcoding to BC formats, on the calling thread and in the worker thread pool.
+//   Reports the throughput in MB of compressed data per second.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "image_util/loadimage.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+namespace
+{
+// A 2048x2048 image.
+constexpr size_t kWidth       = 2048;
+constexpr size_t kHeight      = 2048;
+constexpr size_t kBlocksWide  = kWidth / 4;
+constexpr size_t kBlocksHigh  = kHeight / 4;
+constexpr size_t kBlockHeight = 4;
+
+enum class ETCDecode
+{
+    RGB8ToRGBA8,
+    RGB8ToBC1,
+    RGBA8ToRGBA8,
+    RGBA8ToBC3,
+    R11ToR8,
+    R11ToBC4,
+    RG11ToRG8,
+    RG11ToBC5,
+};
+
+struct ETCDecodeParams
+{
+    ETCDecode decode;
+    bool parallel;
+};
+
+struct ETCDecodeInfo
+{
+    const char *name;
+    rx::LoadImageFunction loadFunction;
+    size_t inputBlockSize;
+    // Bytes per pixel for uncompressed outputs, and per block for compressed ones.
+    size_t outputElementSize;
+    bool outputIsBlock;
+};
+
+ETCDecodeInfo GetDecodeInfo(ETCDecode decode)
+{
+    switch (decode)
+    {
+        case ETCDecode::RGB8ToRGBA8:
+            return {"RGB8ToRGBA8", angle::LoadETC2RGB8ToRGBA8, 8, 4, false};
+        case ETCDecode::RGB8ToBC1:
+            return {"RGB8ToBC1", angle::LoadETC2RGB8ToBC1, 8, 8, true};
+        case ETCDecode::RGBA8ToRGBA8:
+            return {"RGBA8ToRGBA8", angle::LoadETC2RGBA8ToRGBA8, 16, 4, false};
+        case ETCDecode::RGBA8ToBC3:
+            return {"RGBA8ToBC3", angle::LoadETC2RGBA8ToBC3, 16, 16, true};
+        case ETCDecode::R11ToR8:
+            return {"R11ToR8", angle::LoadEACR11ToR8, 8, 1, false};
+        case ETCDecode::R11ToBC4:
+            return {"R11ToBC4", angle::LoadEACR11ToBC4, 8, 8, true};
+        case ETCDecode::RG11ToRG8:
+            return {"RG11ToRG8", angle::LoadEACRG11ToRG8, 16, 2, false};
+        case ETCDecode::RG11ToBC5:
+            return {"RG11ToBC5", angle::LoadEACRG11ToBC5, 16, 16, true};
+        default:
+            UNREACHABLE();
+            return {};
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const ETCDecodeParams &params)
+{
+    os << GetDecodeInfo(params.decode).name << (params.parallel ? "_parallel" : "_serial");
+    return os;
+}
+
+std::string GetStory(const ETCDecodeParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params;
+    return strstr.str();
+}
+
+class ETCDecodePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<ETCDecodeParams>
+{
+  public:
+    ETCDecodePerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    ETCDecodeInfo mInfo;
+    std::shared_ptr<angle::WorkerThreadPool> mPool;
+    size_t mInputRowPitch  = 0;
+    size_t mOutputRowPitch = 0;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+
+    double mDecodeTime  = 0;
+    size_t mDecodeCount = 0;
+};
+
+ETCDecodePerfTest::ETCDecodePerfTest()
+    : ANGLEPerfTest("ETCDecodePerf", "", GetStory(GetParam()), 1),
+      mInfo(GetDecodeInfo(GetParam().decode)),
+      mPool(angle::WorkerThreadPool::Create(GetParam().parallel))
+{
+    mInputRowPitch  = kBlocksWide * mInfo.inputBlockSize;
+    mOutputRowPitch = mInfo.outputIsBlock ? kBlocksWide * mInfo.outputElementSize
+                                          : kWidth * mInfo.outputElementSize;
+
+    mInput.resize(mInputRowPitch * kBlocksHigh);
+    mOutput.resize(mOutputRowPitch * (mInfo.outputIsBlock ? kBlocksHigh : kHeight));
+
+    // Random blocks use all the ETC2 modes.
+    for (size_t i = 0; i < mInput.size(); ++i)
+    {
+        mInput[i] = static_cast<uint8_t>(rand());
+    }
+}
+
+void ETCDecodePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+    mReporter->RegisterImportantMetric(".decode_throughput", "MB/s");
+}
+
+void ETCDecodePerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    if (mDecodeTime > 0)
+    {
+        const double megabytes = static_cast<double>(mInput.size() * mDecodeCount) / 1e6;
+        mReporter->AddResult(".decode_throughput", megabytes / mDecodeTime);
+    }
+}
+
+void ETCDecodePerfTest::step()
+{
+    double startTime = angle::GetCurrentTime();
+
+    rx::LoadImageInParallel(mPool, mInfo.loadFunction, kBlockHeight,
+                            mInfo.outputIsBlock ? kBlockHeight : 1, kWidth, kHeight, 1,
+                            mInput.data(), mInputRowPitch, 0, mOutput.data(), mOutputRowPitch, 0);
+
+    mDecodeTime += angle::GetCurrentTime() - startTime;
+    mDecodeCount++;
+}
+
+TEST_P(ETCDecodePerfTest, Run)
+{
+    run();
+}
+
+std::vector<ETCDecodeParams> GetETCDecodeParams()
+{
+    std::vector<ETCDecodeParams> params;
+    for (ETCDecode decode :
+         {ETCDecode::RGB8ToRGBA8, ETCDecode::RGB8ToBC1, ETCDecode::RGBA8ToRGBA8,
+          ETCDecode::RGBA8ToBC3, ETCDecode::R11ToR8, ETCDecode::R11ToBC4, ETCDecode::RG11ToRG8,
+          ETCDecode::RG11ToBC5})
+    {
+        params.push_back({decode, false});
+        params.push_back({decode, true});
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(, ETCDecodePerfTest, ::testing::ValuesIn(GetETCDecodeParams()));
+
+}  // anonymous namespace
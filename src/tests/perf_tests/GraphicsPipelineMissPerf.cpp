@@ -0,0 +1,206 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GraphicsPipelineMissPerf:
+//   Performance test for draws that miss the graphics pipeline cache.  Every step links a new
+//   program and draws with it using random blend and color mask state, out of enough combinations
+//   that practically every draw needs a new pipeline.  Reports the average and the worst time of
+//   the draws of a step, which is where pipeline creation stalls show up.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <sstream>
+
+#include "common/system_utils.h"
+#include "common/vector_utils.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kDrawsPerStep = 32;
+
+constexpr std::array<GLenum, 15> kBlendFactors = {
+    {GL_ZERO, GL_ONE, GL_SRC_COLOR, GL_ONE_MINUS_SRC_COLOR, GL_DST_COLOR, GL_ONE_MINUS_DST_COLOR,
+     GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_DST_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_CONSTANT_COLOR,
+     GL_ONE_MINUS_CONSTANT_COLOR, GL_CONSTANT_ALPHA, GL_ONE_MINUS_CONSTANT_ALPHA,
+     GL_SRC_ALPHA_SATURATE}};
+
+constexpr std::array<GLenum, 3> kBlendEquations = {
+    {GL_FUNC_ADD, GL_FUNC_SUBTRACT, GL_FUNC_REVERSE_SUBTRACT}};
+
+struct GraphicsPipelineMissParams final : public RenderTestParams
+{
+    GraphicsPipelineMissParams(const EGLPlatformParameters &eglParametersIn, bool asyncPipelines)
+    {
+        iterationsPerStep = 1;
+
+        majorVersion  = 2;
+        minorVersion  = 0;
+        windowWidth   = 256;
+        windowHeight  = 256;
+        eglParameters = eglParametersIn;
+        if (asyncPipelines)
+        {
+            eglParameters.asyncGraphicsPipelineCreation = EGL_TRUE;
+        }
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story();
+
+        if (eglParameters.asyncGraphicsPipelineCreation == EGL_TRUE)
+        {
+            strstr << "_async_pipelines";
+        }
+
+        return strstr.str();
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const GraphicsPipelineMissParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class GraphicsPipelineMissBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<GraphicsPipelineMissParams>
+{
+  public:
+    GraphicsPipelineMissBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void setRandomState();
+
+    std::mt19937 mRandom;
+    GLuint mVertexBuffer = 0;
+    GLuint mProgram      = 0;
+
+    double mDrawTime      = 0;
+    double mWorstDrawTime = 0;
+    size_t mStepCount     = 0;
+};
+
+GraphicsPipelineMissBenchmark::GraphicsPipelineMissBenchmark()
+    : ANGLERenderTest("GraphicsPipelineMiss", GetParam()), mRandom(1)
+{}
+
+void GraphicsPipelineMissBenchmark::initializeBenchmark()
+{
+    mReporter->RegisterImportantMetric(".draw_time", "ms");
+    mReporter->RegisterImportantMetric(".worst_draw_time", "ms");
+
+    std::array<Vector3, 6> vertices = {{Vector3(-1.0f, 1.0f, 0.5f), Vector3(-1.0f, -1.0f, 0.5f),
+                                        Vector3(1.0f, -1.0f, 0.5f), Vector3(-1.0f, 1.0f, 0.5f),
+                                        Vector3(1.0f, -1.0f, 0.5f), Vector3(1.0f, 1.0f, 0.5f)}};
+
+    glGenBuffers(1, &mVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vector3), vertices.data(),
+                 GL_STATIC_DRAW);
+
+    glEnable(GL_BLEND);
+    glBlendColor(0.25f, 0.5f, 0.75f, 1.0f);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void GraphicsPipelineMissBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mVertexBuffer);
+
+    if (mStepCount > 0)
+    {
+        mReporter->AddResult(".draw_time", mDrawTime * 1e3 / mStepCount);
+        mReporter->AddResult(".worst_draw_time", mWorstDrawTime * 1e3);
+    }
+}
+
+void GraphicsPipelineMissBenchmark::setRandomState()
+{
+    std::uniform_int_distribution<size_t> factor(0, kBlendFactors.size() - 1);
+    std::uniform_int_distribution<size_t> equation(0, kBlendEquations.size() - 1);
+    std::uniform_int_distribution<int> mask(0, 1);
+
+    glBlendFuncSeparate(kBlendFactors[factor(mRandom)], kBlendFactors[factor(mRandom)],
+                        kBlendFactors[factor(mRandom)], kBlendFactors[factor(mRandom)]);
+    glBlendEquationSeparate(kBlendEquations[equation(mRandom)],
+                            kBlendEquations[equation(mRandom)]);
+    glColorMask(mask(mRandom), mask(mRandom), mask(mRandom), GL_TRUE);
+}
+
+void GraphicsPipelineMissBenchmark::drawBenchmark()
+{
+    static const char *vertexShader =
+        "attribute vec3 position;\n"
+        "void main() {\n"
+        "    gl_Position = vec4(position, 1);\n"
+        "}";
+    static const char *fragmentShader =
+        "precision mediump float;\n"
+        "uniform vec4 color;\n"
+        "void main() {\n"
+        "    gl_FragColor = color;\n"
+        "}";
+
+    // A new program starts with an empty pipeline cache.  The link isn't part of the measured
+    // draw time.
+    glDeleteProgram(mProgram);
+    mProgram = CompileProgram(vertexShader, fragmentShader);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    GLint positionLoc = glGetAttribLocation(mProgram, "position");
+    glVertexAttribPointer(positionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLoc);
+    GLint colorLoc = glGetUniformLocation(mProgram, "color");
+
+    double startTime = angle::GetCurrentTime();
+
+    for (unsigned int draw = 0; draw < kDrawsPerStep; ++draw)
+    {
+        setRandomState();
+        glUniform4f(colorLoc, 1.0f / (draw + 1), 0.5f, 0.25f, 1.0f);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+
+    // The flush ends the render pass, which is where pipelines created in the background are
+    // waited for.
+    glFlush();
+
+    double drawTime = angle::GetCurrentTime() - startTime;
+    mDrawTime += drawTime;
+    mWorstDrawTime = std::max(mWorstDrawTime, drawTime);
+    mStepCount++;
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(GraphicsPipelineMissBenchmark, Run)
+{
+    run();
+}
+
+using namespace egl_platform;
+
+ANGLE_INSTANTIATE_TEST(GraphicsPipelineMissBenchmark,
+                       GraphicsPipelineMissParams(VULKAN(), false),
+                       GraphicsPipelineMissParams(VULKAN(), true));
+
+}  // anonymous namespace
@@ -0,0 +1,164 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCachePerf:
+//   Performance test for the index range cache of element array buffers.  Every iteration streams
+//   a small update into a large index buffer with BufferSubData, then draws every part of the
+//   buffer.  The draw that covers the update needs a new index range.
+//
+//   The index range is only needed when the draws are validated against the vertex buffers, so
+//   the test uses a WebGL context.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "test_utils/draw_call_perf_utils.h"
+
+using namespace angle;
+
+namespace
+{
+// 1023 vertices.
+constexpr size_t kTriangleCount = 341;
+constexpr size_t kVertexCount   = kTriangleCount * 3;
+
+// A 1MB index buffer, drawn in 8 parts of 128KB.
+constexpr size_t kIndexCount       = 512 * 1024;
+constexpr size_t kDrawCount        = 8;
+constexpr size_t kIndicesPerDraw   = kIndexCount / kDrawCount;
+constexpr size_t kUpdateIndexCount = 64;
+
+struct IndexRangeCacheParams final : public RenderTestParams
+{
+    IndexRangeCacheParams()
+    {
+        iterationsPerStep = 4;
+
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const IndexRangeCacheParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class IndexRangeCacheBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<IndexRangeCacheParams>
+{
+  public:
+    IndexRangeCacheBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram     = 0;
+    GLuint mBuffer      = 0;
+    GLuint mIndexBuffer = 0;
+    std::vector<GLushort> mIndexData;
+    size_t mUpdateOffset = 0;
+};
+
+IndexRangeCacheBenchmark::IndexRangeCacheBenchmark()
+    : ANGLERenderTest("IndexRangeCache", GetParam())
+{
+    setWebGLCompatibilityEnabled(true);
+}
+
+void IndexRangeCacheBenchmark::initializeBenchmark()
+{
+    mProgram = SetupSimpleDrawProgram();
+    ASSERT_NE(0u, mProgram);
+
+    mBuffer = Create2DTriangleBuffer(kTriangleCount, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    mIndexData.resize(kIndexCount);
+    for (size_t index = 0; index < kIndexCount; ++index)
+    {
+        mIndexData[index] = static_cast<GLushort>(rand() % kVertexCount);
+    }
+
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, kIndexCount * sizeof(GLushort), mIndexData.data(),
+                 GL_DYNAMIC_DRAW);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void IndexRangeCacheBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteBuffers(1, &mIndexBuffer);
+}
+
+void IndexRangeCacheBenchmark::drawBenchmark()
+{
+    for (unsigned int iteration = 0; iteration < GetParam().iterationsPerStep; ++iteration)
+    {
+        // Stream the update through the buffer, so it lands in a different draw every time.
+        mUpdateOffset = (mUpdateOffset + kIndicesPerDraw + kUpdateIndexCount) %
+                        (kIndexCount - kUpdateIndexCount);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, mUpdateOffset * sizeof(GLushort),
+                        kUpdateIndexCount * sizeof(GLushort), &mIndexData[mUpdateOffset]);
+
+        for (size_t draw = 0; draw < kDrawCount; ++draw)
+        {
+            const void *offset =
+                reinterpret_cast<const void *>(draw * kIndicesPerDraw * sizeof(GLushort));
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(kIndicesPerDraw / 3 * 3),
+                           GL_UNSIGNED_SHORT, offset);
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+IndexRangeCacheParams IndexRangeCacheVulkanParams(bool nullDevice)
+{
+    IndexRangeCacheParams params;
+    params.eglParameters = nullDevice ? egl_platform::VULKAN_NULL() : egl_platform::VULKAN();
+    return params;
+}
+
+IndexRangeCacheParams IndexRangeCacheOpenGLOrGLESParams(bool nullDevice)
+{
+    IndexRangeCacheParams params;
+    params.eglParameters =
+        nullDevice ? egl_platform::OPENGL_OR_GLES_NULL() : egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+
+IndexRangeCacheParams IndexRangeCacheD3D11Params()
+{
+    IndexRangeCacheParams params;
+    params.eglParameters = egl_platform::D3D11();
+    return params;
+}
+
+TEST_P(IndexRangeCacheBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(IndexRangeCacheBenchmark,
+                       IndexRangeCacheD3D11Params(),
+                       IndexRangeCacheOpenGLOrGLESParams(false),
+                       IndexRangeCacheOpenGLOrGLESParams(true),
+                       IndexRangeCacheVulkanParams(false),
+                       IndexRangeCacheVulkanParams(true));
+
+}  // anonymous namespace
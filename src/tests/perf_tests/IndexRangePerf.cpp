@@ -0,0 +1,163 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for computing the range of an index buffer with the scalar and the vector
+//   implementations of ComputeIndexRange.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "common/utilities.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 16;
+
+struct IndexRangeParams
+{
+    gl::IndexRangeKernel kernel;
+    gl::DrawElementsType indexType;
+    size_t indexCount;
+    bool primitiveRestartEnabled;
+};
+
+const char *GetKernelName(gl::IndexRangeKernel kernel)
+{
+    switch (kernel)
+    {
+        case gl::IndexRangeKernel::Scalar:
+            return "scalar";
+        case gl::IndexRangeKernel::SSE2:
+            return "sse2";
+        case gl::IndexRangeKernel::AVX2:
+            return "avx2";
+        case gl::IndexRangeKernel::NEON:
+            return "neon";
+        default:
+            return "unknown";
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const IndexRangeParams &params)
+{
+    os << GetKernelName(params.kernel) << "_"
+       << (params.indexType == gl::DrawElementsType::UnsignedShort ? "ushort" : "uint") << "_"
+       << params.indexCount;
+    if (params.primitiveRestartEnabled)
+    {
+        os << "_restart";
+    }
+    return os;
+}
+
+std::string GetStory(const IndexRangeParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params;
+    return strstr.str();
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangeParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void step() override;
+
+  private:
+    template <typename T>
+    void fillIndices();
+
+    std::vector<uint8_t> mIndexData;
+    size_t mResult = 0;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", "", GetStory(GetParam()), kIterationsPerStep)
+{
+    if (!gl::IsIndexRangeKernelSupported(GetParam().kernel))
+    {
+        mSkipTest = true;
+        return;
+    }
+
+    if (GetParam().indexType == gl::DrawElementsType::UnsignedShort)
+    {
+        fillIndices<GLushort>();
+    }
+    else
+    {
+        fillIndices<GLuint>();
+    }
+}
+
+template <typename T>
+void IndexRangePerfTest::fillIndices()
+{
+    const IndexRangeParams &params = GetParam();
+    mIndexData.resize(params.indexCount * sizeof(T));
+    T *indices = reinterpret_cast<T *>(mIndexData.data());
+
+    // A triangle strip over a grid, with a restart at the end of every row.
+    constexpr size_t kRowLength = 64;
+    for (size_t i = 0; i < params.indexCount; ++i)
+    {
+        if (params.primitiveRestartEnabled && i % kRowLength == kRowLength - 1)
+        {
+            indices[i] = gl::GetPrimitiveRestartIndexFromType<T>();
+        }
+        else
+        {
+            indices[i] = static_cast<T>((i / 2) + (i % 2) * kRowLength);
+        }
+    }
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangeParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        gl::IndexRange range =
+            gl::ComputeIndexRangeWithKernel(params.kernel, params.indexType, mIndexData.data(),
+                                            params.indexCount, params.primitiveRestartEnabled);
+        mResult += range.end;
+    }
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+std::vector<IndexRangeParams> GetIndexRangeParams()
+{
+    std::vector<IndexRangeParams> params;
+    for (gl::IndexRangeKernel kernel : angle::AllEnums<gl::IndexRangeKernel>())
+    {
+        for (gl::DrawElementsType indexType :
+             {gl::DrawElementsType::UnsignedShort, gl::DrawElementsType::UnsignedInt})
+        {
+            for (size_t indexCount : {256, 4096, 65536})
+            {
+                for (bool primitiveRestartEnabled : {false, true})
+                {
+                    params.push_back({kernel, indexType, indexCount, primitiveRestartEnabled});
+                }
+            }
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(, IndexRangePerfTest, ::testing::ValuesIn(GetIndexRangeParams()));
+
+}  // anonymous namespace
@@ -4,12 +4,16 @@
 // found in the LICENSE file.
 //
 // LinkProgramPerfTest:
-//   Performance tests compiling a lot of shaders.
+//   Performance tests compiling a lot of shaders.  The variants with several programs in flight
+//   link all of them before using any, which lets the implementation link them in parallel.  The
+//   variants that draw variants also draw with every state that needs a different variant of the
+//   program's shaders, which is where the shaders are transformed over and over.
 //
 
 #include "ANGLEPerfTest.h"
 
 #include <array>
+#include <sstream>
 
 #include "common/vector_utils.h"
 #include "util/shader_utils.h"
@@ -23,6 +27,7 @@ enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    CompileLinkAndDrawVariants,
 
     Unspecified
 };
@@ -37,7 +42,9 @@ enum class ThreadOption
 
 struct LinkProgramParams final : public RenderTestParams
 {
-    LinkProgramParams(TaskOption taskOptionIn, ThreadOption threadOptionIn)
+    LinkProgramParams(TaskOption taskOptionIn,
+                      ThreadOption threadOptionIn,
+                      uint32_t programsInFlightIn = 1)
     {
         iterationsPerStep = 1;
 
@@ -45,8 +52,9 @@ struct LinkProgramParams final : public RenderTestParams
         minorVersion = 0;
         windowWidth  = 256;
         windowHeight = 256;
-        taskOption   = taskOptionIn;
-        threadOption = threadOptionIn;
+        taskOption       = taskOptionIn;
+        threadOption     = threadOptionIn;
+        programsInFlight = programsInFlightIn;
     }
 
     std::string story() const override
@@ -62,6 +70,10 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::CompileLinkAndDrawVariants)
+        {
+            strstr << "_compile_link_and_draw_variants";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -72,6 +84,16 @@ struct LinkProgramParams final : public RenderTestParams
             strstr << "_multi_thread";
         }
 
+        if (programsInFlight > 1)
+        {
+            strstr << "_" << programsInFlight << "_programs";
+        }
+
+        if (eglParameters.asyncLinkProgram == EGL_TRUE)
+        {
+            strstr << "_async_link";
+        }
+
         if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
         {
             strstr << "_null";
@@ -82,6 +104,8 @@ struct LinkProgramParams final : public RenderTestParams
 
     TaskOption taskOption;
     ThreadOption threadOption;
+    // Number of programs that are linked before any of them is used.
+    uint32_t programsInFlight;
 };
 
 std::ostream &operator<<(std::ostream &os, const LinkProgramParams &params)
@@ -101,6 +125,9 @@ class LinkProgramBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   protected:
+    void drawMultiplePrograms();
+    void drawVariants();
+
     GLuint mVertexBuffer = 0;
 };
 
@@ -130,6 +157,12 @@ void LinkProgramBenchmark::destroyBenchmark()
 
 void LinkProgramBenchmark::drawBenchmark()
 {
+    if (GetParam().programsInFlight > 1)
+    {
+        drawMultiplePrograms();
+        return;
+    }
+
     static const char *vertexShader =
         "attribute vec2 position;\n"
         "void main() {\n"
@@ -169,9 +202,105 @@ void LinkProgramBenchmark::drawBenchmark()
     // Draw with the program to ensure the shader gets compiled and used.
     glDrawArrays(GL_TRIANGLES, 0, 6);
 
+    if (GetParam().taskOption == TaskOption::CompileLinkAndDrawVariants)
+    {
+        drawVariants();
+    }
+
     glDeleteProgram(program);
 }
 
+void LinkProgramBenchmark::drawVariants()
+{
+    // Lines may be drawn with Bresenham line emulation, and the clip control depth mode decides
+    // whether the depth of gl_Position is transformed to Vulkan's clip space.
+    const bool hasClipControl = IsGLExtensionEnabled("GL_EXT_clip_control");
+
+    for (GLenum depthMode : {GL_ZERO_TO_ONE_EXT, GL_NEGATIVE_ONE_TO_ONE_EXT})
+    {
+        if (hasClipControl)
+        {
+            glClipControlEXT(GL_LOWER_LEFT_EXT, depthMode);
+        }
+
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glDrawArrays(GL_LINES, 0, 6);
+    }
+}
+
+void LinkProgramBenchmark::drawMultiplePrograms()
+{
+    const LinkProgramParams &params = GetParam();
+
+    static const char *vertexShader =
+        "attribute vec2 position;\n"
+        "varying vec2 texCoord;\n"
+        "void main() {\n"
+        "    texCoord = position * 0.5 + 0.5;\n"
+        "    gl_Position = vec4(position, 0, 1);\n"
+        "}";
+
+    std::vector<GLuint> programs(params.programsInFlight);
+    for (uint32_t index = 0; index < params.programsInFlight; ++index)
+    {
+        // Make every fragment shader unique so the programs can't be deduplicated.
+        std::stringstream fragmentShader;
+        fragmentShader << "precision mediump float;\n"
+                          "varying vec2 texCoord;\n"
+                          "void main() {\n"
+                          "    gl_FragColor = vec4(texCoord, "
+                       << index << ".0 / " << params.programsInFlight << ".0, 1);\n"
+                       << "}";
+
+        GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+        GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader.str().c_str());
+        ASSERT_NE(0u, vs);
+        ASSERT_NE(0u, fs);
+
+        if (params.taskOption == TaskOption::CompileOnly)
+        {
+            glDeleteShader(vs);
+            glDeleteShader(fs);
+            continue;
+        }
+
+        programs[index] = glCreateProgram();
+        ASSERT_NE(0u, programs[index]);
+
+        glAttachShader(programs[index], vs);
+        glDeleteShader(vs);
+        glAttachShader(programs[index], fs);
+        glDeleteShader(fs);
+        glLinkProgram(programs[index]);
+    }
+
+    if (params.taskOption == TaskOption::CompileOnly)
+    {
+        return;
+    }
+
+    // Only now wait for the links, in the order they were started.
+    for (GLuint program : programs)
+    {
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        ASSERT_EQ(GL_TRUE, linkStatus);
+
+        glUseProgram(program);
+
+        GLint positionLoc = glGetAttribLocation(program, "position");
+        glVertexAttribPointer(positionLoc, 2, GL_FLOAT, GL_FALSE, 8, nullptr);
+        glEnableVertexAttribArray(positionLoc);
+
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+
+    for (GLuint program : programs)
+    {
+        glDeleteProgram(program);
+    }
+}
+
 using namespace egl_platform;
 
 LinkProgramParams LinkProgramD3D11Params(TaskOption taskOption, ThreadOption threadOption)
@@ -195,6 +324,20 @@ LinkProgramParams LinkProgramVulkanParams(TaskOption taskOption, ThreadOption th
     return params;
 }
 
+LinkProgramParams LinkProgramInFlightParams(const EGLPlatformParameters &eglParameters,
+                                            uint32_t programsInFlight,
+                                            bool asyncLink)
+{
+    LinkProgramParams params(TaskOption::CompileAndLink, ThreadOption::MultiThread,
+                             programsInFlight);
+    params.eglParameters = eglParameters;
+    if (asyncLink)
+    {
+        params.eglParameters.asyncLinkProgram = EGL_TRUE;
+    }
+    return params;
+}
+
 TEST_P(LinkProgramBenchmark, Run)
 {
     run();
@@ -213,6 +356,11 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramVulkanParams(TaskOption::CompileOnly, ThreadOption::SingleThread),
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::CompileLinkAndDrawVariants, ThreadOption::SingleThread),
+    LinkProgramInFlightParams(OPENGL_OR_GLES(), 64, false),
+    LinkProgramInFlightParams(OPENGL_OR_GLES(), 64, true),
+    LinkProgramInFlightParams(VULKAN(), 64, false),
+    LinkProgramInFlightParams(VULKAN(), 64, true));
 
 }  // anonymous namespace
@@ -0,0 +1,169 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf:
+//   Performance test for the row conversions of the image loading functions, with every kernel
+//   that implements them.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "common/PackedEnums.h"
+#include "image_util/loadimage.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+
+// A 512x512 image.
+constexpr size_t kWidth  = 512;
+constexpr size_t kHeight = 512;
+
+struct LoadImageParams
+{
+    angle::LoadImageKernel kernel;
+    angle::LoadImageConversion conversion;
+};
+
+const char *GetKernelName(angle::LoadImageKernel kernel)
+{
+    switch (kernel)
+    {
+        case angle::LoadImageKernel::Scalar:
+            return "scalar";
+        case angle::LoadImageKernel::SSE2:
+            return "sse2";
+        case angle::LoadImageKernel::SSSE3:
+            return "ssse3";
+        case angle::LoadImageKernel::AVX2:
+            return "avx2";
+        case angle::LoadImageKernel::NEON:
+            return "neon";
+        default:
+            return "unknown";
+    }
+}
+
+const char *GetConversionName(angle::LoadImageConversion conversion)
+{
+    switch (conversion)
+    {
+        case angle::LoadImageConversion::A8ToRGBA8:
+            return "A8ToRGBA8";
+        case angle::LoadImageConversion::L8ToRGBA8:
+            return "L8ToRGBA8";
+        case angle::LoadImageConversion::LA8ToRGBA8:
+            return "LA8ToRGBA8";
+        case angle::LoadImageConversion::RGB8ToRGBA8:
+            return "RGB8ToRGBA8";
+        case angle::LoadImageConversion::RGB8ToBGRX8:
+            return "RGB8ToBGRX8";
+        case angle::LoadImageConversion::RGBA8ToBGRA8:
+            return "RGBA8ToBGRA8";
+        case angle::LoadImageConversion::RGB10A2ToRGBA8:
+            return "RGB10A2ToRGBA8";
+        case angle::LoadImageConversion::R32FToR16F:
+            return "RGBA32FToRGBA16F";
+        default:
+            return "unknown";
+    }
+}
+
+// The float conversion loads 4 components per pixel, so that every test converts the same number
+// of pixels.
+size_t GetElementsPerPixel(angle::LoadImageConversion conversion)
+{
+    return conversion == angle::LoadImageConversion::R32FToR16F ? 4 : 1;
+}
+
+std::ostream &operator<<(std::ostream &os, const LoadImageParams &params)
+{
+    os << GetConversionName(params.conversion) << "_" << GetKernelName(params.kernel);
+    return os;
+}
+
+std::string GetStory(const LoadImageParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params;
+    return strstr.str();
+}
+
+class LoadImagePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<LoadImageParams>
+{
+  public:
+    LoadImagePerfTest();
+
+    void step() override;
+
+  private:
+    angle::LoadImageRowFunction mLoadRow = nullptr;
+    size_t mRowCount                     = 0;
+    size_t mInputRowPitch                = 0;
+    size_t mOutputRowPitch               = 0;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadImagePerfTest::LoadImagePerfTest()
+    : ANGLEPerfTest("LoadImagePerf", "", GetStory(GetParam()), kIterationsPerStep)
+{
+    const LoadImageParams &params = GetParam();
+
+    mLoadRow = angle::GetLoadImageRowFunction(params.kernel, params.conversion);
+    if (mLoadRow == nullptr)
+    {
+        mSkipTest = true;
+        return;
+    }
+
+    // Every format is at most 4 bytes per element in and out.
+    mRowCount       = kWidth * GetElementsPerPixel(params.conversion);
+    mInputRowPitch  = mRowCount * 4;
+    mOutputRowPitch = mRowCount * 4;
+
+    mInput.resize(mInputRowPitch * kHeight);
+    mOutput.resize(mOutputRowPitch * kHeight);
+
+    for (size_t i = 0; i < mInput.size(); ++i)
+    {
+        mInput[i] = static_cast<uint8_t>(rand());
+    }
+}
+
+void LoadImagePerfTest::step()
+{
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        angle::priv::LoadRows(mLoadRow, mRowCount, kHeight, 1, mInput.data(), mInputRowPitch, 0,
+                              mOutput.data(), mOutputRowPitch, 0);
+    }
+}
+
+TEST_P(LoadImagePerfTest, Run)
+{
+    run();
+}
+
+std::vector<LoadImageParams> GetLoadImageParams()
+{
+    std::vector<LoadImageParams> params;
+    for (angle::LoadImageConversion conversion : angle::AllEnums<angle::LoadImageConversion>())
+    {
+        for (angle::LoadImageKernel kernel : angle::AllEnums<angle::LoadImageKernel>())
+        {
+            params.push_back({kernel, conversion});
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(, LoadImagePerfTest, ::testing::ValuesIn(GetLoadImageParams()));
+
+}  // anonymous namespace
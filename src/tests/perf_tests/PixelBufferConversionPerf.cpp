@@ -0,0 +1,265 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PixelBufferConversionPerf:
+//   Performance test for pixel buffer transfers that need a format conversion.  The unpack cases
+//   upload from a pixel unpack buffer into a texture of a different format, and the pack case
+//   reads back an RGBA8 framebuffer into a pixel pack buffer as BGRA.  With the
+//   convertPixelsWithCompute feature enabled, the conversion is done on the GPU instead of after
+//   mapping the buffers on the CPU.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+
+enum class PixelConversion
+{
+    RGB8ToRGB565,
+    FloatToHalf,
+    RGBAToBGRA,
+};
+
+struct PixelBufferConversionParams final : public RenderTestParams
+{
+    PixelBufferConversionParams(const EGLPlatformParameters &eglParametersIn,
+                                PixelConversion conversionIn,
+                                bool computeIn)
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion  = 3;
+        minorVersion  = 0;
+        windowWidth   = 512;
+        windowHeight  = 512;
+        eglParameters = eglParametersIn;
+        conversion    = conversionIn;
+        compute       = computeIn;
+
+        if (compute)
+        {
+            eglParameters.convertPixelsWithCompute = EGL_TRUE;
+        }
+    }
+
+    std::string story() const override;
+
+    PixelConversion conversion;
+    bool compute;
+};
+
+std::string PixelBufferConversionParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    switch (conversion)
+    {
+        case PixelConversion::RGB8ToRGB565:
+            strstr << "_rgb8_to_rgb565";
+            break;
+        case PixelConversion::FloatToHalf:
+            strstr << "_float_to_half";
+            break;
+        case PixelConversion::RGBAToBGRA:
+            strstr << "_rgba_to_bgra";
+            break;
+    }
+
+    strstr << (compute ? "_compute" : "_cpu");
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const PixelBufferConversionParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class PixelBufferConversionBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<PixelBufferConversionParams>
+{
+  public:
+    PixelBufferConversionBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mTexture     = 0;
+    GLuint mFramebuffer = 0;
+    GLuint mBuffer      = 0;
+    size_t mBufferSize  = 0;
+
+    GLenum mInternalFormat = GL_NONE;
+    GLenum mFormat         = GL_NONE;
+    GLenum mType           = GL_NONE;
+
+    // Keeps the readback results alive.
+    GLubyte mChecksum = 0;
+};
+
+PixelBufferConversionBenchmark::PixelBufferConversionBenchmark()
+    : ANGLERenderTest("PixelBufferConversion", GetParam())
+{
+    if (GetParam().conversion == PixelConversion::RGBAToBGRA)
+    {
+        addExtensionPrerequisite("GL_EXT_read_format_bgra");
+    }
+}
+
+void PixelBufferConversionBenchmark::initializeBenchmark()
+{
+    const PixelBufferConversionParams &params = GetParam();
+    const GLsizei width                       = params.windowWidth;
+    const GLsizei height                      = params.windowHeight;
+
+    size_t pixelBytes = 0;
+    switch (params.conversion)
+    {
+        case PixelConversion::RGB8ToRGB565:
+            mInternalFormat = GL_RGB565;
+            mFormat         = GL_RGB;
+            mType           = GL_UNSIGNED_BYTE;
+            pixelBytes      = 3;
+            break;
+        case PixelConversion::FloatToHalf:
+            mInternalFormat = GL_RGBA16F;
+            mFormat         = GL_RGBA;
+            mType           = GL_FLOAT;
+            pixelBytes      = 16;
+            break;
+        case PixelConversion::RGBAToBGRA:
+            mInternalFormat = GL_RGBA8;
+            mFormat         = GL_BGRA_EXT;
+            mType           = GL_UNSIGNED_BYTE;
+            pixelBytes      = 4;
+            break;
+    }
+
+    mBufferSize = width * height * pixelBytes;
+
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, mInternalFormat, width, height);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenBuffers(1, &mBuffer);
+
+    if (params.conversion == PixelConversion::RGBAToBGRA)
+    {
+        glGenFramebuffers(1, &mFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, mBufferSize, nullptr, GL_STREAM_READ);
+    }
+    else
+    {
+        std::vector<GLubyte> data(mBufferSize);
+        if (mType == GL_FLOAT)
+        {
+            std::vector<GLfloat> floatData(mBufferSize / sizeof(GLfloat));
+            for (size_t index = 0; index < floatData.size(); ++index)
+            {
+                floatData[index] = static_cast<float>(index % 256) / 255.0f;
+            }
+            memcpy(data.data(), floatData.data(), mBufferSize);
+        }
+        else
+        {
+            for (size_t index = 0; index < data.size(); ++index)
+            {
+                data[index] = static_cast<GLubyte>(index);
+            }
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBuffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, mBufferSize, data.data(), GL_STATIC_DRAW);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void PixelBufferConversionBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteFramebuffers(1, &mFramebuffer);
+    glDeleteTextures(1, &mTexture);
+}
+
+void PixelBufferConversionBenchmark::drawBenchmark()
+{
+    const PixelBufferConversionParams &params = GetParam();
+    const GLsizei width                       = params.windowWidth;
+    const GLsizei height                      = params.windowHeight;
+
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        if (params.conversion != PixelConversion::RGBAToBGRA)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, mFormat, mType, nullptr);
+            continue;
+        }
+
+        glClearColor(0.01f * static_cast<float>(iteration), 0.5f, 0.25f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glReadPixels(0, 0, width, height, mFormat, mType, nullptr);
+    }
+
+    // Wait for the results once per step, so the conversion is part of the measured time.
+    if (params.conversion == PixelConversion::RGBAToBGRA)
+    {
+        const GLubyte *pixels = static_cast<const GLubyte *>(
+            glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, mBufferSize, GL_MAP_READ_BIT));
+        ASSERT_NE(nullptr, pixels);
+        mChecksum += pixels[0];
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    else
+    {
+        glFinish();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(PixelBufferConversionBenchmark, Run)
+{
+    run();
+}
+
+using namespace egl_platform;
+
+ANGLE_INSTANTIATE_TEST(
+    PixelBufferConversionBenchmark,
+    PixelBufferConversionParams(VULKAN(), PixelConversion::RGB8ToRGB565, false),
+    PixelBufferConversionParams(VULKAN(), PixelConversion::RGB8ToRGB565, true),
+    PixelBufferConversionParams(VULKAN(), PixelConversion::FloatToHalf, false),
+    PixelBufferConversionParams(VULKAN(), PixelConversion::FloatToHalf, true),
+    PixelBufferConversionParams(VULKAN(), PixelConversion::RGBAToBGRA, false),
+    PixelBufferConversionParams(VULKAN(), PixelConversion::RGBAToBGRA, true),
+    PixelBufferConversionParams(VULKAN_NULL(), PixelConversion::RGB8ToRGB565, false),
+    PixelBufferConversionParams(VULKAN_NULL(), PixelConversion::RGB8ToRGB565, true),
+    PixelBufferConversionParams(VULKAN_NULL(), PixelConversion::FloatToHalf, false),
+    PixelBufferConversionParams(VULKAN_NULL(), PixelConversion::FloatToHalf, true),
+    PixelBufferConversionParams(VULKAN_NULL(), PixelConversion::RGBAToBGRA, false),
+    PixelBufferConversionParams(VULKAN_NULL(), PixelConversion::RGBAToBGRA, true));
+
+}  // anonymous namespace
@@ -0,0 +1,211 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReadPixelsPerf:
+//   Performance test for an offscreen renderer that reads back every frame it draws.  Without
+//   pipelining, every frame is read back into client memory, so the CPU waits for the GPU at each
+//   frame.  With pipelining, every frame is read back into one of a ring of pixel pack buffers,
+//   which is mapped two frames later, with the deferReadPixelsPacking feature enabled.  The time
+//   per iteration is the time per frame.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <array>
+#include <sstream>
+
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kFramesPerStep  = 4;
+constexpr unsigned int kDrawsPerFrame  = 16;
+constexpr size_t kPixelPackBufferCount = 3;
+
+struct ReadPixelsParams final : public RenderTestParams
+{
+    ReadPixelsParams(const EGLPlatformParameters &eglParametersIn, bool pipelinedIn)
+    {
+        iterationsPerStep = kFramesPerStep;
+
+        majorVersion  = 3;
+        minorVersion  = 0;
+        windowWidth   = 512;
+        windowHeight  = 512;
+        eglParameters = eglParametersIn;
+        pipelined     = pipelinedIn;
+
+        if (pipelined)
+        {
+            eglParameters.deferReadPixelsPacking = EGL_TRUE;
+        }
+    }
+
+    std::string story() const override;
+
+    bool pipelined;
+};
+
+std::string ReadPixelsParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    if (pipelined)
+    {
+        strstr << "_pipelined";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const ReadPixelsParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class ReadPixelsBenchmark : public ANGLERenderTest,
+                            public ::testing::WithParamInterface<ReadPixelsParams>
+{
+  public:
+    ReadPixelsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void drawFrame();
+
+    GLuint mProgram      = 0;
+    GLint mColorLocation = -1;
+    std::array<GLuint, kPixelPackBufferCount> mPixelPackBuffers = {};
+    std::vector<GLubyte> mPixels;
+    size_t mFrameIndex = 0;
+
+    // Keeps the readback results alive.
+    GLubyte mChecksum = 0;
+};
+
+ReadPixelsBenchmark::ReadPixelsBenchmark() : ANGLERenderTest("ReadPixels", GetParam()) {}
+
+void ReadPixelsBenchmark::initializeBenchmark()
+{
+    const ReadPixelsParams &params = GetParam();
+
+    constexpr char kVS[] = R"(#version 300 es
+void main()
+{
+    vec2 position = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 4.0 - 1.0;
+    gl_Position   = vec4(position, 0, 1);
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 color;
+out vec4 fragColor;
+void main()
+{
+    fragColor = color;
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    mColorLocation = glGetUniformLocation(mProgram, "color");
+    ASSERT_NE(-1, mColorLocation);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+
+    const size_t frameSize = params.windowWidth * params.windowHeight * 4;
+    mPixels.resize(frameSize);
+
+    if (params.pipelined)
+    {
+        glGenBuffers(static_cast<GLsizei>(kPixelPackBufferCount), mPixelPackBuffers.data());
+        for (GLuint buffer : mPixelPackBuffers)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+            glBufferData(GL_PIXEL_PACK_BUFFER, frameSize, nullptr, GL_STREAM_READ);
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ReadPixelsBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(static_cast<GLsizei>(kPixelPackBufferCount), mPixelPackBuffers.data());
+    glDeleteProgram(mProgram);
+}
+
+void ReadPixelsBenchmark::drawFrame()
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (unsigned int draw = 0; draw < kDrawsPerFrame; ++draw)
+    {
+        glUniform4f(mColorLocation, 0.01f * static_cast<float>(mFrameIndex % 8), 0.01f,
+                    0.01f * static_cast<float>(draw), 0.0f);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+}
+
+void ReadPixelsBenchmark::drawBenchmark()
+{
+    const ReadPixelsParams &params = GetParam();
+
+    for (unsigned int frame = 0; frame < kFramesPerStep; ++frame, ++mFrameIndex)
+    {
+        drawFrame();
+
+        if (!params.pipelined)
+        {
+            glReadPixels(0, 0, params.windowWidth, params.windowHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+                         mPixels.data());
+            mChecksum += mPixels[0];
+            continue;
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mPixelPackBuffers[mFrameIndex % kPixelPackBufferCount]);
+        glReadPixels(0, 0, params.windowWidth, params.windowHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+                     nullptr);
+
+        // Process the frame that was read back two frames ago, which the GPU is done with.
+        if (mFrameIndex + 1 >= kPixelPackBufferCount)
+        {
+            const size_t readFrame = mFrameIndex + 1 - kPixelPackBufferCount;
+            glBindBuffer(GL_PIXEL_PACK_BUFFER,
+                         mPixelPackBuffers[readFrame % kPixelPackBufferCount]);
+            const GLubyte *pixels = static_cast<const GLubyte *>(
+                glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, mPixels.size(), GL_MAP_READ_BIT));
+            ASSERT_NE(nullptr, pixels);
+            mChecksum += pixels[0];
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(ReadPixelsBenchmark, Run)
+{
+    run();
+}
+
+using namespace egl_platform;
+
+ANGLE_INSTANTIATE_TEST(ReadPixelsBenchmark,
+                       ReadPixelsParams(VULKAN(), false),
+                       ReadPixelsParams(VULKAN(), true),
+                       ReadPixelsParams(VULKAN_NULL(), false),
+                       ReadPixelsParams(VULKAN_NULL(), true));
+
+}  // anonymous namespace
@@ -0,0 +1,250 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMapPerf:
+//   Performance test for the resource maps shared between threads.  Every step, each thread does
+//   a mix of lookups, and of erases and assigns of its own handles, either in a ResourceMap behind
+//   a mutex or in a ConcurrentResourceMap.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "libANGLE/ResourceMap.h"
+
+namespace
+{
+constexpr size_t kOperationsPerStep = 16384;
+
+// One operation in kWriteInterval replaces a resource, the others are lookups.
+constexpr size_t kWriteInterval = 16;
+
+// Every thread owns this many handles, which are interleaved with the other threads' handles.
+constexpr GLuint kHandlesPerThread = 256;
+
+struct ResourceMapParams
+{
+    size_t threadCount;
+    bool concurrent;
+};
+
+std::ostream &operator<<(std::ostream &os, const ResourceMapParams &params)
+{
+    os << params.threadCount << "_threads" << (params.concurrent ? "_concurrent" : "_locked");
+    return os;
+}
+
+std::string GetStory(const ResourceMapParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params;
+    return strstr.str();
+}
+
+class ResourceMapPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<ResourceMapParams>
+{
+  public:
+    ResourceMapPerfTest();
+    ~ResourceMapPerfTest() override;
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    void threadLoop(size_t threadIndex);
+    void runOperations(size_t threadIndex, std::mt19937 *random);
+
+    size_t *query(GLuint handle);
+    void replace(GLuint handle, size_t *resource);
+
+    GLuint getHandleCount() const;
+
+    gl::ResourceMap<size_t, GLuint> mLockedMap;
+    std::mutex mLockedMapMutex;
+    gl::ConcurrentResourceMap<size_t, GLuint> mConcurrentMap;
+
+    std::vector<size_t> mResources;
+    std::vector<std::thread> mThreads;
+
+    // Threads are kicked off by bumping mGeneration and report back through mRunningThreads.
+    std::mutex mMutex;
+    std::condition_variable mStartCondition;
+    std::condition_variable mDoneCondition;
+    uint64_t mGeneration   = 0;
+    size_t mRunningThreads = 0;
+    bool mExiting          = false;
+
+    // Prevents the lookups from being optimized out.
+    std::atomic<size_t> mFoundCount;
+};
+
+ResourceMapPerfTest::ResourceMapPerfTest()
+    : ANGLEPerfTest("ResourceMapPerf", "", GetStory(GetParam()), 1),
+      mResources(getHandleCount()),
+      mFoundCount(0)
+{}
+
+ResourceMapPerfTest::~ResourceMapPerfTest()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExiting = true;
+    }
+    mStartCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+
+    for (GLuint handle = 1; handle <= getHandleCount(); ++handle)
+    {
+        size_t *resource = nullptr;
+        mLockedMap.erase(handle, &resource);
+        mConcurrentMap.erase(handle, &resource);
+    }
+}
+
+void ResourceMapPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    mConcurrentMap.enableConcurrentAccess();
+
+    // Handle 0 is never used, as in the resource managers.
+    for (GLuint handle = 1; handle <= getHandleCount(); ++handle)
+    {
+        mLockedMap.assign(handle, &mResources[handle - 1]);
+        mConcurrentMap.assign(handle, &mResources[handle - 1]);
+    }
+
+    for (size_t threadIndex = 0; threadIndex < GetParam().threadCount; ++threadIndex)
+    {
+        mThreads.emplace_back(&ResourceMapPerfTest::threadLoop, this, threadIndex);
+    }
+}
+
+void ResourceMapPerfTest::step()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mRunningThreads = mThreads.size();
+    mGeneration++;
+    mStartCondition.notify_all();
+
+    mDoneCondition.wait(lock, [this] { return mRunningThreads == 0; });
+}
+
+GLuint ResourceMapPerfTest::getHandleCount() const
+{
+    return static_cast<GLuint>(GetParam().threadCount) * kHandlesPerThread;
+}
+
+size_t *ResourceMapPerfTest::query(GLuint handle)
+{
+    if (GetParam().concurrent)
+    {
+        return mConcurrentMap.query(handle);
+    }
+
+    std::lock_guard<std::mutex> lock(mLockedMapMutex);
+    return mLockedMap.query(handle);
+}
+
+void ResourceMapPerfTest::replace(GLuint handle, size_t *resource)
+{
+    size_t *oldResource = nullptr;
+    if (GetParam().concurrent)
+    {
+        mConcurrentMap.erase(handle, &oldResource);
+        mConcurrentMap.assign(handle, resource);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mLockedMapMutex);
+    mLockedMap.erase(handle, &oldResource);
+    mLockedMap.assign(handle, resource);
+}
+
+void ResourceMapPerfTest::threadLoop(size_t threadIndex)
+{
+    std::mt19937 random(static_cast<uint32_t>(threadIndex));
+
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStartCondition.wait(
+                lock, [this, generation] { return mExiting || mGeneration != generation; });
+            if (mExiting)
+            {
+                return;
+            }
+            generation = mGeneration;
+        }
+
+        runOperations(threadIndex, &random);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (--mRunningThreads == 0)
+        {
+            mDoneCondition.notify_one();
+        }
+    }
+}
+
+void ResourceMapPerfTest::runOperations(size_t threadIndex, std::mt19937 *random)
+{
+    const GLuint handleCount = getHandleCount();
+    const GLuint threadCount = static_cast<GLuint>(GetParam().threadCount);
+
+    size_t foundCount = 0;
+    for (size_t operation = 0; operation < kOperationsPerStep; ++operation)
+    {
+        if (operation % kWriteInterval == 0)
+        {
+            // Erase and reassign one of the handles of this thread.  Only this thread writes
+            // them, so the other threads' handles stay in the map.
+            GLuint ownIndex = (*random)() % kHandlesPerThread;
+            GLuint handle   = ownIndex * threadCount + static_cast<GLuint>(threadIndex) + 1;
+            replace(handle, &mResources[handle - 1]);
+        }
+        else
+        {
+            GLuint handle = (*random)() % handleCount + 1;
+            foundCount += query(handle) != nullptr;
+        }
+    }
+
+    mFoundCount += foundCount;
+}
+
+TEST_P(ResourceMapPerfTest, Run)
+{
+    run();
+}
+
+std::vector<ResourceMapParams> GetResourceMapParams()
+{
+    std::vector<ResourceMapParams> params;
+    for (size_t threadCount : {1, 2, 4, 8})
+    {
+        params.push_back({threadCount, false});
+        params.push_back({threadCount, true});
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(, ResourceMapPerfTest, ::testing::ValuesIn(GetResourceMapParams()));
+
+}  // anonymous namespace
@@ -0,0 +1,182 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TextureChurnPerf:
+//   Performance test for draws that sample from a large and changing set of textures.  Every draw
+//   binds a random combination of textures, so it rarely finds its descriptor set in the cache,
+//   and every step replaces some of the textures with new ones, like a long-running app that
+//   streams its textures in and out.  Measures how well the descriptor sets are reused when the
+//   number of combinations is far larger than what's worth caching.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kDrawsPerStep      = 256;
+constexpr size_t kTextureUnitCount        = 4;
+constexpr size_t kTextureCount            = 1024;
+constexpr size_t kTexturesReplacedPerStep = 32;
+constexpr GLsizei kTextureSize            = 4;
+
+struct TextureChurnParams final : public RenderTestParams
+{
+    TextureChurnParams(const EGLPlatformParameters &eglParametersIn)
+    {
+        iterationsPerStep = kDrawsPerStep;
+
+        majorVersion  = 2;
+        minorVersion  = 0;
+        windowWidth   = 256;
+        windowHeight  = 256;
+        eglParameters = eglParametersIn;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const TextureChurnParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class TextureChurnBenchmark : public ANGLERenderTest,
+                              public ::testing::WithParamInterface<TextureChurnParams>
+{
+  public:
+    TextureChurnBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint createTexture();
+
+    std::mt19937 mRandom;
+    std::vector<GLuint> mTextures;
+    std::vector<GLubyte> mTextureData;
+    size_t mNextReplacedTexture = 0;
+    GLuint mProgram             = 0;
+};
+
+TextureChurnBenchmark::TextureChurnBenchmark()
+    : ANGLERenderTest("TextureChurn", GetParam()), mRandom(1)
+{}
+
+GLuint TextureChurnBenchmark::createTexture()
+{
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, mTextureData.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    return texture;
+}
+
+void TextureChurnBenchmark::initializeBenchmark()
+{
+    std::stringstream fragmentShader;
+    fragmentShader << "precision mediump float;\n";
+    for (size_t unit = 0; unit < kTextureUnitCount; ++unit)
+    {
+        fragmentShader << "uniform sampler2D tex" << unit << ";\n";
+    }
+    fragmentShader << "void main()\n"
+                      "{\n"
+                      "    gl_FragColor = vec4(0)";
+    for (size_t unit = 0; unit < kTextureUnitCount; ++unit)
+    {
+        fragmentShader << " + texture2D(tex" << unit << ", vec2(0.5))";
+    }
+    fragmentShader << ";\n"
+                      "}\n";
+
+    static const char *vertexShader =
+        "void main()\n"
+        "{\n"
+        "    gl_Position = vec4(0, 0, 0, 1);\n"
+        "    gl_PointSize = 1.0;\n"
+        "}\n";
+
+    mProgram = CompileProgram(vertexShader, fragmentShader.str().c_str());
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    for (size_t unit = 0; unit < kTextureUnitCount; ++unit)
+    {
+        std::stringstream uniformName;
+        uniformName << "tex" << unit;
+        GLint location = glGetUniformLocation(mProgram, uniformName.str().c_str());
+        ASSERT_NE(-1, location);
+        glUniform1i(location, static_cast<GLint>(unit));
+    }
+
+    mTextureData.resize(kTextureSize * kTextureSize * 4);
+    for (GLubyte &byte : mTextureData)
+    {
+        byte = static_cast<GLubyte>(mRandom());
+    }
+
+    for (size_t textureIndex = 0; textureIndex < kTextureCount; ++textureIndex)
+    {
+        mTextures.push_back(createTexture());
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void TextureChurnBenchmark::destroyBenchmark()
+{
+    glDeleteTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+    glDeleteProgram(mProgram);
+}
+
+void TextureChurnBenchmark::drawBenchmark()
+{
+    // Stream some of the textures out and new ones in.
+    for (size_t replaced = 0; replaced < kTexturesReplacedPerStep; ++replaced)
+    {
+        GLuint &texture = mTextures[mNextReplacedTexture];
+        glDeleteTextures(1, &texture);
+        texture              = createTexture();
+        mNextReplacedTexture = (mNextReplacedTexture + 1) % kTextureCount;
+    }
+
+    std::uniform_int_distribution<size_t> textureIndex(0, kTextureCount - 1);
+
+    for (unsigned int draw = 0; draw < kDrawsPerStep; ++draw)
+    {
+        for (size_t unit = 0; unit < kTextureUnitCount; ++unit)
+        {
+            glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + unit));
+            glBindTexture(GL_TEXTURE_2D, mTextures[textureIndex(mRandom)]);
+        }
+        glDrawArrays(GL_POINTS, 0, 1);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(TextureChurnBenchmark, Run)
+{
+    run();
+}
+
+using namespace egl_platform;
+
+ANGLE_INSTANTIATE_TEST(TextureChurnBenchmark,
+                       TextureChurnParams(VULKAN()),
+                       TextureChurnParams(VULKAN_NULL()));
+
+}  // anonymous namespace
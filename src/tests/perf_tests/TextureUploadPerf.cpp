@@ -21,6 +21,7 @@ using namespace angle;
 namespace
 {
 constexpr unsigned int kIterationsPerStep = 2;
+constexpr GLuint kDefaultWorkerThreads   = 0xFFFFFFFF;
 
 struct TextureUploadParams final : public RenderTestParams
 {
@@ -31,6 +32,9 @@ struct TextureUploadParams final : public RenderTestParams
 
         baseSize     = 1024;
         subImageSize = 64;
+        depth        = 1;
+
+        maxWorkerThreads = kDefaultWorkerThreads;
 
         webgl = false;
     }
@@ -39,6 +43,11 @@ struct TextureUploadParams final : public RenderTestParams
 
     GLsizei baseSize;
     GLsizei subImageSize;
+    GLsizei depth;
+
+    // Limit set with glMaxShaderCompilerThreadsKHR, which also limits the threads that convert
+    // texture data.  0 converts on the GL thread only.
+    GLuint maxWorkerThreads;
 
     bool webgl;
 };
@@ -55,6 +64,16 @@ std::string TextureUploadParams::story() const
 
     strstr << RenderTestParams::story();
 
+    if (depth > 1)
+    {
+        strstr << "_3d";
+    }
+
+    if (maxWorkerThreads == 0)
+    {
+        strstr << "_serial";
+    }
+
     if (webgl)
     {
         strstr << "_webgl";
@@ -172,6 +191,28 @@ class PBOCompressedSubImageBenchmark : public TextureUploadBenchmarkBase
     GLuint mPBO;
 };
 
+// Uploads RGB data to an RGB8 texture, which most backends store as RGBA8, so that the whole image
+// is converted by the load functions.
+class TextureUploadConversionBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadConversionBenchmark() : TextureUploadBenchmarkBase("TextureUploadConversion")
+    {
+        if (GetParam().maxWorkerThreads != kDefaultWorkerThreads)
+        {
+            addExtensionPrerequisite("GL_KHR_parallel_shader_compile");
+        }
+    }
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mTexture3D = 0;
+    std::vector<uint8_t> mRGBData;
+};
+
 TextureUploadBenchmarkBase::TextureUploadBenchmarkBase(const char *benchmarkName)
     : ANGLERenderTest(benchmarkName, GetParam())
 {
@@ -213,6 +254,72 @@ void TextureUploadBenchmarkBase::initializeBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadConversionBenchmark::initializeBenchmark()
+{
+    TextureUploadBenchmarkBase::initializeBenchmark();
+
+    const auto &params = GetParam();
+
+    // The float data of the other benchmarks isn't used.
+    mTextureData.clear();
+    mTextureData.shrink_to_fit();
+
+    if (params.maxWorkerThreads != kDefaultWorkerThreads)
+    {
+        glMaxShaderCompilerThreadsKHR(params.maxWorkerThreads);
+    }
+
+    mRGBData.resize(static_cast<size_t>(params.baseSize) * params.baseSize * params.depth * 3);
+    for (size_t i = 0; i < mRGBData.size(); ++i)
+    {
+        mRGBData[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    if (params.depth == 1)
+    {
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGB8, params.baseSize, params.baseSize);
+        ASSERT_GL_NO_ERROR();
+        return;
+    }
+
+    // Replace the program with one that samples the 3D texture, so that the draws flush it.
+    constexpr char kVS[] = R"(#version 300 es
+in vec4 a_position;
+void main()
+{
+    gl_Position = a_position;
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+uniform mediump sampler3D s_texture;
+out vec4 color;
+void main()
+{
+    color = texture(s_texture, vec3(0));
+})";
+
+    glDeleteProgram(mProgram);
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+    glUniform1i(glGetUniformLocation(mProgram, "s_texture"), 0);
+
+    glGenTextures(1, &mTexture3D);
+    glBindTexture(GL_TEXTURE_3D, mTexture3D);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexStorage3D(GL_TEXTURE_3D, 1, GL_RGB8, params.baseSize, params.baseSize, params.depth);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void TextureUploadConversionBenchmark::destroyBenchmark()
+{
+    TextureUploadBenchmarkBase::destroyBenchmark();
+    glDeleteTextures(1, &mTexture3D);
+}
+
 void TextureUploadBenchmarkBase::initShaders()
 {
     constexpr char kVS[] = R"(attribute vec4 a_position;
@@ -291,6 +398,33 @@ void TextureUploadFullMipBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadConversionBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        if (params.depth == 1)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, params.baseSize, params.baseSize, GL_RGB,
+                            GL_UNSIGNED_BYTE, mRGBData.data());
+        }
+        else
+        {
+            glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, params.baseSize, params.baseSize,
+                            params.depth, GL_RGB, GL_UNSIGNED_BYTE, mRGBData.data());
+        }
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void PBOSubImageBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -366,6 +500,19 @@ TextureUploadParams VulkanPBOParams(GLsizei baseSize, GLsizei subImageSize)
     return params;
 }
 
+TextureUploadParams VulkanConversionParams(GLsizei baseSize, GLsizei depth, GLuint maxWorkerThreads)
+{
+    TextureUploadParams params;
+    params.eglParameters    = egl_platform::VULKAN();
+    params.majorVersion     = 3;
+    params.minorVersion     = 0;
+    params.trackGpuTime     = false;
+    params.baseSize         = baseSize;
+    params.depth            = depth;
+    params.maxWorkerThreads = maxWorkerThreads;
+    return params;
+}
+
 TextureUploadParams ES3OpenGLPBOParams(GLsizei baseSize, GLsizei subImageSize)
 {
     TextureUploadParams params;
@@ -391,6 +538,11 @@ TEST_P(TextureUploadFullMipBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadConversionBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(PBOSubImageBenchmark, Run)
 {
     run();
@@ -420,6 +572,13 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        VulkanParams(false),
                        VulkanParams(true));
 
+// A 4K texture and a 3D texture, converted on the GL thread and in the worker threads.
+ANGLE_INSTANTIATE_TEST(TextureUploadConversionBenchmark,
+                       VulkanConversionParams(4096, 1, 0),
+                       VulkanConversionParams(4096, 1, kDefaultWorkerThreads),
+                       VulkanConversionParams(256, 64, 0),
+                       VulkanConversionParams(256, 64, kDefaultWorkerThreads));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PBOSubImageBenchmark);
 ANGLE_INSTANTIATE_TEST(PBOSubImageBenchmark,
                        ES3OpenGLPBOParams(1024, 128),
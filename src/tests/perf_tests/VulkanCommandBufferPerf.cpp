@@ -7,9 +7,27 @@
 //  Can run just these tests by adding "--gtest_filter=VulkanCommandBufferPerfTest*"
 //   option to angle_white_box_perftests.
 //  When running on Android with run_angle_white_box_perftests, use "-v" option.
+//  VulkanCommandQueuePerfTest measures how long it takes several threads to hand tasks over to
+//   the command processor thread of the renderer, with the asyncCommandQueue feature.
+//  VulkanSecondaryCommandBufferReplayPerfTest measures the memory used per draw by ANGLE's
+//   SecondaryCommandBuffer, and how long it takes to replay its draws in a primary cmd buffer.
 
 #include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
 #include "common/platform.h"
+#include "common/system_utils.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+#include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "test_utils/third_party/vulkan_command_buffer_utils.h"
 
 #if defined(ANDROID)
@@ -88,6 +106,62 @@ class VulkanCommandBufferPerfTest : public ANGLEPerfTest,
     int mBuffers                        = 0;
 };
 
+// Creates everything the tests need to draw the sample's cube.
+void InitSample(sample_info &info, const char *title, int numBuffers, bool depthPresent)
+{
+    init_global_layer_properties(info);
+    init_instance_extension_names(info);
+    init_device_extension_names(info);
+    init_instance(info, title);
+    init_enumerate_device(info);
+    init_window_size(info, 500, 500);
+    init_connection(info);
+    init_window(info);
+    init_swapchain_extension(info);
+    init_device(info);
+
+    init_command_pool(info, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    init_command_buffer(info);                      // Primary command buffer to hold secondaries
+    init_command_buffer_array(info, numBuffers);    // Array of primary command buffers
+    init_command_buffer2_array(info, numBuffers);   // Array containing all secondary buffers
+    init_device_queue(info);
+    init_swap_chain(info);
+    init_depth_buffer(info);
+    init_uniform_buffer(info);
+    init_descriptor_and_pipeline_layouts(info, false);
+    init_renderpass(info, depthPresent);
+    init_shaders(info, kVertShaderText, kFragShaderText);
+    init_framebuffers(info, depthPresent);
+    init_vertex_buffer(info, g_vb_solid_face_colors_Data, sizeof(g_vb_solid_face_colors_Data),
+                       sizeof(g_vb_solid_face_colors_Data[0]), false);
+    init_descriptor_pool(info, false);
+    init_descriptor_set(info);
+    init_pipeline_cache(info);
+    init_pipeline(info, depthPresent);
+}
+
+void DestroySample(sample_info &info, int numBuffers)
+{
+    destroy_pipeline(info);
+    destroy_pipeline_cache(info);
+    destroy_descriptor_pool(info);
+    destroy_vertex_buffer(info);
+    destroy_framebuffers(info);
+    destroy_shaders(info);
+    destroy_renderpass(info);
+    destroy_descriptor_and_pipeline_layouts(info);
+    destroy_uniform_buffer(info);
+    destroy_depth_buffer(info);
+    destroy_swap_chain(info);
+    destroy_command_buffer2_array(info, numBuffers);
+    destroy_command_buffer_array(info, numBuffers);
+    destroy_command_buffer(info);
+    destroy_command_pool(info);
+    destroy_device(info);
+    destroy_window(info);
+    destroy_instance(info);
+}
+
 VulkanCommandBufferPerfTest::VulkanCommandBufferPerfTest()
     : ANGLEPerfTest("VulkanCommandBufferPerfTest", "", GetParam().story, GetParam().frames)
 {
@@ -110,35 +184,7 @@ void VulkanCommandBufferPerfTest::SetUp()
         return;
     }
 
-    init_global_layer_properties(mInfo);
-    init_instance_extension_names(mInfo);
-    init_device_extension_names(mInfo);
-    init_instance(mInfo, mSampleTitle.c_str());
-    init_enumerate_device(mInfo);
-    init_window_size(mInfo, 500, 500);
-    init_connection(mInfo);
-    init_window(mInfo);
-    init_swapchain_extension(mInfo);
-    init_device(mInfo);
-
-    init_command_pool(mInfo, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
-    init_command_buffer(mInfo);                   // Primary command buffer to hold secondaries
-    init_command_buffer_array(mInfo, mBuffers);   // Array of primary command buffers
-    init_command_buffer2_array(mInfo, mBuffers);  // Array containing all secondary buffers
-    init_device_queue(mInfo);
-    init_swap_chain(mInfo);
-    init_depth_buffer(mInfo);
-    init_uniform_buffer(mInfo);
-    init_descriptor_and_pipeline_layouts(mInfo, false);
-    init_renderpass(mInfo, mDepthPresent);
-    init_shaders(mInfo, kVertShaderText, kFragShaderText);
-    init_framebuffers(mInfo, mDepthPresent);
-    init_vertex_buffer(mInfo, g_vb_solid_face_colors_Data, sizeof(g_vb_solid_face_colors_Data),
-                       sizeof(g_vb_solid_face_colors_Data[0]), false);
-    init_descriptor_pool(mInfo, false);
-    init_descriptor_set(mInfo);
-    init_pipeline_cache(mInfo);
-    init_pipeline(mInfo, mDepthPresent);
+    InitSample(mInfo, mSampleTitle.c_str(), mBuffers, mDepthPresent);
 
     mClearValues[0].color.float32[0]     = 0.2f;
     mClearValues[0].color.float32[1]     = 0.2f;
@@ -188,24 +234,7 @@ void VulkanCommandBufferPerfTest::TearDown()
 
     vkDestroySemaphore(mInfo.device, mImageAcquiredSemaphore, NULL);
     vkDestroyFence(mInfo.device, mDrawFence, NULL);
-    destroy_pipeline(mInfo);
-    destroy_pipeline_cache(mInfo);
-    destroy_descriptor_pool(mInfo);
-    destroy_vertex_buffer(mInfo);
-    destroy_framebuffers(mInfo);
-    destroy_shaders(mInfo);
-    destroy_renderpass(mInfo);
-    destroy_descriptor_and_pipeline_layouts(mInfo);
-    destroy_uniform_buffer(mInfo);
-    destroy_depth_buffer(mInfo);
-    destroy_swap_chain(mInfo);
-    destroy_command_buffer2_array(mInfo, mBuffers);
-    destroy_command_buffer_array(mInfo, mBuffers);
-    destroy_command_buffer(mInfo);
-    destroy_command_pool(mInfo);
-    destroy_device(mInfo);
-    destroy_window(mInfo);
-    destroy_instance(mInfo);
+    DestroySample(mInfo, mBuffers);
     ANGLEPerfTest::TearDown();
 }
 
@@ -648,3 +677,332 @@ INSTANTIATE_TEST_SUITE_P(,
                                            CommandBufferExplicitHardResetParams(),
                                            CommandBufferExplicitSoftResetParams(),
                                            CommandBufferImplicitResetParams()));
+
+// Every producer thread stands in for a context and hands tasks over to the real CommandProcessor
+// of the renderer.  CheckCompletedCommands tasks are used, as they need nothing to be recorded
+// and the worker thread processes them quickly, so the measurement is dominated by queueing the
+// tasks and waking the worker thread up.
+constexpr uint32_t kTasksPerProducer = 1024;
+
+struct CommandQueueTestParams final : public RenderTestParams
+{
+    CommandQueueTestParams(size_t producerCountIn)
+    {
+        iterationsPerStep = kTasksPerProducer;
+
+        eglParameters                                = angle::egl_platform::VULKAN();
+        eglParameters.asyncCommandQueueFeatureVulkan = EGL_TRUE;
+        producerCount                                = producerCountIn;
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story() << "_" << producerCount << "_producers";
+        return strstr.str();
+    }
+
+    size_t producerCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const CommandQueueTestParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class VulkanCommandQueuePerfTest : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<CommandQueueTestParams>
+{
+  public:
+    VulkanCommandQueuePerfTest();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void producerLoop();
+
+    rx::ContextVk *mContextVk = nullptr;
+    std::vector<std::thread> mProducers;
+
+    // Producers are kicked off by bumping mGeneration and report back through mRunningProducers.
+    std::mutex mMutex;
+    std::condition_variable mStartCondition;
+    std::condition_variable mDoneCondition;
+    uint64_t mGeneration     = 0;
+    size_t mRunningProducers = 0;
+    bool mExiting            = false;
+
+    // Enqueue latencies, in seconds, over all steps.  Written under mMutex.
+    double mEnqueueTime      = 0;
+    double mWorstEnqueueTime = 0;
+    uint64_t mEnqueueCount   = 0;
+};
+
+VulkanCommandQueuePerfTest::VulkanCommandQueuePerfTest()
+    : ANGLERenderTest("VulkanCommandQueuePerfTest", GetParam())
+{}
+
+void VulkanCommandQueuePerfTest::initializeBenchmark()
+{
+    const gl::Context *context =
+        static_cast<const gl::Context *>(static_cast<EGLWindow *>(getGLWindow())->getContext());
+    mContextVk = rx::GetImplAs<rx::ContextVk>(context);
+    if (!mContextVk->getFeatures().asyncCommandQueue.enabled)
+    {
+        mSkipTest = true;
+        return;
+    }
+
+    mReporter->RegisterImportantMetric(".enqueue_latency", "ns");
+    mReporter->RegisterImportantMetric(".worst_enqueue_latency", "ns");
+
+    for (size_t producer = 0; producer < GetParam().producerCount; ++producer)
+    {
+        mProducers.emplace_back(&VulkanCommandQueuePerfTest::producerLoop, this);
+    }
+}
+
+void VulkanCommandQueuePerfTest::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExiting = true;
+    }
+    mStartCondition.notify_all();
+
+    for (std::thread &producer : mProducers)
+    {
+        producer.join();
+    }
+
+    if (mEnqueueCount > 0)
+    {
+        mReporter->AddResult(".enqueue_latency", mEnqueueTime * 1e9 / mEnqueueCount);
+        mReporter->AddResult(".worst_enqueue_latency", mWorstEnqueueTime * 1e9);
+    }
+}
+
+void VulkanCommandQueuePerfTest::drawBenchmark()
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mRunningProducers = mProducers.size();
+        mGeneration++;
+        mStartCondition.notify_all();
+
+        mDoneCondition.wait(lock, [this] { return mRunningProducers == 0; });
+    }
+
+    // The step is done when the worker thread has processed every task of the step.
+    ASSERT_EQ(angle::Result::Continue, mContextVk->getRenderer()->finish(mContextVk, false));
+}
+
+void VulkanCommandQueuePerfTest::producerLoop()
+{
+    rx::RendererVk *renderer = mContextVk->getRenderer();
+
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStartCondition.wait(
+                lock, [this, generation] { return mExiting || mGeneration != generation; });
+            if (mExiting)
+            {
+                return;
+            }
+            generation = mGeneration;
+        }
+
+        double enqueueTime      = 0;
+        double worstEnqueueTime = 0;
+        for (uint32_t index = 0; index < kTasksPerProducer; ++index)
+        {
+            const double startTime = angle::GetCurrentTime();
+            // Queues a CheckCompletedCommands task with CommandProcessor::queueCommand.
+            (void)renderer->checkCompletedCommands(mContextVk);
+            const double time = angle::GetCurrentTime() - startTime;
+
+            enqueueTime += time;
+            worstEnqueueTime = std::max(worstEnqueueTime, time);
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEnqueueTime += enqueueTime;
+        mWorstEnqueueTime = std::max(mWorstEnqueueTime, worstEnqueueTime);
+        mEnqueueCount += kTasksPerProducer;
+        if (--mRunningProducers == 0)
+        {
+            mDoneCondition.notify_one();
+        }
+    }
+}
+
+TEST_P(VulkanCommandQueuePerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(VulkanCommandQueuePerfTest,
+                       CommandQueueTestParams(1),
+                       CommandQueueTestParams(4),
+                       CommandQueueTestParams(8));
+
+// Draws the way ContextVk does when its dirty bits make it bind all the state again before each
+// draw.  With |changingState|, the vertex buffer offset changes with every draw, so the binds
+// can't be skipped.
+struct SecondaryCommandBufferReplayParams
+{
+    std::string story;
+    bool changingState;
+};
+
+constexpr uint32_t kReplayDrawsPerStep       = 1000;
+constexpr size_t kReplayPoolAllocatorPageSize = 16 * 1024;
+
+class VulkanSecondaryCommandBufferReplayPerfTest
+    : public ANGLEPerfTest,
+      public ::testing::WithParamInterface<SecondaryCommandBufferReplayParams>
+{
+  public:
+    VulkanSecondaryCommandBufferReplayPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    void recordDraws();
+
+    const bool mDepthPresent = true;
+    struct sample_info mInfo = {};
+    rx::vk::Pipeline mPipeline;
+    rx::vk::PipelineLayout mPipelineLayout;
+
+    angle::PoolAllocator mAllocator;
+    rx::vk::priv::SecondaryCommandBuffer mCommandBuffer;
+
+    size_t mStepCount  = 0;
+    double mReplayTime = 0;
+    size_t mUsedMemory = 0;
+    size_t mDrawCount  = 0;
+};
+
+VulkanSecondaryCommandBufferReplayPerfTest::VulkanSecondaryCommandBufferReplayPerfTest()
+    : ANGLEPerfTest("VulkanSecondaryCommandBufferReplayPerfTest", "", GetParam().story, 1)
+{}
+
+void VulkanSecondaryCommandBufferReplayPerfTest::SetUp()
+{
+    if (mSkipTest)
+    {
+        return;
+    }
+
+    InitSample(mInfo, "Replay Secondary Command Buffer", 1, mDepthPresent);
+    mPipeline.setHandle(mInfo.pipeline);
+    mPipelineLayout.setHandle(mInfo.pipeline_layout);
+
+    mAllocator.initialize(kReplayPoolAllocatorPageSize, 1);
+    mAllocator.push();
+    mCommandBuffer.initialize(&mAllocator);
+
+    mReporter->RegisterImportantMetric(".bytes_per_draw", "bytes");
+    mReporter->RegisterImportantMetric(".replay_time_per_draw", "ns");
+}
+
+void VulkanSecondaryCommandBufferReplayPerfTest::TearDown()
+{
+    if (mSkipTest)
+    {
+        return;
+    }
+
+    if (mStepCount > 0)
+    {
+        mReporter->AddResult(".bytes_per_draw", static_cast<double>(mUsedMemory) / mDrawCount);
+        mReporter->AddResult(".replay_time_per_draw", mReplayTime * 1e9 / mDrawCount);
+    }
+
+    mCommandBuffer.releaseHandle();
+    mAllocator.popAll();
+    // The sample owns the handles.
+    mPipeline.release();
+    mPipelineLayout.release();
+    DestroySample(mInfo, 1);
+    ANGLEPerfTest::TearDown();
+}
+
+void VulkanSecondaryCommandBufferReplayPerfTest::recordDraws()
+{
+    const bool changingState      = GetParam().changingState;
+    const VkDeviceSize vertexSize = sizeof(g_vb_solid_face_colors_Data[0]);
+
+    for (uint32_t draw = 0; draw < kReplayDrawsPerStep; ++draw)
+    {
+        const VkDeviceSize offset = changingState ? (draw % 2) * vertexSize : 0;
+
+        mCommandBuffer.bindGraphicsPipeline(mPipeline);
+        mCommandBuffer.bindDescriptorSets(mPipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                          rx::DescriptorSetIndex::Internal, NUM_DESCRIPTOR_SETS,
+                                          mInfo.desc_set.data(), 0, nullptr);
+        mCommandBuffer.bindVertexBuffers(0, 1, &mInfo.vertex_buffer.buf, &offset);
+        mCommandBuffer.draw(3, draw % 3 * 3);
+    }
+}
+
+void VulkanSecondaryCommandBufferReplayPerfTest::step()
+{
+    mAllocator.pop();
+    mAllocator.push();
+    mCommandBuffer.reset();
+    recordDraws();
+
+    size_t allocatedMemory;
+    size_t usedMemory;
+    mCommandBuffer.getMemoryUsageStats(&usedMemory, &allocatedMemory);
+    mUsedMemory += usedMemory;
+    mDrawCount += mCommandBuffer.getDrawCount();
+
+    VkRenderPassBeginInfo rpBegin    = {};
+    rpBegin.sType                    = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    rpBegin.renderPass               = mInfo.render_pass;
+    rpBegin.framebuffer              = mInfo.framebuffers[0];
+    rpBegin.renderArea.extent.width  = mInfo.width;
+    rpBegin.renderArea.extent.height = mInfo.height;
+
+    VkCommandBufferBeginInfo cmdBufferInfo = {};
+    cmdBufferInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmdBufferInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    // The cmd buffer is never submitted.  Only replaying the draws into it is timed.
+    vkBeginCommandBuffer(mInfo.cmd, &cmdBufferInfo);
+    vkCmdBeginRenderPass(mInfo.cmd, &rpBegin, VK_SUBPASS_CONTENTS_INLINE);
+    init_viewports(mInfo);
+    init_scissors(mInfo);
+
+    double startTime = angle::GetCurrentTime();
+    mCommandBuffer.executeCommands(mInfo.cmd);
+    mReplayTime += angle::GetCurrentTime() - startTime;
+
+    vkCmdEndRenderPass(mInfo.cmd);
+    VkResult res = vkEndCommandBuffer(mInfo.cmd);
+    ASSERT_EQ(VK_SUCCESS, res);
+
+    mStepCount++;
+}
+
+TEST_P(VulkanSecondaryCommandBufferReplayPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VulkanSecondaryCommandBufferReplayPerfTest,
+                         ::testing::Values(
+                             SecondaryCommandBufferReplayParams{"_Redundant_State", false},
+                             SecondaryCommandBufferReplayParams{"_Changing_State", true}));
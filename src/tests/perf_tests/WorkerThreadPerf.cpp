@@ -0,0 +1,214 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkerThreadPerf:
+//   Performance test for the worker thread pool.  Every step, each producer thread posts a batch
+//   of small tasks and waits for them.  The wall time measures throughput, and the time between
+//   posting a task and a worker starting it is reported as the dispatch latency.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "libANGLE/WorkerThread.h"
+
+namespace
+{
+constexpr size_t kTasksPerProducer = 256;
+
+struct WorkerThreadParams
+{
+    size_t producerCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const WorkerThreadParams &params)
+{
+    os << params.producerCount << "_producers";
+    return os;
+}
+
+std::string GetStory(const WorkerThreadParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params;
+    return strstr.str();
+}
+
+// Does a little work so that the pool has something to run, and records its dispatch latency.
+class LatencyTask : public angle::Closure
+{
+  public:
+    LatencyTask(std::atomic<uint64_t> *totalLatencyNs) : mTotalLatencyNs(totalLatencyNs) {}
+
+    void setPostTime(double postTime) { mPostTime = postTime; }
+
+    void operator()() override
+    {
+        double latency = angle::GetCurrentTime() - mPostTime;
+        *mTotalLatencyNs += static_cast<uint64_t>(latency * 1e9);
+
+        for (uint32_t iteration = 0; iteration < 256; ++iteration)
+        {
+            mResult = mResult * 31 + iteration;
+        }
+    }
+
+  private:
+    std::atomic<uint64_t> *mTotalLatencyNs;
+    double mPostTime          = 0;
+    volatile uint32_t mResult = 0;
+};
+
+class WorkerThreadPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<WorkerThreadParams>
+{
+  public:
+    WorkerThreadPerfTest();
+    ~WorkerThreadPerfTest() override;
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    void producerLoop();
+    void postAndWaitTasks();
+
+    std::shared_ptr<angle::WorkerThreadPool> mPool;
+    std::vector<std::thread> mProducers;
+
+    // Producers are kicked off by bumping mGeneration and report back through mRunningProducers.
+    std::mutex mMutex;
+    std::condition_variable mStartCondition;
+    std::condition_variable mDoneCondition;
+    uint64_t mGeneration     = 0;
+    size_t mRunningProducers = 0;
+    bool mExiting            = false;
+
+    std::atomic<uint64_t> mTotalLatencyNs;
+    std::atomic<uint64_t> mTaskCount;
+};
+
+WorkerThreadPerfTest::WorkerThreadPerfTest()
+    : ANGLEPerfTest("WorkerThreadPerf", "", GetStory(GetParam()), 1),
+      mPool(angle::WorkerThreadPool::Create(true)),
+      mTotalLatencyNs(0),
+      mTaskCount(0)
+{}
+
+WorkerThreadPerfTest::~WorkerThreadPerfTest()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExiting = true;
+    }
+    mStartCondition.notify_all();
+
+    for (std::thread &producer : mProducers)
+    {
+        producer.join();
+    }
+}
+
+void WorkerThreadPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    for (size_t producerIndex = 0; producerIndex < GetParam().producerCount; ++producerIndex)
+    {
+        mProducers.emplace_back(&WorkerThreadPerfTest::producerLoop, this);
+    }
+
+    mReporter->RegisterImportantMetric(".dispatch_latency", "ns");
+}
+
+void WorkerThreadPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    if (mTaskCount > 0)
+    {
+        mReporter->AddResult(".dispatch_latency", static_cast<double>(mTotalLatencyNs.load()) /
+                                                      static_cast<double>(mTaskCount.load()));
+    }
+}
+
+void WorkerThreadPerfTest::step()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mRunningProducers = mProducers.size();
+    mGeneration++;
+    mStartCondition.notify_all();
+
+    mDoneCondition.wait(lock, [this] { return mRunningProducers == 0; });
+}
+
+void WorkerThreadPerfTest::producerLoop()
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStartCondition.wait(lock, [this, generation] {
+                return mExiting || mGeneration != generation;
+            });
+            if (mExiting)
+            {
+                return;
+            }
+            generation = mGeneration;
+        }
+
+        postAndWaitTasks();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (--mRunningProducers == 0)
+        {
+            mDoneCondition.notify_one();
+        }
+    }
+}
+
+void WorkerThreadPerfTest::postAndWaitTasks()
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> events;
+    events.reserve(kTasksPerProducer);
+
+    for (size_t taskIndex = 0; taskIndex < kTasksPerProducer; ++taskIndex)
+    {
+        auto task = std::make_shared<LatencyTask>(&mTotalLatencyNs);
+        task->setPostTime(angle::GetCurrentTime());
+        events.push_back(angle::WorkerThreadPool::PostWorkerTask(mPool, task));
+    }
+
+    for (std::shared_ptr<angle::WaitableEvent> &event : events)
+    {
+        event->wait();
+    }
+
+    mTaskCount += kTasksPerProducer;
+}
+
+TEST_P(WorkerThreadPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         WorkerThreadPerfTest,
+                         ::testing::Values(WorkerThreadParams{1},
+                                           WorkerThreadParams{2},
+                                           WorkerThreadParams{4},
+                                           WorkerThreadParams{8}));
+
+}  // anonymous namespace
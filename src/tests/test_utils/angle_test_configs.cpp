@@ -278,6 +278,51 @@ std::ostream &operator<<(std::ostream &stream, const PlatformParameters &pp)
         stream << "_DirectSPIRVGen";
     }
 
+    if (pp.eglParameters.asyncLinkProgram == EGL_TRUE)
+    {
+        stream << "_AsyncLink";
+    }
+
+    if (pp.eglParameters.asyncGraphicsPipelineCreation == EGL_TRUE)
+    {
+        stream << "_AsyncPipelines";
+    }
+
+    if (pp.eglParameters.warmUpGraphicsPipelines == EGL_TRUE)
+    {
+        stream << "_WarmUpPipelines";
+    }
+
+    if (pp.eglParameters.parallelCommandBufferRecording == EGL_TRUE)
+    {
+        stream << "_ParallelRecording";
+    }
+
+    if (pp.eglParameters.deferReadPixelsPacking == EGL_TRUE)
+    {
+        stream << "_DeferReadPixelsPacking";
+    }
+
+    if (pp.eglParameters.convertPixelsWithCompute == EGL_TRUE)
+    {
+        stream << "_ConvertPixelsWithCompute";
+    }
+
+    if (pp.eglParameters.suballocateSmallBuffers == EGL_TRUE)
+    {
+        stream << "_SuballocateSmallBuffers";
+    }
+
+    if (pp.eglParameters.evictTexturesOverMemoryBudget == EGL_TRUE)
+    {
+        stream << "_EvictTexturesOverMemoryBudget";
+    }
+
+    if (pp.eglParameters.transcodeETCToBC == EGL_TRUE)
+    {
+        stream << "_TranscodeETCToBC";
+    }
+
     return stream;
 }
 
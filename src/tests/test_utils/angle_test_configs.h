@@ -303,6 +303,69 @@ inline PlatformParameters WithDirectSPIRVGeneration(const PlatformParameters &pa
     directSPIRVGeneration.eglParameters.directSPIRVGeneration = EGL_TRUE;
     return directSPIRVGeneration;
 }
+
+inline PlatformParameters WithAsyncLinkProgram(const PlatformParameters &params)
+{
+    PlatformParameters asyncLinkProgram             = params;
+    asyncLinkProgram.eglParameters.asyncLinkProgram = EGL_TRUE;
+    return asyncLinkProgram;
+}
+
+inline PlatformParameters WithAsyncGraphicsPipelineCreation(const PlatformParameters &params)
+{
+    PlatformParameters asyncPipelines                          = params;
+    asyncPipelines.eglParameters.asyncGraphicsPipelineCreation = EGL_TRUE;
+    return asyncPipelines;
+}
+
+inline PlatformParameters WithWarmUpGraphicsPipelines(const PlatformParameters &params)
+{
+    PlatformParameters warmUpPipelines                    = params;
+    warmUpPipelines.eglParameters.warmUpGraphicsPipelines = EGL_TRUE;
+    return warmUpPipelines;
+}
+
+inline PlatformParameters WithParallelCommandBufferRecording(const PlatformParameters &params)
+{
+    PlatformParameters parallelRecording                           = params;
+    parallelRecording.eglParameters.parallelCommandBufferRecording = EGL_TRUE;
+    return parallelRecording;
+}
+
+inline PlatformParameters WithDeferReadPixelsPacking(const PlatformParameters &params)
+{
+    PlatformParameters deferPacking                   = params;
+    deferPacking.eglParameters.deferReadPixelsPacking = EGL_TRUE;
+    return deferPacking;
+}
+
+inline PlatformParameters WithConvertPixelsWithCompute(const PlatformParameters &params)
+{
+    PlatformParameters convertWithCompute                     = params;
+    convertWithCompute.eglParameters.convertPixelsWithCompute = EGL_TRUE;
+    return convertWithCompute;
+}
+
+inline PlatformParameters WithSuballocateSmallBuffers(const PlatformParameters &params)
+{
+    PlatformParameters suballocate                    = params;
+    suballocate.eglParameters.suballocateSmallBuffers = EGL_TRUE;
+    return suballocate;
+}
+
+inline PlatformParameters WithEvictTexturesOverMemoryBudget(const PlatformParameters &params)
+{
+    PlatformParameters evict                          = params;
+    evict.eglParameters.evictTexturesOverMemoryBudget = EGL_TRUE;
+    return evict;
+}
+
+inline PlatformParameters WithTranscodeETCToBC(const PlatformParameters &params)
+{
+    PlatformParameters transcode             = params;
+    transcode.eglParameters.transcodeETCToBC = EGL_TRUE;
+    return transcode;
+}
 }  // namespace angle
 
 #endif  // ANGLE_TEST_CONFIGS_H_
@@ -12,6 +12,8 @@
 
 #include <stddef.h>
 
+#include <vector>
+
 #include "util/gles_loader_autogen.h"
 
 // Returns program ID. The program is left in use, no uniforms.
@@ -27,6 +29,9 @@ GLuint SetupDoubleTextureProgram();
 // uScale = 0.5, uOffset = -0.5
 GLuint SetupSimpleScaleAndOffsetProgram();
 
+// Appends 2-component triangle coordinates to |floatData|, as used by Create2DTriangleBuffer.
+void Generate2DTriangleData(size_t numTris, std::vector<float> *floatData);
+
 // Returns buffer ID filled with 2-component triangle coordinates. The buffer is left as bound.
 // Generates triangles like this with 2-component coordinates:
 //    A
@@ -65,7 +65,10 @@ struct EGLPlatformParameters
                         robustness, emulatedPrerotation, asyncCommandQueueFeatureVulkan,
                         hasExplicitMemBarrierFeatureMtl, hasCheapRenderPassFeatureMtl,
                         forceBufferGPUStorageFeatureMtl, supportsVulkanViewportFlip, emulatedVAOs,
-                        directSPIRVGeneration);
+                        directSPIRVGeneration, asyncLinkProgram, asyncGraphicsPipelineCreation,
+                        warmUpGraphicsPipelines, parallelCommandBufferRecording,
+                        deferReadPixelsPacking, convertPixelsWithCompute, suballocateSmallBuffers,
+                        evictTexturesOverMemoryBudget, transcodeETCToBC);
     }
 
     EGLint renderer                               = EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE;
@@ -89,6 +92,15 @@ struct EGLPlatformParameters
     EGLint supportsVulkanViewportFlip             = EGL_DONT_CARE;
     EGLint emulatedVAOs                           = EGL_DONT_CARE;
     EGLint directSPIRVGeneration                  = EGL_DONT_CARE;
+    EGLint asyncLinkProgram                       = EGL_DONT_CARE;
+    EGLint asyncGraphicsPipelineCreation          = EGL_DONT_CARE;
+    EGLint warmUpGraphicsPipelines                = EGL_DONT_CARE;
+    EGLint parallelCommandBufferRecording         = EGL_DONT_CARE;
+    EGLint deferReadPixelsPacking                 = EGL_DONT_CARE;
+    EGLint convertPixelsWithCompute               = EGL_DONT_CARE;
+    EGLint suballocateSmallBuffers                = EGL_DONT_CARE;
+    EGLint evictTexturesOverMemoryBudget          = EGL_DONT_CARE;
+    EGLint transcodeETCToBC                       = EGL_DONT_CARE;
     angle::PlatformMethods *platformMethods       = nullptr;
 };
 
@@ -278,6 +278,51 @@ bool EGLWindow::initializeDisplay(OSWindow *osWindow,
         enabledFeatureOverrides.push_back("sync_vertex_arrays_to_default");
     }
 
+    if (params.asyncLinkProgram == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("asyncLinkProgram");
+    }
+
+    if (params.asyncGraphicsPipelineCreation == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("asyncGraphicsPipelineCreation");
+    }
+
+    if (params.warmUpGraphicsPipelines == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("warmUpGraphicsPipelines");
+    }
+
+    if (params.parallelCommandBufferRecording == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("parallelCommandBufferRecording");
+    }
+
+    if (params.deferReadPixelsPacking == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("deferReadPixelsPacking");
+    }
+
+    if (params.convertPixelsWithCompute == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("convertPixelsWithCompute");
+    }
+
+    if (params.suballocateSmallBuffers == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("suballocateSmallBuffers");
+    }
+
+    if (params.evictTexturesOverMemoryBudget == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("evictTexturesOverMemoryBudget");
+    }
+
+    if (params.transcodeETCToBC == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("transcodeETCToBC");
+    }
+
     const bool hasFeatureControlANGLE =
         strstr(extensionString, "EGL_ANGLE_feature_control") != nullptr;
 